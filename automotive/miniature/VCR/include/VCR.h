@@ -23,9 +23,9 @@
 #include <opencv/cv.h>
 #include <opencv/highgui.h>
 
-#include <memory>
+#include <vector>
 #include "opendavinci/odcore/base/module/TimeTriggeredConferenceClientModule.h"
-#include "opendavinci/odcore/wrapper/SharedMemory.h"
+#include "opendavinci/odcore/data/image/SharedImageReader.h"
 
 namespace automotive {
     namespace miniature {
@@ -79,8 +79,8 @@ namespace automotive {
 	            bool readSharedImage(odcore::data::Container &c);
 
             private:
-	            bool m_hasAttachedToSharedImageMemory;
-	            std::shared_ptr<odcore::wrapper::SharedMemory> m_sharedImageMemory;
+	            odcore::data::image::SharedImageReader m_sharedImageReader;
+	            vector<uint8_t> m_sharedImageBuffer;
 	            IplImage *m_image;
                 bool m_debug;
                 CvVideoWriter *m_writer;
@@ -21,7 +21,7 @@
 
 #include "opendavinci/odcore/base/KeyValueConfiguration.h"
 #include "opendavinci/odcore/data/Container.h"
-#include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"
+#include "opendavinci/odcore/data/image/ImageKernels.h"
 
 #include "opendavinci/GeneratedHeaders_OpenDaVINCI.h"
 
@@ -36,8 +36,8 @@ namespace automotive {
         using namespace odcore::data::image;
 
         VCR::VCR(const int32_t &argc, char **argv) : TimeTriggeredConferenceClientModule(argc, argv, "VCR"),
-	        m_hasAttachedToSharedImageMemory(false),
-            m_sharedImageMemory(),
+	        m_sharedImageReader(),
+	        m_sharedImageBuffer(),
 	        m_image(NULL),
             m_debug(false),
             m_writer(NULL) {}
@@ -74,42 +74,19 @@ namespace automotive {
 	        if (c.getDataType() == odcore::data::image::SharedImage::ID()) {
 		        SharedImage si = c.getData<SharedImage> ();
 
-		        // Check if we have already attached to the shared memory.
-		        if (!m_hasAttachedToSharedImageMemory) {
-			        m_sharedImageMemory
-					        = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(
-							        si.getName());
+		        const uint32_t numberOfChannels = 3;
+		        if (m_image == NULL) {
+			        m_image = cvCreateImage(cvSize(si.getWidth(), si.getHeight()), IPL_DEPTH_8U, numberOfChannels);
 		        }
 
-		        // Check if we could successfully attach to the shared memory.
-		        if (m_sharedImageMemory->isValid()) {
-			        //cerr << "Got image: LOG 0.2 " << si.toString() << endl;
-
-			        // Lock the memory region to gain exclusive access. REMEMBER!!! DO NOT FAIL WITHIN lock() / unlock(), otherwise, the image producing process would fail.
-			        m_sharedImageMemory->lock();
-			        {
-				        // Here, do something with the image. For example, we simply show the image.
-
-				        const uint32_t numberOfChannels = 3;
-				        // For example, simply show the image.
-				        if (m_image == NULL) {
-					        m_image = cvCreateImage(cvSize(si.getWidth(),
-							        si.getHeight()), IPL_DEPTH_8U, numberOfChannels);
-				        }
-
-				        // Copying the image data is very expensive...
-				        if (m_image != NULL) {
-					        memcpy(m_image->imageData,
-							        m_sharedImageMemory->getSharedMemory(),
-							        si.getWidth() * si.getHeight() * numberOfChannels);
-				        }
-			        }
-
-			        // Release the memory region so that the image produce (i.e. the camera for example) can provide the next raw image data.
-			        m_sharedImageMemory->unlock();
-
+		        // Copy the image into our process space; the shared memory is only locked while copying.
+		        if ( (m_image != NULL) && (static_cast<uint32_t>(m_image->width) == si.getWidth()) && (static_cast<uint32_t>(m_image->height) == si.getHeight())
+		             && (static_cast<uint32_t>(m_image->nChannels) == si.getBytesPerPixel())
+		             && m_sharedImageReader.copy(si, m_sharedImageBuffer) ) {
 			        // Mirror the image.
-			        cvFlip(m_image, 0, -1);
+			        ImageKernels::flip(&m_sharedImageBuffer[0], si.getWidth() * si.getBytesPerPixel(),
+			                           reinterpret_cast<uint8_t*>(m_image->imageData), m_image->widthStep,
+			                           si.getWidth(), si.getHeight(), si.getBytesPerPixel(), ImageKernels::BOTH);
 
 			        retVal = true;
 		        }
@@ -24,9 +24,8 @@
 #include <opencv/highgui.h>
 
 #include "opendavinci/odcore/base/KeyValueConfiguration.h"
-#include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/data/Container.h"
-#include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"
+#include "opendavinci/odcore/data/image/ImageKernels.h"
 
 #include "opendavinci/odtools/player/Player.h"
 
@@ -48,8 +47,8 @@ namespace automotive {
 
         LaneDetector::LaneDetector(const int32_t &argc, char **argv) :
             TimeTriggeredConferenceClientModule(argc, argv, "LaneDetector"),
-            m_hasAttachedToSharedImageMemory(false),
-            m_sharedImageMemory(),
+            m_sharedImageReader(),
+            m_sharedImageBuffer(),
             m_image(NULL),
             m_debug(false) {}
 
@@ -82,27 +81,18 @@ namespace automotive {
 	        if (c.getDataType() == odcore::data::image::SharedImage::ID()) {
 		        SharedImage si = c.getData<SharedImage> ();
 
-		        // Check if we have already attached to the shared memory containing the image from the virtual camera.
-		        if (!m_hasAttachedToSharedImageMemory) {
-			        m_sharedImageMemory = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(si.getName());
+		        if (m_image == NULL) {
+			        m_image = cvCreateImage(cvSize(si.getWidth(), si.getHeight()), IPL_DEPTH_8U, si.getBytesPerPixel());
 		        }
 
-		        // Check if we could successfully attach to the shared memory.
-		        if (m_sharedImageMemory->isValid()) {
-			        // Lock the memory region to gain exclusive access using a scoped lock.
-                    Lock l(m_sharedImageMemory);
-
-			        if (m_image == NULL) {
-				        m_image = cvCreateImage(cvSize(si.getWidth(), si.getHeight()), IPL_DEPTH_8U, si.getBytesPerPixel());
-			        }
-
-			        // Example: Simply copy the image into our process space.
-			        if (m_image != NULL) {
-				        memcpy(m_image->imageData, m_sharedImageMemory->getSharedMemory(), si.getWidth() * si.getHeight() * si.getBytesPerPixel());
-			        }
-
+		        // Copy the image into our process space; the shared memory is only locked while copying.
+		        if ( (m_image != NULL) && (static_cast<uint32_t>(m_image->width) == si.getWidth()) && (static_cast<uint32_t>(m_image->height) == si.getHeight())
+		             && (static_cast<uint32_t>(m_image->nChannels) == si.getBytesPerPixel())
+		             && m_sharedImageReader.copy(si, m_sharedImageBuffer) ) {
 			        // Mirror the image.
-			        cvFlip(m_image, 0, -1);
+			        ImageKernels::flip(&m_sharedImageBuffer[0], si.getWidth() * si.getBytesPerPixel(),
+			                           reinterpret_cast<uint8_t*>(m_image->imageData), m_image->widthStep,
+			                           si.getWidth(), si.getHeight(), si.getBytesPerPixel(), ImageKernels::BOTH);
 
 			        retVal = true;
 		        }
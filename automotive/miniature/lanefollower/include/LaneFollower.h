@@ -22,10 +22,10 @@
 
 #include <opencv/cv.h>
 
-#include <memory>
+#include <vector>
 #include "opendavinci/odcore/base/module/TimeTriggeredConferenceClientModule.h"
 #include "opendavinci/odcore/data/TimeStamp.h"
-#include "opendavinci/odcore/wrapper/SharedMemory.h"
+#include "opendavinci/odcore/data/image/SharedImageReader.h"
 
 #include "automotivedata/GeneratedHeaders_AutomotiveData.h"
 #include "opendavinci/GeneratedHeaders_OpenDaVINCI.h"
@@ -82,8 +82,8 @@ namespace automotive {
 	            bool readSharedImage(odcore::data::Container &c);
 
             private:
-	            bool m_hasAttachedToSharedImageMemory;
-	            std::shared_ptr<odcore::wrapper::SharedMemory> m_sharedImageMemory;
+	            odcore::data::image::SharedImageReader m_sharedImageReader;
+	            vector<uint8_t> m_sharedImageBuffer;
 	            IplImage *m_image;
                 bool m_debug;
                 CvFont m_font;
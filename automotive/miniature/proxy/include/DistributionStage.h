@@ -0,0 +1,78 @@
+/**
+ * proxy - Sample application to encapsulate HW/SW interfacing with embedded systems.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef DISTRIBUTIONSTAGE_H_
+#define DISTRIBUTIONSTAGE_H_
+
+#include "ProxyStage.h"
+
+namespace odcore { namespace io { namespace conference { class ContainerConference; } } }
+
+namespace automotive {
+    namespace miniature {
+
+        using namespace std;
+
+        /**
+         * This stage sends the captured containers to the conference.
+         */
+        class DistributionStage : public ProxyStage {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                DistributionStage(const DistributionStage &/*obj*/);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                DistributionStage& operator=(const DistributionStage &/*obj*/);
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param conference Conference to send the containers to.
+                 * @param capacity Maximum number of queued containers.
+                 * @param dropPolicy Container to drop if the queue is full.
+                 */
+                DistributionStage(odcore::io::conference::ContainerConference &conference, const uint32_t &capacity, const DROPPOLICY &dropPolicy);
+
+                virtual ~DistributionStage();
+
+            protected:
+                virtual void process(odcore::data::Container &c);
+
+            private:
+                odcore::io::conference::ContainerConference &m_conference;
+        };
+
+    }
+} // automotive::miniature
+
+#endif /*DISTRIBUTIONSTAGE_H_*/
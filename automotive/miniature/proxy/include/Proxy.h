@@ -28,6 +28,7 @@
 #include "opendavinci/odtools/recorder/Recorder.h"
 
 #include "Camera.h"
+#include "DistributionStage.h"
 
 namespace automotive {
     namespace miniature {
@@ -36,6 +37,13 @@ namespace automotive {
 
         /**
          * This class wraps the software/hardware interface board.
+         *
+         * Captured data is handed to a distribution stage, which runs in
+         * its own thread; thus, the capturing loop never waits for the
+         * network. The recorder is only used from the capturing loop: It
+         * copies shared memory into a preallocated memory segment and
+         * writes it to disk in its own thread. Per-stage statistics are
+         * sent once per second as ProxyStageStatistics.
          */
         class Proxy : public odcore::base::module::TimeTriggeredConferenceClientModule {
             private:
@@ -76,11 +84,28 @@ namespace automotive {
 
                 virtual void tearDown();
 
+                /**
+                 * This method time stamps the captured container, stores it
+                 * to the recorder, and enters it into the distribution stage.
+                 *
+                 * @param c Captured container.
+                 */
                 void distribute(odcore::data::Container c);
 
+                /**
+                 * This method sends the statistics of all stages.
+                 */
+                void sendStatistics();
+
             private:
                 unique_ptr<odtools::recorder::Recorder> m_recorder;
                 unique_ptr<Camera> m_camera;
+                bool m_dumpSharedData;
+                unique_ptr<DistributionStage> m_distributionStage;
+                ProxyStageStatistics m_captureStatistics;
+                uint64_t m_sumOfCaptureLatencies;
+                ProxyStageStatistics m_recordStatistics;
+                uint64_t m_sumOfRecordLatencies;
         };
 
     }
@@ -0,0 +1,129 @@
+/**
+ * proxy - Sample application to encapsulate HW/SW interfacing with embedded systems.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef PROXYSTAGE_H_
+#define PROXYSTAGE_H_
+
+#include <deque>
+#include <string>
+
+#include "opendavinci/odcore/base/Condition.h"
+#include "opendavinci/odcore/base/Mutex.h"
+#include "opendavinci/odcore/base/Service.h"
+#include "opendavinci/odcore/data/Container.h"
+
+#include "automotivedata/generated/automotive/miniature/ProxyStageStatistics.h"
+
+namespace automotive {
+    namespace miniature {
+
+        using namespace std;
+
+        /**
+         * This class runs one stage of the proxy's pipeline in its own
+         * thread. Containers are entered into a bounded queue and are
+         * processed in order; entering never blocks on processing. If the
+         * queue is full, a container is dropped according to the stage's
+         * drop policy.
+         *
+         * The latency of a container is measured from its received time
+         * stamp, which is set when the data was captured.
+         */
+        class ProxyStage : public odcore::base::Service {
+            public:
+                enum DROPPOLICY {
+                    DROP_OLDEST, // Replace the oldest queued container.
+                    DROP_NEWEST  // Reject the container to be entered.
+                };
+
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                ProxyStage(const ProxyStage &/*obj*/);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                ProxyStage& operator=(const ProxyStage &/*obj*/);
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param name Name of this stage for the statistics.
+                 * @param capacity Maximum number of queued containers.
+                 * @param dropPolicy Container to drop if the queue is full.
+                 */
+                ProxyStage(const string &name, const uint32_t &capacity, const DROPPOLICY &dropPolicy);
+
+                virtual ~ProxyStage();
+
+                /**
+                 * This method enters a container to be processed.
+                 *
+                 * @param c Container to process.
+                 * @return false if a container was dropped.
+                 */
+                bool enter(const odcore::data::Container &c);
+
+                /**
+                 * @return Statistics about this stage.
+                 */
+                ProxyStageStatistics getStatistics() const;
+
+            protected:
+                /**
+                 * This method is called from the stage's thread for every
+                 * entered container.
+                 *
+                 * @param c Container to process.
+                 */
+                virtual void process(odcore::data::Container &c) = 0;
+
+            private:
+                virtual void beforeStop();
+
+                virtual void run();
+
+            private:
+                uint32_t m_capacity;
+                DROPPOLICY m_dropPolicy;
+
+                odcore::base::Condition m_queueCondition;
+                deque<odcore::data::Container> m_queue;
+
+                mutable odcore::base::Mutex m_statisticsMutex;
+                ProxyStageStatistics m_statistics;
+                uint64_t m_sumOfLatencies;
+        };
+
+    }
+} // automotive::miniature
+
+#endif /*PROXYSTAGE_H_*/
@@ -0,0 +1,41 @@
+/**
+ * proxy - Sample application to encapsulate HW/SW interfacing with embedded systems.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "opendavinci/odcore/io/conference/ContainerConference.h"
+
+#include "DistributionStage.h"
+
+namespace automotive {
+    namespace miniature {
+
+        using namespace std;
+        using namespace odcore::data;
+
+        DistributionStage::DistributionStage(odcore::io::conference::ContainerConference &conference, const uint32_t &capacity, const DROPPOLICY &dropPolicy) :
+            ProxyStage("distribute", capacity, dropPolicy),
+            m_conference(conference) {}
+
+        DistributionStage::~DistributionStage() {}
+
+        void DistributionStage::process(Container &c) {
+            m_conference.send(c);
+        }
+
+    }
+} // automotive::miniature
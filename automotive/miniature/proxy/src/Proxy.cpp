@@ -25,6 +25,10 @@
 #include "opendavinci/odcore/base/KeyValueConfiguration.h"
 #include "opendavinci/odcore/data/Container.h"
 #include "opendavinci/odcore/data/TimeStamp.h"
+#include "opendavinci/odtools/recorder/SharedDataListener.h"
+#include "opendavinci/generated/odcore/data/SharedData.h"
+#include "opendavinci/generated/odcore/data/SharedPointCloud.h"
+#include "opendavinci/generated/odcore/data/image/SharedImage.h"
 
 #include "OpenCVCamera.h"
 
@@ -45,8 +49,17 @@ namespace automotive {
         Proxy::Proxy(const int32_t &argc, char **argv) :
             TimeTriggeredConferenceClientModule(argc, argv, "proxy"),
             m_recorder(),
-            m_camera()
-        {}
+            m_camera(),
+            m_dumpSharedData(false),
+            m_distributionStage(),
+            m_captureStatistics(),
+            m_sumOfCaptureLatencies(0),
+            m_recordStatistics(),
+            m_sumOfRecordLatencies(0)
+        {
+            m_captureStatistics.setName("capture");
+            m_recordStatistics.setName("record");
+        }
 
         Proxy::~Proxy() {
         }
@@ -73,10 +86,19 @@ namespace automotive {
                 // Run recorder in asynchronous mode to allow real-time recording in background.
                 const bool THREADING = true;
                 // Dump shared images and shared data?
-                const bool DUMP_SHARED_DATA = getKeyValueConfiguration().getValue<uint32_t>("proxy.recorder.dumpshareddata") == 1;
+                m_dumpSharedData = getKeyValueConfiguration().getValue<uint32_t>("proxy.recorder.dumpshareddata") == 1;
+
+                m_recorder = unique_ptr<Recorder>(new Recorder(recordingURL.str(), MEMORY_SEGMENT_SIZE, NUMBER_OF_SEGMENTS, THREADING, m_dumpSharedData));
+            }
 
-                m_recorder = unique_ptr<Recorder>(new Recorder(recordingURL.str(), MEMORY_SEGMENT_SIZE, NUMBER_OF_SEGMENTS, THREADING, DUMP_SHARED_DATA));
+            // Only the most recent containers are worth distributing; older ones are replaced.
+            uint32_t distributionCapacity = 2;
+            try {
+                distributionCapacity = kv.getValue<uint32_t>("proxy.distribution.capacity");
             }
+            catch(...) {}
+            m_distributionStage = unique_ptr<DistributionStage>(new DistributionStage(getConference(), distributionCapacity, ProxyStage::DROP_OLDEST));
+            m_distributionStage->start();
 
             // Create the camera grabber.
             const string NAME = getKeyValueConfiguration().getValue<string>("proxy.camera.name");
@@ -103,34 +125,108 @@ namespace automotive {
 
         void Proxy::tearDown() {
             // This method will be call automatically _after_ return from body().
+
+            // Stopping the stages processes the remaining queued containers.
+            if ( (m_recorder.get() != NULL) && m_dumpSharedData ) {
+                cout << "Proxy: " << m_recordStatistics.toString() << endl;
+            }
+            if (m_distributionStage.get() != NULL) {
+                m_distributionStage->stop();
+                cout << "Proxy: " << m_distributionStage->getStatistics().toString() << endl;
+            }
         }
 
         void Proxy::distribute(Container c) {
+            // Time stamp data when it was captured.
+            const TimeStamp now;
+            c.setReceivedTimeStamp(now);
+            c.setSampleTimeStamp(now);
+
             // Store data to recorder.
             if (m_recorder.get() != NULL) {
-                // Time stamp data before storing.
-                c.setReceivedTimeStamp(TimeStamp());
-                m_recorder->store(c);
+                const bool IS_SHARED_MEMORY = (c.getDataType() == odcore::data::SharedData::ID()) ||
+                                              (c.getDataType() == odcore::data::SharedPointCloud::ID()) ||
+                                              (c.getDataType() == odcore::data::image::SharedImage::ID());
+                if (m_dumpSharedData && IS_SHARED_MEMORY) {
+                    // The recorder drops the shared memory if no memory segment is free.
+                    const bool HAS_FREE_MEMORY_SEGMENT = !m_recorder->getDataStoreForSharedData().isEmpty();
+
+                    // The recorder copies the shared memory before the next capture overwrites it;
+                    // writing the copy to disk is done by the recorder's own thread.
+                    const TimeStamp beforeStore;
+                    m_recorder->store(c);
+                    const int64_t latency = (TimeStamp() - beforeStore).toMicroseconds();
+
+                    if (HAS_FREE_MEMORY_SEGMENT) {
+                        const uint32_t numberOfProcessedContainers = m_recordStatistics.getNumberOfProcessedContainers() + 1;
+                        m_sumOfRecordLatencies += static_cast<uint64_t>(latency);
+                        m_recordStatistics.setNumberOfProcessedContainers(numberOfProcessedContainers);
+                        m_recordStatistics.setAverageLatency(static_cast<uint32_t>(m_sumOfRecordLatencies / numberOfProcessedContainers));
+                        if (latency > static_cast<int64_t>(m_recordStatistics.getMaximumLatency())) {
+                            m_recordStatistics.setMaximumLatency(static_cast<uint32_t>(latency));
+                        }
+                    }
+                    else {
+                        m_recordStatistics.setNumberOfDroppedContainers(m_recordStatistics.getNumberOfDroppedContainers() + 1);
+                    }
+                }
+                else {
+                    m_recorder->store(c);
+                }
             }
 
             // Share data.
+            if (m_distributionStage.get() != NULL) {
+                m_distributionStage->enter(c);
+            }
+        }
+
+        void Proxy::sendStatistics() {
+            Container c(m_captureStatistics);
             getConference().send(c);
+
+            // Without dumping shared data, the recorder does not record any captured frames.
+            if ( (m_recorder.get() != NULL) && m_dumpSharedData ) {
+                Container c2(m_recordStatistics);
+                getConference().send(c2);
+            }
+
+            if (m_distributionStage.get() != NULL) {
+                Container c3(m_distributionStage->getStatistics());
+                getConference().send(c3);
+            }
         }
 
         // This method will do the main data processing job.
         odcore::data::dmcp::ModuleExitCodeMessage::ModuleExitCode Proxy::body() {
             uint32_t captureCounter = 0;
+            TimeStamp lastStatistics;
             while (getModuleStateAndWaitForRemainingTimeInTimeslice() == odcore::data::dmcp::ModuleStateMessage::RUNNING) {
                 // Capture frame.
                 if (m_camera.get() != NULL) {
+                    const TimeStamp beforeCapture;
                     odcore::data::image::SharedImage si = m_camera->capture();
+                    const int64_t latency = (TimeStamp() - beforeCapture).toMicroseconds();
 
                     Container c(si);
                     distribute(c);
                     captureCounter++;
+
+                    m_sumOfCaptureLatencies += static_cast<uint64_t>(latency);
+                    m_captureStatistics.setNumberOfProcessedContainers(captureCounter);
+                    m_captureStatistics.setAverageLatency(static_cast<uint32_t>(m_sumOfCaptureLatencies / captureCounter));
+                    if (latency > static_cast<int64_t>(m_captureStatistics.getMaximumLatency())) {
+                        m_captureStatistics.setMaximumLatency(static_cast<uint32_t>(latency));
+                    }
                 }
 
                 // Get sensor data from IR/US.
+
+                const TimeStamp now;
+                if ((now - lastStatistics).toMicroseconds() >= 1000 * 1000) {
+                    sendStatistics();
+                    lastStatistics = now;
+                }
             }
 
             cout << "Proxy: Captured " << captureCounter << " frames." << endl;
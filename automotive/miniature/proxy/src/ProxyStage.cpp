@@ -0,0 +1,116 @@
+/**
+ * proxy - Sample application to encapsulate HW/SW interfacing with embedded systems.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
+
+#include "ProxyStage.h"
+
+namespace automotive {
+    namespace miniature {
+
+        using namespace std;
+        using namespace odcore::base;
+        using namespace odcore::data;
+
+        ProxyStage::ProxyStage(const string &name, const uint32_t &capacity, const DROPPOLICY &dropPolicy) :
+            Service(),
+            m_capacity((capacity > 0) ? capacity : 1),
+            m_dropPolicy(dropPolicy),
+            m_queueCondition(),
+            m_queue(),
+            m_statisticsMutex(),
+            m_statistics(),
+            m_sumOfLatencies(0) {
+            m_statistics.setName(name);
+        }
+
+        ProxyStage::~ProxyStage() {}
+
+        bool ProxyStage::enter(const Container &c) {
+            bool hasDropped = false;
+            {
+                Lock l(m_queueCondition);
+                if (m_queue.size() >= m_capacity) {
+                    hasDropped = true;
+                    if (m_dropPolicy == DROP_NEWEST) {
+                        Lock l2(m_statisticsMutex);
+                        m_statistics.setNumberOfDroppedContainers(m_statistics.getNumberOfDroppedContainers() + 1);
+                        return false;
+                    }
+                    m_queue.pop_front();
+                }
+                m_queue.push_back(c);
+                m_queueCondition.wakeAll();
+            }
+
+            if (hasDropped) {
+                Lock l(m_statisticsMutex);
+                m_statistics.setNumberOfDroppedContainers(m_statistics.getNumberOfDroppedContainers() + 1);
+            }
+            return !hasDropped;
+        }
+
+        ProxyStageStatistics ProxyStage::getStatistics() const {
+            Lock l(m_statisticsMutex);
+            return m_statistics;
+        }
+
+        void ProxyStage::beforeStop() {
+            // Wake up the stage's thread to drain the queue.
+            Lock l(m_queueCondition);
+            m_queueCondition.wakeAll();
+        }
+
+        void ProxyStage::run() {
+            serviceReady();
+
+            while (true) {
+                Container c;
+                {
+                    Lock l(m_queueCondition);
+                    while (m_queue.empty() && isRunning()) {
+                        m_queueCondition.waitOnSignal();
+                    }
+                    // Queued containers are still processed after stop() was called.
+                    if (m_queue.empty()) {
+                        break;
+                    }
+                    c = m_queue.front();
+                    m_queue.pop_front();
+                }
+
+                process(c);
+
+                const int64_t latency = (TimeStamp() - c.getReceivedTimeStamp()).toMicroseconds();
+                {
+                    Lock l(m_statisticsMutex);
+                    const uint32_t numberOfProcessedContainers = m_statistics.getNumberOfProcessedContainers() + 1;
+                    m_sumOfLatencies += static_cast<uint64_t>((latency > 0) ? latency : 0);
+                    m_statistics.setNumberOfProcessedContainers(numberOfProcessedContainers);
+                    m_statistics.setAverageLatency(static_cast<uint32_t>(m_sumOfLatencies / numberOfProcessedContainers));
+                    if (latency > static_cast<int64_t>(m_statistics.getMaximumLatency())) {
+                        m_statistics.setMaximumLatency(static_cast<uint32_t>(latency));
+                    }
+                }
+            }
+        }
+
+    }
+} // automotive::miniature
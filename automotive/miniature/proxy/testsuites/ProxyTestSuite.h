@@ -20,15 +20,70 @@
 #ifndef ProxyTESTSUITE_H_
 #define ProxyTESTSUITE_H_
 
+#include <vector>
+
 #include "cxxtest/TestSuite.h"
 
+#include "opendavinci/odcore/base/Condition.h"
+#include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/base/Thread.h"
+#include "automotivedata/generated/automotive/miniature/SteeringData.h"
+
 // Include local header files.
 #include "../include/Proxy.h"
+#include "../include/ProxyStage.h"
 
 using namespace std;
+using namespace odcore::base;
 using namespace odcore::data;
 using namespace automotive::miniature;
 
+/**
+ * This stage blocks in process() until it is opened.
+ */
+class ProxyStageTestling : public ProxyStage {
+    private:
+        ProxyStageTestling(const ProxyStageTestling &/*obj*/);
+        ProxyStageTestling& operator=(const ProxyStageTestling &/*obj*/);
+
+    public:
+        ProxyStageTestling(const DROPPOLICY &dropPolicy) :
+            ProxyStage("test", 2, dropPolicy),
+            m_gate(),
+            m_isOpen(false),
+            m_processed() {}
+
+        void open() {
+            Lock l(m_gate);
+            m_isOpen = true;
+            m_gate.wakeAll();
+        }
+
+        uint32_t getNumberOfStartedContainers() {
+            Lock l(m_gate);
+            return m_processed.size();
+        }
+
+        vector<double> getProcessed() {
+            Lock l(m_gate);
+            return m_processed;
+        }
+
+    protected:
+        virtual void process(Container &c) {
+            Lock l(m_gate);
+            m_processed.push_back(c.getData<SteeringData>().getExampleData());
+            while (!m_isOpen) {
+                m_gate.waitOnSignal();
+            }
+        }
+
+    private:
+        Condition m_gate;
+        bool m_isOpen;
+        vector<double> m_processed;
+};
+
 /**
  * This class derives from SensorBoard to allow access to protected methods.
  */
@@ -84,6 +139,49 @@ class ProxyTest : public CxxTest::TestSuite {
             TS_ASSERT(dt != NULL);
         }
 
+        vector<double> runProxyStage(const ProxyStage::DROPPOLICY &dropPolicy) {
+            ProxyStageTestling stage(dropPolicy);
+            stage.start();
+
+            // The first container blocks the stage.
+            SteeringData sd;
+            sd.setExampleData(0);
+            TS_ASSERT(stage.enter(Container(sd)));
+            while (stage.getNumberOfStartedContainers() == 0) {
+                Thread::usleepFor(1000);
+            }
+
+            // Two containers are queued; the others are dropped.
+            for (uint32_t i = 1; i < 6; i++) {
+                sd.setExampleData(i);
+                TS_ASSERT(stage.enter(Container(sd)) == (i < 3));
+            }
+
+            stage.open();
+            stage.stop();
+
+            TS_ASSERT(stage.getStatistics().getNumberOfProcessedContainers() == 3);
+            TS_ASSERT(stage.getStatistics().getNumberOfDroppedContainers() == 3);
+            TS_ASSERT(stage.getStatistics().getName() == "test");
+            return stage.getProcessed();
+        }
+
+        void testProxyStageDropOldest() {
+            vector<double> processed = runProxyStage(ProxyStage::DROP_OLDEST);
+            TS_ASSERT(processed.size() == 3);
+            TS_ASSERT_DELTA(processed.at(0), 0, 1e-5);
+            TS_ASSERT_DELTA(processed.at(1), 4, 1e-5);
+            TS_ASSERT_DELTA(processed.at(2), 5, 1e-5);
+        }
+
+        void testProxyStageDropNewest() {
+            vector<double> processed = runProxyStage(ProxyStage::DROP_NEWEST);
+            TS_ASSERT(processed.size() == 3);
+            TS_ASSERT_DELTA(processed.at(0), 0, 1e-5);
+            TS_ASSERT_DELTA(processed.at(1), 1, 1e-5);
+            TS_ASSERT_DELTA(processed.at(2), 2, 1e-5);
+        }
+
         ////////////////////////////////////////////////////////////////////////////////////
         // Below this line the necessary constructor for initializing the pointer variables,
         // and the forbidden copy constructor and assignment operator are declared.
@@ -23,6 +23,7 @@ package org.opendavinci.generator
 import java.util.ArrayList
 import java.util.HashMap
 import java.util.Iterator
+import java.util.TreeMap
 import org.eclipse.emf.ecore.resource.Resource
 import org.eclipse.xtext.generator.IFileSystemAccess
 import org.eclipse.xtext.generator.IGenerator
@@ -66,14 +67,17 @@ class CANDataModelGenerator implements IGenerator {
 			includedClasses.add(e.mappingName.toString().replaceAll("\\.", "/"))
 		}
 		
+		// Collect for each CAN identifier the mappings consuming it to dispatch directly in CanMapping::mapNext.
+		val decodersByCANID = collectDecodersByCANID(resource.allContents.toIterable.filter(typeof(CANSignalMapping)), mapOfDefinedCANSignals)
+
 		fsa.generateFile("include/GeneratedHeaders_" + generatedHeadersFile + ".h", generateSuperHeaderFileContent(generatedHeadersFile, includedClasses, odvdIncludedFiles))
-		fsa.generateFile("src/GeneratedHeaders_" + generatedHeadersFile + ".cpp", generateSuperImplementationFileContent(generatedHeadersFile, includedClasses))
+		fsa.generateFile("src/GeneratedHeaders_" + generatedHeadersFile + ".cpp", generateSuperImplementationFileContent(generatedHeadersFile, includedClasses, decodersByCANID))
 		
 		var ArrayList<CANSignalTesting> tests=new ArrayList<CANSignalTesting>(resource.allContents.toIterable.filter(typeof(CANSignalTesting)).toList);
 		
 		// Next, generate the code for the actual mapping.
 		for (e : resource.allContents.toIterable.filter(typeof(CANSignalMapping))) {
-			fsa.generateFile("include/generated/" + e.mappingName.toString().replaceAll("\\.", "/") + ".h", generateHeaderFileContent(generatedHeadersFile, odvdIncludedFiles, e))
+			fsa.generateFile("include/generated/" + e.mappingName.toString().replaceAll("\\.", "/") + ".h", generateHeaderFileContent(generatedHeadersFile, odvdIncludedFiles, e, collectCANIDs(e, mapOfDefinedCANSignals).size))
 			fsa.generateFile("src/generated/" + e.mappingName.toString().replaceAll("\\.", "/") + ".cpp", 
 				generateImplementationFileContent(e, "generated", mapOfDefinedCANSignals))
 			fsa.generateFile("testsuites/" + e.mappingName.toString().replaceAll("\\.", "_") + "TestSuite.h", generateTestSuiteContent(generatedHeadersFile, odvdIncludedFiles, e, tests, mapOfDefinedCANSignals))
@@ -108,6 +112,45 @@ class CANDataModelGenerator implements IGenerator {
         return cansignalsByFQDN
 	}
 
+	/* This method collects the distinct CAN identifiers needed by a mapping in the order of their first use. */
+	def collectCANIDs(CANSignalMapping mapping, HashMap<String, CANSignalDescription> canSignals) {
+		val canIDs = new ArrayList<String>
+		for (currentMapping : mapping.mappings) {
+			val canSignal = canSignals.get(currentMapping.cansignalname)
+			if (canSignal != null && slotOf(canIDs, canSignal.m_CANID) < 0) {
+				canIDs.add(canSignal.m_CANID)
+			}
+		}
+		return canIDs
+	}
+
+	/* This method returns the index of the payload slot for a given CAN identifier or -1 if it is not needed. */
+	def int slotOf(ArrayList<String> canIDs, String canID) {
+		for (var int i = 0; i < canIDs.size; i++) {
+			if (canIDs.get(i).compareToIgnoreCase(canID) == 0) {
+				return i
+			}
+		}
+		return -1
+	}
+
+	/* This method collects for each CAN identifier the CanMapping members that need to decode it. */
+	def collectDecodersByCANID(Iterable<CANSignalMapping> iter, HashMap<String, CANSignalDescription> canSignals) {
+		val decodersByCANID = new TreeMap<Long, ArrayList<String>>
+		for (mapping : iter) {
+			val String[] chunks = mapping.mappingName.toString.split('\\.')
+			val member = "m_" + chunks.get(chunks.size - 1).toFirstLower
+			for (canID : collectCANIDs(mapping, canSignals)) {
+				val key = Long.decode(canID)
+				if (!decodersByCANID.containsKey(key)) {
+					decodersByCANID.put(key, new ArrayList<String>)
+				}
+				decodersByCANID.get(key).add(member)
+			}
+		}
+		return decodersByCANID
+	}
+
 	/* This method collects the name of the needed odvd headers. */
 	def extractOdvdHeaders(Iterable<ODVDFile> iter) {
 		val odvdHeaders =  new ArrayList<String>
@@ -185,6 +228,37 @@ namespace canmapping {
              */
             vector<odcore::data::Container> mapNext(const ::automotive::GenericCANMessage &gcm);
 
+            /**
+             * This method adds the given GenericCANMessage to only those
+             * CAN message decoders consuming its CAN identifier and appends
+             * all fully decoded Containers to the given list.
+             *
+             * @param gcm Next GenericCANMessage.
+             * @param listOfContainers List to append the decoded Containers to.
+             * @return Number of appended Containers.
+             */
+            uint32_t mapNext(const ::automotive::GenericCANMessage &gcm, vector<odcore::data::Container> &listOfContainers);
+
+            /**
+             * This method maps a batch of GenericCANMessages in their
+             * given order and appends all fully decoded Containers to
+             * the given list.
+             *
+             * @param listOfGCMs GenericCANMessages to be mapped.
+             * @param listOfContainers List to append the decoded Containers to.
+             * @return Number of appended Containers.
+             */
+            uint32_t mapNext(const vector< ::automotive::GenericCANMessage > &listOfGCMs, vector<odcore::data::Container> &listOfContainers);
+
+            /**
+             * This method returns the CAN identifiers consumed by all
+             * mappings; it can be used to filter CAN messages already
+             * on the CAN device.
+             *
+             * @return List of consumed CAN identifiers.
+             */
+            vector<uint64_t> getListOfCANIdentifiers() const;
+
         private:
         
 			«FOR include : includedClasses»
@@ -200,7 +274,7 @@ namespace canmapping {
 '''
 
     /* This method generates the super implementation file content. */
-	def generateSuperImplementationFileContent(String generatedHeadersFile, ArrayList<String> includedClasses) '''
+	def generateSuperImplementationFileContent(String generatedHeadersFile, ArrayList<String> includedClasses, TreeMap<Long, ArrayList<String>> decodersByCANID) '''
 /*
  * This software is open source. Please see COPYING and AUTHORS for further information.
  *
@@ -237,26 +311,57 @@ namespace canmapping {
 
     vector<odcore::data::Container> CanMapping::mapNext(const ::automotive::GenericCANMessage &gcm) {
         vector<odcore::data::Container> listOfContainers;
+        mapNext(gcm, listOfContainers);
+        return listOfContainers;
+    }
 
-        // Traverse all defined mappings and check whether a new high-level message could be fully decoded.
-	    «FOR member:members»
-	    {
-	    	odcore::data::Container container = «member.substring(0,member.indexOf(" ()"))».decode(gcm);
-	    	if (container.getDataType() != odcore::data::Container::UNDEFINEDDATA)
-	    	{
-	    		listOfContainers.push_back(container);
-	    	}
-	    }
+    uint32_t CanMapping::mapNext(const ::automotive::GenericCANMessage &gcm, vector<odcore::data::Container> &listOfContainers) {
+        const uint32_t numberOfContainersBefore = static_cast<uint32_t>(listOfContainers.size());
+
+        // Dispatch the CAN message only to the mappings consuming its CAN identifier;
+        // the cases are known at compile time and thus, turned into a jump table or binary search.
+        switch (gcm.getIdentifier()) {
+	    «FOR entry : decodersByCANID.entrySet»
+            case 0x«Long.toHexString(entry.key)»:
+	    	«FOR member : entry.value»
+            {
+                odcore::data::Container container = «member».decode(gcm);
+                if (container.getDataType() != odcore::data::Container::UNDEFINEDDATA) {
+                    listOfContainers.push_back(container);
+                }
+            }
+	    	«ENDFOR»
+            break;
 	    «ENDFOR»
+            default:
+            break;
+        }
 
-        return listOfContainers;
+        return static_cast<uint32_t>(listOfContainers.size()) - numberOfContainersBefore;
+    }
+
+    uint32_t CanMapping::mapNext(const vector< ::automotive::GenericCANMessage > &listOfGCMs, vector<odcore::data::Container> &listOfContainers) {
+        uint32_t numberOfContainers = 0;
+        vector< ::automotive::GenericCANMessage >::const_iterator it = listOfGCMs.begin();
+        while (it != listOfGCMs.end()) {
+            numberOfContainers += mapNext(*it++, listOfContainers);
+        }
+        return numberOfContainers;
+    }
+
+    vector<uint64_t> CanMapping::getListOfCANIdentifiers() const {
+        vector<uint64_t> listOfCANIdentifiers;
+	    «FOR entry : decodersByCANID.entrySet»
+        listOfCANIdentifiers.push_back(0x«Long.toHexString(entry.key)»);
+	    «ENDFOR»
+        return listOfCANIdentifiers;
     }
 
 } // canmapping
 '''
 
 // this method generates the header file body
-	def generateHeaderFileBody(String className, CANSignalMapping mapping) '''
+	def generateHeaderFileBody(String className, CANSignalMapping mapping, int numberOfNeededCanMessages) '''
     using namespace std;
 
     class «className» : public odcore::data::SerializableData, public odcore::base::Visitable {
@@ -377,9 +482,13 @@ namespace canmapping {
         	double m_«capitalizedName.toFirstLower»;
         	«ENDFOR»
         	
-        	std::map<uint64_t,uint64_t> m_payloads;
-        	std::vector<uint64_t> m_neededCanMessages;
-        	uint64_t m_index;
+        	// One fixed payload slot per needed CAN message in the order of their first use.
+        	enum { NUMBER_OF_PAYLOAD_SLOTS = «Math.max(1, numberOfNeededCanMessages)» };
+        	uint64_t m_payloads[NUMBER_OF_PAYLOAD_SLOTS];
+        	bool m_receivedPayloads[NUMBER_OF_PAYLOAD_SLOTS];
+        	uint32_t m_numberOfReceivedPayloads;
+        	uint32_t m_numberOfNeededCanMessages;
+        	uint32_t m_index;
         	
         	::«mapping.mappingName.replaceAll("\\.", "::")» «"m_"+mapping.mappingName.toFirstLower.replaceAll("\\.", "_")»;
         	
@@ -387,18 +496,18 @@ namespace canmapping {
     
 	'''
 
-	def generateHeaderFileNSs(String[] namespaces, int i, CANSignalMapping mapping) '''
+	def generateHeaderFileNSs(String[] namespaces, int i, CANSignalMapping mapping, int numberOfNeededCanMessages) '''
 	«IF namespaces.size>i+1»
 	namespace «namespaces.get(i)» {
-		«generateHeaderFileNSs(namespaces, i+1, mapping)»
+		«generateHeaderFileNSs(namespaces, i+1, mapping, numberOfNeededCanMessages)»
 	} // end of namespace "«namespaces.get(i)»"
 	«ELSE»
-	«generateHeaderFileBody(namespaces.get(i), mapping)»
+	«generateHeaderFileBody(namespaces.get(i), mapping, numberOfNeededCanMessages)»
 	«ENDIF»
 	'''
 
     /* This method generates the header file content. */
-	def generateHeaderFileContent(String generatedHeadersFile, ArrayList<String> odvdIncludedFiles, CANSignalMapping mapping) '''
+	def generateHeaderFileContent(String generatedHeadersFile, ArrayList<String> odvdIncludedFiles, CANSignalMapping mapping, int numberOfNeededCanMessages) '''
 /*
  * This software is open source. Please see COPYING and AUTHORS for further information.
  *
@@ -422,9 +531,9 @@ namespace canmapping {
 namespace canmapping {
 	«var String[] classNames = mapping.mappingName.toString.split('\\.')»
 	«IF classNames.size>1»
-		«generateHeaderFileNSs(classNames, 0, mapping)»
+		«generateHeaderFileNSs(classNames, 0, mapping, numberOfNeededCanMessages)»
 	«ELSE»
-		«generateHeaderFileBody(classNames.get(0), mapping)»
+		«generateHeaderFileBody(classNames.get(0), mapping, numberOfNeededCanMessages)»
 	«ENDIF»
 } // end of namespace canmapping
 
@@ -468,14 +577,12 @@ namespace canmapping {
 		m_«capitalizedName.toFirstLower»(0.0),
 		«ENDFOR»
 		m_payloads(),
-		m_neededCanMessages(),
+		m_receivedPayloads(),
+		m_numberOfReceivedPayloads(0),
+		m_numberOfNeededCanMessages(«canIDs.size»),
 		m_index(0),
 		«"m_"+mapping.mappingName.toFirstLower.replaceAll("\\.", "_")»()
-	{
-		«FOR id : canIDs»
-		m_neededCanMessages.push_back(«id»);
-        «ENDFOR»
-	}
+	{}
 	
 	«IF mapping.mappings.size>0»
 	«var ArrayList<String> parameters=new ArrayList<String>»
@@ -502,14 +609,12 @@ namespace canmapping {
 		odcore::base::Visitable(),
 		«FOR initialization:initializations»«initialization+","+'\n'»«ENDFOR»
 		m_payloads(),
-		m_neededCanMessages(),
+		m_receivedPayloads(),
+		m_numberOfReceivedPayloads(0),
+		m_numberOfNeededCanMessages(«canIDs.size»),
 		m_index(0),
 		«"m_"+mapping.mappingName.toFirstLower.replaceAll("\\.", "_")»()
-	{
-		«FOR id : canIDs»
-		m_neededCanMessages.push_back(«id»);
-        «ENDFOR»
-	}
+	{}
 	«ENDIF»
 	
 	«className»::~«className»() {}
@@ -942,21 +1047,32 @@ namespace canmapping {
 		switch(gcm.getIdentifier())
 		{
     	«FOR id : canIDs»
+    		«var int slot=slotOf(canIDs, id)»
 
     		case «id» : 
     		«IF mapping.unordered!=null && mapping.unordered.compareTo("unordered")==0»
 
-	    	// since the order doesn't matter, store the payload in a map for future use replacing the current content held there
-	    	m_payloads[gcm.getIdentifier()] = gcm.getData();
+	    	// since the order doesn't matter, store the payload in its slot for future use replacing the current content held there
+	    	if(!m_receivedPayloads[«slot»])
+	    	{
+	    		m_receivedPayloads[«slot»] = true;
+	    		++m_numberOfReceivedPayloads;
+	    	}
+	    	m_payloads[«slot»] = gcm.getData();
     		«ELSE»
 
 	    	// since the order matters:
-	    	if(m_neededCanMessages.at(m_index) == «id») // if we got the expected message
+	    	if(m_index == «slot») // if we got the expected message
 	    	{
-	    		// Store the payload in a map for future use replacing the current content
-	    		m_payloads[«id»] = gcm.getData();
+	    		// Store the payload in its slot for future use replacing the current content
+	    		if(!m_receivedPayloads[«slot»])
+	    		{
+	    			m_receivedPayloads[«slot»] = true;
+	    			++m_numberOfReceivedPayloads;
+	    		}
+	    		m_payloads[«slot»] = gcm.getData();
 	    		// modularly increase the internal index
-	    		(m_index==m_neededCanMessages.size()-1) ? m_index=0 : ++m_index;
+	    		(m_index==m_numberOfNeededCanMessages-1) ? m_index=0 : ++m_index;
 	    	}
 	    	else // otherwise reset
 	    		reset=true;
@@ -971,15 +1087,16 @@ namespace canmapping {
 
 		if(reset)
 		{		
-			// reset the payloads map
-			while(! m_payloads.empty())
-				m_payloads.erase(m_payloads.begin());
+			// reset the payload slots
+			for(uint32_t i=0;i<NUMBER_OF_PAYLOAD_SLOTS;++i)
+				m_receivedPayloads[i]=false;
+			m_numberOfReceivedPayloads=0;
 			// reset the internal index
 			m_index=0;
 		}
 		«ENDIF»
 		// if we don't have all the needed CAN messages, return 
-		if(m_payloads.size()!=m_neededCanMessages.size())
+		if(m_numberOfReceivedPayloads!=m_numberOfNeededCanMessages)
 			return c;
 
 		// Create a generic message.
@@ -992,7 +1109,7 @@ namespace canmapping {
 			// addressing signal «currentSignalInMapping.cansignalname»
 			{
 				// Get the raw payload.
-				uint64_t data = m_payloads[«CurrentCANSignal.m_CANID»];
+				uint64_t data = m_payloads[«slotOf(canIDs, CurrentCANSignal.m_CANID)»];
 
 				«IF mapping.bit_numbering==null || mapping.bit_numbering.compareTo("vector")!=0»
 					// the rolling is due to Vector's dbc file numeration convention
@@ -1265,22 +1382,10 @@ namespace canmapping {
  */
 // Source file for: «mapping.mappingName.toString»
 
-«var ArrayList<String> canIDs=new ArrayList<String>»
+«var ArrayList<String> canIDs=collectCANIDs(mapping, canSignals)»
 «FOR currentMapping : mapping.mappings»
 «var String signalName=currentMapping.cansignalname»
 «var CANSignalDescription canSignal=canSignals.get(signalName)»
-«{ // make sure we don't add 2 times the same CAN id
-	if(canSignal!=null)
-	{
-		var boolean test=true;
-		for(id:canIDs)
-			if(id.compareToIgnoreCase(canSignal.m_CANID)==0)
-				test=false;
-		if(test)
-			canIDs.add(canSignal.m_CANID);		
-	}
-	""
-}»
 «IF canSignal==null»
 «System.err.println("\n\nWarning: Signal "+signalName+" could not be found. Check your .can file. \n\n") /*first one to show up in console*/»
 «throwSignalNotFoundException(signalName)»
@@ -1320,22 +1425,10 @@ namespace canmapping {
  * This file is auto-generated. DO NOT CHANGE AS YOUR CHANGES MIGHT BE OVERWRITTEN!
  */
 // Test suite file for: «mapping.mappingName.toString»
-«var ArrayList<String> canIDs=new ArrayList<String>»
+«var ArrayList<String> canIDs=collectCANIDs(mapping, canSignals)»
 «FOR currentMapping : mapping.mappings»
 «var String signalName=currentMapping.cansignalname»
 «var CANSignalDescription canSignal=canSignals.get(signalName)»
-«{ // make sure we don't add 2 times the same CAN id
-	if(canSignal!=null)
-	{
-		var boolean test=true;
-		for(id:canIDs)
-			if(id.compareToIgnoreCase(canSignal.m_CANID)==0)
-				test=false;
-		if(test)
-			canIDs.add(canSignal.m_CANID);		
-	}
-	""
-}»
 «IF canSignal==null»
 «System.err.println("\n\nWarning: Signal "+signalName+" could not be found. Check your .can file. \n\n")»
 «throwSignalNotFoundException(signalName)»
@@ -1531,22 +1624,10 @@ class CANBridgeTest : public CxxTest::TestSuite {
 This file is auto-generated. DO NOT CHANGE AS YOUR CHANGES MIGHT BE OVERWRITTEN!
 UPPAAL file for: «mapping.mappingName.toString»
 Unordered messages*/
-«var ArrayList<String> canIDs=new ArrayList<String>»/*
+«var ArrayList<String> canIDs=collectCANIDs(mapping, canSignals)»/*
 «FOR currentMapping : mapping.mappings»
 «var String signalName=currentMapping.cansignalname»
 «var CANSignalDescription canSignal=canSignals.get(signalName)»
-«{ // make sure we don't add 2 times the same CAN id
-	if(canSignal!=null)
-	{
-		var boolean test=true;
-		for(id:canIDs)
-			if(id.compareToIgnoreCase(canSignal.m_CANID)==0)
-				test=false;
-		if(test)
-			canIDs.add(canSignal.m_CANID);		
-	}
-	""
-}»
 «IF canSignal!=null»
 CANID       : «canSignal.m_CANID»
 «ELSE»
@@ -1735,25 +1816,13 @@ system messageGenerator,Receiver,Synchronizer;
 This file is auto-generated. DO NOT CHANGE AS YOUR CHANGES MIGHT BE OVERWRITTEN!
 UPPAAL file for: «mapping.mappingName.toString»
 Ordered messages*/
-«var ArrayList<String> canIDs=new ArrayList<String>»/*
+«var ArrayList<String> canIDs=collectCANIDs(mapping, canSignals)»/*
 «FOR currentMapping : mapping.mappings»
 «var String signalName=currentMapping.cansignalname»
 «var CANSignalDescription canSignal=canSignals.get(signalName)»
 «/* DON'T NEED TO RUN THIS CHECK
 var String[] splittedMN=mapping.mappingName.toString.toLowerCase.split("\\.")»
 IF(splittedMN.get(splittedMN.size-1).compareToIgnoreCase(signalName.split("\\.").get(0).toLowerCase)==0)*/»
-«{ // make sure we don't add 2 times the same CAN id
-	if(canSignal!=null)
-	{
-		var boolean test=true;
-		for(id:canIDs)
-			if(id.compareToIgnoreCase(canSignal.m_CANID)==0)
-				test=false;
-		if(test)
-			canIDs.add(canSignal.m_CANID);		
-	}
-	""
-}»
 «IF canSignal!=null»
 CANID       : «canSignal.m_CANID»
 «ELSE»
@@ -2007,25 +2076,13 @@ system messageGenerator,Receiver,Synchronizer;
 «IF mapping.unordered!=null && mapping.unordered.compareTo("unordered")==0»
 «generateUPPAALUnordered(mapping,canSignals)»
 «ELSE»
-	«var ArrayList<String> canIDs=new ArrayList<String>»
+	«var ArrayList<String> canIDs=collectCANIDs(mapping, canSignals)»
 	«FOR currentMapping : mapping.mappings»
 	«var String signalName=currentMapping.cansignalname»
 	«var CANSignalDescription canSignal=canSignals.get(signalName)»
 	«/* DON'T NEED TO RUN THIS CHECK
 	var String[] splittedMN=mapping.mappingName.toString.toLowerCase.split("\\.")»
 	IF(splittedMN.get(splittedMN.size-1).compareTo(signalName.split("\\.").get(0).toLowerCase)==0)*/»
-	«{ // make sure we don't add 2 times the same CAN id
-		if(canSignal!=null)
-		{
-			var boolean test=true;
-			for(id:canIDs)
-				if(id.compareTo(canSignal.m_CANID)==0)
-					test=false;
-			if(test)
-				canIDs.add(canSignal.m_CANID);		
-		}
-		""
-	}»
 	«IF canSignal==null»
 	// Warning: Signal "+«signalName»+" could not be found. Check your .can file.
 	«System.err.println("\n\nWarning: Signal "+signalName+" could not be found. Check your .can file. \n\n")»
@@ -20,10 +20,9 @@
 #ifndef CANDEVICE_H_
 #define CANDEVICE_H_
 
-#include <memory>
-#include <string>
+#include <stdint.h>
 
-#include <libpcan.h>
+#include <vector>
 
 #include <opendavinci/odcore/base/Service.h>
 
@@ -32,14 +31,14 @@ namespace automotive { class GenericCANMessage; }
 namespace automotive {
     namespace odcantools {
 
-class GenericCANMessageListener;
-
         using namespace std;
 
         /**
-         * This class encapsulates the service for reading low-level CAN message to be
-         * wrapped into a GenericCANMessage and for writing a GenericCANDevice to the
-         * device node represented by this class.
+         * This class is the interface for all services reading low-level CAN
+         * messages to be wrapped into a GenericCANMessage and for writing
+         * a GenericCANMessage to the device node represented by this class.
+         *
+         * Use CANDeviceFactory to create a concrete CAN device.
          */
         class CANDevice : public odcore::base::Service {
            private:
@@ -62,15 +61,10 @@ class GenericCANMessageListener;
                  */
                 CANDevice& operator=(const CANDevice &/*obj*/);
 
-            public:
-                /**
-                 * Constructor.
-                 *
-                 * @param deviceNode CAN device node.
-                 * @param listener Listener that will receive wrapped GenericCANMessages.
-                 */
-                CANDevice(const string &deviceNode, GenericCANMessageListener &listener);
+            protected:
+                CANDevice();
 
+            public:
                 virtual ~CANDevice();
 
                 /**
@@ -78,23 +72,24 @@ class GenericCANMessageListener;
                  *
                  * @return true if the device could be successfully openend.
                  */
-                bool isOpen() const;
+                virtual bool isOpen() const = 0;
 
                 /**
                  * This methods writes a GenericCANMessage to the device.
                  *
                  * @param gcm GenericCANMessage to be written.
                  */
-                void write(const GenericCANMessage &gcm);
+                virtual void write(const GenericCANMessage &gcm) = 0;
 
-                virtual void beforeStop();
-
-                virtual void run();
-
-            private:
-                string m_deviceNode;
-                HANDLE m_handle;
-                GenericCANMessageListener &m_listener;
+                /**
+                 * This method restricts the CAN messages to be received to
+                 * the given CAN identifiers; an empty list receives all
+                 * CAN messages. It needs to be called before start().
+                 *
+                 * @param listOfCANIdentifiers CAN identifiers to be received.
+                 * @return true if the device applied the filter.
+                 */
+                virtual bool setCANIdentifierFilter(const vector<uint64_t> &listOfCANIdentifiers);
         };
 
     } // odcantools
@@ -0,0 +1,79 @@
+/**
+ * libodcantools - Library to wrap a CAN interface.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CANDEVICEFACTORY_H_
+#define CANDEVICEFACTORY_H_
+
+#include <memory>
+#include <string>
+
+namespace automotive {
+    namespace odcantools {
+
+class CANDevice;
+class GenericCANMessageListener;
+
+        using namespace std;
+
+        /**
+         * This class creates the CAN device matching a given device node:
+         * Device nodes in /dev (e.g. /dev/pcan0) are opened with the PEAK
+         * driver; all other names (e.g. can0 or vcan0) are treated as Linux
+         * SocketCAN network interfaces.
+         */
+        class CANDeviceFactory {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                CANDeviceFactory(const CANDeviceFactory &/*obj*/);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                CANDeviceFactory& operator=(const CANDeviceFactory &/*obj*/);
+
+                CANDeviceFactory();
+
+            public:
+                virtual ~CANDeviceFactory();
+
+                /**
+                 * This method creates a CAN device for the given device node.
+                 *
+                 * @param deviceNode CAN device node or CAN network interface.
+                 * @param listener Listener that will receive wrapped GenericCANMessages.
+                 * @return CAN device; use isOpen() to check whether it could be opened.
+                 */
+                static shared_ptr<CANDevice> createCANDevice(const string &deviceNode, GenericCANMessageListener &listener);
+        };
+
+    } // odcantools
+} // automotive
+
+#endif /*CANDEVICEFACTORY_H_*/
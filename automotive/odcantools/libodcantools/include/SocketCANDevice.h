@@ -0,0 +1,114 @@
+/**
+ * libodcantools - Library to wrap a CAN interface.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef SOCKETCANDEVICE_H_
+#define SOCKETCANDEVICE_H_
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "CANDevice.h"
+
+namespace automotive { class GenericCANMessage; }
+
+namespace automotive {
+    namespace odcantools {
+
+class GenericCANMessageListener;
+
+        using namespace std;
+
+        /**
+         * This class encapsulates the service for reading low-level CAN messages
+         * from a Linux SocketCAN network interface (e.g. can0 or vcan0) to be
+         * wrapped into GenericCANMessages and for writing GenericCANMessages to it.
+         *
+         * CAN messages are received in batches using recvmmsg and time stamped
+         * by the network adapter if supported or by the kernel otherwise. CAN FD
+         * frames are received as long as their payload fits into a GenericCANMessage.
+         */
+        class SocketCANDevice : public CANDevice {
+           private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                SocketCANDevice(const SocketCANDevice &/*obj*/);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                SocketCANDevice& operator=(const SocketCANDevice &/*obj*/);
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param deviceNode Name of the CAN network interface.
+                 * @param listener Listener that will receive wrapped GenericCANMessages.
+                 */
+                SocketCANDevice(const string &deviceNode, GenericCANMessageListener &listener);
+
+                virtual ~SocketCANDevice();
+
+                virtual bool isOpen() const;
+
+                virtual void write(const GenericCANMessage &gcm);
+
+                virtual bool setCANIdentifierFilter(const vector<uint64_t> &listOfCANIdentifiers);
+
+                /**
+                 * This method returns the number of received CAN FD frames
+                 * that were skipped as their payload exceeds 8 bytes.
+                 *
+                 * @return Number of skipped CAN FD frames.
+                 */
+                uint64_t getNumberOfSkippedFrames() const;
+
+                virtual void beforeStop();
+
+                virtual void run();
+
+            private:
+                /**
+                 * This method closes the socket.
+                 */
+                void close();
+
+            private:
+                string m_deviceNode;
+                int32_t m_socket;
+                GenericCANMessageListener &m_listener;
+                uint64_t m_numberOfSkippedFrames;
+        };
+
+    } // odcantools
+} // automotive
+
+#endif /*SOCKETCANDEVICE_H_*/
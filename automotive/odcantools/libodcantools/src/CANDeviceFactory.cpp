@@ -0,0 +1,48 @@
+/**
+ * libodcantools - Library to wrap a CAN interface.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "CANDevice.h"
+#include "CANDeviceFactory.h"
+#include "PCANDevice.h"
+#include "SocketCANDevice.h"
+
+namespace automotive {
+    namespace odcantools {
+
+        CANDeviceFactory::CANDeviceFactory() {}
+
+        CANDeviceFactory::~CANDeviceFactory() {}
+
+        shared_ptr<CANDevice> CANDeviceFactory::createCANDevice(const string &deviceNode, GenericCANMessageListener &listener) {
+            shared_ptr<CANDevice> device;
+
+            const string DEVICE_DIRECTORY = "/dev/";
+            if (deviceNode.compare(0, DEVICE_DIRECTORY.size(), DEVICE_DIRECTORY) == 0) {
+                device = shared_ptr<CANDevice>(new PCANDevice(deviceNode, listener));
+            }
+            else {
+                device = shared_ptr<CANDevice>(new SocketCANDevice(deviceNode, listener));
+            }
+
+            return device;
+        }
+
+    } // odcantools
+} // automotive
+
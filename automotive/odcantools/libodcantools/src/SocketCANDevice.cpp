@@ -0,0 +1,280 @@
+/**
+ * libodcantools - Library to wrap a CAN interface.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifdef HAVE_LINUX_SOCKETCAN
+    #include <linux/can.h>
+    #include <linux/can/raw.h>
+    #include <linux/net_tstamp.h>
+    #include <net/if.h>
+    #include <poll.h>
+    #include <sys/ioctl.h>
+    #include <sys/socket.h>
+    #include <sys/uio.h>
+    #include <unistd.h>
+#endif
+
+#include <cstring>
+#include <iostream>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/module/AbstractCIDModule.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
+
+#include "automotivedata/generated/automotive/GenericCANMessage.h"
+
+#include "GenericCANMessageListener.h"
+#include "SocketCANDevice.h"
+
+namespace automotive {
+    namespace odcantools {
+
+        using namespace std;
+        using namespace odcore::base::module;
+        using namespace odcore::data;
+
+        SocketCANDevice::SocketCANDevice(const string &deviceNode, GenericCANMessageListener &listener) :
+            CANDevice(),
+            m_deviceNode(deviceNode),
+            m_socket(-1),
+            m_listener(listener),
+            m_numberOfSkippedFrames(0) {
+            CLOG << "[SocketCANDevice] Opening " << m_deviceNode << "... ";
+#ifdef HAVE_LINUX_SOCKETCAN
+            m_socket = ::socket(PF_CAN, SOCK_RAW, CAN_RAW);
+
+            struct ifreq ifr;
+            ::memset(&ifr, 0, sizeof(ifr));
+            ::strncpy(ifr.ifr_name, m_deviceNode.c_str(), IFNAMSIZ - 1);
+            if ( (m_socket < 0) || (::ioctl(m_socket, SIOCGIFINDEX, &ifr) < 0) ) {
+                close();
+            }
+
+            if (m_socket > -1) {
+                // Receive CAN FD frames in addition to classic CAN frames; this fails silently on adapters without CAN FD support.
+                const int32_t ENABLE_CANFD = 1;
+                ::setsockopt(m_socket, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &ENABLE_CANFD, sizeof(ENABLE_CANFD));
+
+                // Prefer time stamps from the network adapter and fall back to the kernel's receive time stamps.
+                const int32_t TIMESTAMPING = SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE |
+                                             SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+                if (::setsockopt(m_socket, SOL_SOCKET, SO_TIMESTAMPING, &TIMESTAMPING, sizeof(TIMESTAMPING)) < 0) {
+                    const int32_t ENABLE_TIMESTAMPNS = 1;
+                    ::setsockopt(m_socket, SOL_SOCKET, SO_TIMESTAMPNS, &ENABLE_TIMESTAMPNS, sizeof(ENABLE_TIMESTAMPNS));
+                }
+
+                struct sockaddr_can address;
+                ::memset(&address, 0, sizeof(address));
+                address.can_family = AF_CAN;
+                address.can_ifindex = ifr.ifr_ifindex;
+                if (::bind(m_socket, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) < 0) {
+                    close();
+                }
+            }
+#endif
+            if (m_socket < 0) {
+                CLOG << "failed." << endl;
+            }
+            else {
+                CLOG << "done." << endl;
+            }
+        }
+
+        SocketCANDevice::~SocketCANDevice() {
+            CLOG << "[SocketCANDevice] Closing " << m_deviceNode << "... ";
+            close();
+            CLOG << "done." << endl;
+        }
+
+        void SocketCANDevice::close() {
+#ifdef HAVE_LINUX_SOCKETCAN
+            if (m_socket > -1) {
+                ::close(m_socket);
+            }
+#endif
+            m_socket = -1;
+        }
+
+        bool SocketCANDevice::isOpen() const {
+            return (m_socket > -1);
+        }
+
+        uint64_t SocketCANDevice::getNumberOfSkippedFrames() const {
+            return m_numberOfSkippedFrames;
+        }
+
+        bool SocketCANDevice::setCANIdentifierFilter(const vector<uint64_t> &listOfCANIdentifiers) {
+            bool retVal = false;
+#ifdef HAVE_LINUX_SOCKETCAN
+            if (m_socket > -1) {
+                if (listOfCANIdentifiers.empty()) {
+                    // Restore the default filter to receive all CAN messages.
+                    struct can_filter filter;
+                    filter.can_id = 0;
+                    filter.can_mask = 0;
+                    retVal = (::setsockopt(m_socket, SOL_CAN_RAW, CAN_RAW_FILTER, &filter, sizeof(filter)) == 0);
+                }
+                else {
+                    vector<struct can_filter> filters(listOfCANIdentifiers.size());
+                    for (uint32_t i = 0; i < listOfCANIdentifiers.size(); i++) {
+                        // Match standard and extended frames exactly on their identifier.
+                        if (listOfCANIdentifiers[i] > CAN_SFF_MASK) {
+                            filters[i].can_id = (static_cast<canid_t>(listOfCANIdentifiers[i]) & CAN_EFF_MASK) | CAN_EFF_FLAG;
+                            filters[i].can_mask = CAN_EFF_MASK | CAN_EFF_FLAG | CAN_RTR_FLAG;
+                        }
+                        else {
+                            filters[i].can_id = static_cast<canid_t>(listOfCANIdentifiers[i]);
+                            filters[i].can_mask = CAN_SFF_MASK | CAN_EFF_FLAG | CAN_RTR_FLAG;
+                        }
+                    }
+                    retVal = (::setsockopt(m_socket, SOL_CAN_RAW, CAN_RAW_FILTER, &filters[0], filters.size() * sizeof(struct can_filter)) == 0);
+                }
+                CLOG1 << "[SocketCANDevice] Filtering " << listOfCANIdentifiers.size() << " CAN identifiers: " << (retVal ? "done." : "failed.") << endl;
+            }
+#else
+            (void)listOfCANIdentifiers;
+#endif
+            return retVal;
+        }
+
+        void SocketCANDevice::write(const GenericCANMessage &gcm) {
+#ifdef HAVE_LINUX_SOCKETCAN
+            if (m_socket > -1) {
+                struct can_frame frame;
+                ::memset(&frame, 0, sizeof(frame));
+
+                const uint8_t LENGTH = (gcm.getLength() > CAN_MAX_DLEN) ? CAN_MAX_DLEN : gcm.getLength();
+                frame.can_id = static_cast<canid_t>(gcm.getIdentifier());
+                if (gcm.getIdentifier() > CAN_SFF_MASK) {
+                    frame.can_id = (frame.can_id & CAN_EFF_MASK) | CAN_EFF_FLAG;
+                }
+                frame.can_dlc = LENGTH;
+                uint64_t data = gcm.getData();
+                for (uint8_t i = 0; i < LENGTH; i++) {
+                    frame.data[LENGTH-1-i] = (data & 0xFF);
+                    data = data >> 8;
+                }
+                const ssize_t written = ::write(m_socket, &frame, sizeof(frame));
+
+                CLOG1 << "[SocketCANDevice] Writing ID = " << gcm.getIdentifier() << ", LEN = " << static_cast<uint32_t>(LENGTH) << ", written = " << written << endl;
+            }
+#else
+            (void)gcm;
+#endif
+        }
+
+        void SocketCANDevice::beforeStop() {}
+
+        void SocketCANDevice::run() {
+            serviceReady();
+
+#ifdef HAVE_LINUX_SOCKETCAN
+            // Buffers for receiving a batch of CAN frames including their time stamps at once.
+            const uint32_t BATCH_SIZE = 32;
+            const uint32_t CONTROL_SIZE = CMSG_SPACE(3 * sizeof(struct timespec));
+            struct canfd_frame frames[BATCH_SIZE];
+            struct iovec iovecs[BATCH_SIZE];
+            struct mmsghdr messages[BATCH_SIZE];
+            char controls[BATCH_SIZE][CONTROL_SIZE];
+
+            ::memset(messages, 0, sizeof(messages));
+            for (uint32_t i = 0; i < BATCH_SIZE; i++) {
+                iovecs[i].iov_base = &frames[i];
+                iovecs[i].iov_len = sizeof(frames[i]);
+                messages[i].msg_hdr.msg_iov = &iovecs[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+                messages[i].msg_hdr.msg_control = controls[i];
+            }
+
+            while ( (m_socket > -1) &&
+                    isRunning() ) {
+                // Wait for new CAN frames but wake up regularly to check whether this service shall stop.
+                struct pollfd descriptor;
+                descriptor.fd = m_socket;
+                descriptor.events = POLLIN;
+                descriptor.revents = 0;
+                const int32_t TIMEOUT_IN_MILLISECONDS = 100;
+                if (::poll(&descriptor, 1, TIMEOUT_IN_MILLISECONDS) < 1) {
+                    continue;
+                }
+
+                for (uint32_t i = 0; i < BATCH_SIZE; i++) {
+                    messages[i].msg_hdr.msg_controllen = CONTROL_SIZE;
+                    messages[i].msg_hdr.msg_flags = 0;
+                }
+
+                const int32_t RECEIVED = ::recvmmsg(m_socket, messages, BATCH_SIZE, MSG_DONTWAIT, NULL);
+                for (int32_t i = 0; i < RECEIVED; i++) {
+                    const struct canfd_frame &frame = frames[i];
+
+                    // Skip error frames and frames of unknown size.
+                    if ( ((messages[i].msg_len != CAN_MTU) && (messages[i].msg_len != CANFD_MTU)) ||
+                         ((frame.can_id & CAN_ERR_FLAG) != 0) ) {
+                        continue;
+                    }
+
+                    // GenericCANMessage carries at most 8 bytes.
+                    if (frame.len > CAN_MAX_DLEN) {
+                        m_numberOfSkippedFrames++;
+                        continue;
+                    }
+
+                    // Set time stamp from hardware or kernel.
+                    TimeStamp driverTimeStamp;
+                    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&messages[i].msg_hdr); cmsg != NULL; cmsg = CMSG_NXTHDR(&messages[i].msg_hdr, cmsg)) {
+                        if (cmsg->cmsg_level != SOL_SOCKET) {
+                            continue;
+                        }
+                        if (cmsg->cmsg_type == SO_TIMESTAMPING) {
+                            struct timespec timeStamps[3];
+                            ::memcpy(timeStamps, CMSG_DATA(cmsg), sizeof(timeStamps));
+                            // Index 2 holds the raw hardware time stamp, index 0 the software time stamp.
+                            const struct timespec &ts = ((timeStamps[2].tv_sec != 0) || (timeStamps[2].tv_nsec != 0)) ? timeStamps[2] : timeStamps[0];
+                            driverTimeStamp = TimeStamp(ts.tv_sec, ts.tv_nsec / 1000);
+                        }
+                        else if (cmsg->cmsg_type == SO_TIMESTAMPNS) {
+                            struct timespec ts;
+                            ::memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+                            driverTimeStamp = TimeStamp(ts.tv_sec, ts.tv_nsec / 1000);
+                        }
+                    }
+
+                    // Create generic CAN message representation.
+                    const uint64_t IDENTIFIER = ((frame.can_id & CAN_EFF_FLAG) != 0) ? (frame.can_id & CAN_EFF_MASK) : (frame.can_id & CAN_SFF_MASK);
+                    GenericCANMessage gcm;
+                    gcm.setDriverTimeStamp(driverTimeStamp);
+                    gcm.setIdentifier(IDENTIFIER);
+                    gcm.setLength(frame.len);
+                    uint64_t data = 0;
+                    for (uint8_t j = 0; j < frame.len; j++) {
+                        data |= (static_cast<uint64_t>(frame.data[j]) << ((frame.len-1-j)*8));
+                    }
+                    gcm.setData(data);
+
+                    CLOG1 << "[SocketCANDevice] ID = " << IDENTIFIER << ", LEN = " << static_cast<uint32_t>(frame.len) << endl;
+
+                    // Propagate GenericCANMessage.
+                    m_listener.nextGenericCANMessage(gcm);
+                }
+            }
+#endif
+        }
+
+    } // odcantools
+} // automotive
+
@@ -20,12 +20,59 @@
 #ifndef CANTOOLSTESTSUITE_H_
 #define CANTOOLSTESTSUITE_H_
 
+#include <iostream>
+#include <memory>
+#include <vector>
+
 #include "cxxtest/TestSuite.h"
 
+#include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/base/Mutex.h"
+#include "opendavinci/odcore/base/Thread.h"
+#include "automotivedata/generated/automotive/GenericCANMessage.h"
+
 // Include local header files.
-//#include "../include/....h"
+#include "../include/CANDevice.h"
+#include "../include/CANDeviceFactory.h"
+#include "../include/GenericCANMessageListener.h"
+#include "../include/SocketCANDevice.h"
 
 using namespace std;
+using namespace odcore::base;
+using namespace automotive;
+using namespace automotive::odcantools;
+
+/**
+ * Listener collecting all received GenericCANMessages.
+ */
+class CANToolsTestListener : public GenericCANMessageListener {
+    public:
+        CANToolsTestListener() :
+            m_mutex(),
+            m_listOfGCMs() {}
+
+        virtual void nextGenericCANMessage(const GenericCANMessage &gcm) {
+            Lock l(m_mutex);
+            m_listOfGCMs.push_back(gcm);
+        }
+
+        vector<GenericCANMessage> getListOfGCMs() {
+            Lock l(m_mutex);
+            return m_listOfGCMs;
+        }
+
+        vector<GenericCANMessage> waitFor(const uint32_t &numberOfGCMs) {
+            // Wait at most 2s.
+            for (uint32_t i = 0; (i < 200) && (getListOfGCMs().size() < numberOfGCMs); i++) {
+                Thread::usleepFor(10 * 1000);
+            }
+            return getListOfGCMs();
+        }
+
+    private:
+        Mutex m_mutex;
+        vector<GenericCANMessage> m_listOfGCMs;
+};
 
 /**
  * The actual testsuite starts here.
@@ -35,7 +82,91 @@ class CANToolsTest : public CxxTest::TestSuite {
         void testCase1() {
             TS_ASSERT(1 != 2);
         }
+
+        void testCANDeviceFactoryCreatesSocketCANDeviceForNetworkInterfaces() {
+            CANToolsTestListener listener;
+            shared_ptr<CANDevice> device = CANDeviceFactory::createCANDevice("odcantools_does_not_exist", listener);
+            TS_ASSERT(device.get() != NULL);
+            TS_ASSERT(dynamic_cast<SocketCANDevice*>(device.get()) != NULL);
+            TS_ASSERT(!device->isOpen());
+        }
+
+        // The following tests require a virtual CAN interface:
+        //   modprobe vcan && ip link add dev vcan0 type vcan && ip link set up vcan0
+        void testSocketCANDeviceWriteAndReceiveOnVCAN() {
+            CANToolsTestListener receiverListener;
+            CANToolsTestListener senderListener;
+            SocketCANDevice receiver("vcan0", receiverListener);
+            SocketCANDevice sender("vcan0", senderListener);
+            if (!receiver.isOpen() || !sender.isOpen()) {
+                cout << "Skipping " << __FUNCTION__ << ": vcan0 not available." << endl;
+                return;
+            }
+
+            receiver.start();
+
+            GenericCANMessage gcm;
+            gcm.setIdentifier(0x123);
+            gcm.setLength(4);
+            gcm.setData(0x01020304);
+            sender.write(gcm);
+
+            // Extended CAN identifier.
+            GenericCANMessage gcm2;
+            gcm2.setIdentifier(0x18FEF100);
+            gcm2.setLength(8);
+            gcm2.setData(0x0102030405060708);
+            sender.write(gcm2);
+
+            vector<GenericCANMessage> received = receiverListener.waitFor(2);
+            receiver.stop();
+
+            TS_ASSERT(received.size() == 2);
+            if (received.size() == 2) {
+                TS_ASSERT(received[0].getIdentifier() == 0x123);
+                TS_ASSERT(received[0].getLength() == 4);
+                TS_ASSERT(received[0].getData() == 0x01020304);
+                TS_ASSERT(received[0].getDriverTimeStamp().toMicroseconds() > 0);
+                TS_ASSERT(received[1].getIdentifier() == 0x18FEF100);
+                TS_ASSERT(received[1].getLength() == 8);
+                TS_ASSERT(received[1].getData() == 0x0102030405060708);
+            }
+        }
+
+        void testSocketCANDeviceFiltersCANIdentifiersOnVCAN() {
+            CANToolsTestListener receiverListener;
+            CANToolsTestListener senderListener;
+            SocketCANDevice receiver("vcan0", receiverListener);
+            SocketCANDevice sender("vcan0", senderListener);
+            if (!receiver.isOpen() || !sender.isOpen()) {
+                cout << "Skipping " << __FUNCTION__ << ": vcan0 not available." << endl;
+                return;
+            }
+
+            vector<uint64_t> listOfCANIdentifiers;
+            listOfCANIdentifiers.push_back(0x7FF);
+            TS_ASSERT(receiver.setCANIdentifierFilter(listOfCANIdentifiers));
+
+            receiver.start();
+
+            for (uint32_t i = 0; i < 10; i++) {
+                GenericCANMessage gcm;
+                gcm.setIdentifier(((i % 2) == 0) ? 0x7FF : 0x001);
+                gcm.setLength(1);
+                gcm.setData(i);
+                sender.write(gcm);
+            }
+
+            // Wait for more messages than expected to detect unfiltered ones.
+            vector<GenericCANMessage> received = receiverListener.waitFor(10);
+            receiver.stop();
+
+            TS_ASSERT(received.size() == 5);
+            for (uint32_t i = 0; i < received.size(); i++) {
+                TS_ASSERT(received[i].getIdentifier() == 0x7FF);
+                TS_ASSERT(received[i].getData() == 2*i);
+            }
+        }
 };
 
 #endif /*CANTOOLSTESTSUITE_H_*/
-
@@ -0,0 +1,143 @@
+/**
+ * odcanascreplay - Tool to replay from an ASC file.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef ASCREADER_H_
+#define ASCREADER_H_
+
+#include <stdint.h>
+
+#include <string>
+
+namespace automotive { class GenericCANMessage; }
+
+namespace automotive {
+    namespace odcantools {
+
+        using namespace std;
+
+        /**
+         * This class provides sequential access to the CAN frames stored
+         * in an ASC file. The file is memory-mapped whenever possible
+         * (i.e. for regular files including redirected stdin) and parsed
+         * in-place by a hand-written scanner; streams that cannot be mapped
+         * (e.g. pipes) are read into memory once.
+         *
+         * Structure of an ASC entry:
+         * 'Timestamp Channel  ID             Rx   d Length 00 11 22 33 44 55 66 77'
+         */
+        class ASCReader {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                ASCReader(const ASCReader &/*obj*/);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                ASCReader& operator=(const ASCReader &/*obj*/);
+
+            public:
+                /**
+                 * Constructor to read from an already opened file descriptor.
+                 * The file descriptor is not closed by this class.
+                 *
+                 * @param fileDescriptor File descriptor to read from.
+                 */
+                ASCReader(const int32_t &fileDescriptor);
+
+                /**
+                 * Constructor to read from a named file.
+                 *
+                 * @param fileName ASC file to read from.
+                 */
+                ASCReader(const string &fileName);
+
+                /**
+                 * Constructor to read from an existing memory region. The
+                 * memory region must outlive this instance.
+                 *
+                 * @param begin Pointer to the first character.
+                 * @param end Pointer behind the last character.
+                 */
+                ASCReader(const char *begin, const char *end);
+
+                virtual ~ASCReader();
+
+                /**
+                 * @return true if the ASC data could be made accessible.
+                 */
+                bool isValid() const;
+
+                /**
+                 * This method reads the next CAN frame.
+                 *
+                 * @param timeStamp Time stamp from the ASC file in microseconds.
+                 * @param gcm GenericCANMessage to be filled.
+                 * @return true if a CAN frame was read, false at the end of the data.
+                 */
+                bool next(int64_t &timeStamp, GenericCANMessage &gcm);
+
+                /**
+                 * This method rewinds the reader to the beginning of the data.
+                 */
+                void rewind();
+
+                /**
+                 * @return Number of lines that did not contain a received CAN frame.
+                 */
+                uint32_t getNumberOfSkippedLines() const;
+
+                /**
+                 * This method parses one line from an ASC file.
+                 *
+                 * @param begin Pointer to the first character of the line.
+                 * @param end Pointer behind the last character of the line.
+                 * @param timeStamp Time stamp from the ASC file in microseconds.
+                 * @param gcm GenericCANMessage to be filled.
+                 * @return true if the line contains a received CAN frame.
+                 */
+                static bool parseLine(const char *begin, const char *end, int64_t &timeStamp, GenericCANMessage &gcm);
+
+            private:
+                void mapFileDescriptor(const int32_t &fileDescriptor);
+
+            private:
+                string m_buffer;
+                void *m_mappedMemory;
+                uint64_t m_mappedLength;
+                const char *m_begin;
+                const char *m_end;
+                const char *m_position;
+                uint32_t m_numberOfSkippedLines;
+        };
+
+    } // odcantools
+} // automotive
+
+#endif /*ASCREADER_H_*/
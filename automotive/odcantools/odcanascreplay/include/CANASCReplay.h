@@ -22,6 +22,9 @@
 
 #include <stdint.h>
 
+#include <memory>
+#include <string>
+
 #include "opendavinci/odcore/base/module/TimeTriggeredConferenceClientModule.h"
 #include "opendavinci/generated/odcore/data/dmcp/ModuleExitCodeMessage.h"
 
@@ -30,8 +33,13 @@ namespace automotive {
 
         using namespace std;
 
+        class ASCReader;
+
         /**
-         * This class plays back data from an ASC file.
+         * This class plays back data from an ASC file. The CAN frames are
+         * sent either with their original inter-frame timing, scaled by a
+         * speed factor, or as fast as possible. All frames that are due
+         * within a short window are sent as one batch.
          */
         class CANASCReplay : public odcore::base::module::TimeTriggeredConferenceClientModule {
             private:
@@ -72,6 +80,9 @@ namespace automotive {
                 virtual void tearDown();
 
             private:
+                string m_fileName;
+                float m_speed;
+                unique_ptr<ASCReader> m_reader;
         };
 
     } // odcantools
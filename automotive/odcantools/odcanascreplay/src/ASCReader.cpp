@@ -0,0 +1,274 @@
+/**
+ * odcanascreplay - Tool to replay from an ASC file.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef WIN32
+    #include <sys/mman.h>
+    #include <unistd.h>
+#else
+    #include <io.h>
+#endif
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#include <cstring>
+
+#include "opendavinci/odcore/data/TimeStamp.h"
+
+#include "automotivedata/generated/automotive/GenericCANMessage.h"
+
+#include "ASCReader.h"
+
+namespace automotive {
+    namespace odcantools {
+
+        using namespace std;
+        using namespace odcore::data;
+
+        namespace {
+            inline const char* skipBlanks(const char *p, const char *end) {
+                while ( (p < end) && ((*p == ' ') || (*p == '\t')) ) {
+                    p++;
+                }
+                return p;
+            }
+
+            inline const char* skipToken(const char *p, const char *end) {
+                while ( (p < end) && (*p != ' ') && (*p != '\t') ) {
+                    p++;
+                }
+                return p;
+            }
+
+            inline int32_t hexValue(const char c) {
+                if ( (c >= '0') && (c <= '9') ) return c - '0';
+                if ( (c >= 'a') && (c <= 'f') ) return c - 'a' + 10;
+                if ( (c >= 'A') && (c <= 'F') ) return c - 'A' + 10;
+                return -1;
+            }
+        }
+
+        ASCReader::ASCReader(const int32_t &fileDescriptor) :
+            m_buffer(),
+            m_mappedMemory(NULL),
+            m_mappedLength(0),
+            m_begin(NULL),
+            m_end(NULL),
+            m_position(NULL),
+            m_numberOfSkippedLines(0) {
+            mapFileDescriptor(fileDescriptor);
+        }
+
+        ASCReader::ASCReader(const string &fileName) :
+            m_buffer(),
+            m_mappedMemory(NULL),
+            m_mappedLength(0),
+            m_begin(NULL),
+            m_end(NULL),
+            m_position(NULL),
+            m_numberOfSkippedLines(0) {
+            const int32_t fileDescriptor = ::open(fileName.c_str(), O_RDONLY);
+            if (fileDescriptor >= 0) {
+                mapFileDescriptor(fileDescriptor);
+                ::close(fileDescriptor);
+            }
+        }
+
+        ASCReader::ASCReader(const char *begin, const char *end) :
+            m_buffer(),
+            m_mappedMemory(NULL),
+            m_mappedLength(0),
+            m_begin(begin),
+            m_end(end),
+            m_position(begin),
+            m_numberOfSkippedLines(0) {}
+
+        ASCReader::~ASCReader() {
+#ifndef WIN32
+            if (m_mappedMemory != NULL) {
+                ::munmap(m_mappedMemory, m_mappedLength);
+            }
+#endif
+        }
+
+        void ASCReader::mapFileDescriptor(const int32_t &fileDescriptor) {
+#ifndef WIN32
+            struct stat fileStatus;
+            if ( (::fstat(fileDescriptor, &fileStatus) == 0) &&
+                 S_ISREG(fileStatus.st_mode) &&
+                 (fileStatus.st_size > 0) ) {
+                // Map the entire file; the kernel's read-ahead is told that we scan it sequentially.
+                void *memory = ::mmap(NULL, fileStatus.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+                if (memory != MAP_FAILED) {
+                    ::madvise(memory, fileStatus.st_size, MADV_SEQUENTIAL);
+                    m_mappedMemory = memory;
+                    m_mappedLength = fileStatus.st_size;
+                    m_begin = static_cast<const char*>(memory);
+                    m_end = m_begin + m_mappedLength;
+                    m_position = m_begin;
+                    return;
+                }
+            }
+#endif
+
+            // Fallback for streams that cannot be mapped: Read everything at once.
+            char buffer[65536];
+            int32_t length = 0;
+            while ((length = ::read(fileDescriptor, buffer, sizeof(buffer))) > 0) {
+                m_buffer.append(buffer, length);
+            }
+            if (length == 0) {
+                m_begin = m_buffer.data();
+                m_end = m_begin + m_buffer.size();
+                m_position = m_begin;
+            }
+        }
+
+        bool ASCReader::isValid() const {
+            return (m_begin != NULL);
+        }
+
+        bool ASCReader::next(int64_t &timeStamp, GenericCANMessage &gcm) {
+            while (m_position < m_end) {
+                const char *lineEnd = static_cast<const char*>(::memchr(m_position, '\n', m_end - m_position));
+                if (lineEnd == NULL) {
+                    lineEnd = m_end;
+                }
+
+                const char *lineBegin = m_position;
+                m_position = (lineEnd < m_end) ? lineEnd + 1 : m_end;
+
+                if (parseLine(lineBegin, lineEnd, timeStamp, gcm)) {
+                    return true;
+                }
+                m_numberOfSkippedLines++;
+            }
+            return false;
+        }
+
+        void ASCReader::rewind() {
+            m_position = m_begin;
+            m_numberOfSkippedLines = 0;
+        }
+
+        uint32_t ASCReader::getNumberOfSkippedLines() const {
+            return m_numberOfSkippedLines;
+        }
+
+        bool ASCReader::parseLine(const char *begin, const char *end, int64_t &timeStamp, GenericCANMessage &gcm) {
+            // Ignore '\r' from files with Windows line endings.
+            while ( (end > begin) && ((*(end - 1) == '\r') || (*(end - 1) == ' ')) ) {
+                end--;
+            }
+
+            // Time stamp in seconds with up to microseconds resolution.
+            const char *p = skipBlanks(begin, end);
+            int64_t seconds = 0;
+            const char *digits = p;
+            while ( (p < end) && (*p >= '0') && (*p <= '9') ) {
+                seconds = seconds * 10 + (*p++ - '0');
+            }
+            if (p == digits) {
+                return false;
+            }
+            int64_t microseconds = 0;
+            if ( (p < end) && (*p == '.') ) {
+                p++;
+                int64_t scale = 100000;
+                while ( (p < end) && (*p >= '0') && (*p <= '9') ) {
+                    microseconds += (*p++ - '0') * scale;
+                    scale /= 10;
+                }
+            }
+
+            // Channel; lines like 'Begin Triggerblock' or 'Time (s) ...' stop here.
+            p = skipBlanks(p, end);
+            digits = p;
+            while ( (p < end) && (*p >= '0') && (*p <= '9') ) {
+                p++;
+            }
+            if ( (p == digits) || (p == end) || ((*p != ' ') && (*p != '\t')) ) {
+                return false;
+            }
+
+            // CAN identifier in hex with an optional 'x' suffix for extended identifiers.
+            p = skipBlanks(p, end);
+            uint64_t identifier = 0;
+            digits = p;
+            int32_t value = 0;
+            while ( (p < end) && ((value = hexValue(*p)) >= 0) ) {
+                identifier = (identifier << 4) | value;
+                p++;
+            }
+            if (p == digits) {
+                return false;
+            }
+            if ( (p < end) && ((*p == 'x') || (*p == 'X')) ) {
+                p++;
+            }
+
+            // Only received data frames are replayed.
+            p = skipBlanks(p, end);
+            if ( ((end - p) < 2) ||
+                 ((p[0] != 'R') && (p[0] != 'r')) ||
+                 ((p[1] != 'X') && (p[1] != 'x')) ) {
+                return false;
+            }
+            p = skipBlanks(skipToken(p, end), end);
+            if ( (p == end) || ((*p != 'd') && (*p != 'D')) ) {
+                return false;
+            }
+            p = skipBlanks(skipToken(p, end), end);
+
+            // Payload length (0-8).
+            if ( (p == end) || (*p < '0') || (*p > '8') ) {
+                return false;
+            }
+            const uint8_t length = static_cast<uint8_t>(*p++ - '0');
+            if ( (p < end) && (*p != ' ') && (*p != '\t') ) {
+                return false;
+            }
+
+            // Payload.
+            uint64_t data = 0;
+            for (uint8_t i = 0; i < length; i++) {
+                p = skipBlanks(p, end);
+                int32_t byte = 0;
+                digits = p;
+                while ( (p < end) && ((value = hexValue(*p)) >= 0) ) {
+                    byte = (byte << 4) | value;
+                    p++;
+                }
+                if ( (p == digits) || ((p - digits) > 2) ) {
+                    return false;
+                }
+                data |= (static_cast<uint64_t>(byte) << (i*8));
+            }
+
+            timeStamp = seconds * 1000 * 1000 + microseconds;
+
+            gcm.setDriverTimeStamp(TimeStamp(static_cast<int32_t>(seconds), static_cast<int32_t>(microseconds)));
+            gcm.setIdentifier(identifier);
+            gcm.setLength(length);
+            gcm.setData(data);
+
+            return true;
+        }
+
+    } // odcantools
+} // automotive
@@ -17,13 +17,22 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <unistd.h>
+
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
-#include "opendavinci/odcore/strings/StringToolbox.h"
+#include "opendavinci/odcore/base/KeyValueConfiguration.h"
+#include "opendavinci/odcore/base/Thread.h"
+#include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
+#include "opendavinci/odcore/exceptions/Exceptions.h"
 
 #include "automotivedata/generated/automotive/GenericCANMessage.h"
 
+#include "ASCReader.h"
 #include "CANASCReplay.h"
 
 namespace automotive {
@@ -32,67 +41,118 @@ namespace automotive {
         using namespace std;
         using namespace odcore::base;
         using namespace odcore::data;
-        using namespace odcore::strings;
 
         CANASCReplay::CANASCReplay(const int32_t &argc, char **argv) :
-            TimeTriggeredConferenceClientModule(argc, argv, "odcanascreplay") {}
+            TimeTriggeredConferenceClientModule(argc, argv, "odcanascreplay"),
+            m_fileName(),
+            m_speed(1),
+            m_reader() {}
 
         CANASCReplay::~CANASCReplay() {}
 
-        void CANASCReplay::setUp() {}
+        void CANASCReplay::setUp() {
+            // ASC file to replay; stdin is used if not specified.
+            try {
+                m_fileName = getKeyValueConfiguration().getValue<string>("odcanascreplay.file");
+            }
+            catch (const odcore::exceptions::ValueForKeyNotFoundException &e) {
+            }
+
+            // Speed factor: 1 replays with the original timing, 0 as fast as possible.
+            try {
+                m_speed = getKeyValueConfiguration().getValue<float>("odcanascreplay.speed");
+            }
+            catch (const odcore::exceptions::ValueForKeyNotFoundException &e) {
+            }
+
+            if (m_fileName.size() > 0) {
+                m_reader = unique_ptr<ASCReader>(new ASCReader(m_fileName));
+            }
+            else {
+                m_reader = unique_ptr<ASCReader>(new ASCReader(STDIN_FILENO));
+            }
+
+            if (!m_reader->isValid()) {
+                cerr << "[odcanascreplay] Could not read " << (m_fileName.size() > 0 ? m_fileName : "stdin") << "." << endl;
+            }
+        }
 
-        void CANASCReplay::tearDown() {}
+        void CANASCReplay::tearDown() {
+            m_reader.reset();
+        }
 
         odcore::data::dmcp::ModuleExitCodeMessage::ModuleExitCode CANASCReplay::body() {
-            // Structure of an ASC entry: 'Timestamp Channel  ID             Rx   d Length 00 11 22 33 44 55 66 77'
-            char buffer[100];
-            while (getModuleStateAndWaitForRemainingTimeInTimeslice() == odcore::data::dmcp::ModuleStateMessage::RUNNING) {
-                // Read next line from STDIN.
-                cin.getline(buffer, 100);
-
-                // Tokenize the read line.
-                vector<string> tokens = StringToolbox::split(string(buffer), ' ');
-
-                // Do we have a valid line?
-                if ( (tokens.size() >= 7) &&
-                     (StringToolbox::equalsIgnoreCase(tokens[3], "rx")) ) {
-                    // Read CAN identifier.
-                    stringstream _identifier;
-                    uint64_t identifier = 0;
-                    _identifier << tokens[2]; _identifier >> hex >> identifier;
-
-                    // Read payload length (1-8).
-                    stringstream _length;
-                    uint16_t length = 0;
-                    _length << tokens[5]; _length >> dec >> length;
-
-                    // Read payload.
-                    uint64_t data = 0;
-                    for (uint16_t i = 0; i < length; i++) {
-                        // Put next data byte into stringstream.
-                        stringstream _data;
-                        _data << tokens[6 + i];
-
-                        // Read next data byte.
-                        uint16_t value = 0;
-                        _data >> hex >> value;
-                        data |= (static_cast<uint64_t>(value) << (i*8));
+            if ( (m_reader.get() == NULL) || !m_reader->isValid() ) {
+                return odcore::data::dmcp::ModuleExitCodeMessage::SERIOUS_ERROR;
+            }
+
+            // Frames due within this window are sent together.
+            const int64_t BATCH_WINDOW = 1000;
+            const uint32_t MAX_BATCH_SIZE = 256;
+            // Longest sleep before re-checking the time slice.
+            const int64_t MAX_SLEEP = 10 * 1000;
+            const int64_t SLICE = static_cast<int64_t>(1000 * 1000 / getFrequency());
+            const bool AS_FAST_AS_POSSIBLE = !(m_speed > 0);
+
+            vector<Container> batch;
+            batch.reserve(MAX_BATCH_SIZE);
+
+            GenericCANMessage gcm;
+            int64_t timeStamp = 0;
+            bool hasNext = m_reader->next(timeStamp, gcm);
+
+            // Replay time line: first frame in the file is sent at replayStart.
+            const int64_t firstTimeStamp = timeStamp;
+            TimeStamp replayStart;
+            bool started = false;
+
+            while (hasNext && (getModuleStateAndWaitForRemainingTimeInTimeslice() == odcore::data::dmcp::ModuleStateMessage::RUNNING)) {
+                if (!started) {
+                    replayStart = TimeStamp();
+                    started = true;
+                }
+                const int64_t endOfSlice = (TimeStamp() - replayStart).toMicroseconds() + SLICE;
+
+                while (hasNext) {
+                    const int64_t now = (TimeStamp() - replayStart).toMicroseconds();
+                    if (now >= endOfSlice) {
+                        break;
                     }
 
-                    // Create GenericCANMessage from parsed data.
-                    GenericCANMessage gcm;
-                    gcm.setIdentifier(identifier);
-                    gcm.setLength(length);
-                    gcm.setData(data);
+                    // Collect all frames that are due.
+                    int64_t due = 0;
+                    while (hasNext && (batch.size() < MAX_BATCH_SIZE)) {
+                        due = AS_FAST_AS_POSSIBLE ? 0 : static_cast<int64_t>((timeStamp - firstTimeStamp) / m_speed);
+                        if (due > now + BATCH_WINDOW) {
+                            break;
+                        }
 
-                    CLOG1 << gcm.toString() << endl;
+                        CLOG1 << gcm.toString() << endl;
 
-                    // Distribute data.
-                    Container c(gcm);
-                    getConference().send(c);
+                        batch.push_back(Container(gcm));
+                        hasNext = m_reader->next(timeStamp, gcm);
+                    }
+
+                    if (batch.empty()) {
+                        // Wait for the next frame but not beyond the current time slice.
+                        int64_t sleep = min(due, endOfSlice) - now;
+                        sleep = min(sleep, MAX_SLEEP);
+                        if (sleep > 0) {
+                            Thread::usleepFor(sleep);
+                        }
+                    }
+                    else {
+                        // Distribute data.
+                        for (vector<Container>::iterator it = batch.begin(); it != batch.end(); ++it) {
+                            getConference().send(*it);
+                        }
+                        batch.clear();
+                    }
                 }
             }
 
+            CLOG1 << "[odcanascreplay] Replay finished, skipped " << m_reader->getNumberOfSkippedLines() << " lines." << endl;
+
             return odcore::data::dmcp::ModuleExitCodeMessage::OKAY;
         }
 
@@ -20,13 +20,22 @@
 #ifndef CANASCREPLAYTESTSUITE_H_
 #define CANASCREPLAYTESTSUITE_H_
 
+#include <cstdio>
+#include <fstream>
+#include <string>
+
 #include "cxxtest/TestSuite.h"
 
+#include "opendavinci/odcore/opendavinci.h"
+#include "automotivedata/generated/automotive/GenericCANMessage.h"
+
 // Include local header files.
+#include "../include/ASCReader.h"
 #include "../include/CANASCReplay.h"
 
 using namespace std;
 using namespace odcore::data;
+using namespace automotive;
 using namespace automotive::odcantools;
 
 /**
@@ -84,6 +93,102 @@ class CANASCReplayTest : public CxxTest::TestSuite {
             TS_ASSERT(dt != NULL);
         }
 
+        void testASCReaderParsesLine() {
+            const string line("5.365 1 123 Rx d 8 00 74 00 83 00 7D 00 00");
+            int64_t timeStamp = 0;
+            GenericCANMessage gcm;
+            TS_ASSERT(ASCReader::parseLine(line.c_str(), line.c_str() + line.size(), timeStamp, gcm));
+            TS_ASSERT(timeStamp == 5365000);
+            TS_ASSERT(gcm.getDriverTimeStamp().toMicroseconds() == 5365000);
+            TS_ASSERT(gcm.getIdentifier() == 0x123);
+            TS_ASSERT(gcm.getLength() == 8);
+            TS_ASSERT(gcm.getData() == 0x00007D0083007400);
+        }
+
+        void testASCReaderParsesExtendedIdentifierAndShortPayload() {
+            const string line("   0.011520 2  18FEF100x       Rx   d 3 0A bc 1\r");
+            int64_t timeStamp = 0;
+            GenericCANMessage gcm;
+            TS_ASSERT(ASCReader::parseLine(line.c_str(), line.c_str() + line.size(), timeStamp, gcm));
+            TS_ASSERT(timeStamp == 11520);
+            TS_ASSERT(gcm.getIdentifier() == 0x18FEF100);
+            TS_ASSERT(gcm.getLength() == 3);
+            TS_ASSERT(gcm.getData() == 0x01BC0A);
+        }
+
+        void testASCReaderSkipsNonDataLines() {
+            const char* lines[] = { "Time (s) Channel ID RX/TX d Length Byte 1 Byte 2",
+                                    "date Mon Sep 21 10:00:00 2016",
+                                    "Begin Triggerblock Mon Sep 21 10:00:00 2016",
+                                    "1.000 1 123 Tx d 1 00",
+                                    "1.000 1 123 Rx r",
+                                    "1.000 1 ErrorFrame",
+                                    "1.000 1 123 Rx d 4 00 01",
+                                    "" };
+            for (uint32_t i = 0; i < sizeof(lines)/sizeof(lines[0]); i++) {
+                const string line(lines[i]);
+                int64_t timeStamp = 0;
+                GenericCANMessage gcm;
+                TS_ASSERT(!ASCReader::parseLine(line.c_str(), line.c_str() + line.size(), timeStamp, gcm));
+            }
+        }
+
+        void testASCReaderReadsFromMemory() {
+            const string asc("Time (s) Channel ID RX/TX d Length Byte 1\n"
+                             "5.29517 1 123 Rx d 1 01\n"
+                             "\n"
+                             "5.30506 1 124 Rx d 1 02\n"
+                             "5.31502 1 125 Rx d 1 03");
+            ASCReader reader(asc.c_str(), asc.c_str() + asc.size());
+            TS_ASSERT(reader.isValid());
+
+            for (uint32_t run = 0; run < 2; run++) {
+                int64_t timeStamp = 0;
+                GenericCANMessage gcm;
+                for (uint32_t i = 0; i < 3; i++) {
+                    TS_ASSERT(reader.next(timeStamp, gcm));
+                    TS_ASSERT(gcm.getIdentifier() == 0x123 + i);
+                    TS_ASSERT(gcm.getData() == i + 1);
+                }
+                TS_ASSERT(timeStamp == 5315020);
+                TS_ASSERT(!reader.next(timeStamp, gcm));
+                TS_ASSERT(reader.getNumberOfSkippedLines() == 2);
+
+                reader.rewind();
+            }
+        }
+
+        void testASCReaderReadsFromFile() {
+            const string fileName("CANASCReplayTestSuite.asc");
+            {
+                fstream fout(fileName.c_str(), ios::out | ios::trunc);
+                for (uint32_t i = 0; i < 1000; i++) {
+                    fout << (i / 100) << "." << (i % 100) << " 1 7FF Rx d 2 " << hex << (i & 0xFF) << " " << ((i >> 8) & 0xFF) << dec << "\r\n";
+                }
+            }
+
+            ASCReader reader(fileName);
+            TS_ASSERT(reader.isValid());
+
+            uint32_t numberOfFrames = 0;
+            int64_t timeStamp = 0;
+            GenericCANMessage gcm;
+            while (reader.next(timeStamp, gcm)) {
+                TS_ASSERT(gcm.getIdentifier() == 0x7FF);
+                TS_ASSERT(gcm.getData() == numberOfFrames);
+                numberOfFrames++;
+            }
+            TS_ASSERT(numberOfFrames == 1000);
+            TS_ASSERT(reader.getNumberOfSkippedLines() == 0);
+
+            UNLINK(fileName.c_str());
+        }
+
+        void testASCReaderIsInvalidForMissingFile() {
+            ASCReader reader(string("CANASCReplayTestSuite_does_not_exist.asc"));
+            TS_ASSERT(!reader.isValid());
+        }
+
         ////////////////////////////////////////////////////////////////////////////////////
         // Below this line the necessary constructor for initializing the pointer variables,
         // and the forbidden copy constructor and assignment operator are declared.
@@ -21,13 +21,13 @@
 
 #include <vector>
 
-#include "opendavinci/odcore/base/Thread.h"
 #include "opendavinci/odcore/data/Container.h"
 #include "opendavinci/odtools/recorder/Recorder.h"
 #include "automotivedata/generated/automotive/GenericCANMessage.h"
 
 #include "CANBridge.h"
 #include "CANDevice.h"
+#include "CANDeviceFactory.h"
 
 namespace automotive {
     namespace odcantools {
@@ -60,9 +60,9 @@ namespace automotive {
             m_deviceNodeB = getKeyValueConfiguration().getValue<string>("odcanbridge.devicenodeB");
 
             // Try to open CAN device A and register this instance as receiver for GenericCANMessages.
-            m_deviceA = std::shared_ptr<CANDevice>(new CANDevice(m_deviceNodeA, m_replicatorFromAtoB));
+            m_deviceA = CANDeviceFactory::createCANDevice(m_deviceNodeA, m_replicatorFromAtoB);
             // Try to open CAN device B and register this instance as receiver for GenericCANMessages.
-            m_deviceB = std::shared_ptr<CANDevice>(new CANDevice(m_deviceNodeB, m_replicatorFromBtoA));
+            m_deviceB = CANDeviceFactory::createCANDevice(m_deviceNodeB, m_replicatorFromBtoA);
 
             // If the device could be successfully opened, create a recording file with a dump of the data.
             if (m_deviceA->isOpen() &&
@@ -113,7 +113,6 @@ namespace automotive {
                 while (it != listOfContainers.end()) {
                     Container container = (*it++);
                     getConference().send(container);
-                    Thread::usleepFor(100);
                 }
             }
         }
@@ -22,11 +22,12 @@
 #define CANMAPPER_H_
 
 #include <opendavinci/odcore/base/module/DataTriggeredConferenceClientModule.h>
+#include <opendavinci/odcore/data/Container.h>
 #include <stdint.h>
 
-#include "canmessagemapping/GeneratedHeaders_CANMessageMapping.h"
+#include <vector>
 
-namespace odcore { namespace data { class Container; } }
+#include "canmessagemapping/GeneratedHeaders_CANMessageMapping.h"
 
 namespace automotive {
     namespace odcantools {
@@ -85,6 +86,7 @@ namespace automotive {
 
             private:
                 canmapping::CanMapping m_canMapping;
+                vector<odcore::data::Container> m_listOfContainers;
         };
 
     } // odcantools
@@ -22,7 +22,6 @@
 #include <vector>
 
 #include "CanMapper.h"
-#include "opendavinci/odcore/base/Thread.h"
 #include "opendavinci/odcore/base/module/DataTriggeredConferenceClientModule.h"
 #include "opendavinci/odcore/data/Container.h"
 #include "automotivedata/generated/automotive/GenericCANMessage.h"
@@ -36,7 +35,8 @@ namespace automotive {
 
         CanMapper::CanMapper(const int32_t &argc, char **argv) :
             DataTriggeredConferenceClientModule(argc, argv, "odcanmapper"),
-            m_canMapping() {}
+            m_canMapping(),
+            m_listOfContainers() {}
 
         CanMapper::~CanMapper() {}
 
@@ -65,16 +65,17 @@ namespace automotive {
                 GenericCANMessage gcm = c.getData<GenericCANMessage>();
 
                 // Optionally: print payload for debug purposes.
-                uint64_t data = gcm.getData();
-                printPayload(data);
+                if (getVerbosity() > 0) {
+                    printPayload(gcm.getData());
+                }
 
-                vector<Container> listOfContainers = m_canMapping.mapNext(gcm);
-                if (listOfContainers.size() > 0) {
-                    vector<Container>::iterator it = listOfContainers.begin();
-                    while (it != listOfContainers.end()) {
+                // Reuse the list of decoded containers to avoid allocations per CAN message.
+                m_listOfContainers.clear();
+                if (m_canMapping.mapNext(gcm, m_listOfContainers) > 0) {
+                    vector<Container>::iterator it = m_listOfContainers.begin();
+                    while (it != m_listOfContainers.end()) {
                         Container container = (*it++);
                         getConference().send(container);
-                        Thread::usleepFor(100);
                     }
                 }
             }
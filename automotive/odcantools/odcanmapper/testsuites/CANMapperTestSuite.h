@@ -24,6 +24,9 @@
 #include "cxxtest/TestSuite.h"
 
 #include <memory>
+#include <sstream>
+#include <vector>
+#include <opendavinci/odcore/data/TimeStamp.h>
 #include <opendavinci/odcore/reflection/Message.h>
 #include <opendavinci/odcore/reflection/MessageToVisitableVisitor.h>
 #include <opendavinci/odcore/reflection/MessagePrettyPrinterVisitor.h>
@@ -212,6 +215,70 @@ class CanMapperTest : public CxxTest::TestSuite {
             TS_ASSERT_DELTA(wheelSpeed.getRearRight(), 0.15, 1e-3);
         }
 
+        void testReplayASCTraceThroughCanMapping() {
+            // Excerpt from odcanascreplay/example/example.asc extended by a light system message and an unmapped CAN message.
+            const string ASC_TRACE = "5.40501 1 123 Rx d 8 00 8C 00 8F 00 88 00 8C\n"
+                                     "5.41494 1 123 Rx d 8 00 8F 00 93 00 8B 00 8C\n"
+                                     "5.42000 1 7FF Rx d 8 01 02 03 04 05 06 07 08\n"
+                                     "5.42504 1 123 Rx d 8 00 95 00 97 00 8E 00 8C\n"
+                                     "5.43000 1 001 Rx d 1 40\n"
+                                     "5.43509 1 123 Rx d 8 00 99 00 9B 00 91 00 8C\n";
+
+            vector<automotive::GenericCANMessage> listOfGCMs;
+            uint32_t numberOfMappedCANMessages = 0;
+            {
+                stringstream sstrTrace(ASC_TRACE);
+                string line;
+                while (getline(sstrTrace, line)) {
+                    stringstream sstrLine(line);
+                    string timeStamp, channel, rx, d;
+                    uint64_t identifier = 0;
+                    uint16_t length = 0;
+                    sstrLine >> timeStamp >> channel >> hex >> identifier >> rx >> d >> dec >> length;
+
+                    uint64_t data = 0;
+                    for (uint16_t i = 0; i < length; i++) {
+                        uint16_t value = 0;
+                        sstrLine >> hex >> value;
+                        data |= (static_cast<uint64_t>(value) << (i*8));
+                    }
+
+                    automotive::GenericCANMessage gcm;
+                    gcm.setIdentifier(identifier);
+                    gcm.setLength(length);
+                    gcm.setData(data);
+                    listOfGCMs.push_back(gcm);
+
+                    if (identifier != 0x7FF) {
+                        numberOfMappedCANMessages++;
+                    }
+                }
+            }
+            TS_ASSERT(listOfGCMs.size() == 6);
+
+            canmapping::CanMapping canMapping;
+            vector<Container> listOfContainers;
+
+            const uint32_t ROUNDS = 10000;
+            uint64_t numberOfContainers = 0;
+            TimeStamp before;
+            for (uint32_t round = 0; round < ROUNDS; round++) {
+                listOfContainers.clear();
+                numberOfContainers += canMapping.mapNext(listOfGCMs, listOfContainers);
+            }
+            TimeStamp after;
+
+            // Every message for 0x123 and 0x001 completes a mapping; 0x7FF is not dispatched at all.
+            TS_ASSERT(numberOfContainers == static_cast<uint64_t>(ROUNDS) * numberOfMappedCANMessages);
+            TS_ASSERT(listOfContainers.size() == numberOfMappedCANMessages);
+            TS_ASSERT(listOfContainers.at(0).getDataType() == automotive::vehicle::WheelSpeed::ID());
+
+            const double DURATION = static_cast<double>((after - before).toMicroseconds());
+            const double CAN_MESSAGES = static_cast<double>(ROUNDS) * listOfGCMs.size();
+            cout << "Mapped " << CAN_MESSAGES << " CAN messages in " << DURATION << " us ("
+                 << (DURATION > 0 ? (CAN_MESSAGES / DURATION) * 1000.0 * 1000.0 : 0) << " CAN messages/s)." << endl;
+        }
+
         ////////////////////////////////////////////////////////////////////////////////////
         // Below this line the necessary constructor for initializing the pointer variables,
         // and the forbidden copy constructor and assignment operator are declared.
@@ -23,6 +23,7 @@
 #include <stdint.h>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "GenericCANMessageListener.h"
 #include "opendavinci/odcore/base/FIFOQueue.h"
@@ -88,6 +89,17 @@ class CANDevice;
                  */
                 void writeGenericCANMessage(const GenericCANMessage &gcm);
 
+            protected:
+                /**
+                 * This method returns the CAN identifiers to be received
+                 * from the CAN device if odcanproxy.filtercanidentifiers
+                 * is set to 1; an empty list (default) receives all CAN
+                 * messages.
+                 *
+                 * @return List of CAN identifiers to be received.
+                 */
+                virtual vector<uint64_t> getListOfCANIdentifiersToReceive() const;
+
             private:
                 virtual void setUp();
 
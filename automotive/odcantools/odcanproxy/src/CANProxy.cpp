@@ -18,6 +18,7 @@
  */
 
 #include <iostream>
+#include <vector>
 
 #include "opendavinci/odcore/data/Container.h"
 #include "opendavinci/odcore/data/TimeStamp.h"
@@ -25,6 +26,7 @@
 #include "automotivedata/generated/automotive/GenericCANMessage.h"
 
 #include "CANDevice.h"
+#include "CANDeviceFactory.h"
 #include "CANProxy.h"
 
 namespace automotive {
@@ -50,10 +52,21 @@ namespace automotive {
             m_deviceNode = getKeyValueConfiguration().getValue<string>("odcanproxy.devicenode");
 
             // Try to open CAN device and register this instance as receiver for GenericCANMessages.
-            m_device = shared_ptr<CANDevice>(new CANDevice(m_deviceNode, *this));
+            m_device = CANDeviceFactory::createCANDevice(m_deviceNode, *this);
 
             // If the device could be successfully opened, create a recording file with a dump of the data.
             if (m_device->isOpen()) {
+                // Dropping unneeded CAN messages already in the kernel also removes
+                // them from the recording; thus, it needs to be enabled explicitly.
+                bool filterCANIdentifiers = false;
+                try {
+                    filterCANIdentifiers = (getKeyValueConfiguration().getValue<uint32_t>("odcanproxy.filtercanidentifiers") == 1);
+                }
+                catch(...) {}
+                if (filterCANIdentifiers) {
+                    m_device->setCANIdentifierFilter(getListOfCANIdentifiersToReceive());
+                }
+
                 // Associate the CAN device to the data store to transform Containers to CAN messages.
                 m_messageToCANDataStore = unique_ptr<MessageToCANDataStore>(new MessageToCANDataStore(m_device));
 
@@ -76,6 +89,10 @@ namespace automotive {
 
         void CANProxy::tearDown() {}
 
+        vector<uint64_t> CANProxy::getListOfCANIdentifiersToReceive() const {
+            return vector<uint64_t>();
+        }
+
         void CANProxy::nextGenericCANMessage(const GenericCANMessage &gcm) {
             Container c(gcm);
             m_fifo.add(c);
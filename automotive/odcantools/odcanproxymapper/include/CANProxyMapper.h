@@ -22,6 +22,8 @@
 
 #include <stdint.h>
 
+#include <vector>
+
 #include "CANProxy.h"
 #include "canmessagemapping/GeneratedHeaders_CANMessageMapping.h"
 
@@ -69,6 +71,9 @@ namespace automotive {
 
                 virtual void nextGenericCANMessage(const GenericCANMessage &gcm);
 
+            protected:
+                virtual vector<uint64_t> getListOfCANIdentifiersToReceive() const;
+
             private:
                 canmapping::CanMapping m_canMapping;
         };
@@ -20,7 +20,6 @@
 #include <vector>
 
 #include "CANProxyMapper.h"
-#include "opendavinci/odcore/base/Thread.h"
 #include "opendavinci/odcore/data/Container.h"
 
 namespace automotive { class GenericCANMessage; }
@@ -46,10 +45,14 @@ namespace automotive {
                 while (it != listOfContainers.end()) {
                     Container container = (*it++);
                     getConference().send(container);
-                    Thread::usleepFor(100);
                 }
             }
         }
 
+        vector<uint64_t> CANProxyMapper::getListOfCANIdentifiersToReceive() const {
+            // Only CAN messages consumed by the mappings need to be received.
+            return m_canMapping.getListOfCANIdentifiers();
+        }
+
     } // odcantools
 } // automotive
@@ -21,7 +21,7 @@
 #define CONTEXT_BASE_BLOCKABLECONTAINERLISTENER_H_
 
 #include "opendavinci/odcore/opendavinci.h"
-#include "opendavinci/odcore/base/Mutex.h"
+#include "opendavinci/odcore/base/Condition.h"
 #include "opendavinci/odcore/io/conference/ContainerListener.h"
 
 namespace odcontext {
@@ -65,8 +65,13 @@ namespace odcontext {
                  */
                 bool isNextContainerAllowed() const;
 
+                /**
+                 * This method blocks until nextContainer(...) is allowed.
+                 */
+                void waitForNextContainerAllowed() const;
+
             private:
-                mutable odcore::base::Mutex m_nextContainerAllowedMutex;
+                mutable odcore::base::Condition m_nextContainerAllowedCondition;
                 bool m_nextContainerAllowed;
         };
 
@@ -35,11 +35,6 @@ namespace odcontext {
          * system under test.
          */
         class OPENDAVINCI_API BlockableContainerReceiver : public BlockableContainerListener {
-            private:
-                enum THREAD_YIELDING {
-                    YIELDING_TIME = 100,
-                };
-
             private:
                 /**
                  * "Forbidden" copy constructor. Goal: The compiler should warn
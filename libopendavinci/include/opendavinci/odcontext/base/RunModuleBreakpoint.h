@@ -21,7 +21,7 @@
 #define CONTEXT_BASE_RUNMODULEBREAKPOINT_H_
 
 #include "opendavinci/odcore/opendavinci.h"
-#include "opendavinci/odcore/base/Mutex.h"
+#include "opendavinci/odcore/base/Condition.h"
 #include "opendavinci/odcore/base/module/Breakpoint.h"
 
 namespace odcontext {
@@ -68,6 +68,15 @@ class BlockableContainerListener;
                  */
                 bool hasReached() const;
 
+                /**
+                 * This method blocks until the breakpoint was reached or
+                 * the timeout expired.
+                 *
+                 * @param timeoutInMilliseconds Maximum time to wait.
+                 * @return true if the breakpoint was reached.
+                 */
+                bool waitForReaching(const uint32_t &timeoutInMilliseconds);
+
                 /**
                  * This method continues the application's execution.
                  */
@@ -80,22 +89,13 @@ class BlockableContainerListener;
                  */
                 void setFinallyReaching();
 
-            private:
-                /**
-                 * This method returns true if the application can continue
-                 * to execute.
-                 *
-                 * @return true if continue.
-                 */
-                bool hasContinue() const;
-
             private:
                 BlockableContainerListener &m_blockableContainerListener;
 
-                mutable odcore::base::Mutex m_reachedMutex;
+                mutable odcore::base::Condition m_reachedCondition;
                 bool m_reached;
 
-                mutable odcore::base::Mutex m_continueMutex;
+                odcore::base::Condition m_continueCondition;
                 bool m_continue;
         };
 
@@ -64,6 +64,16 @@ namespace odcontext {
                  */
                 bool needsExecution(const odcore::wrapper::Time &t) const;
 
+                /**
+                 * This method returns the time until this runner needs to be
+                 * executed next after the given time. It follows the same
+                 * schedule as needsExecution.
+                 *
+                 * @param t Time.
+                 * @return Time in milliseconds until the next execution or 0 if the app will not be executed anymore.
+                 */
+                uint32_t getTimeUntilNextExecution(const odcore::wrapper::Time &t) const;
+
                 /**
                  * This method should be overridden in subclasses to add an additional
                  * condition to the time needsExecution indicating whether an
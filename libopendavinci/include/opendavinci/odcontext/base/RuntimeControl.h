@@ -38,6 +38,7 @@ class ControlledTimeFactory;
 class RuntimeControlInterface;
 class RuntimeEnvironment;
 class SuperComponent;
+class SystemFeedbackComponent;
 class TimeTriggeredConferenceClientModuleRunner;
 
         using namespace std;
@@ -151,10 +152,26 @@ class TimeTriggeredConferenceClientModuleRunner;
                  */
                 void tearDownSystemContextComponents(RuntimeEnvironment &rte);
 
+                /**
+                 * This method computes the time until the next component
+                 * needs to be executed to advance the virtual time directly
+                 * to the next event.
+                 *
+                 * @param listOfSystemFeedbackComponents SystemFeedbackComponents.
+                 * @param listOfWrappedTimeTriggeredConferenceClientModules Wrapped ConferenceClientModules.
+                 * @param time Current time.
+                 * @return Time in milliseconds until the next execution or 0 if no component is schedulable.
+                 */
+                uint32_t getTimeUntilNextExecution(const vector<SystemFeedbackComponent*> &listOfSystemFeedbackComponents, const vector<std::shared_ptr<TimeTriggeredConferenceClientModuleRunner> > &listOfWrappedTimeTriggeredConferenceClientModules, const odcore::wrapper::Time &time) const;
+
             private:
                 // This method comes from AbstractModule and will be simply disabled.
                 virtual void waitForNextFullSecond(const uint32_t &secondsIncrement);
 
+                // This method comes from AbstractModule and will be simply disabled as
+                // the controlled time is advanced synchronously with the runners' breakpoints.
+                virtual void wait();
+
                 /**
                  * This method calls the setup-method of all
                  * SystemContextComponents and SystemReportingComponents
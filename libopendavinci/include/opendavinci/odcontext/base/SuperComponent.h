@@ -32,6 +32,7 @@
 #include "opendavinci/odcore/dmcp/ModuleStateListener.h"
 #include "opendavinci/odcore/dmcp/connection/ConnectionHandler.h"
 #include "opendavinci/odcore/io/conference/ContainerConference.h"
+#include "opendavinci/generated/odcore/data/dmcp/CycleStatistics.h"
 #include "opendavinci/generated/odcore/data/dmcp/ModuleExitCodeMessage.h"
 #include "opendavinci/generated/odcore/data/dmcp/ModuleStateMessage.h"
 #include "opendavinci/generated/odcore/data/dmcp/RuntimeStatistic.h"
@@ -104,6 +105,9 @@ namespace odcontext {
                 virtual void handleRuntimeStatistics(const odcore::data::dmcp::ModuleDescriptor& md,
                                                      const odcore::data::dmcp::RuntimeStatistic& rs);
 
+                virtual void handleCycleStatistics(const odcore::data::dmcp::ModuleDescriptor& md,
+                                                   const odcore::data::dmcp::CycleStatistics& cs);
+
                 virtual void handleConnectionLost(const odcore::data::dmcp::ModuleDescriptor& md);
 
                 virtual void handleUnkownContainer(const odcore::data::dmcp::ModuleDescriptor& md,
@@ -0,0 +1,76 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef OPENDAVINCI_CORE_BASE_CONFIGKEY_H_
+#define OPENDAVINCI_CORE_BASE_CONFIGKEY_H_
+
+namespace odcore {
+    namespace base {
+
+        /**
+         * This class is a handle to a typed value from a KeyValueConfiguration.
+         * The value is parsed once when the handle is bound; afterwards,
+         * reading it is a single load:
+         *
+         * @code
+         * KeyValueConfiguration kvc;
+         * ...
+         * ConfigKey<double> k = kvc.bind<double>("module.gain");
+         * while (...) {
+         *     const double gain = k.get();
+         * }
+         * @endcode
+         */
+        template<class T>
+        class ConfigKey {
+            public:
+                ConfigKey() :
+                    m_value() {}
+
+                /**
+                 * Constructor.
+                 *
+                 * @param value Parsed value.
+                 */
+                explicit ConfigKey(const T &value) :
+                    m_value(value) {}
+
+                /**
+                 * @return Parsed value.
+                 */
+                inline const T& get() const {
+                    return m_value;
+                }
+
+                /**
+                 * @return Parsed value.
+                 */
+                inline operator const T&() const {
+                    return m_value;
+                }
+
+            private:
+                T m_value;
+        };
+
+    }
+} // odcore::base
+
+#endif /*OPENDAVINCI_CORE_BASE_CONFIGKEY_H_*/
@@ -0,0 +1,184 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_BASE_CYCLEPROFILE_H_
+#define OPENDAVINCI_CORE_BASE_CYCLEPROFILE_H_
+
+#include <string>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/generated/odcore/data/dmcp/CycleStatistics.h"
+
+namespace odcore {
+    namespace base {
+
+        using namespace std;
+
+        /**
+         * This class accumulates the execution cycles of a module in a
+         * fixed amount of memory: The range, average, and a histogram of
+         * the deviations of the cycles' periods from the nominal duration, a histogram
+         * of the execution times, the number of overruns, and the cycles
+         * with the longest execution times. Bucket 0 of a histogram counts
+         * the value 0 and bucket i counts the values from 2^(i-1) to
+         * 2^i - 1 microseconds; the last bucket counts all larger values.
+         *
+         * Adding a cycle does not allocate memory; thus, it can be used
+         * in a module's cycle path.
+         */
+        class OPENDAVINCI_API CycleProfile {
+            public:
+                enum {
+                    NUMBER_OF_BUCKETS = 32,
+                    NUMBER_OF_WORST_CYCLES = 8
+                };
+
+                /**
+                 * One recorded execution cycle.
+                 */
+                class Cycle {
+                    public:
+                        Cycle();
+
+                    public:
+                        int64_t m_start;
+                        int64_t m_executionTime;
+                        int64_t m_periodDeviation;
+                };
+
+            public:
+                CycleProfile();
+
+                /**
+                 * Copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                CycleProfile(const CycleProfile &obj);
+
+                /**
+                 * Assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                CycleProfile& operator=(const CycleProfile &obj);
+
+                virtual ~CycleProfile();
+
+                /**
+                 * This method adds one execution cycle.
+                 *
+                 * @param start Start of the cycle in microseconds.
+                 * @param executionTime Time consumed by the cycle in microseconds.
+                 * @param periodDeviation Deviation of the cycle's period from the nominal duration in microseconds.
+                 * @param nominalDuration Nominal duration of one cycle in microseconds.
+                 */
+                void add(const int64_t &start, const int64_t &executionTime, const int64_t &periodDeviation, const int64_t &nominalDuration);
+
+                /**
+                 * This method clears all accumulated values.
+                 */
+                void reset();
+
+                uint32_t getNumberOfCycles() const;
+
+                /**
+                 * @return Number of cycles whose execution time exceeded the nominal duration.
+                 */
+                uint32_t getNumberOfOverruns() const;
+
+                /**
+                 * @return Nominal duration of the last added cycle in microseconds.
+                 */
+                int64_t getNominalDuration() const;
+
+                int64_t getMinimumPeriodDeviation() const;
+
+                int64_t getMaximumPeriodDeviation() const;
+
+                /**
+                 * @return Average period deviation in microseconds.
+                 */
+                double getAveragePeriodDeviation() const;
+
+                /**
+                 * @return Average of the absolute period deviations in microseconds.
+                 */
+                double getAverageAbsolutePeriodDeviation() const;
+
+                int64_t getMaximumExecutionTime() const;
+
+                /**
+                 * @param bucket Bucket of the histogram.
+                 * @return Number of cycles whose absolute period deviation falls into the given bucket.
+                 */
+                uint32_t getPeriodDeviationHistogram(const uint32_t &bucket) const;
+
+                /**
+                 * @param bucket Bucket of the histogram.
+                 * @return Number of cycles whose execution time falls into the given bucket.
+                 */
+                uint32_t getExecutionTimeHistogram(const uint32_t &bucket) const;
+
+                uint32_t getNumberOfWorstCycles() const;
+
+                /**
+                 * @param index Index of the cycle; 0 is the cycle with the longest execution time.
+                 * @return Recorded cycle.
+                 */
+                const Cycle& getWorstCycle(const uint32_t &index) const;
+
+                /**
+                 * This method converts the accumulated values into a
+                 * message to be sent to supercomponent. As this method
+                 * allocates memory, it must not be called in the cycle
+                 * path.
+                 *
+                 * @return CycleStatistics.
+                 */
+                odcore::data::dmcp::CycleStatistics getCycleStatistics() const;
+
+                const string toString() const;
+
+                /**
+                 * @param value Value in microseconds.
+                 * @return Bucket of the histogram for the given value.
+                 */
+                static uint32_t getBucket(const int64_t &value);
+
+            private:
+                uint32_t m_numberOfCycles;
+                uint32_t m_numberOfOverruns;
+                int64_t m_nominalDuration;
+                int64_t m_minimumPeriodDeviation;
+                int64_t m_maximumPeriodDeviation;
+                int64_t m_sumOfPeriodDeviations;
+                int64_t m_sumOfAbsolutePeriodDeviations;
+                int64_t m_maximumExecutionTime;
+                uint32_t m_periodDeviationHistogram[NUMBER_OF_BUCKETS];
+                uint32_t m_executionTimeHistogram[NUMBER_OF_BUCKETS];
+                uint32_t m_numberOfWorstCycles;
+                Cycle m_worstCycles[NUMBER_OF_WORST_CYCLES];
+        };
+
+    }
+} // odcore::base
+
+#endif /*OPENDAVINCI_CORE_BASE_CYCLEPROFILE_H_*/
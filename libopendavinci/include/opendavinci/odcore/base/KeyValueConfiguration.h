@@ -21,16 +21,20 @@
 #define OPENDAVINCI_CORE_BASE_KEYVALUECONFIGURATION_H_
 
 #include <cerrno>
-#include <map>
 #include <iosfwd>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/ConfigKey.h"
+#include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/base/Mutex.h"
 #include "opendavinci/odcore/data/SerializableData.h"
 #include "opendavinci/odcore/exceptions/Exceptions.h"
-#include "opendavinci/odcore/strings/StringComparator.h"
 
 namespace odcore {
     namespace base {
@@ -53,6 +57,10 @@ namespace odcore {
          * key=value
          * #key=value Disabled key.
          * anotherKey=anotherValue # Commented key-value-pair.
+         *
+         * Keys are stored in lower case in a hash table that is shared
+         * between copies of a KeyValueConfiguration; hence, copies are cheap.
+         * The values are parsed once per requested type and cached.
          */
         class OPENDAVINCI_API KeyValueConfiguration : public odcore::data::SerializableData {
             public:
@@ -116,17 +124,27 @@ namespace odcore {
                  */
                 template<class T>
                 inline T getValue(const string &key) const throw (exceptions::ValueForKeyNotFoundException) {
-                    string stringValue(getValueFor(key));
-                    if (stringValue == "") {
-                        stringstream s;
-                        s << "Value for key '" << key << "' not found.";
-                        errno = 0;
-                        OPENDAVINCI_CORE_THROW_EXCEPTION(ValueForKeyNotFoundException, s.str());
-                    }
-                    stringstream s(stringValue);
-                    T value;
-                    s >> value;
-                    return value;
+                    return *(getEntry(key).getParsedValue<T>());
+                };
+
+                /**
+                 * This method returns a handle to a configuration value
+                 * that is parsed only once.
+                 *
+                 * @code
+                 * KeyValueConfiguration kvc;
+                 * ...
+                 * ConfigKey<T> k = kvc.bind<T>("key");
+                 * T t = k.get();
+                 * @endcode
+                 *
+                 * @param key Key for retrieving the value.
+                 * @return Handle to the value.
+                 * @throws ValueForKeyNotFoundException is the value for the given key does not exist.
+                 */
+                template<class T>
+                inline ConfigKey<T> bind(const string &key) const throw (exceptions::ValueForKeyNotFoundException) {
+                    return ConfigKey<T>(getValue<T>(key));
                 };
 
                 /**
@@ -156,18 +174,119 @@ namespace odcore {
                 const vector<string> getListOfKeys() const;
 
             private:
-                map<string, string, odcore::strings::StringComparator> m_keyValueConfiguration;
+                /**
+                 * This class is used to determine a unique tag per type for
+                 * caching parsed values.
+                 */
+                template<class T>
+                class TypeTag {
+                    public:
+                        static const char m_tag;
+                };
+
+                /**
+                 * This class holds a value and its parsed representations.
+                 */
+                class OPENDAVINCI_API Entry {
+                    private:
+                        /**
+                         * "Forbidden" copy constructor. Goal: The compiler should warn
+                         * already at compile time for unwanted bugs caused by any misuse
+                         * of the copy constructor.
+                         *
+                         * @param obj Reference to an object of this class.
+                         */
+                        Entry(const Entry &/*obj*/);
+
+                        /**
+                         * "Forbidden" assignment operator. Goal: The compiler should warn
+                         * already at compile time for unwanted bugs caused by any misuse
+                         * of the assignment operator.
+                         *
+                         * @param obj Reference to an object of this class.
+                         * @return Reference to this instance.
+                         */
+                        Entry& operator=(const Entry &/*obj*/);
+
+                    public:
+                        Entry(const string &value);
+
+                        virtual ~Entry();
+
+                        const string& getValue() const;
+
+                        /**
+                         * This method returns the value parsed as T; the
+                         * value is only parsed at the first call per type.
+                         *
+                         * @return Parsed value.
+                         */
+                        template<class T>
+                        inline std::shared_ptr<const T> getParsedValue() const {
+                            const void *tag = &TypeTag<T>::m_tag;
+
+                            Lock l(m_parsedValuesMutex);
+                            vector<pair<const void*, std::shared_ptr<const void> > >::const_iterator it = m_parsedValues.begin();
+                            while (it != m_parsedValues.end()) {
+                                if (it->first == tag) {
+                                    return std::static_pointer_cast<const T>(it->second);
+                                }
+                                it++;
+                            }
+
+                            stringstream s(m_value);
+                            std::shared_ptr<T> value(new T());
+                            s >> *value;
+                            m_parsedValues.push_back(make_pair(tag, std::shared_ptr<const void>(value)));
+                            return value;
+                        }
+
+                    private:
+                        string m_value;
+                        mutable Mutex m_parsedValuesMutex;
+                        mutable vector<pair<const void*, std::shared_ptr<const void> > > m_parsedValues;
+                };
+
+                /**
+                 * This class holds all entries; it is not modified after
+                 * it has been filled and shared between copies.
+                 */
+                class OPENDAVINCI_API Entries {
+                    public:
+                        Entries();
+
+                        virtual ~Entries();
+
+                    public:
+                        unordered_map<string, std::shared_ptr<Entry> > m_mapOfEntries;
+                        vector<string> m_listOfKeys;
+                };
+
+                std::shared_ptr<const Entries> m_entries;
 
                 /**
-                 * This method returns the string for given key or ""
-                 * if the key does not exist.
+                 * This method returns the entry for the given key.
                  *
-                 * @param key Key for which the value is queried for.
-                 * @return value for the key or "".
+                 * @param key Key in any case.
+                 * @return Entry.
+                 * @throws ValueForKeyNotFoundException is the value for the given key does not exist.
                  */
-                string getValueFor(string key) const;
+                const Entry& getEntry(const string &key) const throw (exceptions::ValueForKeyNotFoundException);
+
+                /**
+                 * This method builds a new configuration from the given
+                 * entries whose keys contain section.
+                 *
+                 * @param section Section in any case.
+                 * @param removeLeadingSectionName Remove the part of the key up to and including the section.
+                 * @return (Empty) subset key/value-configuration.
+                 */
+                KeyValueConfiguration getSubset(const string &section, const bool &removeLeadingSectionName) const;
         };
 
+        template<class T>
+        const char KeyValueConfiguration::TypeTag<T>::m_tag = 0;
+
     }
 } // odcore::base
 
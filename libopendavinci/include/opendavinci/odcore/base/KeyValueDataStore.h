@@ -20,8 +20,12 @@
 #ifndef OPENDAVINCI_CORE_BASE_KEYVALUEDATASTORE_H_
 #define OPENDAVINCI_CORE_BASE_KEYVALUEDATASTORE_H_
 
-#include "opendavinci/odcore/opendavinci.h"
+#include <map>
 #include <memory>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Mutex.h"
 #include "opendavinci/odcore/data/Container.h"
 #include "opendavinci/odcore/exceptions/Exceptions.h"
 #include "opendavinci/odcore/wrapper/KeyValueDatabase.h"
@@ -36,12 +40,23 @@ namespace odcore {
          * It can be used as follows:
          *
          * @code
-         * KeyValueDataStore &kv = new KeyValueDataStore(wrapper::KeyValueDatabaseFactory::createKeyValueDatabase());
+         * KeyValueDataStore &kv = new KeyValueDataStore();
          * int32_t key = 1;
          * TimeStamp ts;
          * Container c(TIMESTAMP, ts);
          * kv.put(key, c);
          * @endcode
+         *
+         * Without a database, the latest Container for every key is kept
+         * in memory as shared and immutable copy: The keys are distributed
+         * over NUMBER_OF_SHARDS shards whose index is replaced as a whole
+         * when a new key is added. Thus, reading a value neither decodes
+         * a Container nor waits for writers of other keys; put() replaces
+         * the shared pointer of the slot atomically while readers still
+         * holding the previous value continue to use it.
+         *
+         * Optionally, the last N Containers per key can be kept by
+         * setHistoryDepth(key, N) and queried with getHistory(key, n).
          */
         class OPENDAVINCI_API KeyValueDataStore {
             private:
@@ -64,9 +79,21 @@ namespace odcore {
                  */
                 KeyValueDataStore& operator=(const KeyValueDataStore&);
 
+            public:
+                enum {
+                    NUMBER_OF_SHARDS = 16
+                };
+
             public:
                 /**
-                 * Constructor.
+                 * Constructor for the in-memory store.
+                 */
+                KeyValueDataStore();
+
+                /**
+                 * Constructor for a store backed by a key/value database
+                 * where every Container is encoded on put and decoded on
+                 * get. This store does not keep any history.
                  *
                  * @param keyValueDatabase Associated key/value database.
                  * @throws NoDatabaseAvailableException if keyValueDatabase is NULL.
@@ -91,8 +118,86 @@ namespace odcore {
                  */
                 data::Container get(const int32_t &key) const;
 
+                /**
+                 * This method returns the value for a key without copying
+                 * the Container.
+                 *
+                 * @param key The key for which the value has to be returned.
+                 * @return The value; an empty Container if there is no value for the key.
+                 */
+                std::shared_ptr<const data::Container> getShared(const int32_t &key) const;
+
+                /**
+                 * This method sets the number of Containers to be kept for
+                 * the given key; the default is 1 (i.e. only the latest value).
+                 *
+                 * @param key The key.
+                 * @param depth Number of Containers to be kept.
+                 */
+                void setHistoryDepth(const int32_t &key, const uint32_t &depth);
+
+                /**
+                 * This method returns the last Containers for a key.
+                 *
+                 * @param key The key for which the values have to be returned.
+                 * @param n Maximum number of Containers to be returned.
+                 * @return Up to n Containers, the latest one first.
+                 */
+                vector<std::shared_ptr<const data::Container> > getHistory(const int32_t &key, const uint32_t &n) const;
+
+            private:
+                /**
+                 * The values for one key.
+                 */
+                class Slot {
+                    public:
+                        Slot();
+
+                    public:
+                        // Serializes the writers of this key and the history.
+                        Mutex m_mutex;
+                        std::shared_ptr<const data::Container> m_value;
+                        uint32_t m_historyDepth;
+                        uint32_t m_historyNext;
+                        uint32_t m_historySize;
+                        vector<std::shared_ptr<const data::Container> > m_history;
+                };
+
+                /**
+                 * A shard owns the slots for a subset of all keys.
+                 */
+                class Shard {
+                    public:
+                        Shard();
+
+                    public:
+                        // Serializes adding new slots.
+                        Mutex m_mutex;
+                        vector<std::shared_ptr<Slot> > m_slots;
+                        std::shared_ptr<const map<int32_t, Slot*> > m_index;
+                };
+
+                /**
+                 * This method returns the slot for the given key.
+                 *
+                 * @param key The key.
+                 * @return Slot or NULL if there is no slot for this key.
+                 */
+                Slot* findSlot(const int32_t &key) const;
+
+                /**
+                 * This method returns the slot for the given key and
+                 * creates it if necessary.
+                 *
+                 * @param key The key.
+                 * @return Slot.
+                 */
+                Slot* getSlot(const int32_t &key);
+
             private:
                 std::shared_ptr<wrapper::KeyValueDatabase> m_keyValueDatabase;
+                std::shared_ptr<const data::Container> m_emptyContainer;
+                Shard m_shards[NUMBER_OF_SHARDS];
         };
 
     }
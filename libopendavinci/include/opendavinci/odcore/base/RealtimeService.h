@@ -39,6 +39,14 @@ namespace odcore {
          * for convenience. A binary using RealtimeService MUST be run
          * with super user privileges!
          *
+         * The thread is created for the role "realtime", i.e. a
+         * ThreadConfiguration registered for this role at the
+         * ConcurrencyFactory is applied. The execution times of the time
+         * slices and the deviations of their starts are available from
+         * getCycleProfile(); getAndResetCycleProfile() allows to report
+         * them periodically. The cycles that were not yet reported are
+         * printed when the service is stopped.
+         *
          * It can be used as follows:
          *
          * @code
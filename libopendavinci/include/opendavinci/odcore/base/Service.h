@@ -21,6 +21,7 @@
 #define OPENDAVINCI_CORE_BASE_SERVICE_H_
 
 #include <memory>
+#include <string>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/base/Condition.h"
@@ -85,6 +86,16 @@ namespace odcore {
             public:
                 Service() throw (exceptions::ThreadException) ;
 
+                /**
+                 * Constructor for a service whose thread is configured with
+                 * the ThreadConfiguration registered for the given role at
+                 * the ConcurrencyFactory.
+                 *
+                 * @param threadRole Role of this service's thread like "recorder".
+                 * @throws ThreadException if the thread can not be created.
+                 */
+                Service(const string &threadRole) throw (exceptions::ThreadException);
+
                 virtual ~Service();
 
                 /**
@@ -141,6 +141,27 @@ namespace odcore {
                      */
                     const odcore::data::dmcp::ServerInformation getServerInformation() const;
 
+                private:
+                    /**
+                     * This method applies the thread and memory settings from
+                     * the configuration for this module:
+                     *
+                     * @code
+                     * # CPU cores, scheduling policy (other, fifo, rr), and priority
+                     * # per thread role (body, receiver, recorder, realtime, statistics, worker).
+                     * name.thread.body.cpus = 2,3
+                     * name.thread.body.policy = fifo
+                     * name.thread.body.priority = 40
+                     * # Lock all pages into memory and pre-fault the heap (bytes).
+                     * name.memory.lock = 1
+                     * name.memory.prefault = 16777216
+                     * @endcode
+                     *
+                     * The settings for "body" are applied to the calling thread;
+                     * all other roles are registered at the ConcurrencyFactory.
+                     */
+                    void configureThreadsAndMemory();
+
                 private:
                     string m_name;
                     odcore::base::KeyValueConfiguration m_keyValueConfiguration;
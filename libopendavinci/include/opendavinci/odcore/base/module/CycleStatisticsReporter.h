@@ -0,0 +1,182 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_BASE_CYCLESTATISTICSREPORTER_H_
+#define OPENDAVINCI_BASE_CYCLESTATISTICSREPORTER_H_
+
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Condition.h"
+#include "opendavinci/odcore/base/CycleProfile.h"
+#include "opendavinci/odcore/base/Service.h"
+
+namespace odcore { namespace dmcp { namespace connection { class Client; } } }
+
+namespace odcore {
+    namespace base {
+        namespace module {
+
+            using namespace std;
+
+            /**
+             * This class sends the runtime statistics and cycle statistics
+             * of a module to supercomponent and writes the profiling data
+             * to disk in its own thread (thread role "statistics"). The
+             * module's cycle path only copies the values into memory that
+             * has been allocated during construction; profiling records
+             * that do not fit into this memory are dropped and counted.
+             */
+            class OPENDAVINCI_API CycleStatisticsReporter : public odcore::base::Service {
+                public:
+                    enum {
+                        NUMBER_OF_PROFILING_RECORDS = 1024
+                    };
+
+                    /**
+                     * Profiling data for one execution cycle.
+                     */
+                    class ProfilingRecord {
+                        public:
+                            ProfilingRecord();
+
+                        public:
+                            int64_t m_current;
+                            int64_t m_lastCycle;
+                            float m_freq;
+                            long m_lastWaitTime;
+                            long m_timeConsumptionCurrent;
+                            long m_nominalDuration;
+                            long m_waitingTimeCurrent;
+                            int32_t m_cycleCounter;
+                    };
+
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     */
+                    CycleStatisticsReporter(const CycleStatisticsReporter &);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     */
+                    CycleStatisticsReporter& operator=(const CycleStatisticsReporter &);
+
+                public:
+                    /**
+                     * Constructor.
+                     *
+                     * @param name Name of the module used for the profiling files.
+                     * @param dmcpClient Client to send the statistics to supercomponent (might be NULL).
+                     * @param profiling If true, profiling data is written to disk.
+                     */
+                    CycleStatisticsReporter(const string &name, std::shared_ptr<odcore::dmcp::connection::Client> dmcpClient, const bool &profiling);
+
+                    virtual ~CycleStatisticsReporter();
+
+                    /**
+                     * This method queues the profiling data of one cycle
+                     * to be written to disk.
+                     *
+                     * @param pr Profiling data.
+                     * @return false if the record was dropped.
+                     */
+                    bool addProfilingRecord(const ProfilingRecord &pr);
+
+                    /**
+                     * This method queues a RuntimeStatistic to be sent
+                     * to supercomponent; a pending one is replaced.
+                     *
+                     * @param sliceConsumption Consumed part of the time slice.
+                     */
+                    void reportRuntimeStatistic(const float &sliceConsumption);
+
+                    /**
+                     * This method queues the cycle statistics to be sent to
+                     * supercomponent and to be written to disk; pending
+                     * cycle statistics are replaced.
+                     *
+                     * @param cp Accumulated execution cycles.
+                     */
+                    void reportCycleProfile(const odcore::base::CycleProfile &cp);
+
+                    /**
+                     * @return Number of profiling records that were dropped.
+                     */
+                    uint32_t getNumberOfDroppedProfilingRecords() const;
+
+                protected:
+                    virtual void beforeStop();
+
+                    virtual void run();
+
+                private:
+                    /**
+                     * This method writes and sends all pending entries.
+                     */
+                    void report();
+
+                    /**
+                     * This method writes the given profiling records.
+                     *
+                     * @param numberOfRecords Number of records in m_profilingRecordsToWrite.
+                     */
+                    void writeProfilingRecords(const uint32_t &numberOfRecords);
+
+                    /**
+                     * This method writes the given cycle statistics.
+                     *
+                     * @param cp Accumulated execution cycles.
+                     */
+                    void writeCycleProfile(const odcore::base::CycleProfile &cp);
+
+                private:
+                    string m_name;
+                    std::shared_ptr<odcore::dmcp::connection::Client> m_dmcpClient;
+                    bool m_profiling;
+
+                    mutable odcore::base::Condition m_reportCondition;
+                    vector<ProfilingRecord> m_profilingRecords;
+                    uint32_t m_firstProfilingRecord;
+                    uint32_t m_numberOfProfilingRecords;
+                    uint32_t m_numberOfDroppedProfilingRecords;
+                    bool m_hasRuntimeStatistic;
+                    float m_sliceConsumption;
+                    bool m_hasCycleProfile;
+                    odcore::base::CycleProfile m_cycleProfile;
+
+                    // Only accessed by the reporting thread.
+                    vector<ProfilingRecord> m_profilingRecordsToWrite;
+                    odcore::base::CycleProfile m_cycleProfileToWrite;
+                    ofstream *m_profilingFile;
+                    ofstream *m_cycleStatisticsFile;
+            };
+
+        }
+    }
+} // odcore::base::module
+
+#endif /*OPENDAVINCI_BASE_CYCLESTATISTICSREPORTER_H_*/
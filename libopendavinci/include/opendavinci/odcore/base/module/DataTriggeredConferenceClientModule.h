@@ -20,14 +20,17 @@
 #ifndef OPENDAVINCI_BASE_DATATRIGGEREDCONFERENCECLIENTMODULE_H_
 #define OPENDAVINCI_BASE_DATATRIGGEREDCONFERENCECLIENTMODULE_H_
 
+#include <memory>
 #include <string>
 
 #include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Mutex.h"
 #include "opendavinci/odcore/base/module/AbstractConferenceClientModule.h"
 #include "opendavinci/odcore/exceptions/Exceptions.h"
 #include "opendavinci/generated/odcore/data/dmcp/ModuleExitCodeMessage.h"
 
 namespace odcore { namespace data { class Container; } }
+namespace odcore { namespace io { namespace conference { class ContainerDispatcher; } } }
 
 namespace odcore {
     namespace base {
@@ -72,6 +75,23 @@ namespace odcore {
              *     return myModule.runModule();
              * }
              * @endcode
+             *
+             * By default, nextContainer is called by the thread receiving
+             * the containers. In managed level ML_NONE without realtime
+             * scheduling, the module can be configured to run event-driven
+             * instead: The receiving thread only enters the containers into
+             * a bounded queue and the module's body thread sleeps until
+             * containers arrive, calls nextContainer for them, and checks
+             * the module's state once per time slice. Optionally, worker
+             * threads call nextContainer in parallel for different data
+             * types; then, nextContainer must be thread-safe, while the
+             * containers of one data type are still delivered in order.
+             *
+             * @code
+             * MyName.datatriggered.eventdriven = 1
+             * MyName.datatriggered.capacity = 1024  # Containers per queue; the oldest are dropped.
+             * MyName.datatriggered.workers = 0      # 0 = body thread calls nextContainer.
+             * @endcode
              */
             class OPENDAVINCI_API DataTriggeredConferenceClientModule : public AbstractConferenceClientModule {
                 private:
@@ -110,6 +130,23 @@ namespace odcore {
                     virtual void tearDown() = 0;
 
                     virtual void nextContainer(odcore::data::Container &c) = 0;
+
+                    virtual void waitForRemainingTimeInTimeslice(const long &waitingTimeInMicroseconds);
+
+                    virtual void handleConnectionLost();
+
+                private:
+                    /**
+                     * This method runs the body event-driven with a ContainerDispatcher.
+                     *
+                     * @param capacity Maximum number of queued containers per queue.
+                     * @param numberOfWorkers Number of worker threads.
+                     */
+                    void runEventDriven(const uint32_t &capacity, const uint32_t &numberOfWorkers);
+
+                private:
+                    odcore::base::Mutex m_containerDispatcherMutex;
+                    unique_ptr<odcore::io::conference::ContainerDispatcher> m_containerDispatcher;
             };
 
         }
@@ -21,10 +21,13 @@
 #define OPENDAVINCI_BASE_MANAGEDCLIENTMODULE_H_
 
 #include <string>
+#include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcontext/base/Clock.h"
 #include <memory>
+#include "opendavinci/odcore/base/CycleProfile.h"
+#include "opendavinci/odcore/base/Mutex.h"
 #include "opendavinci/odcore/base/module/Breakpoint.h"
 #include "opendavinci/odcore/base/module/ClientModule.h"
 #include "opendavinci/odcore/data/TimeStamp.h"
@@ -35,6 +38,7 @@
 #include "opendavinci/generated/odcore/data/dmcp/PulseMessage.h"
 
 namespace odcontext { namespace base { class ControlledTimeFactory; } }
+namespace odcore { namespace base { namespace module { class CycleStatisticsReporter; } } }
 
 namespace odcore {
     namespace base {
@@ -47,6 +51,12 @@ namespace odcore {
              *  - unsupervised distributed execution
              *  - supervised distributed execution
              *
+             * The execution cycles are accumulated in fixed memory and sent
+             * as CycleStatistics to supercomponent every
+             * <name>.cyclestatistics.interval seconds (default: 10, 0
+             * disables sending). Sending and writing the profiling data to
+             * disk is done by a CycleStatisticsReporter in its own thread.
+             *
              * @See AbstractConferenceClientModule
              */
             class OPENDAVINCI_API ManagedClientModule : public odcore::base::module::ClientModule, public odcore::base::module::Breakpoint, public odcore::io::conference::ContainerListener {
@@ -91,6 +101,14 @@ namespace odcore {
                      */
                     const odcore::data::TimeStamp getStartOfLastCycle() const;
 
+                    /**
+                     * This method returns the execution cycles that were
+                     * not yet reported as CycleStatistics.
+                     *
+                     * @return Cycle profile since the last report.
+                     */
+                    const odcore::base::CycleProfile getCycleProfile() const;
+
                 protected:
                     /**
                      * This method is called right before the body is executed.
@@ -115,11 +133,27 @@ namespace odcore {
 
                     virtual void reached();
 
+                    /**
+                     * This method suspends the execution of the module's body
+                     * for the remaining time of the current time slice in managed
+                     * level ML_NONE without realtime scheduling.
+                     *
+                     * @param waitingTimeInMicroseconds Remaining time of the current time slice.
+                     */
+                    virtual void waitForRemainingTimeInTimeslice(const long &waitingTimeInMicroseconds);
+
                 private:
                     virtual void wait();
 
                     virtual void DMCPconnectionLost();
 
+                    /**
+                     * This method runs the module's body depending on the managed level.
+                     *
+                     * @return The exit code of the real body.
+                     */
+                    odcore::data::dmcp::ModuleExitCodeMessage::ModuleExitCode runModuleImplementation_ManagedLevel();
+
                     odcore::data::dmcp::ModuleExitCodeMessage::ModuleExitCode runModuleImplementation_ManagedLevel_None();
                     void wait_ManagedLevel_None();
                     void wait_ManagedLevel_None_realtime();
@@ -155,7 +189,8 @@ namespace odcore {
 
                     /**
                      * This method is used to log the time consumption (load)
-                     * for this module into a profiling file.
+                     * for this module into a profiling file. The values are
+                     * only queued here and written by the CycleStatisticsReporter.
                      */
                     void logProfilingData(const odcore::data::TimeStamp &current,
                                           const odcore::data::TimeStamp &lastCycle,
@@ -190,6 +225,28 @@ namespace odcore {
                      */
                     std::shared_ptr<odcore::io::conference::ContainerConference> getContainerConference();
 
+                    /**
+                     * This method declares that this module consumes containers
+                     * of the given data type. In managed level ML_SIMULATION or
+                     * ML_SIMULATION_RT, supercomponent embeds only containers of
+                     * the subscribed data types into the pulses for this module
+                     * unless subscribeToAllDataTypes() has been called.
+                     *
+                     * TimeTriggeredConferenceClientModule subscribes to the data
+                     * types registered with addDataStoreFor(datatype, dataStore)
+                     * automatically.
+                     *
+                     * @param dataType Data type to be received.
+                     */
+                    void subscribeTo(const int32_t &dataType);
+
+                    /**
+                     * This method declares that this module consumes containers
+                     * of all data types. This is also the behavior as long as no
+                     * data type has been subscribed.
+                     */
+                    void subscribeToAllDataTypes();
+
                 private:
 #ifndef WIN32
                     struct timespec m_waitForSlice;
@@ -199,7 +256,12 @@ namespace odcore {
                     odcore::data::TimeStamp m_lastCycle;
                     long m_lastWaitTime;
                     int32_t m_cycleCounter;
-                    ofstream *m_profilingFile;
+                    bool m_isFirstCycle;
+                    mutable odcore::base::Mutex m_cycleProfileMutex;
+                    odcore::base::CycleProfile m_cycleProfile;
+                    uint32_t m_cycleStatisticsInterval;
+                    odcore::data::TimeStamp m_lastCycleStatistics;
+                    unique_ptr<CycleStatisticsReporter> m_cycleStatisticsReporter;
 
                     bool m_firstCallToBreakpoint_ManagedLevel_Pulse;
 
@@ -210,6 +272,11 @@ namespace odcore {
                     std::shared_ptr<odcore::io::conference::ContainerConference> m_localContainerConference;
                     bool m_hasExternalContainerConference;
                     std::shared_ptr<odcore::io::conference::ContainerConference> m_containerConference;
+
+                    odcore::base::Mutex m_subscribedDataTypesMutex;
+                    vector<int32_t> m_listOfSubscribedDataTypes;
+                    bool m_subscribesToAllDataTypes;
+                    bool m_hasChangedSubscribedDataTypes;
             };
 
         }
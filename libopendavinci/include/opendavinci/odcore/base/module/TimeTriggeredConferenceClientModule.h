@@ -92,6 +92,12 @@ namespace odcore {
              *     return myModule.runModule();
              * }
              * @endcode
+             *
+             * In managed level ML_SIMULATION, the data types registered with
+             * addDataStoreFor(datatype, dataStore) are reported to supercomponent
+             * so that only these containers are delivered to this module. Using
+             * getKeyValueDataStore() or addDataStoreFor(dataStore) requests all
+             * data types again.
              */
             class OPENDAVINCI_API TimeTriggeredConferenceClientModule : public AbstractConferenceClientModule, public DataStoreManager {
                 private:
@@ -111,6 +111,22 @@ class SerializableData;
                     return containerData;
                 }
 
+                /**
+                 * This method returns a usable object from a const
+                 * Container. In contrast to the non-const version, the
+                 * data is read from a copy of the serialized data so that
+                 * a shared Container can be decoded concurrently.
+                 *
+                 * @return Usable object.
+                 */
+                template<class T>
+                inline T getData() const {
+                    T containerData;
+                    stringstream serializedData(m_serializedData.str());
+                    serializedData >> containerData;
+                    return containerData;
+                }
+
                 /**
                  * This method returns the time stamp when this
                  * container was sent.
@@ -158,6 +174,14 @@ class SerializableData;
                  */
                 void setSampleTimeStamp(const TimeStamp &sampleTimeStamp);
 
+                /**
+                 * This method returns the size of the serialized data
+                 * in this container without copying it.
+                 *
+                 * @return Size of the serialized data in bytes.
+                 */
+                uint32_t getSizeOfData() const;
+
                 /**
                  * This method returns the data type as String.
                  *
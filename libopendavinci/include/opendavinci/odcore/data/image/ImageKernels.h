@@ -0,0 +1,131 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_DATA_IMAGE_IMAGEKERNELS_H_
+#define OPENDAVINCI_CORE_DATA_IMAGE_IMAGEKERNELS_H_
+
+#include "opendavinci/odcore/opendavinci.h"
+
+namespace odcore {
+    namespace data {
+        namespace image {
+
+            using namespace std;
+
+            /**
+             * This class provides pixel operations on raw 8 bit images as
+             * they are exchanged by SharedImage. All methods work on
+             * caller-provided buffers and do not allocate memory; strides
+             * are given in bytes per row. Hence, they can be applied to a
+             * copy of a shared image after the shared memory was unlocked.
+             *
+             * On x86 with GCC or Clang, flip and swapRedBlue use SSSE3 if
+             * the CPU supports it.
+             *
+             * @code
+             * vector<uint8_t> frame;
+             * if (reader.copy(si, frame)) {
+             *     // Outside of the shared memory's lock.
+             *     ImageKernels::flip(&frame[0], si.getWidth() * 3, m_image, si.getWidth() * 3, si.getWidth(), si.getHeight(), 3, ImageKernels::BOTH);
+             * }
+             * @endcode
+             */
+            struct OPENDAVINCI_API ImageKernels {
+                enum FLIPMODE {
+                    VERTICAL,   // Upside down (rows are mirrored).
+                    HORIZONTAL, // Left to right (columns are mirrored).
+                    BOTH        // Rotation by 180 degrees.
+                };
+
+                /**
+                 * This method copies an image row by row.
+                 *
+                 * @param src Source image.
+                 * @param srcStride Bytes per row in src.
+                 * @param dst Destination image.
+                 * @param dstStride Bytes per row in dst.
+                 * @param width Width in pixels.
+                 * @param height Height in pixels.
+                 * @param bytesPerPixel Bytes per pixel.
+                 */
+                static void copy(const uint8_t *src, const uint32_t &srcStride, uint8_t *dst, const uint32_t &dstStride, const uint32_t &width, const uint32_t &height, const uint32_t &bytesPerPixel);
+
+                /**
+                 * This method mirrors an image; src and dst must not overlap.
+                 *
+                 * @param src Source image.
+                 * @param srcStride Bytes per row in src.
+                 * @param dst Destination image.
+                 * @param dstStride Bytes per row in dst.
+                 * @param width Width in pixels.
+                 * @param height Height in pixels.
+                 * @param bytesPerPixel Bytes per pixel.
+                 * @param mode Axis to mirror.
+                 */
+                static void flip(const uint8_t *src, const uint32_t &srcStride, uint8_t *dst, const uint32_t &dstStride, const uint32_t &width, const uint32_t &height, const uint32_t &bytesPerPixel, const FLIPMODE &mode);
+
+                /**
+                 * This method converts a 3 bytes per pixel image from BGR
+                 * to RGB and vice versa; src and dst may be the same.
+                 *
+                 * @param src Source image.
+                 * @param srcStride Bytes per row in src.
+                 * @param dst Destination image.
+                 * @param dstStride Bytes per row in dst.
+                 * @param width Width in pixels.
+                 * @param height Height in pixels.
+                 */
+                static void swapRedBlue(const uint8_t *src, const uint32_t &srcStride, uint8_t *dst, const uint32_t &dstStride, const uint32_t &width, const uint32_t &height);
+
+                /**
+                 * This method converts a 3 bytes per pixel image to an
+                 * image with 1 byte per pixel using the ITU-R BT.601 weights.
+                 *
+                 * @param src Source image.
+                 * @param srcStride Bytes per row in src.
+                 * @param dst Destination image.
+                 * @param dstStride Bytes per row in dst.
+                 * @param width Width in pixels.
+                 * @param height Height in pixels.
+                 * @param isBGR true if src is BGR, false if src is RGB.
+                 */
+                static void toGrayscale(const uint8_t *src, const uint32_t &srcStride, uint8_t *dst, const uint32_t &dstStride, const uint32_t &width, const uint32_t &height, const bool &isBGR);
+
+                /**
+                 * This method reduces an image by an integer factor; every
+                 * pixel in dst is the mean of factor x factor pixels in src.
+                 * dst has (width / factor) x (height / factor) pixels.
+                 *
+                 * @param src Source image.
+                 * @param srcStride Bytes per row in src.
+                 * @param dst Destination image.
+                 * @param dstStride Bytes per row in dst.
+                 * @param width Width of src in pixels.
+                 * @param height Height of src in pixels.
+                 * @param bytesPerPixel Bytes per pixel.
+                 * @param factor Factor to reduce width and height.
+                 */
+                static void downscale(const uint8_t *src, const uint32_t &srcStride, uint8_t *dst, const uint32_t &dstStride, const uint32_t &width, const uint32_t &height, const uint32_t &bytesPerPixel, const uint32_t &factor);
+            };
+
+        }
+    }
+} // odcore::data::image
+
+#endif /*OPENDAVINCI_CORE_DATA_IMAGE_IMAGEKERNELS_H_*/
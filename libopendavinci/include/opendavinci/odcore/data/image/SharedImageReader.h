@@ -0,0 +1,208 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_DATA_IMAGE_SHAREDIMAGEREADER_H_
+#define OPENDAVINCI_CORE_DATA_IMAGE_SHAREDIMAGEREADER_H_
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+namespace odcore { namespace data { namespace image { class SharedImage; } } }
+namespace odcore { namespace wrapper { class SharedMemory; } }
+
+namespace odcore {
+    namespace data {
+        namespace image {
+
+            using namespace std;
+
+            /**
+             * This class provides access to the pixels described by
+             * SharedImage messages. Attachments to shared memory are cached
+             * by name so that every frame only costs locking the memory.
+             * The pixels can either be accessed in place by a View, which
+             * keeps the shared memory locked until it is released, or be
+             * copied into a caller-provided buffer so that any further
+             * processing (cf. ImageKernels) runs without holding the lock.
+             *
+             * This class is not thread-safe; use one reader per thread.
+             *
+             * @code
+             * SharedImageReader reader;
+             * ...
+             * SharedImage si = c.getData<SharedImage>();
+             * {
+             *     SharedImageReader::View view(reader, si);
+             *     if (view.isValid()) {
+             *         // Use view.getData() until view goes out of scope.
+             *     }
+             * }
+             * @endcode
+             */
+            class OPENDAVINCI_API SharedImageReader {
+                public:
+                    /**
+                     * This class locks the shared memory for one SharedImage
+                     * while it exists or until it is released.
+                     */
+                    class OPENDAVINCI_API View {
+                        private:
+                            /**
+                             * "Forbidden" copy constructor. Goal: The compiler should warn
+                             * already at compile time for unwanted bugs caused by any misuse
+                             * of the copy constructor.
+                             *
+                             * @param obj Reference to an object of this class.
+                             */
+                            View(const View &/*obj*/);
+
+                            /**
+                             * "Forbidden" assignment operator. Goal: The compiler should warn
+                             * already at compile time for unwanted bugs caused by any misuse
+                             * of the assignment operator.
+                             *
+                             * @param obj Reference to an object of this class.
+                             * @return Reference to this instance.
+                             */
+                            View& operator=(const View &/*obj*/);
+
+                        public:
+                            /**
+                             * Constructor.
+                             *
+                             * @param reader Reader to get the shared memory from.
+                             * @param si SharedImage to access.
+                             */
+                            View(SharedImageReader &reader, const SharedImage &si);
+
+                            virtual ~View();
+
+                            /**
+                             * @return true if the pixels can be accessed.
+                             */
+                            bool isValid() const;
+
+                            /**
+                             * @return Pointer to the pixels or NULL; valid until release().
+                             */
+                            const uint8_t* getData() const;
+
+                            /**
+                             * @return Number of bytes accessible by getData().
+                             */
+                            uint32_t getSize() const;
+
+                            /**
+                             * This method unlocks the shared memory; afterwards,
+                             * the view is invalid.
+                             */
+                            void release();
+
+                        private:
+                            std::shared_ptr<odcore::wrapper::SharedMemory> m_sharedMemory;
+                            uint32_t m_size;
+                    };
+
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     *
+                     * @param obj Reference to an object of this class.
+                     */
+                    SharedImageReader(const SharedImageReader &/*obj*/);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     *
+                     * @param obj Reference to an object of this class.
+                     * @return Reference to this instance.
+                     */
+                    SharedImageReader& operator=(const SharedImageReader &/*obj*/);
+
+                public:
+                    SharedImageReader();
+
+                    virtual ~SharedImageReader();
+
+                    /**
+                     * This method copies the pixels into the given buffer,
+                     * which is resized only if it is too small.
+                     *
+                     * @param si SharedImage to copy.
+                     * @param buffer Buffer to copy to.
+                     * @return true if the pixels were copied.
+                     */
+                    bool copy(const SharedImage &si, vector<uint8_t> &buffer);
+
+                    /**
+                     * This method copies the pixels row by row into the
+                     * given image, e.g. an image with padded rows.
+                     *
+                     * @param si SharedImage to copy.
+                     * @param dst Image to copy to with at least si.getHeight() rows.
+                     * @param dstStride Bytes per row in dst.
+                     * @return true if the pixels were copied.
+                     */
+                    bool copy(const SharedImage &si, uint8_t *dst, const uint32_t &dstStride);
+
+                    /**
+                     * This method removes the cached attachment for the given name.
+                     *
+                     * @param name Name of the shared memory.
+                     */
+                    void detach(const string &name);
+
+                    /**
+                     * @return Number of cached attachments.
+                     */
+                    uint32_t getNumberOfAttachments() const;
+
+                    /**
+                     * @param si SharedImage.
+                     * @return Number of bytes described by si.
+                     */
+                    static uint32_t getSize(const SharedImage &si);
+
+                private:
+                    /**
+                     * This method returns the cached attachment for the given
+                     * SharedImage, attaching on first use.
+                     *
+                     * @param si SharedImage to attach to.
+                     * @return Shared memory that holds at least getSize(si) bytes or NULL.
+                     */
+                    std::shared_ptr<odcore::wrapper::SharedMemory> getSharedMemory(const SharedImage &si);
+
+                private:
+                    map<string, std::shared_ptr<odcore::wrapper::SharedMemory> > m_mapOfSharedMemories;
+            };
+
+        }
+    }
+} // odcore::data::image
+
+#endif /*OPENDAVINCI_CORE_DATA_IMAGE_SHAREDIMAGEREADER_H_*/
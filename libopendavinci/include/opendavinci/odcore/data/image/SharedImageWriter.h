@@ -0,0 +1,130 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_DATA_IMAGE_SHAREDIMAGEWRITER_H_
+#define OPENDAVINCI_CORE_DATA_IMAGE_SHAREDIMAGEWRITER_H_
+
+#include <memory>
+#include <string>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/generated/odcore/data/image/SharedImage.h"
+
+namespace odcore { namespace wrapper { class SharedMemory; } }
+
+namespace odcore {
+    namespace data {
+        namespace image {
+
+            using namespace std;
+
+            /**
+             * This class creates the shared memory for an image and provides
+             * the SharedImage message to announce it.
+             *
+             * @code
+             * SharedImageWriter writer("camera", 640, 480, 3);
+             * ...
+             * uint8_t *pixels = writer.acquire();
+             * if (pixels != NULL) {
+             *     // Fill pixels.
+             *     writer.release();
+             * }
+             * Container c(writer.getSharedImage());
+             * getConference().send(c);
+             * @endcode
+             */
+            class OPENDAVINCI_API SharedImageWriter {
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     *
+                     * @param obj Reference to an object of this class.
+                     */
+                    SharedImageWriter(const SharedImageWriter &/*obj*/);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     *
+                     * @param obj Reference to an object of this class.
+                     * @return Reference to this instance.
+                     */
+                    SharedImageWriter& operator=(const SharedImageWriter &/*obj*/);
+
+                public:
+                    /**
+                     * Constructor.
+                     *
+                     * @param name Name of the shared memory to create.
+                     * @param width Width in pixels.
+                     * @param height Height in pixels.
+                     * @param bytesPerPixel Bytes per pixel.
+                     */
+                    SharedImageWriter(const string &name, const uint32_t &width, const uint32_t &height, const uint32_t &bytesPerPixel);
+
+                    virtual ~SharedImageWriter();
+
+                    /**
+                     * @return true if the shared memory could be created.
+                     */
+                    bool isValid() const;
+
+                    /**
+                     * This method locks the shared memory and returns the
+                     * pointer to write the pixels to until release() is called.
+                     *
+                     * @return Pointer to the pixels or NULL.
+                     */
+                    uint8_t* acquire();
+
+                    /**
+                     * This method unlocks the shared memory.
+                     */
+                    void release();
+
+                    /**
+                     * This method copies the given image row by row into
+                     * the shared memory.
+                     *
+                     * @param src Image to copy.
+                     * @param srcStride Bytes per row in src.
+                     * @return true if the pixels were copied.
+                     */
+                    bool write(const uint8_t *src, const uint32_t &srcStride);
+
+                    /**
+                     * @return SharedImage message describing the shared memory.
+                     */
+                    const SharedImage& getSharedImage() const;
+
+                private:
+                    SharedImage m_sharedImage;
+                    std::shared_ptr<odcore::wrapper::SharedMemory> m_sharedMemory;
+                    bool m_isAcquired;
+            };
+
+        }
+    }
+} // odcore::data::image
+
+#endif /*OPENDAVINCI_CORE_DATA_IMAGE_SHAREDIMAGEWRITER_H_*/
@@ -44,6 +44,9 @@ namespace odcore {
                 virtual void handleRuntimeStatistics(const odcore::data::dmcp::ModuleDescriptor &md,
                                                      const odcore::data::dmcp::RuntimeStatistic &rs) = 0;
 
+                virtual void handleCycleStatistics(const odcore::data::dmcp::ModuleDescriptor &md,
+                                                   const odcore::data::dmcp::CycleStatistics &cs) = 0;
+
                 virtual void handleConnectionLost(const odcore::data::dmcp::ModuleDescriptor &md) = 0;
 
                 virtual void handleUnkownContainer(const odcore::data::dmcp::ModuleDescriptor &md,
@@ -29,6 +29,7 @@
 #include "opendavinci/odcore/io/Connection.h"
 #include "opendavinci/odcore/io/ConnectionErrorListener.h"
 #include "opendavinci/odcore/io/conference/ContainerListener.h"
+#include "opendavinci/generated/odcore/data/dmcp/CycleStatistics.h"
 #include "opendavinci/generated/odcore/data/dmcp/ModuleDescriptor.h"
 #include "opendavinci/generated/odcore/data/dmcp/ModuleExitCodeMessage.h"
 #include "opendavinci/generated/odcore/data/dmcp/ModuleStateMessage.h"
@@ -76,6 +77,14 @@ namespace odcore {
                     void sendModuleState(const odcore::data::dmcp::ModuleStateMessage::ModuleState &me);
                     void sendStatistics(const odcore::data::dmcp::RuntimeStatistic &rs);
 
+                    /**
+                     * This method sends the statistics about the execution
+                     * cycles of this component to supercomponent.
+                     *
+                     * @param cs Cycle statistics.
+                     */
+                    void sendCycleStatistics(const odcore::data::dmcp::CycleStatistics &cs);
+
                     odcore::base::KeyValueConfiguration getConfiguration();
 
                     const odcore::data::dmcp::PulseMessage getPulseMessage();
@@ -93,6 +102,16 @@ namespace odcore {
                      */
                     void sendPulseAckContainers(const vector<odcore::data::Container> &listOfContainers);
 
+                    /**
+                     * This method sends the list of data types that this
+                     * component consumes to supercomponent. In ML_SIMULATION,
+                     * supercomponent embeds only containers of these data
+                     * types into the pulses for this component.
+                     *
+                     * @param listOfDataTypes Data types to be received; an empty list means all data types.
+                     */
+                    void sendSubscribedDataTypes(const vector<int32_t> &listOfDataTypes);
+
                     void setSupercomponentStateListener(SupercomponentStateListener* listener);
 
                     bool isConnected();
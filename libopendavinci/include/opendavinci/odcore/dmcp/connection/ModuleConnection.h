@@ -100,6 +100,25 @@ namespace odcore {
                      */
                     vector<odcore::data::Container> pulse_ack_containers(const odcore::data::dmcp::PulseMessage &pm, const uint32_t &timeout);
 
+                    /**
+                     * This method sends an already serialized pulse to the
+                     * connected module. Thus, modules with the same subscribed
+                     * data types can share one serialized pulse.
+                     *
+                     * @param pulse Container with the PulseMessage to be sent.
+                     * @param timeout Timeout in milliseconds to wait for the ACK message.
+                     * @return Containers to be transferred to supercomponent.
+                     */
+                    vector<odcore::data::Container> pulse_ack_containers(odcore::data::Container &pulse, const uint32_t &timeout);
+
+                    /**
+                     * This method returns the data types that the connected
+                     * module consumes.
+                     *
+                     * @return Sorted list of subscribed data types; an empty list means all data types.
+                     */
+                    vector<int32_t> getListOfSubscribedDataTypes() const;
+
                     const odcore::data::dmcp::ModuleDescriptor getModuleDescriptor() const;
 
                 protected:
@@ -126,6 +145,9 @@ namespace odcore {
                     odcore::base::Mutex m_stateListenerMutex;
 
                     vector<odcore::data::Container> m_containersToBeTransferredToSupercomponent;
+
+                    mutable odcore::base::Mutex m_subscribedDataTypesMutex;
+                    vector<int32_t> m_listOfSubscribedDataTypes;
             };
         }
     }
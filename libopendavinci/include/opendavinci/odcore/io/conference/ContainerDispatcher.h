@@ -0,0 +1,213 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_IO_CONFERENCE_CONTAINERDISPATCHER_H_
+#define OPENDAVINCI_CORE_IO_CONFERENCE_CONTAINERDISPATCHER_H_
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Condition.h"
+#include "opendavinci/odcore/base/Service.h"
+#include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/odcore/io/conference/ContainerListener.h"
+
+namespace odcore {
+    namespace io {
+        namespace conference {
+
+            using namespace std;
+
+            /**
+             * This class decouples the thread receiving containers from the
+             * thread processing them: Received containers are entered into
+             * a bounded queue that drops the oldest container when it is
+             * full. Without workers, the queued containers are delivered to
+             * the given ContainerListener by the thread calling dispatchFor();
+             * with workers, every data type is assigned to one worker thread
+             * (thread role "worker") so that different data types are
+             * processed in parallel while the containers of one data type
+             * are delivered in the order of their reception.
+             *
+             * @code
+             * ContainerDispatcher cd(myListener, 1024, 0);
+             * conference->setContainerListener(&cd);
+             *
+             * while (running) {
+             *     // Deliver containers for at most 100ms.
+             *     cd.dispatchFor(100 * 1000);
+             * }
+             * conference->setContainerListener(NULL);
+             * @endcode
+             */
+            class OPENDAVINCI_API ContainerDispatcher : public ContainerListener {
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     */
+                    ContainerDispatcher(const ContainerDispatcher &);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     */
+                    ContainerDispatcher& operator=(const ContainerDispatcher &);
+
+                public:
+                    /**
+                     * Constructor.
+                     *
+                     * @param listener ContainerListener to deliver the containers to.
+                     * @param capacity Maximum number of queued containers per queue.
+                     * @param numberOfWorkers Number of worker threads (0 = deliver by the thread calling dispatchFor()).
+                     */
+                    ContainerDispatcher(ContainerListener &listener, const uint32_t &capacity, const uint32_t &numberOfWorkers);
+
+                    virtual ~ContainerDispatcher();
+
+                    /**
+                     * This method enters the given container into the
+                     * queue; it is called by the receiving thread.
+                     *
+                     * @param c Container.
+                     */
+                    virtual void nextContainer(odcore::data::Container &c);
+
+                    /**
+                     * This method starts the worker threads.
+                     */
+                    void start();
+
+                    /**
+                     * This method stops the worker threads; containers
+                     * that are still queued for them are discarded.
+                     */
+                    void stop();
+
+                    /**
+                     * This method suspends the calling thread until the
+                     * given time has elapsed or wakeUp() has been called
+                     * and delivers all containers queued meanwhile to the
+                     * ContainerListener. Containers that are already queued
+                     * are delivered also for a timeout of 0.
+                     *
+                     * @param timeoutInMicroseconds Maximum time to wait.
+                     */
+                    void dispatchFor(const int64_t &timeoutInMicroseconds);
+
+                    /**
+                     * This method lets a currently waiting dispatchFor() return.
+                     */
+                    void wakeUp();
+
+                    /**
+                     * @return Number of containers that have been dropped as a queue was full.
+                     */
+                    uint32_t getNumberOfDroppedContainers() const;
+
+                private:
+                    /**
+                     * Bounded queue of containers.
+                     */
+                    class Queue {
+                        private:
+                            Queue(const Queue &);
+                            Queue& operator=(const Queue &);
+
+                        public:
+                            Queue(const uint32_t &capacity);
+
+                            /**
+                             * This method enters a container and drops the
+                             * oldest one if the queue is full.
+                             *
+                             * @param c Container.
+                             */
+                            void enter(const odcore::data::Container &c);
+
+                            /**
+                             * This method waits for containers and moves all
+                             * queued containers to the given list.
+                             *
+                             * @param containers List to receive the queued containers.
+                             * @param timeoutInMicroseconds Maximum time to wait if the queue is empty.
+                             * @return true if wakeUp() has been called.
+                             */
+                            bool leave(deque<odcore::data::Container> &containers, const int64_t &timeoutInMicroseconds);
+
+                            void wakeUp();
+
+                            uint32_t getNumberOfDroppedContainers() const;
+
+                        private:
+                            mutable odcore::base::Condition m_queueCondition;
+                            uint32_t m_capacity;
+                            deque<odcore::data::Container> m_containers;
+                            uint32_t m_numberOfDroppedContainers;
+                            bool m_wakeUp;
+                    };
+
+                    /**
+                     * Worker thread delivering the containers of the data
+                     * types assigned to it.
+                     */
+                    class Worker : public odcore::base::Service {
+                        private:
+                            Worker(const Worker &);
+                            Worker& operator=(const Worker &);
+
+                        public:
+                            Worker(ContainerListener &listener, const uint32_t &capacity);
+
+                            virtual ~Worker();
+
+                            void enter(const odcore::data::Container &c);
+
+                            uint32_t getNumberOfDroppedContainers() const;
+
+                        protected:
+                            virtual void beforeStop();
+
+                            virtual void run();
+
+                        private:
+                            ContainerListener &m_listener;
+                            Queue m_queue;
+                    };
+
+                private:
+                    ContainerListener &m_listener;
+                    Queue m_queue;
+                    vector<std::shared_ptr<Worker> > m_workers;
+                    bool m_workersRunning;
+
+                    // Only accessed by the thread calling dispatchFor().
+                    deque<odcore::data::Container> m_containersToDispatch;
+            };
+
+        }
+    }
+} // odcore::io::conference
+
+#endif /*OPENDAVINCI_CORE_IO_CONFERENCE_CONTAINERDISPATCHER_H_*/
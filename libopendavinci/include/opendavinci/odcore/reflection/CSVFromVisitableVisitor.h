@@ -21,11 +21,11 @@
 #define OPENDAVINCI_CORE_REFLECTION_CSVFROMVISITABLEVISITOR_H_
 
 #include <ostream>
-#include <sstream>
 #include <string>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/base/Visitor.h"
+#include "opendavinci/odcore/reflection/ExportBuffer.h"
 
 namespace odcore { namespace serialization { class Serializable; } }
 
@@ -36,6 +36,9 @@ namespace odcore {
 
         /**
          * This class transforms a Visitable into a character separated output.
+         * The values are formatted into reused buffers and every entry is
+         * written to the output with one call. The output is flushed after
+         * every entry so that it can be followed while it is written.
          */
         class CSVFromVisitableVisitor : public odcore::base::Visitor {
             private:
@@ -89,8 +92,8 @@ namespace odcore {
 
             private:
                 ostream &m_buffer;
-                stringstream m_header;
-                stringstream m_entry;
+                ExportBuffer m_header;
+                ExportBuffer m_entry;
                 bool m_addHeader;
                 char m_delimiter;
         };
@@ -0,0 +1,136 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_REFLECTION_EXPORTBUFFER_H_
+#define OPENDAVINCI_CORE_REFLECTION_EXPORTBUFFER_H_
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+namespace odcore {
+    namespace reflection {
+
+        using namespace std;
+
+        /**
+         * This class is a growing character buffer for exporting values as
+         * text. Numbers are formatted exactly as an ostream with default
+         * settings would print them but without creating a stream or locale
+         * lookups per value; once the buffer is large enough, appending does
+         * not allocate memory.
+         */
+        class OPENDAVINCI_API ExportBuffer {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                ExportBuffer(const ExportBuffer &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                ExportBuffer& operator=(const ExportBuffer &);
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param capacity Initially reserved capacity.
+                 */
+                ExportBuffer(const uint32_t &capacity = 4096);
+
+                virtual ~ExportBuffer();
+
+                void appendChar(const char &c);
+
+                void appendString(const char *s, const uint32_t &length);
+
+                void appendString(const string &s);
+
+                /**
+                 * This method appends the given string for JSON, i.e.
+                 * quoted and with escaped special characters.
+                 *
+                 * @param s String to append.
+                 */
+                void appendQuotedString(const string &s);
+
+                void appendInteger(const int64_t &v);
+
+                void appendUnsignedInteger(const uint64_t &v);
+
+                /**
+                 * This method appends the given value like printf's %g
+                 * conversion with six significant digits, i.e. the default
+                 * format of ostream.
+                 *
+                 * @param v Value to append.
+                 */
+                void appendDouble(const double &v);
+
+                /**
+                 * This method appends the content of the given buffer.
+                 *
+                 * @param b Buffer to append.
+                 */
+                void appendBuffer(const ExportBuffer &b);
+
+                /**
+                 * @return Number of characters in the buffer.
+                 */
+                uint32_t getSize() const;
+
+                /**
+                 * @return true if the buffer does not contain any characters.
+                 */
+                bool isEmpty() const;
+
+                /**
+                 * @return Buffer's content.
+                 */
+                string toString() const;
+
+                /**
+                 * This method removes all characters but keeps the capacity.
+                 */
+                void clear();
+
+                /**
+                 * This method writes the content to the given stream and
+                 * clears the buffer.
+                 *
+                 * @param out Stream to write to.
+                 */
+                void writeTo(ostream &out);
+
+            private:
+                vector<char> m_buffer;
+        };
+
+    }
+} // odcore::reflection
+
+#endif /*OPENDAVINCI_CORE_REFLECTION_EXPORTBUFFER_H_*/
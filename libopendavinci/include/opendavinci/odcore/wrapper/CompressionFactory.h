@@ -22,6 +22,7 @@
 
 #include "opendavinci/odcore/opendavinci.h"
 #include <memory>
+#include <string>
 
 namespace odcore {
     namespace wrapper {
@@ -45,10 +46,19 @@ class DecompressedData;
          * }
          * @endcode
          *
+         * If the compressed data is available as file, it should be
+         * passed by its name to avoid copying it into memory:
+         *
+         * @code
+         * std::shared_ptr<DecompressedData> dd = CompressionFactory::getContents("zip-file");
+         * @endcode
+         *
          * @See CompressionFactoryWorker
          */
         struct OPENDAVINCI_API CompressionFactory {
             static std::shared_ptr<DecompressedData> getContents(istream &in);
+
+            static std::shared_ptr<DecompressedData> getContents(const string &fileName);
         };
 
     }
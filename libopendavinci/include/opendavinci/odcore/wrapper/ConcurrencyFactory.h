@@ -20,13 +20,22 @@
 #ifndef OPENDAVINCI_CORE_WRAPPER_CONCURRENCYFACTORY_H_
 #define OPENDAVINCI_CORE_WRAPPER_CONCURRENCYFACTORY_H_
 
+#include <map>
+#include <string>
+
 #include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/wrapper/ThreadConfiguration.h"
 
 namespace odcore {
     namespace wrapper {
 
+class Mutex;
 class Runnable;
 class Thread;
+namespace POSIX { class POSIXThread; }
+namespace WIN32Impl { class WIN32Thread; }
+
+        using namespace std;
 
         /**
          * Abstract factory for creating wrapped threads based on pthread or C++11.
@@ -42,6 +51,64 @@ class Thread;
              */
             static Thread* createThread(Runnable &runnable);
 
+            /**
+             * This method creates a new thread for a given Runnable object
+             * that is configured with the given ThreadConfiguration before
+             * the Runnable is executed.
+             *
+             * @param runnable The Runnable that should be threadified.
+             * @param threadConfiguration Configuration for the new thread.
+             * @return Thread based on the type of instance this factory is.
+             */
+            static Thread* createThread(Runnable &runnable, const ThreadConfiguration &threadConfiguration);
+
+            /**
+             * This method creates a new thread for a given Runnable object
+             * that is configured with the ThreadConfiguration registered
+             * for the given role.
+             *
+             * @param runnable The Runnable that should be threadified.
+             * @param role Role of the new thread like "receiver".
+             * @return Thread based on the type of instance this factory is.
+             */
+            static Thread* createThread(Runnable &runnable, const string &role);
+
+            /**
+             * This method registers a ThreadConfiguration for the given
+             * role. It is applied to all threads that were created for
+             * this role and are still existing, and to all threads that
+             * are created for this role afterwards.
+             *
+             * @param role Role of the threads.
+             * @param threadConfiguration Configuration for these threads.
+             * @return true, iff the configuration could be applied to all existing threads.
+             */
+            static bool setThreadConfiguration(const string &role, const ThreadConfiguration &threadConfiguration);
+
+            /**
+             * @param role Role of the threads.
+             * @return ThreadConfiguration registered for the given role or a default one.
+             */
+            static ThreadConfiguration getThreadConfiguration(const string &role);
+
+            /**
+             * This method applies the given configuration to the calling thread.
+             *
+             * @param threadConfiguration Configuration to apply.
+             * @return true if all settings could be applied.
+             */
+            static bool configureCurrentThread(const ThreadConfiguration &threadConfiguration);
+
+            /**
+             * This method locks all current and future pages of this
+             * process into memory to avoid page faults in time critical
+             * code and maps the given amount of heap memory in advance.
+             *
+             * @param prefaultHeapInBytes Number of bytes to pre-fault on the heap.
+             * @return true if the memory could be locked.
+             */
+            static bool lockMemory(const uint32_t &prefaultHeapInBytes);
+
             /**
              * This method causes the calling to sleep for the specified
              * amount of time.
@@ -58,6 +125,24 @@ class Thread;
              * @param partialMicroseconds Partial microseconds.
              */
             static void usleepUntil(const long &seconds, const long &partialMicroseconds);
+
+            private:
+                friend class POSIX::POSIXThread;
+                friend class WIN32Impl::WIN32Thread;
+
+                /**
+                 * This method is called when a thread is destroyed
+                 * to remove it from the threads with a role.
+                 *
+                 * @param thread Thread to be removed.
+                 */
+                static void removeThread(Thread *thread);
+
+                static Mutex& getThreadConfigurationsMutex();
+
+                static map<string, ThreadConfiguration>& getThreadConfigurations();
+
+                static multimap<string, Thread*>& getThreadsWithRole();
         };
 
     }
@@ -25,6 +25,7 @@
 #include "opendavinci/odcore/wrapper/Runnable.h"
 #include "opendavinci/odcore/wrapper/Thread.h"
 #include "opendavinci/odcore/wrapper/SystemLibraryProducts.h"
+#include "opendavinci/odcore/wrapper/ThreadConfiguration.h"
 
 namespace odcore {
     namespace wrapper {
@@ -49,6 +50,33 @@ namespace odcore {
                  */
                 static Thread* createThread(Runnable &runnable);
 
+                /**
+                 * This method creates a new thread for a given Runnable object
+                 * that is configured before the Runnable is executed.
+                 *
+                 * @param runnable The Runnable that should be threadified.
+                 * @param threadConfiguration Configuration for the new thread.
+                 * @return Thread based on the type of instance this factory is.
+                 */
+                static Thread* createThread(Runnable &runnable, const ThreadConfiguration &threadConfiguration);
+
+                /**
+                 * This method applies the given configuration to the calling thread.
+                 *
+                 * @param threadConfiguration Configuration to apply.
+                 * @return true if all settings could be applied.
+                 */
+                static bool configureCurrentThread(const ThreadConfiguration &threadConfiguration);
+
+                /**
+                 * This method locks all current and future pages of this
+                 * process into memory and pre-faults the heap.
+                 *
+                 * @param prefaultHeapInBytes Number of bytes to pre-fault on the heap.
+                 * @return true if the memory could be locked.
+                 */
+                static bool lockMemory(const uint32_t &prefaultHeapInBytes);
+
                 /**
                  * This method causes the calling to sleep for the specified
                  * amount of time.
@@ -20,7 +20,15 @@
 #ifndef OPENDAVINCI_CORE_WRAPPER_POSIX_POSIXCONCURRENCYFACTORYWORKER_H_
 #define OPENDAVINCI_CORE_WRAPPER_POSIX_POSIXCONCURRENCYFACTORYWORKER_H_
 
+#include <pthread.h>
+#include <sys/mman.h>
 #include <sys/time.h>
+#include <unistd.h>
+#include <cstdlib>
+
+#ifdef __GLIBC__
+    #include <malloc.h>
+#endif
 
 #include "opendavinci/odcore/opendavinci.h"
 
@@ -40,6 +48,42 @@ namespace odcore {
                     return new odcore::wrapper::POSIX::POSIXThread(runnable);
                 };
 
+                static Thread* createThread(Runnable &runnable, const ThreadConfiguration &threadConfiguration) {
+                    return new odcore::wrapper::POSIX::POSIXThread(runnable, threadConfiguration);
+                };
+
+                static bool configureCurrentThread(const ThreadConfiguration &threadConfiguration) {
+                    return odcore::wrapper::POSIX::POSIXThread::applyThreadConfiguration(pthread_self(), threadConfiguration);
+                };
+
+                static bool lockMemory(const uint32_t &prefaultHeapInBytes) {
+#ifdef __GLIBC__
+                    // Keep freed memory in the heap instead of returning it to the
+                    // operating system and do not serve allocations by mmap so
+                    // that the pre-faulted pages are reused.
+                    mallopt(M_TRIM_THRESHOLD, -1);
+                    mallopt(M_MMAP_MAX, 0);
+#endif
+                    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+                        return false;
+                    }
+
+                    if (prefaultHeapInBytes > 0) {
+                        volatile char *heap = static_cast<char*>(malloc(prefaultHeapInBytes));
+                        if (heap != NULL) {
+                            // Touch every page once to map it.
+                            const long SIZE_OF_PAGE = sysconf(_SC_PAGESIZE);
+                            const uint32_t STEP = (SIZE_OF_PAGE > 0) ? static_cast<uint32_t>(SIZE_OF_PAGE) : 4096;
+                            for (uint32_t i = 0; i < prefaultHeapInBytes; i += STEP) {
+                                heap[i] = 0;
+                            }
+                            free(const_cast<char*>(heap));
+                        }
+                    }
+
+                    return true;
+                };
+
                 static void usleepFor(const long &microseconds) {
                     struct timespec delay;
 
@@ -25,6 +25,7 @@
 
 #include "opendavinci/odcore/wrapper/SystemLibraryProducts.h"
 #include "opendavinci/odcore/wrapper/Thread.h"
+#include "opendavinci/odcore/wrapper/ThreadConfiguration.h"
 
 namespace odcore { namespace wrapper { class Mutex; } }
 namespace odcore { namespace wrapper { class Runnable; } }
@@ -36,6 +37,11 @@ namespace odcore {
 
             using namespace std;
 
+            /**
+             * This method encapsulates the runnable.
+             */
+            void *threadRunner(void *v);
+
             /**
              * This class is an implementation of the thread interface
              * using pthread.
@@ -45,6 +51,7 @@ namespace odcore {
             class POSIXThread : public Thread {
                 private:
                 friend class ConcurrencyFactoryWorker<SystemLibraryPosix>;
+                friend void *threadRunner(void *v);
 
                     /**
                      * Constructor.
@@ -53,6 +60,14 @@ namespace odcore {
                      */
                     POSIXThread(Runnable &r);
 
+                    /**
+                     * Constructor.
+                     *
+                     * @param r Runnable to be threadified.
+                     * @param tc Configuration to be applied before r is run.
+                     */
+                    POSIXThread(Runnable &r, const ThreadConfiguration &tc);
+
                 private:
                     enum THREAD_STATE {
                         INITIALIZED,
@@ -84,11 +99,24 @@ namespace odcore {
 
                     virtual bool isRunning() const;
 
+                    virtual bool configure(const ThreadConfiguration &threadConfiguration);
+
+                private:
+                    /**
+                     * This method applies the given configuration to the given thread.
+                     *
+                     * @param thread Thread to configure.
+                     * @param threadConfiguration Configuration to apply.
+                     * @return true, iff all settings could be applied.
+                     */
+                    static bool applyThreadConfiguration(const pthread_t &thread, const ThreadConfiguration &threadConfiguration);
+
                 private:
                     unique_ptr<Mutex> m_threadStateMutex;
                     THREAD_STATE m_threadState;
 
                     Runnable &m_runnable;
+                    ThreadConfiguration m_threadConfiguration;
 
                     pthread_t m_threadWrapper;
             };
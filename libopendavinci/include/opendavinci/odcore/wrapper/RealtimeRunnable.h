@@ -20,12 +20,17 @@
 #ifndef OPENDAVINCI_CORE_WRAPPER_REALTIMERUNNABLE_H_
 #define OPENDAVINCI_CORE_WRAPPER_REALTIMERUNNABLE_H_
 
+#include <memory>
+
 #include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/CycleProfile.h"
 #include "opendavinci/odcore/wrapper/Runnable.h"
 
 namespace odcore {
     namespace wrapper {
 
+class Mutex;
+
         using namespace std;
 
         /**
@@ -33,6 +38,10 @@ namespace odcore {
          * periodic tasks. Only a POSIX implementation for Linux
          * with rt-preempt is available at the moment.
          *
+         * If the executing thread was already configured with a realtime
+         * scheduling policy (cf. ThreadConfiguration), its policy and
+         * priority are kept; otherwise, SCHED_FIFO is used.
+         *
          * It can be used as follows:
          *
          * @code
@@ -113,9 +122,30 @@ namespace odcore {
             public:
                 virtual ~RealtimeRunnable();
 
+                /**
+                 * This method returns the execution times of the time
+                 * slices and the deviations of their starts from their
+                 * scheduled starts so far.
+                 *
+                 * @return Cycle profile.
+                 */
+                odcore::base::CycleProfile getCycleProfile() const;
+
+                /**
+                 * This method returns the cycle profile like getCycleProfile()
+                 * and starts a new one; thus, the caller can report the
+                 * time slices periodically.
+                 *
+                 * @return Cycle profile since the last call.
+                 */
+                odcore::base::CycleProfile getAndResetCycleProfile();
+
             private:
                 uint32_t m_periodInMicroseconds;
 
+                unique_ptr<Mutex> m_cycleProfileMutex;
+                odcore::base::CycleProfile m_cycleProfile;
+
                 virtual void run();
         };
 
@@ -66,7 +66,7 @@ namespace odcore {
 
                 protected:
                     unique_ptr<Mutex> m_mutex;
-                    mutable map<int, string> m_entries;
+                    map<int, string> m_entries;
             };
 
         }
@@ -23,6 +23,8 @@
 namespace odcore {
     namespace wrapper {
 
+class ThreadConfiguration;
+
         /**
          * This class controls a thread. It can be used
          * to start different types of Runnables.
@@ -96,6 +98,16 @@ namespace odcore {
                  * @return true, iff the thread is running.
                  */
                 virtual bool isRunning() const = 0;
+
+                /**
+                 * This method applies the given configuration to this
+                 * thread. If the thread is not started yet, the
+                 * configuration is applied when it is started.
+                 *
+                 * @param threadConfiguration Configuration to apply.
+                 * @return true, iff all settings could be applied.
+                 */
+                virtual bool configure(const ThreadConfiguration &threadConfiguration) = 0;
         };
 
     }
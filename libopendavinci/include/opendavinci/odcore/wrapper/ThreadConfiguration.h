@@ -0,0 +1,132 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_WRAPPER_THREADCONFIGURATION_H_
+#define OPENDAVINCI_CORE_WRAPPER_THREADCONFIGURATION_H_
+
+#include <string>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+namespace odcore {
+    namespace wrapper {
+
+        using namespace std;
+
+        /**
+         * This class describes how a thread shall be scheduled: The CPU
+         * cores it may run on, its scheduling policy, and its priority.
+         * A default constructed ThreadConfiguration leaves the thread
+         * as it was created by the operating system.
+         *
+         * Configurations can be registered for a thread role like
+         * "body", "receiver", "recorder", or "realtime" at the
+         * ConcurrencyFactory; threads created for that role are
+         * configured before their Runnable is executed.
+         *
+         * @See ConcurrencyFactory
+         */
+        class OPENDAVINCI_API ThreadConfiguration {
+            public:
+                enum {
+                    MAXIMUM_NUMBER_OF_CPUS = 1024
+                };
+
+                enum SCHEDULINGPOLICY {
+                    INHERIT,     // Do not change the scheduling policy.
+                    OTHER,       // SCHED_OTHER
+                    FIFO,        // SCHED_FIFO
+                    ROUND_ROBIN  // SCHED_RR
+                };
+
+            public:
+                ThreadConfiguration();
+
+                /**
+                 * Copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                ThreadConfiguration(const ThreadConfiguration &obj);
+
+                /**
+                 * Assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                ThreadConfiguration& operator=(const ThreadConfiguration &obj);
+
+                virtual ~ThreadConfiguration();
+
+                /**
+                 * @return true if this configuration does not change anything.
+                 */
+                bool isDefault() const;
+
+                /**
+                 * @return CPU cores the thread is allowed to run on (empty = all).
+                 */
+                const vector<uint32_t> getCPUs() const;
+
+                /**
+                 * @param cpus CPU cores the thread is allowed to run on (empty = all).
+                 */
+                void setCPUs(const vector<uint32_t> &cpus);
+
+                SCHEDULINGPOLICY getSchedulingPolicy() const;
+
+                void setSchedulingPolicy(const SCHEDULINGPOLICY &policy);
+
+                /**
+                 * @return Priority for FIFO and ROUND_ROBIN in range [1, 99].
+                 */
+                uint32_t getPriority() const;
+
+                void setPriority(const uint32_t &priority);
+
+                const string toString() const;
+
+                /**
+                 * This method parses a list of CPU cores like "1,3-5".
+                 *
+                 * @param cpus List of CPU cores.
+                 * @return Parsed CPU cores; invalid entries and cores beyond MAXIMUM_NUMBER_OF_CPUS are skipped.
+                 */
+                static vector<uint32_t> parseCPUs(const string &cpus);
+
+                /**
+                 * This method parses "other", "fifo", or "rr".
+                 *
+                 * @param policy Name of the scheduling policy.
+                 * @return Scheduling policy or INHERIT if unknown.
+                 */
+                static SCHEDULINGPOLICY parseSchedulingPolicy(const string &policy);
+
+            private:
+                vector<uint32_t> m_cpus;
+                SCHEDULINGPOLICY m_schedulingPolicy;
+                uint32_t m_priority;
+        };
+
+    }
+} // odcore::wrapper
+
+#endif /*OPENDAVINCI_CORE_WRAPPER_THREADCONFIGURATION_H_*/
@@ -42,6 +42,20 @@ namespace odcore {
                     return new odcore::wrapper::WIN32Impl::WIN32Thread(runnable);
                 };
 
+                static Thread* createThread(Runnable &runnable, const ThreadConfiguration &threadConfiguration) {
+                    return new odcore::wrapper::WIN32Impl::WIN32Thread(runnable, threadConfiguration);
+                };
+
+                static bool configureCurrentThread(const ThreadConfiguration &threadConfiguration) {
+                    // CPU affinity and scheduling policies are not supported by C++11 threads.
+                    return threadConfiguration.isDefault();
+                };
+
+                static bool lockMemory(const uint32_t &/*prefaultHeapInBytes*/) {
+                    // Memory locking is not supported on this platform.
+                    return false;
+                };
+
                 static void usleepFor(const long &microseconds) {
                     std::this_thread::sleep_until(std::chrono::steady_clock::now() + std::chrono::microseconds(microseconds));
                 };
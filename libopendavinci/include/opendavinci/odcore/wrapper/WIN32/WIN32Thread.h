@@ -30,6 +30,7 @@
 #include "opendavinci/odcore/wrapper/Mutex.h"
 #include "opendavinci/odcore/wrapper/Runnable.h"
 #include "opendavinci/odcore/wrapper/Thread.h"
+#include "opendavinci/odcore/wrapper/ThreadConfiguration.h"
 #include "opendavinci/odcore/wrapper/SystemLibraryProducts.h"
 #include "opendavinci/odcore/wrapper/ConcurrencyFactoryWorker.h"
 
@@ -39,6 +40,11 @@ namespace odcore {
 
             using namespace std;
 
+            /**
+             * This method encapsulates the runnable.
+             */
+            void *threadRunner(void *v);
+
             /**
              * This class is an implementation of the thread interface
              * using pthread.
@@ -48,6 +54,7 @@ namespace odcore {
             class WIN32Thread : public Thread {
                 private:
                 friend class ConcurrencyFactoryWorker<SystemLibraryWin32>;
+                friend void *threadRunner(void *v);
 
                     /**
                      * Constructor.
@@ -56,6 +63,14 @@ namespace odcore {
                      */
                     WIN32Thread(Runnable &r);
 
+                    /**
+                     * Constructor.
+                     *
+                     * @param r Runnable to be threadified.
+                     * @param tc Configuration to be applied before r is run.
+                     */
+                    WIN32Thread(Runnable &r, const ThreadConfiguration &tc);
+
                 private:
                     enum THREAD_STATE {
                         INITIALIZED,
@@ -87,11 +102,14 @@ namespace odcore {
 
                     virtual bool isRunning() const;
 
+                    virtual bool configure(const ThreadConfiguration &threadConfiguration);
+
                 private:
                     unique_ptr<Mutex> m_threadStateMutex;
                     THREAD_STATE m_threadState;
 
                     Runnable &m_runnable;
+                    ThreadConfiguration m_threadConfiguration;
 
                     std::thread m_theThread;
             };
@@ -21,11 +21,14 @@
 #define OPENDAVINCI_CORE_WRAPPER_ZIP_ZIPDECOMPRESSEDDATA_H_
 
 #include <iosfwd>
+#include <list>
 #include <map>
 #include <string>
 #include <vector>
 
 #include <memory>
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Mutex.h"
 #include "opendavinci/odcore/strings/StringComparator.h"
 #include "opendavinci/odcore/wrapper/CompressionLibraryProducts.h"
 #include "opendavinci/odcore/wrapper/DecompressedData.h"
@@ -38,16 +41,28 @@ namespace odcore {
 
             using namespace std;
 
+            class ZipArchiveMemory;
+
             /**
              * This class implements an abstract object containing
              * the decompressed contents of a compressed archive.
              *
+             * The archive is kept in memory (or memory-mapped when
+             * created from a file) and only its central directory is
+             * read during construction. An entry is decompressed when
+             * its input stream is requested: Stored entries are read
+             * directly from the archive, small entries are inflated
+             * once and kept in an LRU cache bounded by MAXIMUM_CACHE_SIZE,
+             * and entries larger than the cache are inflated while
+             * being read.
+             *
              * @See DecompressedData.
              */
             class ZipDecompressedData : public DecompressedData {
                 private:
                     enum {
-                        BUFFER_SIZE = 1024
+                        BUFFER_SIZE = 16384,
+                        MAXIMUM_CACHE_SIZE = 64 * 1024 * 1024
                     };
 
                 private:
@@ -60,6 +75,13 @@ namespace odcore {
                      */
                     ZipDecompressedData(istream &in);
 
+                    /**
+                     * Constructor.
+                     *
+                     * @param fileName File to be memory-mapped for reading the contents.
+                     */
+                    ZipDecompressedData(const string &fileName);
+
                 private:
                     /**
                      * "Forbidden" copy constructor. Goal: The compiler should warn
@@ -83,15 +105,75 @@ namespace odcore {
                     virtual std::shared_ptr<istream> getInputStreamFor(const string &entry);
 
                 private:
-                    map<string, std::shared_ptr<istream>, odcore::strings::StringComparator> m_mapOfDecompressedEntries;
+                    /**
+                     * This class describes an entry from the central directory.
+                     */
+                    class Entry {
+                        public:
+                            Entry();
+
+                        public:
+                            uint16_t m_compressionMethod;
+                            uint32_t m_crc32;
+                            uint32_t m_compressedSize;
+                            uint32_t m_uncompressedSize;
+                            uint32_t m_localHeaderOffset;
+                    };
+
+                    /**
+                     * This class describes a decompressed entry in the cache.
+                     */
+                    class CachedEntry {
+                        public:
+                            CachedEntry();
+
+                        public:
+                            std::shared_ptr<string> m_data;
+                            list<string>::iterator m_positionInLRU;
+                    };
 
+                private:
                     /**
-                     * This method tries to decompress the given archive and
-                     * read the complete content into memory.
+                     * This method reads the central directory of the archive.
+                     */
+                    void readCentralDirectory();
+
+                    /**
+                     * This method returns the position of the entry's data in the archive.
                      *
-                     * @param in Stream to be used for reading the contents.
+                     * @param entry Entry.
+                     * @return Pointer to the first byte of the entry's data or NULL.
+                     */
+                    const char* getDataFor(const Entry &entry) const;
+
+                    /**
+                     * This method inflates the given entry completely.
+                     *
+                     * @param entry Entry.
+                     * @param data Pointer to the entry's data.
+                     * @return Decompressed data or NULL in case of an error.
                      */
-                    void decompressData(istream &in);
+                    std::shared_ptr<string> inflateEntry(const Entry &entry, const char *data) const;
+
+                    /**
+                     * This method returns the decompressed data for the given
+                     * entry from the cache or decompresses and caches it.
+                     *
+                     * @param name Name of the entry.
+                     * @param entry Entry.
+                     * @param data Pointer to the entry's data.
+                     * @return Decompressed data or NULL in case of an error.
+                     */
+                    std::shared_ptr<string> getCachedEntry(const string &name, const Entry &entry, const char *data);
+
+                private:
+                    std::shared_ptr<ZipArchiveMemory> m_archive;
+                    map<string, Entry, odcore::strings::StringComparator> m_mapOfEntries;
+
+                    odcore::base::Mutex m_cacheMutex;
+                    map<string, CachedEntry, odcore::strings::StringComparator> m_cache;
+                    list<string> m_listOfRecentlyUsedEntries;
+                    uint32_t m_cacheSize;
             };
 
         }
@@ -48,10 +48,13 @@ namespace odtools {
                  * be encoded into a different format). To indicate
                  * in the original .rec data stream that the original Container
                  * has been replaced, a placeholder Container is expected
-                 * that is written to the .rec file instead of c.
+                 * that is written to the .rec file instead of c. A delegate
+                 * that produces the placeholder asynchronously returns an empty
+                 * Container and enters the placeholder into the Recorder's
+                 * FIFOQueue later.
                  *
                  * @param c Container to be stored externally.
-                 * @return Container that is written instead of c into the .rec file.
+                 * @return Container that is written instead of c into the .rec file or an empty Container.
                  */
                 virtual odcore::data::Container process(odcore::data::Container &c) = 0;
         };
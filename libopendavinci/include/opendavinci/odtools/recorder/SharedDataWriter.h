@@ -37,6 +37,7 @@ namespace odtools {
 
         /**
          * This class writes the FIFO of MemorySegments to an outstream.
+         * Its thread is created for the thread role "recorder".
          */
         class SharedDataWriter : public odcore::base::Service {
             private:
@@ -27,7 +27,7 @@ namespace odcontext {
         using namespace odcore::base;
 
         BlockableContainerListener::BlockableContainerListener() :
-            m_nextContainerAllowedMutex(),
+            m_nextContainerAllowedCondition(),
             m_nextContainerAllowed(false) {}
 
         BlockableContainerListener::~BlockableContainerListener() {
@@ -37,19 +37,29 @@ namespace odcontext {
 
         void BlockableContainerListener::setNextContainerAllowed(const bool &allowed) {
             {
-                Lock l(m_nextContainerAllowedMutex);
+                Lock l(m_nextContainerAllowedCondition);
                 m_nextContainerAllowed = allowed;
+                if (m_nextContainerAllowed) {
+                    m_nextContainerAllowedCondition.wakeAll();
+                }
             }
         }
 
         bool BlockableContainerListener::isNextContainerAllowed() const {
             bool retVal = false;
             {
-                Lock l(m_nextContainerAllowedMutex);
+                Lock l(m_nextContainerAllowedCondition);
                 retVal = m_nextContainerAllowed;
             }
             return retVal;
         }
 
+        void BlockableContainerListener::waitForNextContainerAllowed() const {
+            Lock l(m_nextContainerAllowedCondition);
+            while (!m_nextContainerAllowed) {
+                m_nextContainerAllowedCondition.waitOnSignal();
+            }
+        }
+
     }
 } // odcontext::base
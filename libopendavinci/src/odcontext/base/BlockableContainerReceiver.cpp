@@ -18,7 +18,6 @@
  */
 
 #include "opendavinci/odcontext/base/BlockableContainerReceiver.h"
-#include "opendavinci/odcore/base/Thread.h"
 #include "opendavinci/odcore/data/Container.h"
 #include "opendavinci/odcore/data/TimeStamp.h"
 #include "opendavinci/odcore/io/conference/ContainerListener.h"
@@ -39,9 +38,8 @@ namespace odcontext {
         }
 
         void BlockableContainerReceiver::nextContainer(Container &c) {
-            while (!isNextContainerAllowed()) {
-                Thread::usleepFor(BlockableContainerReceiver::YIELDING_TIME);
-            }
+            // Wait until the RuntimeControl allows sending again.
+            waitForNextContainerAllowed();
 
             // Set received TimeStamp.
             c.setReceivedTimeStamp(TimeStamp());
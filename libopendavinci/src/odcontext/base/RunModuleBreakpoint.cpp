@@ -20,7 +20,6 @@
 #include "opendavinci/odcontext/base/BlockableContainerListener.h"
 #include "opendavinci/odcontext/base/RunModuleBreakpoint.h"
 #include "opendavinci/odcore/base/Lock.h"
-#include "opendavinci/odcore/base/Thread.h"
 
 namespace odcontext {
     namespace base {
@@ -30,9 +29,9 @@ namespace odcontext {
 
         RunModuleBreakpoint::RunModuleBreakpoint(BlockableContainerListener &bcl) :
             m_blockableContainerListener(bcl),
-            m_reachedMutex(),
+            m_reachedCondition(),
             m_reached(false),
-            m_continueMutex(),
+            m_continueCondition(),
             m_continue(false) {}
 
         RunModuleBreakpoint::~RunModuleBreakpoint() {}
@@ -43,59 +42,65 @@ namespace odcontext {
 
             // Indicate the outer thread that the inner thread has reached its breakpoint.
             {
-                Lock l1(m_reachedMutex);
+                Lock l1(m_reachedCondition);
                 m_reached = true;
+                m_reachedCondition.wakeAll();
             }
 
-            // Wait for continue.
-            while (!hasContinue()) {
-                Thread::usleepFor(1000);
+            // Wait for continue and consume it.
+            {
+                Lock l2(m_continueCondition);
+                while (!m_continue) {
+                    m_continueCondition.waitOnSignal();
+                }
+                m_continue = false;
             }
 
             // Enable sending.
             m_blockableContainerListener.setNextContainerAllowed(true);
-
-            // Consume continue.
-            {
-                Lock l3(m_continueMutex);
-                m_continue = false;
-            }
         }
 
         void RunModuleBreakpoint::setFinallyReaching() {
-            Lock l1(m_reachedMutex);
+            Lock l1(m_reachedCondition);
             m_reached = true;
+            m_reachedCondition.wakeAll();
         }
 
         bool RunModuleBreakpoint::hasReached() const {
             bool retVal = false;
             {
-                Lock l(m_reachedMutex);
+                Lock l(m_reachedCondition);
                 retVal = m_reached;
             }
             return retVal;
         }
 
-        bool RunModuleBreakpoint::hasContinue() const {
-            bool retVal = false;
-            {
-                Lock l1(m_continueMutex);
-                retVal = m_continue;
+        bool RunModuleBreakpoint::waitForReaching(const uint32_t &timeoutInMilliseconds) {
+            // The time might be controlled by RuntimeControl; thus, count the timed out waits instead of using TimeStamp.
+            const uint32_t WAIT_PER_ITERATION = 100;
+            uint32_t waited = 0;
+
+            Lock l(m_reachedCondition);
+            while (!m_reached && (waited < timeoutInMilliseconds)) {
+                if (!m_reachedCondition.waitOnSignalWithTimeout(WAIT_PER_ITERATION)) {
+                    waited += WAIT_PER_ITERATION;
+                }
             }
-            return retVal;
+            return m_reached;
         }
 
         void RunModuleBreakpoint::continueExecution() {
             // Prepare reached for next execution.
             {
-                Lock l1(m_reachedMutex);
+                Lock l1(m_reachedCondition);
                 m_reached = false;
             }
 
             // Continue execution.
             {
-                Lock l2(m_continueMutex);
+                Lock l2(m_continueCondition);
                 m_continue = true;
+                m_continueCondition.wakeAll();
             }
         }
 
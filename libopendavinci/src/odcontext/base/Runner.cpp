@@ -47,5 +47,28 @@ namespace odcontext {
             return (retVal && !hasFinished());
         }
 
+        uint32_t Runner::getTimeUntilNextExecution(const odcore::wrapper::Time &t) const {
+            uint32_t retVal = 0;
+            if ( (getFrequency() > 0) && !hasFinished() ) {
+                uint32_t THIS_RUN_AT_TIME = static_cast<uint32_t>(TimeConstants::ONE_SECOND_IN_MILLISECONDS / getFrequency());
+                THIS_RUN_AT_TIME = (THIS_RUN_AT_TIME > 0) ? THIS_RUN_AT_TIME : 1;
+
+                const uint32_t CURRENT_PARTIAL_MILLISECONDS = t.getPartialMicroseconds() / TimeConstants::ONE_MILLISECOND_IN_MICROSECONDS;
+                if (THIS_RUN_AT_TIME > TimeConstants::ONE_SECOND_IN_MILLISECONDS) {
+                    // Slower than 1 Hz: Next multiple of the period on the absolute time line.
+                    const uint32_t CURRENT_MILLISECONDS = t.getSeconds() * TimeConstants::ONE_SECOND_IN_MILLISECONDS + CURRENT_PARTIAL_MILLISECONDS;
+                    retVal = (CURRENT_MILLISECONDS / THIS_RUN_AT_TIME + 1) * THIS_RUN_AT_TIME - CURRENT_MILLISECONDS;
+                }
+                else {
+                    // Next multiple of the period within the current second or the beginning of the next second.
+                    const uint32_t ONE_SECOND = TimeConstants::ONE_SECOND_IN_MILLISECONDS;
+                    const uint32_t NEXT = (CURRENT_PARTIAL_MILLISECONDS / THIS_RUN_AT_TIME + 1) * THIS_RUN_AT_TIME;
+                    retVal = ( (NEXT < ONE_SECOND) ? NEXT : ONE_SECOND ) - CURRENT_PARTIAL_MILLISECONDS;
+                }
+            }
+
+            return retVal;
+        }
+
     }
 } // odcontext::base
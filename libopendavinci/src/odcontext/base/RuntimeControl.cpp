@@ -264,6 +264,34 @@ namespace odcontext {
             }
         }
 
+        uint32_t RuntimeControl::getTimeUntilNextExecution(const vector<SystemFeedbackComponent*> &listOfSystemFeedbackComponents, const vector<std::shared_ptr<TimeTriggeredConferenceClientModuleRunner> > &listOfWrappedTimeTriggeredConferenceClientModules, const odcore::wrapper::Time &time) const {
+            uint32_t retVal = 0;
+
+            vector<SystemFeedbackComponent*>::const_iterator it = listOfSystemFeedbackComponents.begin();
+            while (it != listOfSystemFeedbackComponents.end()) {
+                SystemFeedbackComponent *sfc = (*it++);
+                if (sfc != NULL) {
+                    const uint32_t TIME_UNTIL_NEXT_EXECUTION = sfc->getTimeUntilNextExecution(time);
+                    if ( (TIME_UNTIL_NEXT_EXECUTION > 0) && ((retVal == 0) || (TIME_UNTIL_NEXT_EXECUTION < retVal)) ) {
+                        retVal = TIME_UNTIL_NEXT_EXECUTION;
+                    }
+                }
+            }
+
+            vector<std::shared_ptr<TimeTriggeredConferenceClientModuleRunner> >::const_iterator jt = listOfWrappedTimeTriggeredConferenceClientModules.begin();
+            while (jt != listOfWrappedTimeTriggeredConferenceClientModules.end()) {
+                std::shared_ptr<TimeTriggeredConferenceClientModuleRunner> runner = (*jt++);
+                if (runner.get()) {
+                    const uint32_t TIME_UNTIL_NEXT_EXECUTION = runner->getTimeUntilNextExecution(time);
+                    if ( (TIME_UNTIL_NEXT_EXECUTION > 0) && ((retVal == 0) || (TIME_UNTIL_NEXT_EXECUTION < retVal)) ) {
+                        retVal = TIME_UNTIL_NEXT_EXECUTION;
+                    }
+                }
+            }
+
+            return retVal;
+        }
+
         enum RuntimeControl::ERRORCODES RuntimeControl::run(RuntimeEnvironment &rte, const uint32_t &maxRunningTimeInSeconds) {
             enum ERRORCODES retVal = RuntimeControl::NO_ERROR_OCCURRED;
 
@@ -294,7 +322,7 @@ namespace odcontext {
 
                         // Compute greatest possible time step in the runtime environment.
                         const uint32_t SLEEPING_TIME = rte.getGreatestTimeStep();
-                        clog << "(context::base::RuntimeControl) greatest common divisor: " << SLEEPING_TIME << "ms." << endl;
+                        clog << "(context::base::RuntimeControl) greatest common divisor: " << SLEEPING_TIME << "ms (used only when no component is schedulable)." << endl;
 
                         ////////////////////////////////////////////////////////
                         // Assert necessary things.
@@ -359,8 +387,10 @@ namespace odcontext {
                                 }
                             }
 
-                            // Increment the time using the computed greatest common divisor.
-                            time.increment(SLEEPING_TIME);
+                            // Jump directly to the next point in time when any component needs to be executed;
+                            // use the computed greatest common divisor only if no component is schedulable anymore.
+                            const uint32_t TIME_UNTIL_NEXT_EXECUTION = getTimeUntilNextExecution(listOfSystemFeedbackComponents, listOfWrappedTimeTriggeredConferenceClientModules, time.now());
+                            time.increment((TIME_UNTIL_NEXT_EXECUTION > 0) ? TIME_UNTIL_NEXT_EXECUTION : SLEEPING_TIME);
 
                             // Feed forward current valid system time to TimeFactory.
                             m_controlledTimeFactory->setTime(time.now());
@@ -420,6 +450,8 @@ namespace odcontext {
 
         void RuntimeControl::waitForNextFullSecond(const uint32_t &/*secondsIncrement*/) {}
 
+        void RuntimeControl::wait() {}
+
         ////////////////////////////////////////////////////////////////////////
 
         void RuntimeControl::DisableTimeFactory::disable() {
@@ -18,13 +18,16 @@
  */
 
 #include <iostream>
+#include <memory>
 #include <sstream>
+#include <vector>
 
 #include "opendavinci/odcontext/base/Clock.h"
 #include "opendavinci/odcontext/base/ControlledTime.h"
 #include "opendavinci/odcontext/base/RuntimeControlInterface.h"
 #include "opendavinci/odcontext/base/StandaloneRuntimeControl.h"
 #include "opendavinci/odcontext/base/SystemFeedbackComponent.h"
+#include "opendavinci/odcontext/base/TimeTriggeredConferenceClientModuleRunner.h"
 #include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/base/Thread.h"
 #include "opendavinci/odcore/data/TimeStamp.h"
@@ -118,6 +121,9 @@ namespace odcontext {
                 const uint32_t SLEEPING_TIME = m_rte.getGreatestTimeStep();
                 clog << "(StandaloneRuntimeControl) Greatest time step: " << SLEEPING_TIME << "ms." << endl;
 
+                // No TimeTriggeredConferenceClientModules are scheduled here.
+                const vector<std::shared_ptr<TimeTriggeredConferenceClientModuleRunner> > noRunners;
+
                 Clock time;
                 TimeStamp startTime;
                 setModuleState(odcore::data::dmcp::ModuleStateMessage::RUNNING);
@@ -147,7 +153,11 @@ namespace odcontext {
                     // Calculate the real sleeping time to map simulation time onto the real time.
                     TimeStamp consumedTimeFromTimeSlice = endTimeSlice - startTimeSlice;
 
-                    const double nominalTimeInMicroSeconds = SLEEPING_TIME * 1000.0; // Multiply by 1000.0 to convert milliseconds to microseconds.
+                    // Jump directly to the next point in time when any SystemFeedbackComponent needs to be executed.
+                    const uint32_t TIME_UNTIL_NEXT_EXECUTION = getTimeUntilNextExecution(m_listOfSystemFeedbackComponents, noRunners, time.now());
+                    const uint32_t TIME_STEP = (TIME_UNTIL_NEXT_EXECUTION > 0) ? TIME_UNTIL_NEXT_EXECUTION : SLEEPING_TIME;
+
+                    const double nominalTimeInMicroSeconds = TIME_STEP * 1000.0; // Multiply by 1000.0 to convert milliseconds to microseconds.
                     const double consumedTimeInMicroSeconds = consumedTimeFromTimeSlice.toMicroseconds();
                     const double CURRENT_SLEEPING_TIME = nominalTimeInMicroSeconds - consumedTimeInMicroSeconds;
                     if (CURRENT_SLEEPING_TIME > 0) {
@@ -155,8 +165,7 @@ namespace odcontext {
                         Thread::usleepFor(CURRENT_SLEEPING_TIME);
                     }
 
-                    // Increment the time using the computed greatest common divisor.
-                    time.increment(SLEEPING_TIME);
+                    time.increment(TIME_STEP);
                 }
                 TimeStamp endTime;
 
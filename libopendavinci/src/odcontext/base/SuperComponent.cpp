@@ -200,6 +200,10 @@ namespace odcontext {
             clog << "(context::base::SuperComponent) Received RuntimeStatistics for " << md.toString() << ": " << rs.toString() << endl;
         }
 
+        void SuperComponent::handleCycleStatistics(const odcore::data::dmcp::ModuleDescriptor& md,  const odcore::data::dmcp::CycleStatistics& cs) {
+            clog << "(context::base::SuperComponent) Received CycleStatistics for " << md.toString() << ": " << cs.toString() << endl;
+        }
+
         void SuperComponent::handleConnectionLost(const odcore::data::dmcp::ModuleDescriptor& md) {
             clog << "(context::base::SuperComponent) Lost connection to " << md.toString() << endl;
         }
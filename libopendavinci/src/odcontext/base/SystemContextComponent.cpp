@@ -19,8 +19,6 @@
 
 #include "opendavinci/odcontext/base/SystemContextComponent.h"
 #include "opendavinci/odcore/data/Container.h"
-#include "opendavinci/odcore/wrapper/KeyValueDatabase.h"
-#include "opendavinci/odcore/wrapper/KeyValueDatabaseFactory.h"
 
 namespace odcontext {
     namespace base {
@@ -31,8 +29,8 @@ namespace odcontext {
         SystemContextComponent::SystemContextComponent() :
             m_fifo(),
             m_keyValueDataStore() {
-            // Create an in-memory database.
-            m_keyValueDataStore = std::shared_ptr<KeyValueDataStore>(new KeyValueDataStore(odcore::wrapper::KeyValueDatabaseFactory::createKeyValueDatabase()));
+            // Keep the latest Container per data type in memory.
+            m_keyValueDataStore = std::shared_ptr<KeyValueDataStore>(new KeyValueDataStore());
         }
 
         SystemContextComponent::~SystemContextComponent() {}
@@ -27,7 +27,6 @@
 #include "opendavinci/odcontext/base/TimeConstants.h"
 #include "opendavinci/odcontext/base/TimeTriggeredConferenceClientModuleRunner.h"
 #include "opendavinci/odcore/base/Lock.h"
-#include "opendavinci/odcore/base/Thread.h"
 #include "opendavinci/odcore/base/module/TimeTriggeredConferenceClientModule.h"
 #include "opendavinci/odcore/exceptions/Exceptions.h"
 #include "opendavinci/odcore/io/conference/ContainerConference.h"
@@ -78,20 +77,14 @@ namespace odcontext {
                     m_runModuleBreakpoint.continueExecution();
                 }
 
-                // Waiting for breakpoint.
-                uint32_t waitingForReachingBreakpoint = 0;
-                while (!m_runModuleBreakpoint.hasReached()) {
-                    Thread::usleepFor(TimeConstants::ONE_MILLISECOND_IN_MICROSECONDS);
-                    waitingForReachingBreakpoint += TimeConstants::ONE_MILLISECOND_IN_MICROSECONDS;
+                // Waiting for breakpoint; the application's thread signals when reaching it.
+                if (!m_runModuleBreakpoint.waitForReaching(TimeConstants::MAX_WAIT_FOR_REACHING_BREAKPOINT_PER_CYCLE / TimeConstants::ONE_MILLISECOND_IN_MICROSECONDS)) {
+                    stringstream reason;
+                    reason << m_timeTriggeredConferenceClientModule.getName() << " is not responding after " << (TimeConstants::MAX_WAIT_FOR_REACHING_BREAKPOINT_PER_CYCLE / TimeConstants::ONE_SECOND_IN_MICROSECONDS) << "s." << endl;
 
-                    if (waitingForReachingBreakpoint > TimeConstants::MAX_WAIT_FOR_REACHING_BREAKPOINT_PER_CYCLE) {
-                        stringstream reason;
-                        reason << m_timeTriggeredConferenceClientModule.getName() << " is not responding after " << (TimeConstants::MAX_WAIT_FOR_REACHING_BREAKPOINT_PER_CYCLE / TimeConstants::ONE_SECOND_IN_MICROSECONDS) << "s." << endl;
-
-                        // Throw exception to kill ourselves.
-                        errno = 0;
-                        OPENDAVINCI_CORE_THROW_EXCEPTION(ModulesNotRespondingException, reason.str());
-                    }
+                    // Throw exception to kill ourselves.
+                    errno = 0;
+                    OPENDAVINCI_CORE_THROW_EXCEPTION(ModulesNotRespondingException, reason.str());
                 }
             }
         }
@@ -0,0 +1,234 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <cstring>
+#include <sstream>
+
+#include "opendavinci/odcore/base/CycleProfile.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
+#include "opendavinci/generated/odcore/data/dmcp/CycleRecord.h"
+
+namespace odcore {
+    namespace base {
+
+        using namespace std;
+
+        CycleProfile::Cycle::Cycle() :
+            m_start(0),
+            m_executionTime(0),
+            m_periodDeviation(0) {}
+
+        CycleProfile::CycleProfile() :
+            m_numberOfCycles(0),
+            m_numberOfOverruns(0),
+            m_nominalDuration(0),
+            m_minimumPeriodDeviation(0),
+            m_maximumPeriodDeviation(0),
+            m_sumOfPeriodDeviations(0),
+            m_sumOfAbsolutePeriodDeviations(0),
+            m_maximumExecutionTime(0),
+            m_periodDeviationHistogram(),
+            m_executionTimeHistogram(),
+            m_numberOfWorstCycles(0),
+            m_worstCycles() {
+            reset();
+        }
+
+        CycleProfile::CycleProfile(const CycleProfile &obj) :
+            m_numberOfCycles(obj.m_numberOfCycles),
+            m_numberOfOverruns(obj.m_numberOfOverruns),
+            m_nominalDuration(obj.m_nominalDuration),
+            m_minimumPeriodDeviation(obj.m_minimumPeriodDeviation),
+            m_maximumPeriodDeviation(obj.m_maximumPeriodDeviation),
+            m_sumOfPeriodDeviations(obj.m_sumOfPeriodDeviations),
+            m_sumOfAbsolutePeriodDeviations(obj.m_sumOfAbsolutePeriodDeviations),
+            m_maximumExecutionTime(obj.m_maximumExecutionTime),
+            m_periodDeviationHistogram(),
+            m_executionTimeHistogram(),
+            m_numberOfWorstCycles(obj.m_numberOfWorstCycles),
+            m_worstCycles() {
+            ::memcpy(m_periodDeviationHistogram, obj.m_periodDeviationHistogram, sizeof(m_periodDeviationHistogram));
+            ::memcpy(m_executionTimeHistogram, obj.m_executionTimeHistogram, sizeof(m_executionTimeHistogram));
+            for (uint32_t i = 0; i < NUMBER_OF_WORST_CYCLES; i++) {
+                m_worstCycles[i] = obj.m_worstCycles[i];
+            }
+        }
+
+        CycleProfile& CycleProfile::operator=(const CycleProfile &obj) {
+            m_numberOfCycles = obj.m_numberOfCycles;
+            m_numberOfOverruns = obj.m_numberOfOverruns;
+            m_nominalDuration = obj.m_nominalDuration;
+            m_minimumPeriodDeviation = obj.m_minimumPeriodDeviation;
+            m_maximumPeriodDeviation = obj.m_maximumPeriodDeviation;
+            m_sumOfPeriodDeviations = obj.m_sumOfPeriodDeviations;
+            m_sumOfAbsolutePeriodDeviations = obj.m_sumOfAbsolutePeriodDeviations;
+            m_maximumExecutionTime = obj.m_maximumExecutionTime;
+            ::memcpy(m_periodDeviationHistogram, obj.m_periodDeviationHistogram, sizeof(m_periodDeviationHistogram));
+            ::memcpy(m_executionTimeHistogram, obj.m_executionTimeHistogram, sizeof(m_executionTimeHistogram));
+            m_numberOfWorstCycles = obj.m_numberOfWorstCycles;
+            for (uint32_t i = 0; i < NUMBER_OF_WORST_CYCLES; i++) {
+                m_worstCycles[i] = obj.m_worstCycles[i];
+            }
+            return *this;
+        }
+
+        CycleProfile::~CycleProfile() {}
+
+        void CycleProfile::add(const int64_t &start, const int64_t &executionTime, const int64_t &periodDeviation, const int64_t &nominalDuration) {
+            if ( (m_numberOfCycles == 0) || (periodDeviation < m_minimumPeriodDeviation) ) {
+                m_minimumPeriodDeviation = periodDeviation;
+            }
+            if ( (m_numberOfCycles == 0) || (periodDeviation > m_maximumPeriodDeviation) ) {
+                m_maximumPeriodDeviation = periodDeviation;
+            }
+            const int64_t ABSOLUTE_PERIOD_DEVIATION = (periodDeviation < 0) ? -periodDeviation : periodDeviation;
+            m_sumOfPeriodDeviations += periodDeviation;
+            m_sumOfAbsolutePeriodDeviations += ABSOLUTE_PERIOD_DEVIATION;
+            if (executionTime > m_maximumExecutionTime) {
+                m_maximumExecutionTime = executionTime;
+            }
+            if (executionTime > nominalDuration) {
+                m_numberOfOverruns++;
+            }
+            m_nominalDuration = nominalDuration;
+            m_numberOfCycles++;
+
+            m_periodDeviationHistogram[getBucket(ABSOLUTE_PERIOD_DEVIATION)]++;
+            m_executionTimeHistogram[getBucket(executionTime)]++;
+
+            // Keep the worst cycles ordered by descending execution time.
+            if ( (m_numberOfWorstCycles < NUMBER_OF_WORST_CYCLES) || (executionTime > m_worstCycles[NUMBER_OF_WORST_CYCLES - 1].m_executionTime) ) {
+                uint32_t i = (m_numberOfWorstCycles < NUMBER_OF_WORST_CYCLES) ? m_numberOfWorstCycles++ : (NUMBER_OF_WORST_CYCLES - 1);
+                while ( (i > 0) && (m_worstCycles[i - 1].m_executionTime < executionTime) ) {
+                    m_worstCycles[i] = m_worstCycles[i - 1];
+                    i--;
+                }
+                m_worstCycles[i].m_start = start;
+                m_worstCycles[i].m_executionTime = executionTime;
+                m_worstCycles[i].m_periodDeviation = periodDeviation;
+            }
+        }
+
+        void CycleProfile::reset() {
+            m_numberOfCycles = 0;
+            m_numberOfOverruns = 0;
+            m_minimumPeriodDeviation = 0;
+            m_maximumPeriodDeviation = 0;
+            m_sumOfPeriodDeviations = 0;
+            m_sumOfAbsolutePeriodDeviations = 0;
+            m_maximumExecutionTime = 0;
+            ::memset(m_periodDeviationHistogram, 0, sizeof(m_periodDeviationHistogram));
+            ::memset(m_executionTimeHistogram, 0, sizeof(m_executionTimeHistogram));
+            m_numberOfWorstCycles = 0;
+        }
+
+        uint32_t CycleProfile::getNumberOfCycles() const {
+            return m_numberOfCycles;
+        }
+
+        uint32_t CycleProfile::getNumberOfOverruns() const {
+            return m_numberOfOverruns;
+        }
+
+        int64_t CycleProfile::getNominalDuration() const {
+            return m_nominalDuration;
+        }
+
+        int64_t CycleProfile::getMinimumPeriodDeviation() const {
+            return m_minimumPeriodDeviation;
+        }
+
+        int64_t CycleProfile::getMaximumPeriodDeviation() const {
+            return m_maximumPeriodDeviation;
+        }
+
+        double CycleProfile::getAveragePeriodDeviation() const {
+            return (m_numberOfCycles > 0) ? static_cast<double>(m_sumOfPeriodDeviations) / m_numberOfCycles : 0;
+        }
+
+        double CycleProfile::getAverageAbsolutePeriodDeviation() const {
+            return (m_numberOfCycles > 0) ? static_cast<double>(m_sumOfAbsolutePeriodDeviations) / m_numberOfCycles : 0;
+        }
+
+        int64_t CycleProfile::getMaximumExecutionTime() const {
+            return m_maximumExecutionTime;
+        }
+
+        uint32_t CycleProfile::getPeriodDeviationHistogram(const uint32_t &bucket) const {
+            return (bucket < NUMBER_OF_BUCKETS) ? m_periodDeviationHistogram[bucket] : 0;
+        }
+
+        uint32_t CycleProfile::getExecutionTimeHistogram(const uint32_t &bucket) const {
+            return (bucket < NUMBER_OF_BUCKETS) ? m_executionTimeHistogram[bucket] : 0;
+        }
+
+        uint32_t CycleProfile::getNumberOfWorstCycles() const {
+            return m_numberOfWorstCycles;
+        }
+
+        const CycleProfile::Cycle& CycleProfile::getWorstCycle(const uint32_t &index) const {
+            return m_worstCycles[(index < NUMBER_OF_WORST_CYCLES) ? index : (NUMBER_OF_WORST_CYCLES - 1)];
+        }
+
+        odcore::data::dmcp::CycleStatistics CycleProfile::getCycleStatistics() const {
+            odcore::data::dmcp::CycleStatistics cs;
+            cs.setNominalDuration(static_cast<uint32_t>(m_nominalDuration));
+            cs.setNumberOfCycles(m_numberOfCycles);
+            cs.setNumberOfOverruns(m_numberOfOverruns);
+            cs.setMinimumPeriodDeviation(static_cast<int32_t>(m_minimumPeriodDeviation));
+            cs.setMaximumPeriodDeviation(static_cast<int32_t>(m_maximumPeriodDeviation));
+            cs.setMaximumExecutionTime(static_cast<uint32_t>(m_maximumExecutionTime));
+
+            cs.setListOfPeriodDeviationHistogram(vector<uint32_t>(m_periodDeviationHistogram, m_periodDeviationHistogram + NUMBER_OF_BUCKETS));
+            cs.setListOfExecutionTimeHistogram(vector<uint32_t>(m_executionTimeHistogram, m_executionTimeHistogram + NUMBER_OF_BUCKETS));
+
+            for (uint32_t i = 0; i < m_numberOfWorstCycles; i++) {
+                odcore::data::dmcp::CycleRecord cr;
+                cr.setStart(odcore::data::TimeStamp(static_cast<int32_t>(m_worstCycles[i].m_start / 1000000L), static_cast<int32_t>(m_worstCycles[i].m_start % 1000000L)));
+                cr.setExecutionTime(static_cast<uint32_t>(m_worstCycles[i].m_executionTime));
+                cr.setPeriodDeviation(static_cast<int32_t>(m_worstCycles[i].m_periodDeviation));
+                cs.addTo_ListOfWorstCycles(cr);
+            }
+
+            return cs;
+        }
+
+        const string CycleProfile::toString() const {
+            stringstream sstr;
+            sstr << "cycles: " << m_numberOfCycles
+                 << ", overruns: " << m_numberOfOverruns
+                 << ", period deviation: [" << m_minimumPeriodDeviation << ", " << m_maximumPeriodDeviation << "] us"
+                 << ", avg: " << getAveragePeriodDeviation() << " us"
+                 << ", avg(abs): " << getAverageAbsolutePeriodDeviation() << " us"
+                 << ", max execution time: " << m_maximumExecutionTime << " us";
+            return sstr.str();
+        }
+
+        uint32_t CycleProfile::getBucket(const int64_t &value) {
+            uint32_t bucket = 0;
+            int64_t v = value;
+            while ( (v > 0) && (bucket < (NUMBER_OF_BUCKETS - 1)) ) {
+                v >>= 1;
+                bucket++;
+            }
+            return bucket;
+        }
+
+    }
+} // odcore::base
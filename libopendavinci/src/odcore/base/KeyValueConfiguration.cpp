@@ -18,8 +18,12 @@
  */
 
 #include <algorithm>
+#include <cctype>
 #include <functional>
 #include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
 
 #include "opendavinci/odcore/serialization/Deserializer.h"
 #include "opendavinci/odcore/base/KeyValueConfiguration.h"
@@ -32,14 +36,31 @@ namespace odcore {
 
         using namespace odcore::serialization;
 
-        KeyValueConfiguration::KeyValueConfiguration() : m_keyValueConfiguration() {}
+        KeyValueConfiguration::Entry::Entry(const string &value) :
+            m_value(value),
+            m_parsedValuesMutex(),
+            m_parsedValues() {}
+
+        KeyValueConfiguration::Entry::~Entry() {}
+
+        const string& KeyValueConfiguration::Entry::getValue() const {
+            return m_value;
+        }
+
+        KeyValueConfiguration::Entries::Entries() :
+            m_mapOfEntries(),
+            m_listOfKeys() {}
+
+        KeyValueConfiguration::Entries::~Entries() {}
+
+        KeyValueConfiguration::KeyValueConfiguration() : m_entries(new Entries()) {}
 
         KeyValueConfiguration::KeyValueConfiguration(const KeyValueConfiguration &obj) :
             SerializableData(),
-            m_keyValueConfiguration(obj.m_keyValueConfiguration) {}
+            m_entries(obj.m_entries) {}
 
         KeyValueConfiguration& KeyValueConfiguration::operator=(const KeyValueConfiguration &obj) {
-            m_keyValueConfiguration = obj.m_keyValueConfiguration;
+            m_entries = obj.m_entries;
             return (*this);
         }
 
@@ -85,15 +106,15 @@ namespace odcore {
 
         ostream& KeyValueConfiguration::writeTo(ostream &out) const {
             // Print out configuration data.
-            map<string, string, odcore::strings::StringComparator>::const_iterator it = m_keyValueConfiguration.begin();
-            for (; it != m_keyValueConfiguration.end(); ++it) {
-                out << it->first << "=" << it->second << endl;
+            vector<string>::const_iterator it = m_entries->m_listOfKeys.begin();
+            for (; it != m_entries->m_listOfKeys.end(); ++it) {
+                out << (*it) << "=" << m_entries->m_mapOfEntries.find(*it)->second->getValue() << endl;
             }
             return out;
         }
 
         istream& KeyValueConfiguration::readFrom(istream &in) {
-            m_keyValueConfiguration.clear();
+            std::shared_ptr<Entries> entries(new Entries());
             while (!in.eof()) {
                 string line;
                 getline(in, line);
@@ -146,36 +167,27 @@ namespace odcore {
                 // Transform to lower case for case insensitive searches.
                 transform(key.begin(), key.end(), key.begin(), ptr_fun(::tolower));
 
-                m_keyValueConfiguration[key] = value;
+                std::shared_ptr<Entry> &entry = entries->m_mapOfEntries[key];
+                if (entry.get() == NULL) {
+                    entries->m_listOfKeys.push_back(key);
+                }
+                entry = std::shared_ptr<Entry>(new Entry(value));
             }
+            sort(entries->m_listOfKeys.begin(), entries->m_listOfKeys.end());
+
+            m_entries = entries;
             return in;
         }
 
         KeyValueConfiguration KeyValueConfiguration::getSubsetForSectionRemoveLeadingSectionName(const string &section) const {
-            KeyValueConfiguration subset;
-            stringstream subsetStringStream;
-
-            // Transform section name to lower case for case insensitive subset building.
-            string subsetSection = section;
-            transform(subsetSection.begin(), subsetSection.end(), subsetSection.begin(), ptr_fun(::tolower));
-
-            // Print32_t out configuration data.
-            map<string, string, odcore::strings::StringComparator>::const_iterator it = m_keyValueConfiguration.begin();
-            for (; it != m_keyValueConfiguration.end(); ++it) {
-                string key = it->first;
-                string::size_type pos = key.find(subsetSection, 0);
-                if (pos != string::npos) {
-                    subsetStringStream << key.substr(pos + section.length()) << "=" << it->second << endl;
-                }
-            }
-
-            // Use stringstream to read new subset configuration.
-            subset.readFrom(subsetStringStream);
-
-            return subset;
+            return getSubset(section, true);
         }
 
         KeyValueConfiguration KeyValueConfiguration::getSubsetForSection(const string &section) const {
+            return getSubset(section, false);
+        }
+
+        KeyValueConfiguration KeyValueConfiguration::getSubset(const string &section, const bool &removeLeadingSectionName) const {
             KeyValueConfiguration subset;
             stringstream subsetStringStream;
 
@@ -184,12 +196,12 @@ namespace odcore {
             transform(subsetSection.begin(), subsetSection.end(), subsetSection.begin(), ptr_fun(::tolower));
 
             // Print32_t out configuration data.
-            map<string, string, odcore::strings::StringComparator>::const_iterator it = m_keyValueConfiguration.begin();
-            for (; it != m_keyValueConfiguration.end(); ++it) {
-                string key = it->first;
+            vector<string>::const_iterator it = m_entries->m_listOfKeys.begin();
+            for (; it != m_entries->m_listOfKeys.end(); ++it) {
+                const string &key = (*it);
                 string::size_type pos = key.find(subsetSection, 0);
                 if (pos != string::npos) {
-                    subsetStringStream << key << "=" << it->second << endl;
+                    subsetStringStream << (removeLeadingSectionName ? key.substr(pos + section.length()) : key) << "=" << m_entries->m_mapOfEntries.find(key)->second->getValue() << endl;
                 }
             }
 
@@ -200,29 +212,29 @@ namespace odcore {
         }
 
         const vector<string> KeyValueConfiguration::getListOfKeys() const {
-            vector<string> listOfKeys;
-
-            map<string, string, odcore::strings::StringComparator>::const_iterator it = m_keyValueConfiguration.begin();
-            for (; it != m_keyValueConfiguration.end(); ++it) {
-                listOfKeys.push_back(it->first);
-            }
-
-            return listOfKeys;
+            return m_entries->m_listOfKeys;
         }
 
-        string KeyValueConfiguration::getValueFor(string key) const {
-            string value = "";
-
-            // Transform key name to lower case for case insensitive lookups.
-            transform(key.begin(), key.end(), key.begin(), ptr_fun(::tolower));
+        const KeyValueConfiguration::Entry& KeyValueConfiguration::getEntry(const string &key) const throw (exceptions::ValueForKeyNotFoundException) {
+            unordered_map<string, std::shared_ptr<Entry> >::const_iterator it;
 
-            // Try to find the key/value.
-            map<string, string, odcore::strings::StringComparator>::const_iterator it = m_keyValueConfiguration.find(key);
-            if (it != m_keyValueConfiguration.end()) {
-                value = it->second;
+            // Keys are stored in lower case; avoid copying keys that are already in lower case.
+            if (find_if(key.begin(), key.end(), ::isupper) == key.end()) {
+                it = m_entries->m_mapOfEntries.find(key);
+            }
+            else {
+                string lowerCaseKey = key;
+                transform(lowerCaseKey.begin(), lowerCaseKey.end(), lowerCaseKey.begin(), ptr_fun(::tolower));
+                it = m_entries->m_mapOfEntries.find(lowerCaseKey);
             }
 
-            return value;
+            if (it == m_entries->m_mapOfEntries.end()) {
+                stringstream s;
+                s << "Value for key '" << key << "' not found.";
+                errno = 0;
+                OPENDAVINCI_CORE_THROW_EXCEPTION(ValueForKeyNotFoundException, s.str());
+            }
+            return *(it->second);
         }
 
     }
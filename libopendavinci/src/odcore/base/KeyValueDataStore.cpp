@@ -18,9 +18,11 @@
  */
 
 #include <iosfwd>
+#include <memory>
 #include <string>
 
 #include "opendavinci/odcore/base/KeyValueDataStore.h"
+#include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/serialization/Serializable.h"
 #include "opendavinci/odcore/opendavinci.h"
 
@@ -30,8 +32,28 @@ namespace odcore {
         using namespace data;
         using namespace exceptions;
 
+        KeyValueDataStore::Slot::Slot() :
+            m_mutex(),
+            m_value(),
+            m_historyDepth(1),
+            m_historyNext(0),
+            m_historySize(0),
+            m_history() {}
+
+        KeyValueDataStore::Shard::Shard() :
+            m_mutex(),
+            m_slots(),
+            m_index(new map<int32_t, Slot*>()) {}
+
+        KeyValueDataStore::KeyValueDataStore() :
+                m_keyValueDatabase(),
+                m_emptyContainer(new Container()),
+                m_shards() {}
+
         KeyValueDataStore::KeyValueDataStore(std::shared_ptr<wrapper::KeyValueDatabase> keyValueDatabase) throw (NoDatabaseAvailableException) :
-                m_keyValueDatabase(keyValueDatabase) {
+                m_keyValueDatabase(keyValueDatabase),
+                m_emptyContainer(new Container()),
+                m_shards() {
             if (!m_keyValueDatabase.get()) {
                 OPENDAVINCI_CORE_THROW_EXCEPTION(NoDatabaseAvailableException, "Given database is NULL.");
             }
@@ -39,28 +61,160 @@ namespace odcore {
 
         KeyValueDataStore::~KeyValueDataStore() {}
 
+        KeyValueDataStore::Slot* KeyValueDataStore::findSlot(const int32_t &key) const {
+            const Shard &shard = m_shards[static_cast<uint32_t>(key) % NUMBER_OF_SHARDS];
+
+            // The index is never modified after publishing; new keys replace the whole index.
+            std::shared_ptr<const map<int32_t, Slot*> > index = std::atomic_load(&shard.m_index);
+            map<int32_t, Slot*>::const_iterator it = index->find(key);
+            return (it != index->end()) ? it->second : NULL;
+        }
+
+        KeyValueDataStore::Slot* KeyValueDataStore::getSlot(const int32_t &key) {
+            Slot *slot = findSlot(key);
+            if (slot == NULL) {
+                Shard &shard = m_shards[static_cast<uint32_t>(key) % NUMBER_OF_SHARDS];
+
+                Lock l(shard.m_mutex);
+                // Another writer might have added the slot in the meantime.
+                map<int32_t, Slot*>::const_iterator it = shard.m_index->find(key);
+                if (it != shard.m_index->end()) {
+                    return it->second;
+                }
+
+                std::shared_ptr<Slot> newSlot(new Slot());
+                shard.m_slots.push_back(newSlot);
+                slot = newSlot.get();
+
+                std::shared_ptr<map<int32_t, Slot*> > newIndex(new map<int32_t, Slot*>(*shard.m_index));
+                (*newIndex)[key] = slot;
+                std::atomic_store(&shard.m_index, std::shared_ptr<const map<int32_t, Slot*> >(newIndex));
+            }
+            return slot;
+        }
+
         void KeyValueDataStore::put(const int32_t &key, const Container &value) {
-            // Transform the given Container to a plain string...
-            stringstream stringStreamValue;
-            stringStreamValue << value;
-            string stringValue = stringStreamValue.str();
+            if (m_keyValueDatabase.get()) {
+                // Transform the given Container to a plain string...
+                stringstream stringStreamValue;
+                stringStreamValue << value;
+                string stringValue = stringStreamValue.str();
+
+                // ...and use the datastore backend for storing the content.
+                m_keyValueDatabase->put(key, stringValue);
+                return;
+            }
 
-            // ...and use the datastore backend for storing the content.
-            m_keyValueDatabase->put(key, stringValue);
+            std::shared_ptr<const Container> sharedValue(new Container(value));
+
+            Slot *slot = getSlot(key);
+            Lock l(slot->m_mutex);
+            std::atomic_store(&slot->m_value, sharedValue);
+
+            if (slot->m_historyDepth > 1) {
+                slot->m_history[slot->m_historyNext] = sharedValue;
+                slot->m_historyNext = (slot->m_historyNext + 1) % slot->m_historyDepth;
+                if (slot->m_historySize < slot->m_historyDepth) {
+                    slot->m_historySize++;
+                }
+            }
         }
 
         Container KeyValueDataStore::get(const int32_t &key) const {
-            Container value;
+            if (m_keyValueDatabase.get()) {
+                Container value;
 
-            // Try to get the value from the database backend and try to parse a Container.
-            string stringValue(m_keyValueDatabase->get(key));
-            if (stringValue != "") {
-                stringstream stringStreamValue;
-                stringStreamValue.str(stringValue);
-                stringStreamValue >> value;
+                // Try to get the value from the database backend and try to parse a Container.
+                string stringValue(m_keyValueDatabase->get(key));
+                if (stringValue != "") {
+                    stringstream stringStreamValue;
+                    stringStreamValue.str(stringValue);
+                    stringStreamValue >> value;
+                }
+
+                return value;
+            }
+
+            return *getShared(key);
+        }
+
+        std::shared_ptr<const Container> KeyValueDataStore::getShared(const int32_t &key) const {
+            if (m_keyValueDatabase.get()) {
+                return std::shared_ptr<const Container>(new Container(get(key)));
+            }
+
+            Slot *slot = findSlot(key);
+            if (slot != NULL) {
+                std::shared_ptr<const Container> value = std::atomic_load(&slot->m_value);
+                if (value.get() != NULL) {
+                    return value;
+                }
+            }
+            return m_emptyContainer;
+        }
+
+        void KeyValueDataStore::setHistoryDepth(const int32_t &key, const uint32_t &depth) {
+            if (m_keyValueDatabase.get()) {
+                return;
             }
 
-            return value;
+            Slot *slot = getSlot(key);
+            Lock l(slot->m_mutex);
+
+            // Keep the latest Containers that still fit into the new history.
+            vector<std::shared_ptr<const Container> > history;
+            const uint32_t newDepth = (depth > 1) ? depth : 1;
+            if (newDepth > 1) {
+                history.resize(newDepth);
+                const uint32_t size = (slot->m_historySize < newDepth) ? slot->m_historySize : newDepth;
+                for (uint32_t i = 0; i < size; i++) {
+                    history[size - 1 - i] = slot->m_history[(slot->m_historyNext + slot->m_historyDepth - 1 - i) % slot->m_historyDepth];
+                }
+                if ( (size == 0) && (slot->m_value.get() != NULL) ) {
+                    history[0] = slot->m_value;
+                    slot->m_historySize = 1;
+                }
+                else {
+                    slot->m_historySize = size;
+                }
+                slot->m_historyNext = slot->m_historySize % newDepth;
+            }
+            else {
+                slot->m_historySize = 0;
+                slot->m_historyNext = 0;
+            }
+            slot->m_history.swap(history);
+            slot->m_historyDepth = newDepth;
+        }
+
+        vector<std::shared_ptr<const Container> > KeyValueDataStore::getHistory(const int32_t &key, const uint32_t &n) const {
+            vector<std::shared_ptr<const Container> > history;
+
+            if (m_keyValueDatabase.get()) {
+                if (n > 0) {
+                    std::shared_ptr<const Container> value = getShared(key);
+                    if (value->getDataType() != Container::UNDEFINEDDATA) {
+                        history.push_back(value);
+                    }
+                }
+                return history;
+            }
+
+            Slot *slot = findSlot(key);
+            if ( (slot != NULL) && (n > 0) ) {
+                Lock l(slot->m_mutex);
+                if (slot->m_historyDepth > 1) {
+                    const uint32_t size = (slot->m_historySize < n) ? slot->m_historySize : n;
+                    history.reserve(size);
+                    for (uint32_t i = 0; i < size; i++) {
+                        history.push_back(slot->m_history[(slot->m_historyNext + slot->m_historyDepth - 1 - i) % slot->m_historyDepth]);
+                    }
+                }
+                else if (slot->m_value.get() != NULL) {
+                    history.push_back(slot->m_value);
+                }
+            }
+            return history;
         }
 
     }
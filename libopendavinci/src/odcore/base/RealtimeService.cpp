@@ -17,8 +17,11 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <iostream>
+
 #include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/base/RealtimeService.h"
+#include "opendavinci/odcore/base/module/AbstractCIDModule.h"
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/wrapper/ConcurrencyFactory.h"
 #include "opendavinci/odcore/wrapper/Thread.h"
@@ -33,7 +36,7 @@ namespace odcore {
             m_thread(),
             m_realtimeServiceStateMutex(),
             m_realtimeServiceState(INITIALIZED) {
-            m_thread = unique_ptr<odcore::wrapper::Thread>(odcore::wrapper::ConcurrencyFactory::createThread(*this));
+            m_thread = unique_ptr<odcore::wrapper::Thread>(odcore::wrapper::ConcurrencyFactory::createThread(*this, "realtime"));
             if (m_thread.get() == NULL) {
                 OPENDAVINCI_CORE_THROW_EXCEPTION(ThreadException, "[core::base::RealtimeService] Thread could not be created!");
             }
@@ -62,6 +65,11 @@ namespace odcore {
             }
             if (doStop) {
                 m_thread->stop();
+
+                const CycleProfile cp = getAndResetCycleProfile();
+                if (cp.getNumberOfCycles() > 0) {
+                    CLOG1 << "(RealtimeService) cycles since last report: " << cp.toString() << endl;
+                }
             }
         }
 
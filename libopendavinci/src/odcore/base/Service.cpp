@@ -40,6 +40,18 @@ namespace odcore {
             }
         }
 
+        Service::Service(const string &threadRole) throw (ThreadException) :
+            m_thread(),
+            m_serviceStateMutex(),
+            m_serviceState(INITIALIZED),
+            m_serviceReadyCondition(),
+            m_serviceReady(false) {
+            m_thread = unique_ptr<odcore::wrapper::Thread>(wrapper::ConcurrencyFactory::createThread(*this, threadRole));
+            if (m_thread.get() == NULL) {
+                OPENDAVINCI_CORE_THROW_EXCEPTION(ThreadException, "[core::base::Service] Thread could not be created!");
+            }
+        }
+
         Service::~Service() {
             // Do not call this->stop() here because beforeStop() is a pure virtual method!
             m_thread->stop();
@@ -25,6 +25,8 @@
 #include "opendavinci/odcore/dmcp/discoverer/Client.h"
 #include "opendavinci/odcore/exceptions/Exceptions.h"
 #include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/wrapper/ConcurrencyFactory.h"
+#include "opendavinci/odcore/wrapper/ThreadConfiguration.h"
 #include "opendavinci/generated/odcore/data/dmcp/Constants.h"
 #include "opendavinci/generated/odcore/data/dmcp/ModuleDescriptor.h"
 #include "opendavinci/generated/odcore/data/dmcp/ModuleStateMessage.h"
@@ -119,6 +121,8 @@ namespace odcore {
 
                 CLOG1 << "(ClientModule) connecting to supercomponent...done - managed level: " << m_serverInformation.getManagedLevel() << endl;
 
+                configureThreadsAndMemory();
+
                 // Run user implementation from derived ConferenceClientModule.
                 odcore::data::dmcp::ModuleExitCodeMessage::ModuleExitCode retVal = runModuleImplementation();
 
@@ -129,6 +133,70 @@ namespace odcore {
                 return retVal;
             }
 
+            void ClientModule::configureThreadsAndMemory() {
+                using namespace odcore::wrapper;
+
+                const string ROLES[] = { "body", "receiver", "recorder", "realtime", "statistics", "worker" };
+                for (uint32_t i = 0; i < (sizeof(ROLES) / sizeof(ROLES[0])); i++) {
+                    const string PREFIX = getName() + ".thread." + ROLES[i] + ".";
+
+                    ThreadConfiguration tc;
+                    try {
+                        tc.setCPUs(ThreadConfiguration::parseCPUs(m_keyValueConfiguration.getValue<string>(PREFIX + "cpus")));
+                    }
+                    catch(...) {}
+                    try {
+                        tc.setSchedulingPolicy(ThreadConfiguration::parseSchedulingPolicy(m_keyValueConfiguration.getValue<string>(PREFIX + "policy")));
+                    }
+                    catch(...) {}
+                    try {
+                        tc.setPriority(m_keyValueConfiguration.getValue<uint32_t>(PREFIX + "priority"));
+                    }
+                    catch(...) {}
+
+                    if ( ( (tc.getSchedulingPolicy() == ThreadConfiguration::FIFO) || (tc.getSchedulingPolicy() == ThreadConfiguration::ROUND_ROBIN) ) &&
+                         ( (tc.getPriority() < 1) || (tc.getPriority() > 99) ) ) {
+                        clog << "(ClientModule) Ignoring scheduling policy for thread role '" << ROLES[i] << "': priority has to be in range [1, 99]." << endl;
+                        tc.setSchedulingPolicy(ThreadConfiguration::INHERIT);
+                    }
+
+                    if (!tc.isDefault()) {
+                        CLOG1 << "(ClientModule) thread role '" << ROLES[i] << "': " << tc.toString() << endl;
+
+                        bool applied = false;
+                        if (ROLES[i] == "body") {
+                            applied = ConcurrencyFactory::configureCurrentThread(tc);
+                        }
+                        else {
+                            applied = ConcurrencyFactory::setThreadConfiguration(ROLES[i], tc);
+                        }
+                        if (!applied) {
+                            clog << "(ClientModule) Could not apply configuration for thread role '" << ROLES[i] << "' (" << tc.toString() << "). Are you superuser?" << endl;
+                        }
+                    }
+                }
+
+                bool lockMemory = false;
+                try {
+                    lockMemory = (m_keyValueConfiguration.getValue<uint32_t>(getName() + ".memory.lock") == 1);
+                }
+                catch(...) {}
+                if (lockMemory) {
+                    uint32_t prefaultHeapInBytes = 0;
+                    try {
+                        prefaultHeapInBytes = m_keyValueConfiguration.getValue<uint32_t>(getName() + ".memory.prefault");
+                    }
+                    catch(...) {}
+
+                    if (ConcurrencyFactory::lockMemory(prefaultHeapInBytes)) {
+                        CLOG1 << "(ClientModule) memory locked, pre-faulted " << prefaultHeapInBytes << " bytes on the heap." << endl;
+                    }
+                    else {
+                        clog << "(ClientModule) Could not lock memory. Are you superuser?" << endl;
+                    }
+                }
+            }
+
             void ClientModule::handleConnectionLost() {
                 CLOG1 << "(ClientModule) connection to supercomponent lost. Shutting down" << endl;
                 setModuleState(odcore::data::dmcp::ModuleStateMessage::NOT_RUNNING);
@@ -0,0 +1,280 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/base/module/AbstractCIDModule.h"
+#include "opendavinci/odcore/base/module/CycleStatisticsReporter.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
+#include "opendavinci/odcore/dmcp/connection/Client.h"
+#include "opendavinci/generated/odcore/data/dmcp/CycleStatistics.h"
+#include "opendavinci/generated/odcore/data/dmcp/RuntimeStatistic.h"
+
+namespace odcore {
+    namespace base {
+        namespace module {
+
+            using namespace std;
+            using namespace odcore::base;
+            using namespace odcore::data;
+
+            CycleStatisticsReporter::ProfilingRecord::ProfilingRecord() :
+                m_current(0),
+                m_lastCycle(0),
+                m_freq(0),
+                m_lastWaitTime(0),
+                m_timeConsumptionCurrent(0),
+                m_nominalDuration(0),
+                m_waitingTimeCurrent(0),
+                m_cycleCounter(0) {}
+
+            CycleStatisticsReporter::CycleStatisticsReporter(const string &name, std::shared_ptr<odcore::dmcp::connection::Client> dmcpClient, const bool &profiling) :
+                Service("statistics"),
+                m_name(name),
+                m_dmcpClient(dmcpClient),
+                m_profiling(profiling),
+                m_reportCondition(),
+                m_profilingRecords(profiling ? NUMBER_OF_PROFILING_RECORDS : 0),
+                m_firstProfilingRecord(0),
+                m_numberOfProfilingRecords(0),
+                m_numberOfDroppedProfilingRecords(0),
+                m_hasRuntimeStatistic(false),
+                m_sliceConsumption(0),
+                m_hasCycleProfile(false),
+                m_cycleProfile(),
+                m_profilingRecordsToWrite(profiling ? NUMBER_OF_PROFILING_RECORDS : 0),
+                m_cycleProfileToWrite(),
+                m_profilingFile(NULL),
+                m_cycleStatisticsFile(NULL) {}
+
+            CycleStatisticsReporter::~CycleStatisticsReporter() {
+                if (m_profilingFile != NULL) {
+                    m_profilingFile->flush();
+                    m_profilingFile->close();
+                }
+                OPENDAVINCI_CORE_DELETE_POINTER(m_profilingFile);
+
+                if (m_cycleStatisticsFile != NULL) {
+                    m_cycleStatisticsFile->flush();
+                    m_cycleStatisticsFile->close();
+                }
+                OPENDAVINCI_CORE_DELETE_POINTER(m_cycleStatisticsFile);
+
+                if (m_numberOfDroppedProfilingRecords > 0) {
+                    clog << "(CycleStatisticsReporter) Dropped " << m_numberOfDroppedProfilingRecords << " profiling records." << endl;
+                }
+            }
+
+            bool CycleStatisticsReporter::addProfilingRecord(const ProfilingRecord &pr) {
+                Lock l(m_reportCondition);
+                if (m_numberOfProfilingRecords >= m_profilingRecords.size()) {
+                    m_numberOfDroppedProfilingRecords++;
+                    return false;
+                }
+
+                m_profilingRecords[(m_firstProfilingRecord + m_numberOfProfilingRecords) % m_profilingRecords.size()] = pr;
+                m_numberOfProfilingRecords++;
+
+                // Wake up the reporting thread only when a quarter of the records is occupied to reduce the context switches.
+                if (m_numberOfProfilingRecords >= (m_profilingRecords.size() / 4)) {
+                    m_reportCondition.wakeAll();
+                }
+                return true;
+            }
+
+            void CycleStatisticsReporter::reportRuntimeStatistic(const float &sliceConsumption) {
+                Lock l(m_reportCondition);
+                m_sliceConsumption = sliceConsumption;
+                m_hasRuntimeStatistic = true;
+                m_reportCondition.wakeAll();
+            }
+
+            void CycleStatisticsReporter::reportCycleProfile(const CycleProfile &cp) {
+                Lock l(m_reportCondition);
+                m_cycleProfile = cp;
+                m_hasCycleProfile = true;
+                m_reportCondition.wakeAll();
+            }
+
+            uint32_t CycleStatisticsReporter::getNumberOfDroppedProfilingRecords() const {
+                Lock l(m_reportCondition);
+                return m_numberOfDroppedProfilingRecords;
+            }
+
+            void CycleStatisticsReporter::beforeStop() {
+                Lock l(m_reportCondition);
+                m_reportCondition.wakeAll();
+            }
+
+            void CycleStatisticsReporter::run() {
+                serviceReady();
+
+                while (isRunning()) {
+                    {
+                        Lock l(m_reportCondition);
+                        if (!m_hasRuntimeStatistic && !m_hasCycleProfile) {
+                            // Write pending profiling records at least once per second.
+                            m_reportCondition.waitOnSignalWithTimeout(1000);
+                        }
+                    }
+
+                    report();
+                }
+
+                // Write the remaining entries.
+                report();
+            }
+
+            void CycleStatisticsReporter::report() {
+                uint32_t numberOfRecords = 0;
+                bool hasRuntimeStatistic = false;
+                float sliceConsumption = 0;
+                bool hasCycleProfile = false;
+                {
+                    Lock l(m_reportCondition);
+                    while (numberOfRecords < m_numberOfProfilingRecords) {
+                        m_profilingRecordsToWrite[numberOfRecords] = m_profilingRecords[(m_firstProfilingRecord + numberOfRecords) % m_profilingRecords.size()];
+                        numberOfRecords++;
+                    }
+                    m_firstProfilingRecord = 0;
+                    m_numberOfProfilingRecords = 0;
+
+                    hasRuntimeStatistic = m_hasRuntimeStatistic;
+                    sliceConsumption = m_sliceConsumption;
+                    m_hasRuntimeStatistic = false;
+
+                    hasCycleProfile = m_hasCycleProfile;
+                    if (hasCycleProfile) {
+                        m_cycleProfileToWrite = m_cycleProfile;
+                    }
+                    m_hasCycleProfile = false;
+                }
+
+                if (numberOfRecords > 0) {
+                    writeProfilingRecords(numberOfRecords);
+                }
+
+                if (hasRuntimeStatistic && m_dmcpClient.get()) {
+                    odcore::data::dmcp::RuntimeStatistic rts;
+                    rts.setSliceConsumption(sliceConsumption);
+                    m_dmcpClient->sendStatistics(rts);
+                }
+
+                if (hasCycleProfile) {
+                    CLOG1 << "(CycleStatisticsReporter) " << m_cycleProfileToWrite.toString() << endl;
+
+                    if (m_dmcpClient.get()) {
+                        m_dmcpClient->sendCycleStatistics(m_cycleProfileToWrite.getCycleStatistics());
+                    }
+                    if (m_profiling) {
+                        writeCycleProfile(m_cycleProfileToWrite);
+                    }
+                }
+            }
+
+            void CycleStatisticsReporter::writeProfilingRecords(const uint32_t &numberOfRecords) {
+                if (m_profilingFile == NULL) {
+                    stringstream sstr;
+                    sstr << m_name << "_" << TimeStamp().getYYYYMMDD_HHMMSS() << ".profiling.csv";
+                    m_profilingFile = new ofstream();
+                    m_profilingFile->open(sstr.str().c_str(), ios::out | ios::app);
+
+                    (*m_profilingFile) <<
+                        "timestamp_current_cycle" << ";" <<
+                        "timestamp_last_cycle" << ";" <<
+                        "freq" << ";" <<
+                        "last_wait_time" << ";" <<
+                        "time_consumption_current" << ";" <<
+                        "nominal_duration" << ";" <<
+                        "waiting_time_current" << ";" <<
+                        "percentage_load_current_slice" << ";" <<
+                        "percentage_waiting_current_slice" << ";" <<
+                        "cycle_counter" << endl;
+                }
+
+                for (uint32_t i = 0; i < numberOfRecords; i++) {
+                    const ProfilingRecord &pr = m_profilingRecordsToWrite[i];
+                    (*m_profilingFile) <<
+                        pr.m_current << ";" <<
+                        pr.m_lastCycle << ";" <<
+                        pr.m_freq << ";" <<
+                        pr.m_lastWaitTime << ";" <<
+                        pr.m_timeConsumptionCurrent << ";" <<
+                        pr.m_nominalDuration << ";" <<
+                        pr.m_waitingTimeCurrent << ";" <<
+                        (100.0-(pr.m_waitingTimeCurrent*100.0/(static_cast<float>(pr.m_nominalDuration)))) << ";" <<
+                        (pr.m_waitingTimeCurrent*100.0/(static_cast<float>(pr.m_nominalDuration))) << ";" <<
+                        pr.m_cycleCounter << "\n";
+                }
+                m_profilingFile->flush();
+            }
+
+            void CycleStatisticsReporter::writeCycleProfile(const CycleProfile &cp) {
+                if (m_cycleStatisticsFile == NULL) {
+                    stringstream sstr;
+                    sstr << m_name << "_" << TimeStamp().getYYYYMMDD_HHMMSS() << ".cyclestatistics.csv";
+                    m_cycleStatisticsFile = new ofstream();
+                    m_cycleStatisticsFile->open(sstr.str().c_str(), ios::out | ios::app);
+
+                    (*m_cycleStatisticsFile) <<
+                        "timestamp" << ";" <<
+                        "nominal_duration" << ";" <<
+                        "number_of_cycles" << ";" <<
+                        "number_of_overruns" << ";" <<
+                        "minimum_period_deviation" << ";" <<
+                        "maximum_period_deviation" << ";" <<
+                        "maximum_execution_time" << ";" <<
+                        "period_deviation_histogram" << ";" <<
+                        "execution_time_histogram" << ";" <<
+                        "worst_cycles" << endl;
+                }
+
+                (*m_cycleStatisticsFile) <<
+                    TimeStamp().toMicroseconds() << ";" <<
+                    cp.getNominalDuration() << ";" <<
+                    cp.getNumberOfCycles() << ";" <<
+                    cp.getNumberOfOverruns() << ";" <<
+                    cp.getMinimumPeriodDeviation() << ";" <<
+                    cp.getMaximumPeriodDeviation() << ";" <<
+                    cp.getMaximumExecutionTime() << ";";
+
+                // Histograms are written as space-separated counts per bucket.
+                for (uint32_t i = 0; i < CycleProfile::NUMBER_OF_BUCKETS; i++) {
+                    (*m_cycleStatisticsFile) << ((i > 0) ? " " : "") << cp.getPeriodDeviationHistogram(i);
+                }
+                (*m_cycleStatisticsFile) << ";";
+                for (uint32_t i = 0; i < CycleProfile::NUMBER_OF_BUCKETS; i++) {
+                    (*m_cycleStatisticsFile) << ((i > 0) ? " " : "") << cp.getExecutionTimeHistogram(i);
+                }
+                (*m_cycleStatisticsFile) << ";";
+
+                // Worst cycles are written as start:execution time:period deviation.
+                for (uint32_t i = 0; i < cp.getNumberOfWorstCycles(); i++) {
+                    const CycleProfile::Cycle &c = cp.getWorstCycle(i);
+                    (*m_cycleStatisticsFile) << ((i > 0) ? " " : "") << c.m_start << ":" << c.m_executionTime << ":" << c.m_periodDeviation;
+                }
+                (*m_cycleStatisticsFile) << endl;
+            }
+
+        }
+    }
+} // odcore::base::module
@@ -17,8 +17,13 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <iostream>
+
+#include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/base/module/DataTriggeredConferenceClientModule.h"
+#include "opendavinci/odcore/io/conference/ContainerDispatcher.h"
 #include "opendavinci/generated/odcore/data/dmcp/ModuleStateMessage.h"
+#include "opendavinci/generated/odcore/data/dmcp/ServerInformation.h"
 
 namespace odcore {
     namespace base {
@@ -29,22 +34,100 @@ namespace odcore {
             using namespace odcore;
             using namespace odcore::base;
             using namespace odcore::exceptions;
+            using namespace odcore::io::conference;
 
             DataTriggeredConferenceClientModule::DataTriggeredConferenceClientModule(const int32_t &argc, char **argv, const string &name) throw (InvalidArgumentException) :
-                    AbstractConferenceClientModule(argc, argv, name) {}
+                    AbstractConferenceClientModule(argc, argv, name),
+                    m_containerDispatcherMutex(),
+                    m_containerDispatcher() {}
 
             DataTriggeredConferenceClientModule::~DataTriggeredConferenceClientModule() {}
 
             odcore::data::dmcp::ModuleExitCodeMessage::ModuleExitCode DataTriggeredConferenceClientModule::body() {
-                while (getModuleStateAndWaitForRemainingTimeInTimeslice() == odcore::data::dmcp::ModuleStateMessage::RUNNING) {
-                    // Do nothing.
-                    //
-                    // This empty implementation is required to ensure proper scheduling.
+                const KeyValueConfiguration kvc = getKeyValueConfiguration();
+
+                bool eventDriven = false;
+                try {
+                    eventDriven = (kvc.getValue<uint32_t>(getName() + ".datatriggered.eventdriven") == 1);
+                }
+                catch(...) {}
+
+                if (eventDriven && !isRealtime() && (getServerInformation().getManagedLevel() == odcore::data::dmcp::ServerInformation::ML_NONE) ) {
+                    uint32_t capacity = 1024;
+                    try {
+                        capacity = kvc.getValue<uint32_t>(getName() + ".datatriggered.capacity");
+                    }
+                    catch(...) {}
+
+                    uint32_t numberOfWorkers = 0;
+                    try {
+                        numberOfWorkers = kvc.getValue<uint32_t>(getName() + ".datatriggered.workers");
+                    }
+                    catch(...) {}
+
+                    runEventDriven(capacity, numberOfWorkers);
+                }
+                else {
+                    while (getModuleStateAndWaitForRemainingTimeInTimeslice() == odcore::data::dmcp::ModuleStateMessage::RUNNING) {
+                        // Do nothing.
+                        //
+                        // This empty implementation is required to ensure proper scheduling.
+                    }
                 }
 
                 return odcore::data::dmcp::ModuleExitCodeMessage::OKAY;
             }
 
+            void DataTriggeredConferenceClientModule::runEventDriven(const uint32_t &capacity, const uint32_t &numberOfWorkers) {
+                CLOG1 << "(DataTriggeredConferenceClientModule) event-driven, capacity: " << capacity << ", workers: " << numberOfWorkers << endl;
+
+                {
+                    Lock l(m_containerDispatcherMutex);
+                    m_containerDispatcher = unique_ptr<ContainerDispatcher>(new ContainerDispatcher(*this, capacity, numberOfWorkers));
+                    m_containerDispatcher->start();
+                }
+
+                // From now on, the receiving thread only queues the containers.
+                getContainerConference()->setContainerListener(m_containerDispatcher.get());
+
+                // The containers are delivered while waiting for the remaining time of each time slice.
+                while (getModuleStateAndWaitForRemainingTimeInTimeslice() == odcore::data::dmcp::ModuleStateMessage::RUNNING) {}
+
+                // Deliver containers directly again during tearDown().
+                getContainerConference()->setContainerListener(this);
+
+                {
+                    Lock l(m_containerDispatcherMutex);
+                    m_containerDispatcher->stop();
+                    if (m_containerDispatcher->getNumberOfDroppedContainers() > 0) {
+                        clog << "(DataTriggeredConferenceClientModule) Dropped " << m_containerDispatcher->getNumberOfDroppedContainers() << " containers." << endl;
+                    }
+                    m_containerDispatcher.reset();
+                }
+            }
+
+            void DataTriggeredConferenceClientModule::waitForRemainingTimeInTimeslice(const long &waitingTimeInMicroseconds) {
+                // m_containerDispatcher is only modified by the body's thread calling this method.
+                if (m_containerDispatcher.get() != NULL) {
+                    const long ONE_SECOND_IN_MICROSECONDS = 1000 * 1000 * 1;
+                    const bool waitingTimeValid = ( (waitingTimeInMicroseconds > 0) && (waitingTimeInMicroseconds < ONE_SECOND_IN_MICROSECONDS) );
+                    m_containerDispatcher->dispatchFor(waitingTimeValid ? waitingTimeInMicroseconds : 0);
+                }
+                else {
+                    AbstractConferenceClientModule::waitForRemainingTimeInTimeslice(waitingTimeInMicroseconds);
+                }
+            }
+
+            void DataTriggeredConferenceClientModule::handleConnectionLost() {
+                AbstractConferenceClientModule::handleConnectionLost();
+
+                // Let the body notice the changed module state immediately.
+                Lock l(m_containerDispatcherMutex);
+                if (m_containerDispatcher.get() != NULL) {
+                    m_containerDispatcher->wakeUp();
+                }
+            }
+
         }
     }
 } // odcore::base
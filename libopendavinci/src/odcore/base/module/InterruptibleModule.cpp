@@ -18,7 +18,6 @@
  */
 
 #include "opendavinci/odcore/base/Lock.h"
-#include "opendavinci/odcore/base/Thread.h"
 #include "opendavinci/odcore/base/module/Breakpoint.h"
 #include "opendavinci/odcore/base/module/InterruptibleModule.h"
 
@@ -51,10 +50,9 @@ namespace odcore {
 
                 // Reach breakpoint.
                 if (bp != NULL) {
+                    // Containers are delivered by their own threads or synchronously
+                    // while the breakpoint is held; thus, continue without yielding.
                     bp->reached();
-
-                    // Yielding other threads to deliver containers.
-                    Thread::usleepFor(100);
                 }
                 else {
                     // Yielding other threads and adjust to a fixed frequency if no breakpoint is set.
@@ -22,17 +22,18 @@
     #include <sys/time.h>
 #endif
 
+#include <algorithm>
 #include <cmath>
 #include <exception>
-#include <fstream>
 #include <iostream>
-#include <sstream>
 #include <vector>
 
 #include "opendavinci/odcontext/base/ControlledTime.h"
 #include "opendavinci/odcontext/base/ControlledTimeFactory.h"
 #include "opendavinci/odcontext/base/RuntimeControl.h"
+#include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/base/Thread.h"
+#include "opendavinci/odcore/base/module/CycleStatisticsReporter.h"
 #include "opendavinci/odcore/base/module/ManagedClientModule.h"
 #include "opendavinci/odcore/base/module/ManagedClientModuleContainerConference.h"
 #include "opendavinci/odcore/data/Container.h"
@@ -41,7 +42,6 @@
 #include "opendavinci/odcore/exceptions/Exceptions.h"
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/generated/odcore/data/dmcp/ModuleStateMessage.h"
-#include "opendavinci/generated/odcore/data/dmcp/RuntimeStatistic.h"
 #include "opendavinci/generated/odcore/data/dmcp/ServerInformation.h"
 
 namespace odcore {
@@ -65,29 +65,35 @@ namespace odcore {
                 m_lastCycle(),
                 m_lastWaitTime(0),
                 m_cycleCounter(0),
-                m_profilingFile(NULL),
+                m_isFirstCycle(true),
+                m_cycleProfileMutex(),
+                m_cycleProfile(),
+                m_cycleStatisticsInterval(10),
+                m_lastCycleStatistics(),
+                m_cycleStatisticsReporter(),
                 m_firstCallToBreakpoint_ManagedLevel_Pulse(true),
                 m_time(),
                 m_controlledTimeFactory(NULL),
                 m_pulseMessage(),
                 m_localContainerConference(NULL),
                 m_hasExternalContainerConference(false),
-                m_containerConference(NULL) {
+                m_containerConference(NULL),
+                m_subscribedDataTypesMutex(),
+                m_listOfSubscribedDataTypes(),
+                m_subscribesToAllDataTypes(false),
+                m_hasChangedSubscribedDataTypes(false) {
                 m_localContainerConference = std::shared_ptr<odcore::io::conference::ContainerConference>(new ManagedClientModuleContainerConference());
             }
 
             ManagedClientModule::~ManagedClientModule() {
-                if (m_profilingFile != NULL) {
-                    m_profilingFile->flush();
-                    m_profilingFile->close();
+                if (m_cycleStatisticsReporter.get()) {
+                    m_cycleStatisticsReporter->stop();
                 }
 
                 if (m_hasExternalContainerConference) {
                     m_containerConference.reset();
                     m_hasExternalContainerConference = false;
                 }
-
-                OPENDAVINCI_CORE_DELETE_POINTER(m_profilingFile);
             }
 
             void ManagedClientModule::DMCPconnectionLost() {}
@@ -108,6 +114,22 @@ namespace odcore {
                 return m_containerConference;
             }
 
+            void ManagedClientModule::subscribeTo(const int32_t &dataType) {
+                Lock l(m_subscribedDataTypesMutex);
+                if (find(m_listOfSubscribedDataTypes.begin(), m_listOfSubscribedDataTypes.end(), dataType) == m_listOfSubscribedDataTypes.end()) {
+                    m_listOfSubscribedDataTypes.push_back(dataType);
+                    m_hasChangedSubscribedDataTypes = !m_subscribesToAllDataTypes;
+                }
+            }
+
+            void ManagedClientModule::subscribeToAllDataTypes() {
+                Lock l(m_subscribedDataTypesMutex);
+                if (!m_subscribesToAllDataTypes) {
+                    m_subscribesToAllDataTypes = true;
+                    m_hasChangedSubscribedDataTypes = true;
+                }
+            }
+
             const TimeStamp ManagedClientModule::getStartOfCurrentCycle() const {
                 return m_startOfCurrentCycle;
             }
@@ -116,6 +138,11 @@ namespace odcore {
                 return m_startOfLastCycle;
             }
 
+            const CycleProfile ManagedClientModule::getCycleProfile() const {
+                Lock l(m_cycleProfileMutex);
+                return m_cycleProfile;
+            }
+
             void ManagedClientModule::wait() {
                 // Sanity check for realtime execution.
                 if (isRealtime() && getServerInformation().getManagedLevel() != odcore::data::dmcp::ServerInformation::ML_NONE) {
@@ -154,6 +181,38 @@ namespace odcore {
             }
 
             odcore::data::dmcp::ModuleExitCodeMessage::ModuleExitCode ManagedClientModule::runModuleImplementation() {
+                try {
+                    m_cycleStatisticsInterval = getKeyValueConfiguration().getValue<uint32_t>(getName() + ".cyclestatistics.interval");
+                }
+                catch(...) {}
+
+                // The reporter's thread is only needed to send CycleStatistics or
+                // to write profiling data; it is created before a realtime
+                // scheduling policy is set for the body.
+                if ( (m_cycleStatisticsInterval > 0) || isProfiling() ) {
+                    m_cycleStatisticsReporter = unique_ptr<CycleStatisticsReporter>(new CycleStatisticsReporter(getName(), getDMCPClient(), isProfiling()));
+                    m_cycleStatisticsReporter->start();
+                }
+                m_lastCycleStatistics = TimeStamp();
+
+                odcore::data::dmcp::ModuleExitCodeMessage::ModuleExitCode retVal = runModuleImplementation_ManagedLevel();
+
+                // Report the remaining cycles and write all pending profiling data.
+                if (m_cycleStatisticsReporter.get()) {
+                    {
+                        Lock l(m_cycleProfileMutex);
+                        if ( (m_cycleStatisticsInterval > 0) && (m_cycleProfile.getNumberOfCycles() > 0) ) {
+                            m_cycleStatisticsReporter->reportCycleProfile(m_cycleProfile);
+                            m_cycleProfile.reset();
+                        }
+                    }
+                    m_cycleStatisticsReporter->stop();
+                }
+
+                return retVal;
+            }
+
+            odcore::data::dmcp::ModuleExitCodeMessage::ModuleExitCode ManagedClientModule::runModuleImplementation_ManagedLevel() {
                 // Sanity check for realtime execution.
                 if (isRealtime() && getServerInformation().getManagedLevel() != odcore::data::dmcp::ServerInformation::ML_NONE) {
                     OPENDAVINCI_CORE_THROW_EXCEPTION(InvalidArgumentException,
@@ -243,38 +302,17 @@ namespace odcore {
             }
 
             void ManagedClientModule::logProfilingData(const TimeStamp &current, const TimeStamp &lastCycle, const float &freq, const long &lastWaitTime, const long &timeConsumptionCurrent, const long &nominalDuration, const long &waitingTimeCurrent, const int32_t &cycleCounter) {
-                if (m_profilingFile == NULL) {
-                    stringstream sstr;
-                    sstr << getName() << "_" << TimeStamp().getYYYYMMDD_HHMMSS() << ".profiling.csv";
-                    m_profilingFile = new ofstream();
-                    m_profilingFile->open(sstr.str().c_str(), ios::out | ios::app);
-
-                    (*m_profilingFile) <<
-                        "timestamp_current_cycle" << ";" <<
-                        "timestamp_last_cycle" << ";" <<
-                        "freq" << ";" <<
-                        "last_wait_time" << ";" <<
-                        "time_consumption_current" << ";" <<
-                        "nominal_duration" << ";" <<
-                        "waiting_time_current" << ";" <<
-                        "percentage_load_current_slice" << ";" <<
-                        "percentage_waiting_current_slice" << ";" <<
-                        "cycle_counter" << endl;
-                }
-
-                if (m_profilingFile != NULL) {
-                    (*m_profilingFile) <<
-                        current.toMicroseconds() << ";" <<
-                        lastCycle.toMicroseconds() << ";" <<
-                        freq << ";" <<
-                        lastWaitTime << ";" <<
-                        timeConsumptionCurrent << ";" <<
-                        nominalDuration << ";" <<
-                        waitingTimeCurrent << ";" <<
-                        (100.0-(waitingTimeCurrent*100.0/(static_cast<float>(nominalDuration)))) << ";" <<
-                        (waitingTimeCurrent*100.0/(static_cast<float>(nominalDuration))) << ";" <<
-                        cycleCounter << endl;
-                    m_profilingFile->flush();
+                if (m_cycleStatisticsReporter.get()) {
+                    CycleStatisticsReporter::ProfilingRecord pr;
+                    pr.m_current = current.toMicroseconds();
+                    pr.m_lastCycle = lastCycle.toMicroseconds();
+                    pr.m_freq = freq;
+                    pr.m_lastWaitTime = lastWaitTime;
+                    pr.m_timeConsumptionCurrent = timeConsumptionCurrent;
+                    pr.m_nominalDuration = nominalDuration;
+                    pr.m_waitingTimeCurrent = waitingTimeCurrent;
+                    pr.m_cycleCounter = cycleCounter;
+                    m_cycleStatisticsReporter->addProfilingRecord(pr);
                 }
             }
 
@@ -300,6 +338,14 @@ namespace odcore {
                     // Execute the module's body.
                     retVal = body();
 
+                    const CycleProfile cp = getCycleProfile();
+                    if (isRealtime()) {
+                        clog << "(ManagedClientModule) cycles since last report: " << cp.toString() << endl;
+                    }
+                    else {
+                        CLOG1 << "(ManagedClientModule) cycles since last report: " << cp.toString() << endl;
+                    }
+
                     setModuleState(odcore::data::dmcp::ModuleStateMessage::NOT_RUNNING);
                     if (getDMCPClient().get()) {
                         getDMCPClient()->sendModuleState(odcore::data::dmcp::ModuleStateMessage::NOT_RUNNING);
@@ -340,6 +386,14 @@ namespace odcore {
                 const long NOMINAL_DURATION_OF_ONE_SLICE = static_cast<long>((1.0f/FREQ) * ONE_SECOND_IN_MICROSECONDS);
                 const long WAITING_TIME_OF_CURRENT_SLICE = NOMINAL_DURATION_OF_ONE_SLICE - TIME_CONSUMPTION_OF_CURRENT_SLICE;
 
+                // Deviation of the last cycle's duration from the nominal duration.
+                if (!m_isFirstCycle) {
+                    const int64_t PERIOD_DEVIATION = (current.toMicroseconds() - m_lastCycle.toMicroseconds()) - NOMINAL_DURATION_OF_ONE_SLICE;
+                    Lock l(m_cycleProfileMutex);
+                    m_cycleProfile.add(m_lastCycle.toMicroseconds(), TIME_CONSUMPTION_OF_CURRENT_SLICE, PERIOD_DEVIATION, NOMINAL_DURATION_OF_ONE_SLICE);
+                }
+                m_isFirstCycle = false;
+
                 // Inform supercomponent about statistical runtime data.
                 bool sendStatistics = false;
                 if (FREQ < 1) {
@@ -356,11 +410,20 @@ namespace odcore {
                     }
                 }
 
-                // Send RuntimeStatistic to supercomponent.
-                if (sendStatistics && getDMCPClient().get()) {
-                    odcore::data::dmcp::RuntimeStatistic rts;
-                    rts.setSliceConsumption(static_cast<float>(TIME_CONSUMPTION_OF_CURRENT_SLICE)/static_cast<float>(NOMINAL_DURATION_OF_ONE_SLICE));
-                    getDMCPClient()->sendStatistics(rts);
+                // Send RuntimeStatistic and CycleStatistics to supercomponent without allocating memory in this thread.
+                if (m_cycleStatisticsReporter.get()) {
+                    if (sendStatistics) {
+                        m_cycleStatisticsReporter->reportRuntimeStatistic(static_cast<float>(TIME_CONSUMPTION_OF_CURRENT_SLICE)/static_cast<float>(NOMINAL_DURATION_OF_ONE_SLICE));
+                    }
+
+                    if ( (m_cycleStatisticsInterval > 0) && ((current - m_lastCycleStatistics).toMicroseconds() >= static_cast<long>(m_cycleStatisticsInterval) * ONE_SECOND_IN_MICROSECONDS) ) {
+                        {
+                            Lock l(m_cycleProfileMutex);
+                            m_cycleStatisticsReporter->reportCycleProfile(m_cycleProfile);
+                            m_cycleProfile.reset();
+                        }
+                        m_lastCycleStatistics = current;
+                    }
                 }
 
                 // Check whether we need to save profiling data.
@@ -385,13 +448,17 @@ namespace odcore {
             void ManagedClientModule::wait_ManagedLevel_None() {
                 const long WAITING_TIME_OF_CURRENT_SLICE = getWaitingTimeAndUpdateRuntimeStatistics();
 
+                waitForRemainingTimeInTimeslice(WAITING_TIME_OF_CURRENT_SLICE);
+
+                CLOG2 << "Starting next cycle at " << TimeStamp().toString() << endl;
+            }
+
+            void ManagedClientModule::waitForRemainingTimeInTimeslice(const long &waitingTimeInMicroseconds) {
                 // Enforce waiting to consume the rest of the time slice but ensure that there is no overflow.
                 const long ONE_SECOND_IN_MICROSECONDS = 1000 * 1000 * 1;
-                if ( (WAITING_TIME_OF_CURRENT_SLICE > 0) && (WAITING_TIME_OF_CURRENT_SLICE < ONE_SECOND_IN_MICROSECONDS) ) {
-                    Thread::usleepFor(WAITING_TIME_OF_CURRENT_SLICE);
+                if ( (waitingTimeInMicroseconds > 0) && (waitingTimeInMicroseconds < ONE_SECOND_IN_MICROSECONDS) ) {
+                    Thread::usleepFor(waitingTimeInMicroseconds);
                 }
-
-                CLOG2 << "Starting next cycle at " << TimeStamp().toString() << endl;
             }
 
             void ManagedClientModule::wait_ManagedLevel_None_realtime() {
@@ -656,6 +723,16 @@ namespace odcore {
                 // Confirm the successful processing of the received pulse and
                 // deliver all containers from this module to supercomponent.
                 if (getDMCPClient().get()) {
+                    // Inform supercomponent about changed subscriptions before
+                    // the ACK so that they are considered for the next pulse.
+                    {
+                        Lock l(m_subscribedDataTypesMutex);
+                        if (m_hasChangedSubscribedDataTypes) {
+                            getDMCPClient()->sendSubscribedDataTypes(m_subscribesToAllDataTypes ? vector<int32_t>() : m_listOfSubscribedDataTypes);
+                            m_hasChangedSubscribedDataTypes = false;
+                        }
+                    }
+
                     getDMCPClient()->sendPulseAckContainers(reinterpret_cast<ManagedClientModuleContainerConference*>(m_localContainerConference.operator->())->getListOfContainers());
 
                     // After all containers have been delivered to supercomponent,
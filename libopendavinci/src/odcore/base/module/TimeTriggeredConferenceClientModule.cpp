@@ -20,8 +20,6 @@
 #include "opendavinci/odcore/base/AbstractDataStore.h"
 #include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/base/module/TimeTriggeredConferenceClientModule.h"
-#include "opendavinci/odcore/wrapper/KeyValueDatabase.h"
-#include "opendavinci/odcore/wrapper/KeyValueDatabaseFactory.h"
 
 namespace odcore {
     namespace base {
@@ -41,8 +39,8 @@ namespace odcore {
                 m_listOfDataStores(),
                 m_mapOfListOfDataStores(),
                 m_keyValueDataStore() {
-                // Create an in-memory database.
-                m_keyValueDataStore = std::shared_ptr<KeyValueDataStore>(new KeyValueDataStore(wrapper::KeyValueDatabaseFactory::createKeyValueDatabase()));
+                // Keep the latest Container per data type in memory.
+                m_keyValueDataStore = std::shared_ptr<KeyValueDataStore>(new KeyValueDataStore());
             }
 
             TimeTriggeredConferenceClientModule::~TimeTriggeredConferenceClientModule() {
@@ -94,6 +92,9 @@ namespace odcore {
                 Lock l(m_dataStoresMutex);
 
                 m_listOfDataStores.push_back(&dataStore);
+
+                // A data store for all containers requires all data types in ML_SIMULATION.
+                subscribeToAllDataTypes();
             }
 
             void TimeTriggeredConferenceClientModule::addDataStoreFor(const int32_t &datatype, AbstractDataStore &dataStore) {
@@ -102,9 +103,14 @@ namespace odcore {
                 vector<AbstractDataStore*> listOfDataStores = m_mapOfListOfDataStores[datatype];
                 listOfDataStores.push_back(&dataStore);
                 m_mapOfListOfDataStores[datatype] = listOfDataStores;
+
+                subscribeTo(datatype);
             }
 
             KeyValueDataStore& TimeTriggeredConferenceClientModule::getKeyValueDataStore() {
+                // The KeyValueDataStore holds the latest container of every data type.
+                subscribeToAllDataTypes();
+
                 return *m_keyValueDataStore;
             }
 
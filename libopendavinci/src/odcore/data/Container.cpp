@@ -243,6 +243,15 @@ namespace odcore {
             return in;
         }
 
+        uint32_t Container::getSizeOfData() const {
+            // Determine the end of the get area and restore the current read position.
+            stringbuf *buffer = m_serializedData.rdbuf();
+            const streampos current = buffer->pubseekoff(0, ios_base::cur, ios_base::in);
+            const streampos end = buffer->pubseekoff(0, ios_base::end, ios_base::in);
+            buffer->pubseekpos(current, ios_base::in);
+            return (end > 0) ? static_cast<uint32_t>(end) : 0;
+        }
+
         const string Container::toString() const {
             switch (getDataType()) {
                 case UNDEFINEDDATA:
@@ -0,0 +1,236 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <cstring>
+
+#include "opendavinci/odcore/data/image/ImageKernels.h"
+
+// SSSE3 is enabled per function and selected at runtime; hence, no additional compiler flags are needed.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__clang__) || (defined(__GNUC__) && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 9)))))
+    #define OPENDAVINCI_IMAGEKERNELS_SSSE3
+    #include <tmmintrin.h>
+#endif
+
+namespace odcore {
+    namespace data {
+        namespace image {
+
+            using namespace std;
+
+            namespace {
+                void reverseRow(const uint8_t *src, uint8_t *dst, const uint32_t &width, const uint32_t &bytesPerPixel) {
+                    if (bytesPerPixel == 1) {
+                        for (uint32_t x = 0; x < width; x++) {
+                            dst[width - 1 - x] = src[x];
+                        }
+                    }
+                    else if (bytesPerPixel == 3) {
+                        for (uint32_t x = 0; x < width; x++) {
+                            const uint8_t *s = src + 3 * x;
+                            uint8_t *d = dst + 3 * (width - 1 - x);
+                            d[0] = s[0];
+                            d[1] = s[1];
+                            d[2] = s[2];
+                        }
+                    }
+                    else {
+                        for (uint32_t x = 0; x < width; x++) {
+                            ::memcpy(dst + bytesPerPixel * (width - 1 - x), src + bytesPerPixel * x, bytesPerPixel);
+                        }
+                    }
+                }
+
+                void swapRedBlueInRow(const uint8_t *src, uint8_t *dst, const uint32_t &start, const uint32_t &rowBytes) {
+                    for (uint32_t i = start; (i + 3) <= rowBytes; i += 3) {
+                        const uint8_t first = src[i];
+                        dst[i + 1] = src[i + 1];
+                        dst[i] = src[i + 2];
+                        dst[i + 2] = first;
+                    }
+                }
+
+#ifdef OPENDAVINCI_IMAGEKERNELS_SSSE3
+                bool hasSSSE3() {
+                    static const bool HAS_SSSE3 = (__builtin_cpu_init(), (__builtin_cpu_supports("ssse3") != 0));
+                    return HAS_SSSE3;
+                }
+
+                __attribute__((target("ssse3")))
+                void reverseRowSSSE3(const uint8_t *src, uint8_t *dst, const uint32_t &width, const uint32_t &bytesPerPixel) {
+                    if (bytesPerPixel == 1) {
+                        const __m128i mask = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+                        uint32_t x = 0;
+                        for (; (x + 16) <= width; x += 16) {
+                            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+                            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + width - 16 - x), _mm_shuffle_epi8(v, mask));
+                        }
+                        for (; x < width; x++) {
+                            dst[width - 1 - x] = src[x];
+                        }
+                    }
+                    else if (bytesPerPixel == 3) {
+                        // Five pixels are reversed per shuffle; the 16th byte that is
+                        // stored belongs to the group that is processed next. Thus,
+                        // the groups are processed from the end of the source row
+                        // and the first group is left to the scalar code.
+                        const __m128i mask = _mm_setr_epi8(12, 13, 14, 9, 10, 11, 6, 7, 8, 3, 4, 5, 0, 1, 2, 15);
+                        const uint32_t rowBytes = 3 * width;
+                        const uint32_t groups = (rowBytes >= 16) ? ((rowBytes - 16) / 15 + 1) : 0;
+                        for (uint32_t g = groups - 1; (groups > 1) && (g > 0); g--) {
+                            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 15 * g));
+                            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 3 * (width - 5 - 5 * g)), _mm_shuffle_epi8(v, mask));
+                        }
+                        const uint32_t head = (groups > 1) ? 5 : width;
+                        for (uint32_t x = 0; x < head; x++) {
+                            const uint8_t *s = src + 3 * x;
+                            uint8_t *d = dst + 3 * (width - 1 - x);
+                            d[0] = s[0];
+                            d[1] = s[1];
+                            d[2] = s[2];
+                        }
+                        for (uint32_t x = ((groups > 1) ? 5 * groups : width); x < width; x++) {
+                            const uint8_t *s = src + 3 * x;
+                            uint8_t *d = dst + 3 * (width - 1 - x);
+                            d[0] = s[0];
+                            d[1] = s[1];
+                            d[2] = s[2];
+                        }
+                    }
+                    else if (bytesPerPixel == 4) {
+                        uint32_t x = 0;
+                        for (; (x + 4) <= width; x += 4) {
+                            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 4 * x));
+                            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4 * (width - 4 - x)), _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3)));
+                        }
+                        for (; x < width; x++) {
+                            ::memcpy(dst + 4 * (width - 1 - x), src + 4 * x, 4);
+                        }
+                    }
+                    else {
+                        reverseRow(src, dst, width, bytesPerPixel);
+                    }
+                }
+
+                __attribute__((target("ssse3")))
+                void swapRedBlueInRowSSSE3(const uint8_t *src, uint8_t *dst, const uint32_t &rowBytes) {
+                    // Five pixels are swapped per shuffle; the 16th byte is stored
+                    // unchanged and handled with the next five pixels.
+                    const __m128i mask = _mm_setr_epi8(2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, 15);
+                    uint32_t i = 0;
+                    for (; (i + 16) <= rowBytes; i += 15) {
+                        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(v, mask));
+                    }
+                    swapRedBlueInRow(src, dst, i, rowBytes);
+                }
+#endif
+            }
+
+            void ImageKernels::copy(const uint8_t *src, const uint32_t &srcStride, uint8_t *dst, const uint32_t &dstStride, const uint32_t &width, const uint32_t &height, const uint32_t &bytesPerPixel) {
+                const uint32_t rowBytes = width * bytesPerPixel;
+                if ( (srcStride == rowBytes) && (dstStride == rowBytes) ) {
+                    ::memcpy(dst, src, rowBytes * height);
+                    return;
+                }
+                for (uint32_t y = 0; y < height; y++) {
+                    ::memcpy(dst + y * dstStride, src + y * srcStride, rowBytes);
+                }
+            }
+
+            void ImageKernels::flip(const uint8_t *src, const uint32_t &srcStride, uint8_t *dst, const uint32_t &dstStride, const uint32_t &width, const uint32_t &height, const uint32_t &bytesPerPixel, const FLIPMODE &mode) {
+                const uint32_t rowBytes = width * bytesPerPixel;
+#ifdef OPENDAVINCI_IMAGEKERNELS_SSSE3
+                const bool useSSSE3 = hasSSSE3();
+#endif
+                for (uint32_t y = 0; y < height; y++) {
+                    const uint8_t *srcRow = src + y * srcStride;
+                    uint8_t *dstRow = dst + ((mode == HORIZONTAL) ? y : (height - 1 - y)) * dstStride;
+
+                    if (mode == VERTICAL) {
+                        ::memcpy(dstRow, srcRow, rowBytes);
+                        continue;
+                    }
+#ifdef OPENDAVINCI_IMAGEKERNELS_SSSE3
+                    if (useSSSE3) {
+                        reverseRowSSSE3(srcRow, dstRow, width, bytesPerPixel);
+                        continue;
+                    }
+#endif
+                    reverseRow(srcRow, dstRow, width, bytesPerPixel);
+                }
+            }
+
+            void ImageKernels::swapRedBlue(const uint8_t *src, const uint32_t &srcStride, uint8_t *dst, const uint32_t &dstStride, const uint32_t &width, const uint32_t &height) {
+                const uint32_t rowBytes = width * 3;
+#ifdef OPENDAVINCI_IMAGEKERNELS_SSSE3
+                const bool useSSSE3 = hasSSSE3();
+#endif
+                for (uint32_t y = 0; y < height; y++) {
+#ifdef OPENDAVINCI_IMAGEKERNELS_SSSE3
+                    if (useSSSE3) {
+                        swapRedBlueInRowSSSE3(src + y * srcStride, dst + y * dstStride, rowBytes);
+                        continue;
+                    }
+#endif
+                    swapRedBlueInRow(src + y * srcStride, dst + y * dstStride, 0, rowBytes);
+                }
+            }
+
+            void ImageKernels::toGrayscale(const uint8_t *src, const uint32_t &srcStride, uint8_t *dst, const uint32_t &dstStride, const uint32_t &width, const uint32_t &height, const bool &isBGR) {
+                // Fixed point weights (0.299, 0.587, 0.114) * 256.
+                const uint32_t weightFirst = isBGR ? 29 : 77;
+                const uint32_t weightLast = isBGR ? 77 : 29;
+                const uint32_t weightGreen = 150;
+                for (uint32_t y = 0; y < height; y++) {
+                    const uint8_t *s = src + y * srcStride;
+                    uint8_t *d = dst + y * dstStride;
+                    for (uint32_t x = 0; x < width; x++) {
+                        d[x] = static_cast<uint8_t>((weightFirst * s[3 * x] + weightGreen * s[3 * x + 1] + weightLast * s[3 * x + 2] + 128) >> 8);
+                    }
+                }
+            }
+
+            void ImageKernels::downscale(const uint8_t *src, const uint32_t &srcStride, uint8_t *dst, const uint32_t &dstStride, const uint32_t &width, const uint32_t &height, const uint32_t &bytesPerPixel, const uint32_t &factor) {
+                if (factor == 0) {
+                    return;
+                }
+
+                const uint32_t dstWidth = width / factor;
+                const uint32_t dstHeight = height / factor;
+                const uint32_t numberOfSamples = factor * factor;
+                for (uint32_t y = 0; y < dstHeight; y++) {
+                    uint8_t *d = dst + y * dstStride;
+                    for (uint32_t x = 0; x < dstWidth; x++) {
+                        for (uint32_t c = 0; c < bytesPerPixel; c++) {
+                            uint32_t sum = 0;
+                            for (uint32_t j = 0; j < factor; j++) {
+                                const uint8_t *s = src + (y * factor + j) * srcStride + x * factor * bytesPerPixel + c;
+                                for (uint32_t i = 0; i < factor; i++) {
+                                    sum += s[i * bytesPerPixel];
+                                }
+                            }
+                            d[x * bytesPerPixel + c] = static_cast<uint8_t>((sum + numberOfSamples / 2) / numberOfSamples);
+                        }
+                    }
+                }
+            }
+
+        }
+    }
+} // odcore::data::image
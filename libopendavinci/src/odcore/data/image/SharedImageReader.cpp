@@ -0,0 +1,128 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <iostream>
+
+#include "opendavinci/odcore/base/module/AbstractCIDModule.h"
+#include "opendavinci/odcore/data/image/ImageKernels.h"
+#include "opendavinci/odcore/data/image/SharedImageReader.h"
+#include "opendavinci/odcore/wrapper/SharedMemory.h"
+#include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"
+#include "opendavinci/generated/odcore/data/image/SharedImage.h"
+
+namespace odcore {
+    namespace data {
+        namespace image {
+
+            using namespace std;
+
+            SharedImageReader::View::View(SharedImageReader &reader, const SharedImage &si) :
+                m_sharedMemory(reader.getSharedMemory(si)),
+                m_size(SharedImageReader::getSize(si)) {
+                if (m_sharedMemory.get() != NULL) {
+                    m_sharedMemory->lock();
+                }
+            }
+
+            SharedImageReader::View::~View() {
+                release();
+            }
+
+            bool SharedImageReader::View::isValid() const {
+                return (m_sharedMemory.get() != NULL);
+            }
+
+            const uint8_t* SharedImageReader::View::getData() const {
+                return isValid() ? static_cast<const uint8_t*>(m_sharedMemory->getSharedMemory()) : NULL;
+            }
+
+            uint32_t SharedImageReader::View::getSize() const {
+                return isValid() ? m_size : 0;
+            }
+
+            void SharedImageReader::View::release() {
+                if (m_sharedMemory.get() != NULL) {
+                    m_sharedMemory->unlock();
+                    m_sharedMemory.reset();
+                }
+            }
+
+            SharedImageReader::SharedImageReader() :
+                m_mapOfSharedMemories() {}
+
+            SharedImageReader::~SharedImageReader() {}
+
+            uint32_t SharedImageReader::getSize(const SharedImage &si) {
+                // Older recordings do not contain the size attribute.
+                return (si.getSize() > 0) ? si.getSize() : (si.getWidth() * si.getHeight() * si.getBytesPerPixel());
+            }
+
+            std::shared_ptr<odcore::wrapper::SharedMemory> SharedImageReader::getSharedMemory(const SharedImage &si) {
+                const uint32_t size = getSize(si);
+                if ( (size == 0) || (si.getName().size() == 0) ) {
+                    return std::shared_ptr<odcore::wrapper::SharedMemory>();
+                }
+
+                map<string, std::shared_ptr<odcore::wrapper::SharedMemory> >::iterator it = m_mapOfSharedMemories.find(si.getName());
+                if ( (it != m_mapOfSharedMemories.end()) && (it->second->isValid()) && (it->second->getSize() >= size) ) {
+                    return it->second;
+                }
+
+                // Attach for the first time or again if the shared memory has changed.
+                std::shared_ptr<odcore::wrapper::SharedMemory> sharedMemory = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(si.getName());
+                if ( (sharedMemory.get() == NULL) || !sharedMemory->isValid() || (sharedMemory->getSize() < size) ) {
+                    CLOG2 << "[core::data::image::SharedImageReader] Could not attach to " << si.getName() << "." << endl;
+                    m_mapOfSharedMemories.erase(si.getName());
+                    return std::shared_ptr<odcore::wrapper::SharedMemory>();
+                }
+
+                m_mapOfSharedMemories[si.getName()] = sharedMemory;
+                return sharedMemory;
+            }
+
+            bool SharedImageReader::copy(const SharedImage &si, vector<uint8_t> &buffer) {
+                const uint32_t size = getSize(si);
+                if (buffer.size() < size) {
+                    buffer.resize(size);
+                }
+                const uint32_t rowBytes = si.getWidth() * si.getBytesPerPixel();
+                return (size > 0) && copy(si, &buffer[0], rowBytes);
+            }
+
+            bool SharedImageReader::copy(const SharedImage &si, uint8_t *dst, const uint32_t &dstStride) {
+                const uint32_t rowBytes = si.getWidth() * si.getBytesPerPixel();
+                View view(*this, si);
+                if ( !view.isValid() || (dst == NULL) || (view.getSize() < rowBytes * si.getHeight()) ) {
+                    return false;
+                }
+                ImageKernels::copy(view.getData(), rowBytes, dst, dstStride, si.getWidth(), si.getHeight(), si.getBytesPerPixel());
+                return true;
+            }
+
+            void SharedImageReader::detach(const string &name) {
+                m_mapOfSharedMemories.erase(name);
+            }
+
+            uint32_t SharedImageReader::getNumberOfAttachments() const {
+                return m_mapOfSharedMemories.size();
+            }
+
+        }
+    }
+} // odcore::data::image
@@ -0,0 +1,87 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "opendavinci/odcore/data/image/ImageKernels.h"
+#include "opendavinci/odcore/data/image/SharedImageWriter.h"
+#include "opendavinci/odcore/wrapper/SharedMemory.h"
+#include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"
+
+namespace odcore {
+    namespace data {
+        namespace image {
+
+            using namespace std;
+
+            SharedImageWriter::SharedImageWriter(const string &name, const uint32_t &width, const uint32_t &height, const uint32_t &bytesPerPixel) :
+                m_sharedImage(),
+                m_sharedMemory(),
+                m_isAcquired(false) {
+                m_sharedImage.setName(name);
+                m_sharedImage.setWidth(width);
+                m_sharedImage.setHeight(height);
+                m_sharedImage.setBytesPerPixel(bytesPerPixel);
+                m_sharedImage.setSize(width * height * bytesPerPixel);
+
+                m_sharedMemory = odcore::wrapper::SharedMemoryFactory::createSharedMemory(name, m_sharedImage.getSize());
+            }
+
+            SharedImageWriter::~SharedImageWriter() {
+                release();
+            }
+
+            bool SharedImageWriter::isValid() const {
+                return (m_sharedMemory.get() != NULL) && (m_sharedMemory->isValid());
+            }
+
+            uint8_t* SharedImageWriter::acquire() {
+                if (!isValid()) {
+                    return NULL;
+                }
+                if (!m_isAcquired) {
+                    m_sharedMemory->lock();
+                    m_isAcquired = true;
+                }
+                return static_cast<uint8_t*>(m_sharedMemory->getSharedMemory());
+            }
+
+            void SharedImageWriter::release() {
+                if (m_isAcquired) {
+                    m_sharedMemory->unlock();
+                    m_isAcquired = false;
+                }
+            }
+
+            bool SharedImageWriter::write(const uint8_t *src, const uint32_t &srcStride) {
+                uint8_t *dst = acquire();
+                if ( (dst == NULL) || (src == NULL) ) {
+                    release();
+                    return false;
+                }
+                ImageKernels::copy(src, srcStride, dst, m_sharedImage.getWidth() * m_sharedImage.getBytesPerPixel(), m_sharedImage.getWidth(), m_sharedImage.getHeight(), m_sharedImage.getBytesPerPixel());
+                release();
+                return true;
+            }
+
+            const SharedImage& SharedImageWriter::getSharedImage() const {
+                return m_sharedImage;
+            }
+
+        }
+    }
+} // odcore::data::image
@@ -32,6 +32,7 @@
 #include "opendavinci/generated/odcore/data/dmcp/Constants.h"
 #include "opendavinci/generated/odcore/data/dmcp/PulseAckContainersMessage.h"
 #include "opendavinci/generated/odcore/data/dmcp/PulseAckMessage.h"
+#include "opendavinci/generated/odcore/data/dmcp/SubscribedDataTypesMessage.h"
 
 namespace odcore {
     namespace dmcp {
@@ -92,6 +93,11 @@ namespace odcore {
                 m_connection.send(container);
             }
 
+            void Client::sendCycleStatistics(const odcore::data::dmcp::CycleStatistics& cs) {
+                Container container(cs);
+                m_connection.send(container);
+            }
+
             KeyValueConfiguration Client::getConfiguration() {
                 Lock l(m_configurationMutex);
                 return m_configuration;
@@ -122,6 +128,13 @@ namespace odcore {
                 m_connection.send(container);
             }
 
+            void Client::sendSubscribedDataTypes(const vector<int32_t> &listOfDataTypes) {
+                SubscribedDataTypesMessage sdt;
+                sdt.setListOfDataTypes(listOfDataTypes);
+                Container container(sdt);
+                m_connection.send(container);
+            }
+
             void Client::nextContainer(Container &c) {
                 if (c.getDataType() == odcore::data::Configuration::ID()) {
                     odcore::data::Configuration configuration = c.getData<odcore::data::Configuration>();
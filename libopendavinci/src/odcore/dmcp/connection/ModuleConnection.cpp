@@ -17,6 +17,8 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <algorithm>
+
 #include "opendavinci/odcore/base/KeyValueConfiguration.h"
 #include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/data/Container.h"
@@ -24,11 +26,13 @@
 #include "opendavinci/odcore/dmcp/ModuleStateListener.h"
 #include "opendavinci/odcore/dmcp/connection/ModuleConnection.h"
 #include "opendavinci/generated/odcore/data/Configuration.h"
+#include "opendavinci/generated/odcore/data/dmcp/CycleStatistics.h"
 #include "opendavinci/generated/odcore/data/dmcp/ModuleExitCodeMessage.h"
 #include "opendavinci/generated/odcore/data/dmcp/ModuleStateMessage.h"
 #include "opendavinci/generated/odcore/data/dmcp/PulseAckContainersMessage.h"
 #include "opendavinci/generated/odcore/data/dmcp/PulseMessage.h"
 #include "opendavinci/generated/odcore/data/dmcp/RuntimeStatistic.h"
+#include "opendavinci/generated/odcore/data/dmcp/SubscribedDataTypesMessage.h"
 
 namespace odcore {
     namespace dmcp {
@@ -54,7 +58,9 @@ namespace odcore {
                 m_connectionLost(false),
                 m_stateListener(),
                 m_stateListenerMutex(),
-                m_containersToBeTransferredToSupercomponent() {
+                m_containersToBeTransferredToSupercomponent(),
+                m_subscribedDataTypesMutex(),
+                m_listOfSubscribedDataTypes() {
                 m_connection->setContainerListener(this);
                 m_connection->setErrorListener(this);
                 m_connection->start();
@@ -119,6 +125,11 @@ namespace odcore {
             }
 
             vector<odcore::data::Container> ModuleConnection::pulse_ack_containers(const odcore::data::dmcp::PulseMessage &pm, const uint32_t &timeout) {
+                Container c(pm);
+                return pulse_ack_containers(c, timeout);
+            }
+
+            vector<odcore::data::Container> ModuleConnection::pulse_ack_containers(odcore::data::Container &pulse, const uint32_t &timeout) {
                 // Unfortunately, we cannot prevent code duplication here (cf. pulse_ack)
                 // as in this case, the dependent client module will send all its containers
                 // via this TCP link and NOT via the regular UDP multicast conference.
@@ -139,8 +150,7 @@ namespace odcore {
                         m_hasReceivedPulseAckContainers = false;
                     }
 
-                    Container c(pm);
-                    m_connection->send(c);
+                    m_connection->send(pulse);
 
                     // Wait for the ACK message from client.
                     {
@@ -154,6 +164,11 @@ namespace odcore {
                 return m_containersToBeTransferredToSupercomponent;
             }
 
+            vector<int32_t> ModuleConnection::getListOfSubscribedDataTypes() const {
+                Lock l(m_subscribedDataTypesMutex);
+                return m_listOfSubscribedDataTypes;
+            }
+
             void ModuleConnection::nextContainer(Container &container) {
                 if (container.getDataType() == Container::DMCP_CONFIGURATION_REQUEST) {
                     m_descriptor = container.getData<ModuleDescriptor>();
@@ -197,12 +212,33 @@ namespace odcore {
                     }
                     return;
                 }
+                if (container.getDataType() == CycleStatistics::ID()) {
+                    CycleStatistics cs = container.getData<CycleStatistics>();
+
+                    Lock l(m_stateListenerMutex);
+                    if (m_stateListener) {
+                        m_stateListener->handleCycleStatistics(m_descriptor, cs);
+                    }
+                    return;
+                }
                 if (container.getDataType() == PulseAckMessage::ID()) {
                     Lock l(m_pulseAckCondition);
                     m_hasReceivedPulseAck = true;
                     m_pulseAckCondition.wakeAll();
                     return;
                 }
+                if (container.getDataType() == SubscribedDataTypesMessage::ID()) {
+                    SubscribedDataTypesMessage sdt = container.getData<SubscribedDataTypesMessage>();
+                    vector<int32_t> listOfDataTypes = sdt.getListOfDataTypes();
+
+                    // Keep the list sorted to allow binary search and comparison of subscriptions.
+                    sort(listOfDataTypes.begin(), listOfDataTypes.end());
+                    listOfDataTypes.erase(unique(listOfDataTypes.begin(), listOfDataTypes.end()), listOfDataTypes.end());
+
+                    Lock l(m_subscribedDataTypesMutex);
+                    m_listOfSubscribedDataTypes = listOfDataTypes;
+                    return;
+                }
                 if (container.getDataType() == PulseAckContainersMessage::ID()) {
                     Lock l(m_pulseAckContainersCondition);
                     m_hasReceivedPulseAckContainers = true;
@@ -0,0 +1,184 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
+#include "opendavinci/odcore/io/conference/ContainerDispatcher.h"
+
+namespace odcore {
+    namespace io {
+        namespace conference {
+
+            using namespace std;
+            using namespace odcore::base;
+            using namespace odcore::data;
+
+            ContainerDispatcher::Queue::Queue(const uint32_t &capacity) :
+                m_queueCondition(),
+                m_capacity((capacity > 0) ? capacity : 1),
+                m_containers(),
+                m_numberOfDroppedContainers(0),
+                m_wakeUp(false) {}
+
+            void ContainerDispatcher::Queue::enter(const Container &c) {
+                Lock l(m_queueCondition);
+                if (m_containers.size() >= m_capacity) {
+                    m_containers.pop_front();
+                    m_numberOfDroppedContainers++;
+                }
+                m_containers.push_back(c);
+                m_queueCondition.wakeAll();
+            }
+
+            bool ContainerDispatcher::Queue::leave(deque<Container> &containers, const int64_t &timeoutInMicroseconds) {
+                Lock l(m_queueCondition);
+                if (m_containers.empty() && !m_wakeUp && (timeoutInMicroseconds > 0)) {
+                    // Round up to not return before the timeout has elapsed.
+                    m_queueCondition.waitOnSignalWithTimeout(static_cast<unsigned long>((timeoutInMicroseconds + 999) / 1000));
+                }
+                containers.swap(m_containers);
+
+                const bool wokenUp = m_wakeUp;
+                m_wakeUp = false;
+                return wokenUp;
+            }
+
+            void ContainerDispatcher::Queue::wakeUp() {
+                Lock l(m_queueCondition);
+                m_wakeUp = true;
+                m_queueCondition.wakeAll();
+            }
+
+            uint32_t ContainerDispatcher::Queue::getNumberOfDroppedContainers() const {
+                Lock l(m_queueCondition);
+                return m_numberOfDroppedContainers;
+            }
+
+            ContainerDispatcher::Worker::Worker(ContainerListener &listener, const uint32_t &capacity) :
+                Service("worker"),
+                m_listener(listener),
+                m_queue(capacity) {}
+
+            ContainerDispatcher::Worker::~Worker() {}
+
+            void ContainerDispatcher::Worker::enter(const Container &c) {
+                m_queue.enter(c);
+            }
+
+            uint32_t ContainerDispatcher::Worker::getNumberOfDroppedContainers() const {
+                return m_queue.getNumberOfDroppedContainers();
+            }
+
+            void ContainerDispatcher::Worker::beforeStop() {
+                m_queue.wakeUp();
+            }
+
+            void ContainerDispatcher::Worker::run() {
+                serviceReady();
+
+                deque<Container> containers;
+                while (isRunning()) {
+                    m_queue.leave(containers, 1000 * 1000);
+
+                    while (!containers.empty() && isRunning()) {
+                        m_listener.nextContainer(containers.front());
+                        containers.pop_front();
+                    }
+                }
+            }
+
+            ContainerDispatcher::ContainerDispatcher(ContainerListener &listener, const uint32_t &capacity, const uint32_t &numberOfWorkers) :
+                m_listener(listener),
+                m_queue(capacity),
+                m_workers(),
+                m_workersRunning(false),
+                m_containersToDispatch() {
+                for (uint32_t i = 0; i < numberOfWorkers; i++) {
+                    m_workers.push_back(std::shared_ptr<Worker>(new Worker(listener, capacity)));
+                }
+            }
+
+            ContainerDispatcher::~ContainerDispatcher() {
+                stop();
+            }
+
+            void ContainerDispatcher::nextContainer(Container &c) {
+                if (m_workers.empty()) {
+                    m_queue.enter(c);
+                }
+                else {
+                    // All containers of one data type are delivered by the same worker to preserve their order.
+                    m_workers[static_cast<uint32_t>(c.getDataType()) % m_workers.size()]->enter(c);
+                }
+            }
+
+            void ContainerDispatcher::start() {
+                if (!m_workersRunning) {
+                    vector<std::shared_ptr<Worker> >::iterator it = m_workers.begin();
+                    while (it != m_workers.end()) {
+                        (*it++)->start();
+                    }
+                    m_workersRunning = true;
+                }
+            }
+
+            void ContainerDispatcher::stop() {
+                if (m_workersRunning) {
+                    vector<std::shared_ptr<Worker> >::iterator it = m_workers.begin();
+                    while (it != m_workers.end()) {
+                        (*it++)->stop();
+                    }
+                    m_workersRunning = false;
+                }
+            }
+
+            void ContainerDispatcher::dispatchFor(const int64_t &timeoutInMicroseconds) {
+                const int64_t END = TimeStamp().toMicroseconds() + timeoutInMicroseconds;
+
+                int64_t remaining = timeoutInMicroseconds;
+                bool wokenUp = false;
+                do {
+                    wokenUp = m_queue.leave(m_containersToDispatch, remaining);
+
+                    while (!m_containersToDispatch.empty()) {
+                        m_listener.nextContainer(m_containersToDispatch.front());
+                        m_containersToDispatch.pop_front();
+                    }
+
+                    remaining = END - TimeStamp().toMicroseconds();
+                }
+                while (!wokenUp && (remaining > 0));
+            }
+
+            void ContainerDispatcher::wakeUp() {
+                m_queue.wakeUp();
+            }
+
+            uint32_t ContainerDispatcher::getNumberOfDroppedContainers() const {
+                uint32_t numberOfDroppedContainers = m_queue.getNumberOfDroppedContainers();
+                vector<std::shared_ptr<Worker> >::const_iterator it = m_workers.begin();
+                while (it != m_workers.end()) {
+                    numberOfDroppedContainers += (*it++)->getNumberOfDroppedContainers();
+                }
+                return numberOfDroppedContainers;
+            }
+
+        }
+    }
+} // odcore::io::conference
@@ -41,13 +41,13 @@ namespace odcore {
 
         void CSVFromVisitableVisitor::endVisit() {
             if (m_addHeader) {
-                m_buffer << m_header.str() << endl;
+                m_header.appendChar('\n');
+                m_header.writeTo(m_buffer);
                 m_addHeader = false;
             }
-            m_buffer << m_entry.str() << endl;
+            m_entry.appendChar('\n');
+            m_entry.writeTo(m_buffer);
             m_buffer.flush();
-
-            m_entry.str("");
         }
 
         void CSVFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &/*shortName*/, Serializable &/*v*/) {
@@ -55,93 +55,119 @@ namespace odcore {
 
         void CSVFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, bool &v) {
             if (m_addHeader) {
-                m_header << shortName << m_delimiter;
+                m_header.appendString(shortName);
+                m_header.appendChar(m_delimiter);
             }
-            m_entry << v << m_delimiter;
+            m_entry.appendChar(v ? '1' : '0');
+            m_entry.appendChar(m_delimiter);
         }
 
         void CSVFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, char &v) {
             if (m_addHeader) {
-                m_header << shortName << m_delimiter;
+                m_header.appendString(shortName);
+                m_header.appendChar(m_delimiter);
             }
-            m_entry << v << m_delimiter;
+            m_entry.appendChar(v);
+            m_entry.appendChar(m_delimiter);
         }
 
         void CSVFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, unsigned char &v) {
             if (m_addHeader) {
-                m_header << shortName << m_delimiter;
+                m_header.appendString(shortName);
+                m_header.appendChar(m_delimiter);
             }
-            m_entry << v << m_delimiter;
+            m_entry.appendChar(static_cast<char>(v));
+            m_entry.appendChar(m_delimiter);
         }
 
         void CSVFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, int8_t &v) {
             if (m_addHeader) {
-                m_header << shortName << m_delimiter;
+                m_header.appendString(shortName);
+                m_header.appendChar(m_delimiter);
             }
-            m_entry << (int32_t)v << m_delimiter;
+            m_entry.appendInteger(v);
+            m_entry.appendChar(m_delimiter);
         }
 
         void CSVFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, int16_t &v) {
             if (m_addHeader) {
-                m_header << shortName << m_delimiter;
+                m_header.appendString(shortName);
+                m_header.appendChar(m_delimiter);
             }
-            m_entry << (int32_t)v << m_delimiter;
+            m_entry.appendInteger(v);
+            m_entry.appendChar(m_delimiter);
         }
 
         void CSVFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, uint16_t &v) {
             if (m_addHeader) {
-                m_header << shortName << m_delimiter;
+                m_header.appendString(shortName);
+                m_header.appendChar(m_delimiter);
             }
-            m_entry << (uint32_t)v << m_delimiter;
+            m_entry.appendUnsignedInteger(v);
+            m_entry.appendChar(m_delimiter);
         }
 
         void CSVFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, int32_t &v) {
             if (m_addHeader) {
-                m_header << shortName << m_delimiter;
+                m_header.appendString(shortName);
+                m_header.appendChar(m_delimiter);
             }
-            m_entry << v << m_delimiter;
+            m_entry.appendInteger(v);
+            m_entry.appendChar(m_delimiter);
         }
 
         void CSVFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, uint32_t &v) {
             if (m_addHeader) {
-                m_header << shortName << m_delimiter;
+                m_header.appendString(shortName);
+                m_header.appendChar(m_delimiter);
             }
-            m_entry << v << m_delimiter;
+            m_entry.appendUnsignedInteger(v);
+            m_entry.appendChar(m_delimiter);
         }
 
         void CSVFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, int64_t &v) {
             if (m_addHeader) {
-                m_header << shortName << m_delimiter;
+                m_header.appendString(shortName);
+                m_header.appendChar(m_delimiter);
             }
-            m_entry << v << m_delimiter;
+            m_entry.appendInteger(v);
+            m_entry.appendChar(m_delimiter);
         }
 
         void CSVFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, uint64_t &v) {
             if (m_addHeader) {
-                m_header << shortName << m_delimiter;
+                m_header.appendString(shortName);
+                m_header.appendChar(m_delimiter);
             }
-            m_entry << v << m_delimiter;
+            m_entry.appendUnsignedInteger(v);
+            m_entry.appendChar(m_delimiter);
         }
 
         void CSVFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, float &v) {
             if (m_addHeader) {
-                m_header << shortName << m_delimiter;
+                m_header.appendString(shortName);
+                m_header.appendChar(m_delimiter);
             }
-            m_entry << v << m_delimiter;
+            m_entry.appendDouble(v);
+            m_entry.appendChar(m_delimiter);
         }
 
         void CSVFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, double &v) {
             if (m_addHeader) {
-                m_header << shortName << m_delimiter;
+                m_header.appendString(shortName);
+                m_header.appendChar(m_delimiter);
             }
-            m_entry << v << m_delimiter;
+            m_entry.appendDouble(v);
+            m_entry.appendChar(m_delimiter);
         }
 
         void CSVFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, string &v) {
             if (m_addHeader) {
-                m_header << shortName << m_delimiter;
+                m_header.appendString(shortName);
+                m_header.appendChar(m_delimiter);
             }
-            m_entry << v << m_delimiter;
+            m_entry.appendString(v);
+            m_entry.appendChar(m_delimiter);
         }
 
         void CSVFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &/*shortName*/, void */*data*/, const uint32_t &/*size*/) {
@@ -0,0 +1,231 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <limits>
+
+#include "opendavinci/odcore/reflection/ExportBuffer.h"
+
+namespace odcore {
+    namespace reflection {
+
+        using namespace std;
+
+        // Exactly representable powers of ten for scaling values.
+        static const double POWERS_OF_TEN[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                                1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+        ExportBuffer::ExportBuffer(const uint32_t &capacity) :
+            m_buffer() {
+            m_buffer.reserve(capacity);
+        }
+
+        ExportBuffer::~ExportBuffer() {}
+
+        void ExportBuffer::appendChar(const char &c) {
+            m_buffer.push_back(c);
+        }
+
+        void ExportBuffer::appendString(const char *s, const uint32_t &length) {
+            m_buffer.insert(m_buffer.end(), s, s + length);
+        }
+
+        void ExportBuffer::appendString(const string &s) {
+            m_buffer.insert(m_buffer.end(), s.begin(), s.end());
+        }
+
+        void ExportBuffer::appendQuotedString(const string &s) {
+            static const char HEX[] = "0123456789abcdef";
+
+            m_buffer.push_back('"');
+            for (string::const_iterator it = s.begin(); it != s.end(); it++) {
+                const unsigned char c = static_cast<unsigned char>(*it);
+                if ( (c == '"') || (c == '\\') ) {
+                    m_buffer.push_back('\\');
+                    m_buffer.push_back(static_cast<char>(c));
+                }
+                else if (c < 0x20) {
+                    const char escaped[] = { '\\', 'u', '0', '0', HEX[c >> 4], HEX[c & 0xF] };
+                    m_buffer.insert(m_buffer.end(), escaped, escaped + sizeof(escaped));
+                }
+                else {
+                    m_buffer.push_back(static_cast<char>(c));
+                }
+            }
+            m_buffer.push_back('"');
+        }
+
+        void ExportBuffer::appendInteger(const int64_t &v) {
+            if (v < 0) {
+                m_buffer.push_back('-');
+                // Negate in unsigned arithmetic to handle the smallest value.
+                appendUnsignedInteger(~static_cast<uint64_t>(v) + 1);
+            }
+            else {
+                appendUnsignedInteger(static_cast<uint64_t>(v));
+            }
+        }
+
+        void ExportBuffer::appendUnsignedInteger(const uint64_t &v) {
+            char digits[20];
+            uint32_t length = 0;
+            uint64_t value = v;
+            do {
+                digits[length++] = static_cast<char>('0' + (value % 10));
+                value /= 10;
+            } while (value > 0);
+
+            while (length > 0) {
+                m_buffer.push_back(digits[--length]);
+            }
+        }
+
+        void ExportBuffer::appendDouble(const double &v) {
+            if (fpclassify(v) == FP_ZERO) {
+                appendString(signbit(v) ? "-0" : "0", signbit(v) ? 2 : 1);
+                return;
+            }
+
+            const double a = fabs(v);
+            bool useFallback = !(a <= numeric_limits<double>::max());
+
+            // Compute the six significant digits as integer; the scaling by
+            // an exact power of ten rounds only once. Values that are too
+            // large or small for that or that are too close to the middle
+            // between two six-digit numbers are formatted by snprintf.
+            int32_t exponent = 0;
+            uint32_t digits = 0;
+            if (!useFallback) {
+                exponent = static_cast<int32_t>(floor(log10(a)));
+                for (uint32_t attempt = 0; (attempt < 2) && !useFallback; attempt++) {
+                    const int32_t k = 5 - exponent;
+                    if ( (k < -22) || (k > 22) ) {
+                        useFallback = true;
+                        break;
+                    }
+                    const double scaled = (k >= 0) ? a * POWERS_OF_TEN[k] : a / POWERS_OF_TEN[-k];
+                    if (scaled < 1e5) {
+                        exponent--;
+                        continue;
+                    }
+                    if (scaled >= 1e6) {
+                        exponent++;
+                        continue;
+                    }
+
+                    const double integral = floor(scaled);
+                    const double fraction = scaled - integral;
+                    if (fabs(fraction - 0.5) < 1e-6) {
+                        useFallback = true;
+                        break;
+                    }
+                    digits = static_cast<uint32_t>(integral) + ((fraction > 0.5) ? 1 : 0);
+                    if (digits == 1000000) {
+                        digits = 100000;
+                        exponent++;
+                    }
+                    break;
+                }
+                useFallback |= (digits == 0);
+            }
+
+            if (useFallback) {
+                char buffer[32];
+                const int length = snprintf(buffer, sizeof(buffer), "%g", v);
+                if (length > 0) {
+                    appendString(buffer, static_cast<uint32_t>(length));
+                }
+                return;
+            }
+
+            char d[6];
+            for (int32_t i = 5; i >= 0; i--) {
+                d[i] = static_cast<char>('0' + (digits % 10));
+                digits /= 10;
+            }
+            // Trailing zeros are not printed.
+            int32_t last = 5;
+            while ( (last > 0) && (d[last] == '0') ) {
+                last--;
+            }
+
+            if (v < 0) {
+                m_buffer.push_back('-');
+            }
+
+            if ( (exponent < -4) || (exponent >= 6) ) {
+                m_buffer.push_back(d[0]);
+                if (last > 0) {
+                    m_buffer.push_back('.');
+                    m_buffer.insert(m_buffer.end(), d + 1, d + last + 1);
+                }
+                m_buffer.push_back('e');
+                m_buffer.push_back((exponent < 0) ? '-' : '+');
+                const int32_t e = (exponent < 0) ? -exponent : exponent;
+                if (e >= 100) {
+                    m_buffer.push_back(static_cast<char>('0' + e / 100));
+                }
+                m_buffer.push_back(static_cast<char>('0' + (e / 10) % 10));
+                m_buffer.push_back(static_cast<char>('0' + e % 10));
+            }
+            else if (exponent >= 0) {
+                m_buffer.insert(m_buffer.end(), d, d + exponent + 1);
+                if (last > exponent) {
+                    m_buffer.push_back('.');
+                    m_buffer.insert(m_buffer.end(), d + exponent + 1, d + last + 1);
+                }
+            }
+            else {
+                m_buffer.push_back('0');
+                m_buffer.push_back('.');
+                m_buffer.insert(m_buffer.end(), static_cast<size_t>(-exponent - 1), '0');
+                m_buffer.insert(m_buffer.end(), d, d + last + 1);
+            }
+        }
+
+        void ExportBuffer::appendBuffer(const ExportBuffer &b) {
+            m_buffer.insert(m_buffer.end(), b.m_buffer.begin(), b.m_buffer.end());
+        }
+
+        uint32_t ExportBuffer::getSize() const {
+            return m_buffer.size();
+        }
+
+        bool ExportBuffer::isEmpty() const {
+            return m_buffer.empty();
+        }
+
+        string ExportBuffer::toString() const {
+            return string(m_buffer.begin(), m_buffer.end());
+        }
+
+        void ExportBuffer::clear() {
+            m_buffer.clear();
+        }
+
+        void ExportBuffer::writeTo(ostream &out) {
+            if (!m_buffer.empty()) {
+                out.write(&m_buffer[0], m_buffer.size());
+            }
+            m_buffer.clear();
+        }
+
+    }
+} // odcore::reflection
@@ -0,0 +1,164 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <cmath>
+
+#include "opendavinci/odcore/serialization/Serializable.h"
+#include "opendavinci/odcore/base/Visitable.h"
+#include "opendavinci/odcore/reflection/JSONFromVisitableVisitor.h"
+
+namespace odcore {
+    namespace reflection {
+
+        using namespace odcore;
+        using namespace odcore::base;
+        using namespace odcore::serialization;
+
+        JSONFromVisitableVisitor::JSONFromVisitableVisitor(ostream &out) :
+            m_buffer(out),
+            m_entry(),
+            m_depth(0),
+            m_hasMembers(false) {}
+
+        JSONFromVisitableVisitor::~JSONFromVisitableVisitor() {}
+
+        void JSONFromVisitableVisitor::beginVisit(const int32_t &/*id*/, const string &/*shortName*/, const string &/*longName*/) {
+            m_entry.appendChar('{');
+            m_depth++;
+            m_hasMembers = false;
+        }
+
+        void JSONFromVisitableVisitor::endVisit() {
+            m_entry.appendChar('}');
+            m_hasMembers = true;
+
+            if (m_depth > 0) {
+                m_depth--;
+            }
+            if (m_depth == 0) {
+                m_entry.appendChar('\n');
+                m_entry.writeTo(m_buffer);
+            }
+        }
+
+        void JSONFromVisitableVisitor::appendName(const string &shortName) {
+            if (m_hasMembers) {
+                m_entry.appendChar(',');
+            }
+            m_entry.appendQuotedString(shortName);
+            m_entry.appendChar(':');
+            m_hasMembers = true;
+        }
+
+        void JSONFromVisitableVisitor::appendNumber(const double &v) {
+            if (isfinite(v)) {
+                m_entry.appendDouble(v);
+            }
+            else {
+                m_entry.appendString("null", 4);
+            }
+        }
+
+        void JSONFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, Serializable &v) {
+            try {
+                // Nested Visitables are written as nested objects.
+                Visitable &visitable = dynamic_cast<Visitable&>(v);
+                appendName(shortName);
+                visitable.accept(*this);
+            }
+            catch (...) {
+                // Cast was unsuccessful.
+            }
+        }
+
+        void JSONFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, bool &v) {
+            appendName(shortName);
+            if (v) {
+                m_entry.appendString("true", 4);
+            }
+            else {
+                m_entry.appendString("false", 5);
+            }
+        }
+
+        void JSONFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, char &v) {
+            appendName(shortName);
+            m_entry.appendQuotedString(string(1, v));
+        }
+
+        void JSONFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, unsigned char &v) {
+            appendName(shortName);
+            m_entry.appendUnsignedInteger(v);
+        }
+
+        void JSONFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, int8_t &v) {
+            appendName(shortName);
+            m_entry.appendInteger(v);
+        }
+
+        void JSONFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, int16_t &v) {
+            appendName(shortName);
+            m_entry.appendInteger(v);
+        }
+
+        void JSONFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, uint16_t &v) {
+            appendName(shortName);
+            m_entry.appendUnsignedInteger(v);
+        }
+
+        void JSONFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, int32_t &v) {
+            appendName(shortName);
+            m_entry.appendInteger(v);
+        }
+
+        void JSONFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, uint32_t &v) {
+            appendName(shortName);
+            m_entry.appendUnsignedInteger(v);
+        }
+
+        void JSONFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, int64_t &v) {
+            appendName(shortName);
+            m_entry.appendInteger(v);
+        }
+
+        void JSONFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, uint64_t &v) {
+            appendName(shortName);
+            m_entry.appendUnsignedInteger(v);
+        }
+
+        void JSONFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, float &v) {
+            appendName(shortName);
+            appendNumber(v);
+        }
+
+        void JSONFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, double &v) {
+            appendName(shortName);
+            appendNumber(v);
+        }
+
+        void JSONFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &shortName, string &v) {
+            appendName(shortName);
+            m_entry.appendQuotedString(v);
+        }
+
+        void JSONFromVisitableVisitor::visit(const uint32_t &/*id*/, const string &/*longName*/, const string &/*shortName*/, void */*data*/, const uint32_t &/*size*/) {
+        }
+
+    }
+} // odcore::reflection
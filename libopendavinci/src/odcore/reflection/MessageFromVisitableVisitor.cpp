@@ -35,6 +35,21 @@ namespace odcore {
         using namespace odcore::serialization;
         using namespace odcore::data::reflection;
 
+        /**
+         * This function creates a field holding a copy of the given value;
+         * field and reference counter are allocated together.
+         */
+        template<typename T>
+        static std::shared_ptr<AbstractField> createField(const uint32_t &id, const string &longName, const string &shortName, const T &v, const AbstractField::FIELDDATATYPE &type, const uint32_t &size) {
+            std::shared_ptr<Field<T> > f = std::make_shared<Field<T> >(v);
+            f->setFieldIdentifier(id);
+            f->setLongFieldName(longName);
+            f->setShortFieldName(shortName);
+            f->setFieldDataType(type);
+            f->setSize(size);
+            return f;
+        }
+
         MessageFromVisitableVisitor::MessageFromVisitableVisitor() :
             m_message() {}
 
@@ -61,12 +76,7 @@ namespace odcore {
                 visitable.accept(msgFromVisitableVisitor);
 
                 // Store the generic message representation.
-                Field<Message> *f = new Field<Message>(msgFromVisitableVisitor.getMessage());
-                f->setFieldIdentifier(id);
-                f->setLongFieldName(longName);
-                f->setShortFieldName(shortName);
-                f->setFieldDataType(odcore::data::reflection::AbstractField::SERIALIZABLE_T);
-                m_message.addField(std::shared_ptr<AbstractField>(f));
+                m_message.addField(createField(id, longName, shortName, msgFromVisitableVisitor.getMessage(), odcore::data::reflection::AbstractField::SERIALIZABLE_T, 0));
             }
             catch (...) {
                 // Cast was unsuccessful.
@@ -74,133 +84,55 @@ namespace odcore {
         }
 
         void MessageFromVisitableVisitor::visit(const uint32_t &id, const string &longName, const string &shortName, bool &v) {
-            Field<bool> *f = new Field<bool>(v);
-            f->setFieldIdentifier(id);
-            f->setLongFieldName(longName);
-            f->setShortFieldName(shortName);
-            f->setFieldDataType(odcore::data::reflection::AbstractField::BOOL_T);
-            f->setSize(sizeof(v));
-            m_message.addField(std::shared_ptr<AbstractField>(f));
+            m_message.addField(createField(id, longName, shortName, v, odcore::data::reflection::AbstractField::BOOL_T, sizeof(v)));
         }
 
         void MessageFromVisitableVisitor::visit(const uint32_t &id, const string &longName, const string &shortName, char &v) {
-            Field<char> *f = new Field<char>(v);
-            f->setFieldIdentifier(id);
-            f->setLongFieldName(longName);
-            f->setShortFieldName(shortName);
-            f->setFieldDataType(odcore::data::reflection::AbstractField::CHAR_T);
-            f->setSize(sizeof(v));
-            m_message.addField(std::shared_ptr<AbstractField>(f));
+            m_message.addField(createField(id, longName, shortName, v, odcore::data::reflection::AbstractField::CHAR_T, sizeof(v)));
         }
 
         void MessageFromVisitableVisitor::visit(const uint32_t &id, const string &longName, const string &shortName, unsigned char &v) {
-            Field<unsigned char> *f = new Field<unsigned char>(v);
-            f->setFieldIdentifier(id);
-            f->setLongFieldName(longName);
-            f->setShortFieldName(shortName);
-            f->setFieldDataType(odcore::data::reflection::AbstractField::UCHAR_T);
-            f->setSize(sizeof(v));
-            m_message.addField(std::shared_ptr<AbstractField>(f));
+            m_message.addField(createField(id, longName, shortName, v, odcore::data::reflection::AbstractField::UCHAR_T, sizeof(v)));
         }
 
         void MessageFromVisitableVisitor::visit(const uint32_t &id, const string &longName, const string &shortName, int8_t &v) {
-            Field<int8_t> *f = new Field<int8_t>(v);
-            f->setFieldIdentifier(id);
-            f->setLongFieldName(longName);
-            f->setShortFieldName(shortName);
-            f->setFieldDataType(odcore::data::reflection::AbstractField::INT8_T);
-            f->setSize(sizeof(v));
-            m_message.addField(std::shared_ptr<AbstractField>(f));
+            m_message.addField(createField(id, longName, shortName, v, odcore::data::reflection::AbstractField::INT8_T, sizeof(v)));
         }
 
         void MessageFromVisitableVisitor::visit(const uint32_t &id, const string &longName, const string &shortName, int16_t &v) {
-            Field<int16_t> *f = new Field<int16_t>(v);
-            f->setFieldIdentifier(id);
-            f->setLongFieldName(longName);
-            f->setShortFieldName(shortName);
-            f->setFieldDataType(odcore::data::reflection::AbstractField::INT16_T);
-            f->setSize(sizeof(v));
-            m_message.addField(std::shared_ptr<AbstractField>(f));
+            m_message.addField(createField(id, longName, shortName, v, odcore::data::reflection::AbstractField::INT16_T, sizeof(v)));
         }
 
         void MessageFromVisitableVisitor::visit(const uint32_t &id, const string &longName, const string &shortName, uint16_t &v) {
-            Field<uint16_t> *f = new Field<uint16_t>(v);
-            f->setFieldIdentifier(id);
-            f->setLongFieldName(longName);
-            f->setShortFieldName(shortName);
-            f->setFieldDataType(odcore::data::reflection::AbstractField::UINT16_T);
-            f->setSize(sizeof(v));
-            m_message.addField(std::shared_ptr<AbstractField>(f));
+            m_message.addField(createField(id, longName, shortName, v, odcore::data::reflection::AbstractField::UINT16_T, sizeof(v)));
         }
 
         void MessageFromVisitableVisitor::visit(const uint32_t &id, const string &longName, const string &shortName, int32_t &v) {
-            Field<int32_t> *f = new Field<int32_t>(v);
-            f->setFieldIdentifier(id);
-            f->setLongFieldName(longName);
-            f->setShortFieldName(shortName);
-            f->setFieldDataType(odcore::data::reflection::AbstractField::INT32_T);
-            f->setSize(sizeof(v));
-            m_message.addField(std::shared_ptr<AbstractField>(f));
+            m_message.addField(createField(id, longName, shortName, v, odcore::data::reflection::AbstractField::INT32_T, sizeof(v)));
         }
 
         void MessageFromVisitableVisitor::visit(const uint32_t &id, const string &longName, const string &shortName, uint32_t &v) {
-            Field<uint32_t> *f = new Field<uint32_t>(v);
-            f->setFieldIdentifier(id);
-            f->setLongFieldName(longName);
-            f->setShortFieldName(shortName);
-            f->setFieldDataType(odcore::data::reflection::AbstractField::UINT32_T);
-            f->setSize(sizeof(v));
-            m_message.addField(std::shared_ptr<AbstractField>(f));
+            m_message.addField(createField(id, longName, shortName, v, odcore::data::reflection::AbstractField::UINT32_T, sizeof(v)));
         }
 
         void MessageFromVisitableVisitor::visit(const uint32_t &id, const string &longName, const string &shortName, int64_t &v) {
-            Field<int64_t> *f = new Field<int64_t>(v);
-            f->setFieldIdentifier(id);
-            f->setLongFieldName(longName);
-            f->setShortFieldName(shortName);
-            f->setFieldDataType(odcore::data::reflection::AbstractField::INT64_T);
-            f->setSize(sizeof(v));
-            m_message.addField(std::shared_ptr<AbstractField>(f));
+            m_message.addField(createField(id, longName, shortName, v, odcore::data::reflection::AbstractField::INT64_T, sizeof(v)));
         }
 
         void MessageFromVisitableVisitor::visit(const uint32_t &id, const string &longName, const string &shortName, uint64_t &v) {
-            Field<uint64_t> *f = new Field<uint64_t>(v);
-            f->setFieldIdentifier(id);
-            f->setLongFieldName(longName);
-            f->setShortFieldName(shortName);
-            f->setFieldDataType(odcore::data::reflection::AbstractField::UINT64_T);
-            f->setSize(sizeof(v));
-            m_message.addField(std::shared_ptr<AbstractField>(f));
+            m_message.addField(createField(id, longName, shortName, v, odcore::data::reflection::AbstractField::UINT64_T, sizeof(v)));
         }
 
         void MessageFromVisitableVisitor::visit(const uint32_t &id, const string &longName, const string &shortName, float &v) {
-            Field<float> *f = new Field<float>(v);
-            f->setFieldIdentifier(id);
-            f->setLongFieldName(longName);
-            f->setShortFieldName(shortName);
-            f->setFieldDataType(odcore::data::reflection::AbstractField::FLOAT_T);
-            f->setSize(sizeof(v));
-            m_message.addField(std::shared_ptr<AbstractField>(f));
+            m_message.addField(createField(id, longName, shortName, v, odcore::data::reflection::AbstractField::FLOAT_T, sizeof(v)));
         }
 
         void MessageFromVisitableVisitor::visit(const uint32_t &id, const string &longName, const string &shortName, double &v) {
-            Field<double> *f = new Field<double>(v);
-            f->setFieldIdentifier(id);
-            f->setLongFieldName(longName);
-            f->setShortFieldName(shortName);
-            f->setFieldDataType(odcore::data::reflection::AbstractField::DOUBLE_T);
-            f->setSize(sizeof(v));
-            m_message.addField(std::shared_ptr<AbstractField>(f));
+            m_message.addField(createField(id, longName, shortName, v, odcore::data::reflection::AbstractField::DOUBLE_T, sizeof(v)));
         }
 
         void MessageFromVisitableVisitor::visit(const uint32_t &id, const string &longName, const string &shortName, string &v) {
-            Field<string> *f = new Field<string>(v);
-            f->setFieldIdentifier(id);
-            f->setLongFieldName(longName);
-            f->setShortFieldName(shortName);
-            f->setFieldDataType(odcore::data::reflection::AbstractField::STRING_T);
-            f->setSize(v.size());
-            m_message.addField(std::shared_ptr<AbstractField>(f));
+            m_message.addField(createField(id, longName, shortName, v, odcore::data::reflection::AbstractField::STRING_T, v.size()));
         }
 
         void MessageFromVisitableVisitor::visit(const uint32_t &id, const string &longName, const string &shortName, void *data, const uint32_t &size) {
@@ -210,13 +142,7 @@ namespace odcore {
                 memcpy(ptr, data, size);
 
                 // Create a field.
-                Field<std::shared_ptr<char> > *f = new Field<std::shared_ptr<char> >(std::shared_ptr<char>(ptr));
-                f->setFieldIdentifier(id);
-                f->setLongFieldName(longName);
-                f->setShortFieldName(shortName);
-                f->setFieldDataType(odcore::data::reflection::AbstractField::DATA_T);
-                f->setSize(size);
-                m_message.addField(std::shared_ptr<AbstractField>(f));
+                m_message.addField(createField(id, longName, shortName, std::shared_ptr<char>(ptr, free), odcore::data::reflection::AbstractField::DATA_T, size));
             }
         }
 
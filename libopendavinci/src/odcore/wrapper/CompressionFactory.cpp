@@ -33,5 +33,10 @@ namespace odcore {
             typedef ConfigurationTraits<CompressionLibraryProducts>::configuration configuration;
             return std::shared_ptr<DecompressedData>(CompressionFactoryWorker<configuration::value>::getContents(in));
         }
+
+        std::shared_ptr<DecompressedData> CompressionFactory::getContents(const string &fileName) {
+            typedef ConfigurationTraits<CompressionLibraryProducts>::configuration configuration;
+            return std::shared_ptr<DecompressedData>(CompressionFactoryWorker<configuration::value>::getContents(fileName));
+        }
     }
 } // odcore::wrapper
@@ -20,6 +20,9 @@
 #include "opendavinci/odcore/wrapper/ConcurrencyFactory.h"
 #include "opendavinci/odcore/wrapper/ConfigurationTraits.h"
 #include "opendavinci/odcore/wrapper/Libraries.h"
+#include "opendavinci/odcore/wrapper/Mutex.h"
+#include "opendavinci/odcore/wrapper/MutexFactory.h"
+#include "opendavinci/odcore/wrapper/Thread.h"
 #include "opendavinci/odcore/wrapper/SystemLibraryProducts.h"
 
 namespace odcore { namespace wrapper { class Runnable; } }
@@ -40,6 +43,72 @@ namespace odcore {
             return ConcurrencyFactoryWorker<configuration::value>::createThread(runnable);
         }
 
+        Thread* ConcurrencyFactory::createThread(Runnable &runnable, const ThreadConfiguration &threadConfiguration) {
+            typedef ConfigurationTraits<SystemLibraryProducts>::configuration configuration;
+            return ConcurrencyFactoryWorker<configuration::value>::createThread(runnable, threadConfiguration);
+        }
+
+        Thread* ConcurrencyFactory::createThread(Runnable &runnable, const string &role) {
+            Thread *thread = NULL;
+            Mutex &mutex = getThreadConfigurationsMutex();
+            mutex.lock();
+            {
+                ThreadConfiguration tc;
+                map<string, ThreadConfiguration>::const_iterator it = getThreadConfigurations().find(role);
+                if (it != getThreadConfigurations().end()) {
+                    tc = it->second;
+                }
+
+                thread = createThread(runnable, tc);
+                if (thread != NULL) {
+                    getThreadsWithRole().insert(make_pair(role, thread));
+                }
+            }
+            mutex.unlock();
+            return thread;
+        }
+
+        bool ConcurrencyFactory::setThreadConfiguration(const string &role, const ThreadConfiguration &threadConfiguration) {
+            bool retVal = true;
+            Mutex &mutex = getThreadConfigurationsMutex();
+            mutex.lock();
+            {
+                getThreadConfigurations()[role] = threadConfiguration;
+
+                // Reconfigure the threads that were created for this role already.
+                pair<multimap<string, Thread*>::iterator, multimap<string, Thread*>::iterator> range = getThreadsWithRole().equal_range(role);
+                for (multimap<string, Thread*>::iterator it = range.first; it != range.second; ++it) {
+                    retVal &= it->second->configure(threadConfiguration);
+                }
+            }
+            mutex.unlock();
+            return retVal;
+        }
+
+        ThreadConfiguration ConcurrencyFactory::getThreadConfiguration(const string &role) {
+            ThreadConfiguration retVal;
+            Mutex &mutex = getThreadConfigurationsMutex();
+            mutex.lock();
+            {
+                map<string, ThreadConfiguration>::const_iterator it = getThreadConfigurations().find(role);
+                if (it != getThreadConfigurations().end()) {
+                    retVal = it->second;
+                }
+            }
+            mutex.unlock();
+            return retVal;
+        }
+
+        bool ConcurrencyFactory::configureCurrentThread(const ThreadConfiguration &threadConfiguration) {
+            typedef ConfigurationTraits<SystemLibraryProducts>::configuration configuration;
+            return ConcurrencyFactoryWorker<configuration::value>::configureCurrentThread(threadConfiguration);
+        }
+
+        bool ConcurrencyFactory::lockMemory(const uint32_t &prefaultHeapInBytes) {
+            typedef ConfigurationTraits<SystemLibraryProducts>::configuration configuration;
+            return ConcurrencyFactoryWorker<configuration::value>::lockMemory(prefaultHeapInBytes);
+        }
+
         void ConcurrencyFactory::usleepFor(const long &microseconds) {
             typedef ConfigurationTraits<SystemLibraryProducts>::configuration configuration;
             return ConcurrencyFactoryWorker<configuration::value>::usleepFor(microseconds);
@@ -49,5 +118,40 @@ namespace odcore {
             typedef ConfigurationTraits<SystemLibraryProducts>::configuration configuration;
             return ConcurrencyFactoryWorker<configuration::value>::usleepUntil(seconds, partialMicroseconds);
         }
+
+        void ConcurrencyFactory::removeThread(Thread *thread) {
+            Mutex &mutex = getThreadConfigurationsMutex();
+            mutex.lock();
+            {
+                multimap<string, Thread*>::iterator it = getThreadsWithRole().begin();
+                while (it != getThreadsWithRole().end()) {
+                    if (it->second == thread) {
+                        getThreadsWithRole().erase(it++);
+                    }
+                    else {
+                        ++it;
+                    }
+                }
+            }
+            mutex.unlock();
+        }
+
+        // The following objects are never destroyed as threads
+        // might be destroyed during static deinitialization.
+
+        Mutex& ConcurrencyFactory::getThreadConfigurationsMutex() {
+            static Mutex *mutex = MutexFactory::createMutex();
+            return *mutex;
+        }
+
+        map<string, ThreadConfiguration>& ConcurrencyFactory::getThreadConfigurations() {
+            static map<string, ThreadConfiguration> *threadConfigurations = new map<string, ThreadConfiguration>();
+            return *threadConfigurations;
+        }
+
+        multimap<string, Thread*>& ConcurrencyFactory::getThreadsWithRole() {
+            static multimap<string, Thread*> *threadsWithRole = new multimap<string, Thread*>();
+            return *threadsWithRole;
+        }
     }
 } // odcore::wrapper
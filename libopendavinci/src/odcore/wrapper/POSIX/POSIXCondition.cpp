@@ -68,6 +68,10 @@ namespace odcore {
                 }
                 timeout.tv_sec += seconds;
                 timeout.tv_nsec += milliseconds * 1000 * 1000;
+                if (timeout.tv_nsec >= 1000 * 1000 * 1000) {
+                    timeout.tv_sec++;
+                    timeout.tv_nsec -= 1000 * 1000 * 1000;
+                }
 
                 int32_t error = pthread_cond_timedwait(&m_condition, &m_mutex.getNativeMutex(), &timeout);
 
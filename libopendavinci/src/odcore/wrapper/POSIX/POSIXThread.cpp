@@ -17,6 +17,7 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <sched.h>
 #include <cerrno>
 #include <cstring>
 #include <iostream>
@@ -25,6 +26,7 @@
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/base/module/AbstractCIDModule.h"
+#include "opendavinci/odcore/wrapper/ConcurrencyFactory.h"
 #include "opendavinci/odcore/wrapper/Mutex.h"
 #include "opendavinci/odcore/wrapper/MutexFactory.h"
 #include "opendavinci/odcore/wrapper/POSIX/POSIXThread.h"
@@ -36,12 +38,23 @@ namespace odcore {
 
             using namespace std;
 
-            /**
-             * This method encapsulates the runnable.
-             */
             void *threadRunner(void *v) {
                 pthread_setcanceltype(PTHREAD_CANCEL_ASYNCHRONOUS, NULL);
-                Runnable *runnable = static_cast<Runnable*>(v);
+                POSIXThread *thread = static_cast<POSIXThread*>(v);
+                Runnable *runnable = &(thread->m_runnable);
+
+                ThreadConfiguration tc;
+                thread->m_threadStateMutex->lock();
+                {
+                    tc = thread->m_threadConfiguration;
+                }
+                thread->m_threadStateMutex->unlock();
+
+                if (!tc.isDefault()) {
+                    if (!POSIXThread::applyThreadConfiguration(pthread_self(), tc)) {
+                        cerr << "[core::wrapper::POSIXThread] Could not apply thread configuration (" << tc.toString() << ")." << endl;
+                    }
+                }
 
                 try {
                     runnable->run();
@@ -62,6 +75,22 @@ namespace odcore {
                 m_threadStateMutex(),
                 m_threadState(INITIALIZED),
                 m_runnable(r),
+                m_threadConfiguration(),
+                m_threadWrapper() {
+                // Create mutex.
+                m_threadStateMutex = unique_ptr<Mutex>(MutexFactory::createMutex());
+                if (m_threadStateMutex.get() == NULL) {
+                    stringstream s;
+                    s << "[core::wrapper::POSIXThread] Error creating mutex: " << strerror(errno);
+                    throw s.str();
+                }
+            }
+
+            POSIXThread::POSIXThread(Runnable &r, const ThreadConfiguration &tc) :
+                m_threadStateMutex(),
+                m_threadState(INITIALIZED),
+                m_runnable(r),
+                m_threadConfiguration(tc),
                 m_threadWrapper() {
                 // Create mutex.
                 m_threadStateMutex = unique_ptr<Mutex>(MutexFactory::createMutex());
@@ -73,6 +102,8 @@ namespace odcore {
             }
 
             POSIXThread::~POSIXThread() {
+                // Unregister first so that no concurrent configuration reaches this thread while it is destroyed.
+                ConcurrencyFactory::removeThread(this);
                 stop();
             }
 
@@ -80,7 +111,7 @@ namespace odcore {
                 m_threadStateMutex->lock();
                 {
                     if (m_threadState == INITIALIZED) {
-                        pthread_create(&m_threadWrapper, NULL, threadRunner, &m_runnable);
+                        pthread_create(&m_threadWrapper, NULL, threadRunner, this);
                         m_threadState = RUNNING;
                     }
                 }
@@ -108,6 +139,58 @@ namespace odcore {
                 return !isRunning();
             }
 
+            bool POSIXThread::configure(const ThreadConfiguration &threadConfiguration) {
+                bool retVal = true;
+                m_threadStateMutex->lock();
+                {
+                    m_threadConfiguration = threadConfiguration;
+                    if (m_threadState == RUNNING) {
+                        retVal = applyThreadConfiguration(m_threadWrapper, m_threadConfiguration);
+                    }
+                }
+                m_threadStateMutex->unlock();
+
+                return retVal;
+            }
+
+            bool POSIXThread::applyThreadConfiguration(const pthread_t &thread, const ThreadConfiguration &threadConfiguration) {
+                bool retVal = true;
+
+                const vector<uint32_t> cpus = threadConfiguration.getCPUs();
+                if (!cpus.empty()) {
+#ifdef __linux__
+                    cpu_set_t cpuset;
+                    CPU_ZERO(&cpuset);
+                    for (uint32_t i = 0; i < cpus.size(); i++) {
+                        if (cpus[i] < CPU_SETSIZE) {
+                            CPU_SET(cpus[i], &cpuset);
+                        }
+                    }
+                    retVal &= (pthread_setaffinity_np(thread, sizeof(cpu_set_t), &cpuset) == 0);
+#else
+                    // CPU affinity is not available on this platform.
+                    retVal = false;
+#endif
+                }
+
+                if (threadConfiguration.getSchedulingPolicy() != ThreadConfiguration::INHERIT) {
+                    int policy = SCHED_OTHER;
+                    struct sched_param param;
+                    param.sched_priority = 0;
+                    if (threadConfiguration.getSchedulingPolicy() == ThreadConfiguration::FIFO) {
+                        policy = SCHED_FIFO;
+                        param.sched_priority = threadConfiguration.getPriority();
+                    }
+                    if (threadConfiguration.getSchedulingPolicy() == ThreadConfiguration::ROUND_ROBIN) {
+                        policy = SCHED_RR;
+                        param.sched_priority = threadConfiguration.getPriority();
+                    }
+                    retVal &= (pthread_setschedparam(thread, policy, &param) == 0);
+                }
+
+                return retVal;
+            }
+
             bool POSIXThread::isRunning() const {
                 bool retVal = false;
                 m_threadStateMutex->lock();
@@ -24,6 +24,8 @@
 #include <string>
 
 #include "opendavinci/odcore/data/TimeStamp.h"
+#include "opendavinci/odcore/wrapper/Mutex.h"
+#include "opendavinci/odcore/wrapper/MutexFactory.h"
 #include "opendavinci/odcore/wrapper/RealtimeRunnable.h"
 
 namespace odcore {
@@ -32,21 +34,53 @@ namespace odcore {
         using namespace std;
 
         RealtimeRunnable::RealtimeRunnable(const uint32_t &periodInMicroseconds) :
-            m_periodInMicroseconds(periodInMicroseconds) {
+            m_periodInMicroseconds(periodInMicroseconds),
+            m_cycleProfileMutex(),
+            m_cycleProfile() {
+            m_cycleProfileMutex = unique_ptr<Mutex>(MutexFactory::createMutex());
+            if (m_cycleProfileMutex.get() == NULL) {
+                throw string("[core::wrapper::RealtimeRunnable] Error creating mutex.");
+            }
         }
 
         RealtimeRunnable::~RealtimeRunnable() {}
 
+        odcore::base::CycleProfile RealtimeRunnable::getCycleProfile() const {
+            odcore::base::CycleProfile retVal;
+            m_cycleProfileMutex->lock();
+            {
+                retVal = m_cycleProfile;
+            }
+            m_cycleProfileMutex->unlock();
+            return retVal;
+        }
+
+        odcore::base::CycleProfile RealtimeRunnable::getAndResetCycleProfile() {
+            odcore::base::CycleProfile retVal;
+            m_cycleProfileMutex->lock();
+            {
+                retVal = m_cycleProfile;
+                m_cycleProfile.reset();
+            }
+            m_cycleProfileMutex->unlock();
+            return retVal;
+        }
+
         void RealtimeRunnable::run() {
 #ifdef HAVE_LINUX_RT
-            // Setup realtime task using FIFO scheduling.
-            struct sched_param param;
-            param.sched_priority = REALTIME_PRIORITY;
-
-            if (::sched_setscheduler(0, SCHED_FIFO, &param) == -1) {
-                throw string("[core::wrapper::RealtimeRunnable] Failed to configure scheduler. Are you superuser?");
+            // Setup realtime task using FIFO scheduling unless this thread was configured already.
+            const int policy = ::sched_getscheduler(0);
+            if ( (policy != SCHED_FIFO) && (policy != SCHED_RR) ) {
+                struct sched_param param;
+                param.sched_priority = REALTIME_PRIORITY;
+
+                if (::sched_setscheduler(0, SCHED_FIFO, &param) == -1) {
+                    throw string("[core::wrapper::RealtimeRunnable] Failed to configure scheduler. Are you superuser?");
+                }
             }
 
+            struct timespec wokeUp;
+
             struct timespec waitForSlice;
 
             // Get actual time.
@@ -61,6 +95,10 @@ namespace odcore {
                 // Wait for next time slice.
                 ::clock_nanosleep(CLOCK_REALTIME, TIMER_ABSTIME, &waitForSlice, NULL);
 
+                // Measure how late this slice was started.
+                ::clock_gettime(CLOCK_REALTIME, &wokeUp);
+                const int64_t deviation = (static_cast<int64_t>(wokeUp.tv_sec - waitForSlice.tv_sec) * SECOND + (wokeUp.tv_nsec - waitForSlice.tv_nsec)) / MICROSECOND;
+
                 // Get time before slice.
                 odcore::data::TimeStamp before;
 
@@ -73,6 +111,12 @@ namespace odcore {
                 // Compute delta using monotonic clock.
                 const long delta = after.toMicroseconds() - before.toMicroseconds();
 
+                m_cycleProfileMutex->lock();
+                {
+                    m_cycleProfile.add(before.toMicroseconds(), delta, deviation, m_periodInMicroseconds);
+                }
+                m_cycleProfileMutex->unlock();
+
                 if (isRunning() && !((m_periodInMicroseconds - delta) > 0)) {
                     throw string("[core::wrapper::RealtimeRunnable] Time slice ran out of time defined in microseconds!");
                 }
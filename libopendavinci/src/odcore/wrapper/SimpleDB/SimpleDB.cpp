@@ -49,7 +49,10 @@ namespace odcore {
             const string SimpleDB::get(const int32_t &key) const {
                 string retVal("");
                 m_mutex->lock();
-                    retVal = m_entries[key];
+                    map<int, string>::const_iterator it = m_entries.find(key);
+                    if (it != m_entries.end()) {
+                        retVal = it->second;
+                    }
                 m_mutex->unlock();
 
                 return retVal;
@@ -0,0 +1,144 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <cstdlib>
+#include <sstream>
+
+#include "opendavinci/odcore/strings/StringToolbox.h"
+#include "opendavinci/odcore/wrapper/ThreadConfiguration.h"
+
+namespace odcore {
+    namespace wrapper {
+
+        using namespace std;
+        using namespace odcore::strings;
+
+        ThreadConfiguration::ThreadConfiguration() :
+            m_cpus(),
+            m_schedulingPolicy(INHERIT),
+            m_priority(0) {}
+
+        ThreadConfiguration::ThreadConfiguration(const ThreadConfiguration &obj) :
+            m_cpus(obj.m_cpus),
+            m_schedulingPolicy(obj.m_schedulingPolicy),
+            m_priority(obj.m_priority) {}
+
+        ThreadConfiguration& ThreadConfiguration::operator=(const ThreadConfiguration &obj) {
+            m_cpus = obj.m_cpus;
+            m_schedulingPolicy = obj.m_schedulingPolicy;
+            m_priority = obj.m_priority;
+            return *this;
+        }
+
+        ThreadConfiguration::~ThreadConfiguration() {}
+
+        bool ThreadConfiguration::isDefault() const {
+            return (m_cpus.empty() && (m_schedulingPolicy == INHERIT));
+        }
+
+        const vector<uint32_t> ThreadConfiguration::getCPUs() const {
+            return m_cpus;
+        }
+
+        void ThreadConfiguration::setCPUs(const vector<uint32_t> &cpus) {
+            m_cpus = cpus;
+        }
+
+        ThreadConfiguration::SCHEDULINGPOLICY ThreadConfiguration::getSchedulingPolicy() const {
+            return m_schedulingPolicy;
+        }
+
+        void ThreadConfiguration::setSchedulingPolicy(const SCHEDULINGPOLICY &policy) {
+            m_schedulingPolicy = policy;
+        }
+
+        uint32_t ThreadConfiguration::getPriority() const {
+            return m_priority;
+        }
+
+        void ThreadConfiguration::setPriority(const uint32_t &priority) {
+            m_priority = priority;
+        }
+
+        const string ThreadConfiguration::toString() const {
+            stringstream sstr;
+            sstr << "cpus: ";
+            if (m_cpus.empty()) {
+                sstr << "all";
+            }
+            for (uint32_t i = 0; i < m_cpus.size(); i++) {
+                sstr << ((i > 0) ? "," : "") << m_cpus[i];
+            }
+            sstr << ", policy: ";
+            switch (m_schedulingPolicy) {
+                case INHERIT: sstr << "inherit"; break;
+                case OTHER: sstr << "other"; break;
+                case FIFO: sstr << "fifo"; break;
+                case ROUND_ROBIN: sstr << "rr"; break;
+            }
+            sstr << ", priority: " << m_priority;
+            return sstr.str();
+        }
+
+        vector<uint32_t> ThreadConfiguration::parseCPUs(const string &cpus) {
+            vector<uint32_t> retVal;
+            stringstream sstr(cpus);
+            string entry;
+            while (getline(sstr, entry, ',')) {
+                StringToolbox::trim(entry);
+                if (entry.empty()) {
+                    continue;
+                }
+
+                const string::size_type dash = entry.find('-');
+                const string first = entry.substr(0, dash);
+                const string last = (dash == string::npos) ? first : entry.substr(dash + 1);
+                if ( (first.find_first_of("0123456789") == string::npos) ||
+                     (last.find_first_of("0123456789") == string::npos) ||
+                     (first.find_first_not_of("0123456789 ") != string::npos) ||
+                     (last.find_first_not_of("0123456789 ") != string::npos) ) {
+                    continue;
+                }
+
+                const uint32_t from = static_cast<uint32_t>(atoi(first.c_str()));
+                const uint32_t to = static_cast<uint32_t>(atoi(last.c_str()));
+                for (uint32_t cpu = from; (cpu <= to) && (cpu < MAXIMUM_NUMBER_OF_CPUS); cpu++) {
+                    retVal.push_back(cpu);
+                }
+            }
+            return retVal;
+        }
+
+        ThreadConfiguration::SCHEDULINGPOLICY ThreadConfiguration::parseSchedulingPolicy(const string &policy) {
+            string p = policy;
+            StringToolbox::trim(p);
+            if (StringToolbox::equalsIgnoreCase(p, "other")) {
+                return OTHER;
+            }
+            if (StringToolbox::equalsIgnoreCase(p, "fifo")) {
+                return FIFO;
+            }
+            if (StringToolbox::equalsIgnoreCase(p, "rr")) {
+                return ROUND_ROBIN;
+            }
+            return INHERIT;
+        }
+
+    }
+} // odcore::wrapper
@@ -23,7 +23,9 @@
 #include <string>
 
 #include "opendavinci/odcore/base/module/AbstractCIDModule.h"
+#include "opendavinci/odcore/wrapper/ConcurrencyFactory.h"
 #include "opendavinci/odcore/wrapper/MutexFactory.h"
+#include "opendavinci/odcore/wrapper/WIN32/WIN32ConcurrencyFactoryWorker.h"
 #include "opendavinci/odcore/wrapper/WIN32/WIN32Thread.h"
 
 namespace odcore {
@@ -32,11 +34,22 @@ namespace odcore {
 
             using namespace std;
 
-            /**
-             * This method encapsulates the runnable.
-             */
             void *threadRunner(void *v) {
-                Runnable *runnable = static_cast<Runnable*>(v);
+                WIN32Thread *thread = static_cast<WIN32Thread*>(v);
+                Runnable *runnable = &(thread->m_runnable);
+
+                ThreadConfiguration tc;
+                thread->m_threadStateMutex->lock();
+                {
+                    tc = thread->m_threadConfiguration;
+                }
+                thread->m_threadStateMutex->unlock();
+
+                if (!tc.isDefault()) {
+                    if (!ConcurrencyFactoryWorker<SystemLibraryWin32>::configureCurrentThread(tc)) {
+                        cerr << "[core::wrapper::WIN32Thread] Could not apply thread configuration (" << tc.toString() << ")." << endl;
+                    }
+                }
 
                 try {
                     runnable->run();
@@ -55,6 +68,22 @@ namespace odcore {
                 m_threadStateMutex(),
                 m_threadState(INITIALIZED),
                 m_runnable(r),
+                m_threadConfiguration(),
+                m_theThread() {
+                // Create mutex.
+                m_threadStateMutex = unique_ptr<Mutex>(MutexFactory::createMutex());
+                if (m_threadStateMutex.get() == NULL) {
+                    stringstream s;
+                    s << "[core::wrapper::WIN32Thread] Error while creating mutex.";
+                    throw s.str();
+                }
+            }
+
+            WIN32Thread::WIN32Thread(Runnable &r, const ThreadConfiguration &tc) :
+                m_threadStateMutex(),
+                m_threadState(INITIALIZED),
+                m_runnable(r),
+                m_threadConfiguration(tc),
                 m_theThread() {
                 // Create mutex.
                 m_threadStateMutex = unique_ptr<Mutex>(MutexFactory::createMutex());
@@ -66,6 +95,8 @@ namespace odcore {
             }
 
             WIN32Thread::~WIN32Thread() {
+                // Unregister first so that no concurrent configuration reaches this thread while it is destroyed.
+                ConcurrencyFactory::removeThread(this);
                 stop();
             }
 
@@ -73,7 +104,7 @@ namespace odcore {
                 m_threadStateMutex->lock();
                 {
                     if (m_threadState == INITIALIZED) {
-                        m_theThread = std::thread(threadRunner, &m_runnable);
+                        m_theThread = std::thread(threadRunner, this);
                         m_threadState = RUNNING;
                     }
                 }
@@ -102,6 +133,17 @@ namespace odcore {
                 return !isRunning();
             }
 
+            bool WIN32Thread::configure(const ThreadConfiguration &threadConfiguration) {
+                m_threadStateMutex->lock();
+                {
+                    m_threadConfiguration = threadConfiguration;
+                }
+                m_threadStateMutex->unlock();
+
+                // CPU affinity and scheduling policies are not supported by C++11 threads.
+                return threadConfiguration.isDefault();
+            }
+
             bool WIN32Thread::isRunning() const {
                 bool retVal = false;
                 m_threadStateMutex->lock();
@@ -118,7 +118,7 @@ namespace odcore {
                 }
 
                 // Create thread for encapsulating waiting for receiving data.
-                m_thread = unique_ptr<Thread>(ConcurrencyFactory::createThread(*this));
+                m_thread = unique_ptr<Thread>(ConcurrencyFactory::createThread(*this, "receiver"));
                 if (m_thread.get() == NULL) {
                     stringstream s;
                     s << "[core::wrapper::WIN32UDPReceiver] Error while creating thread.";
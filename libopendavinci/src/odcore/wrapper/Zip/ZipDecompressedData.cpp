@@ -17,18 +17,24 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#ifndef WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
 #include <ctype.h>
-#include <cstdlib>
-#include <cstring>
 #include <algorithm>
-#include <functional>
 #include <fstream>
+#include <functional>
 #include <iostream>
-#include <sstream>
+#include <streambuf>
 
-#include "zip.h"
+#include "zlib.h"
 #include "opendavinci/odcore/opendavinci.h"
 #include <memory>
+#include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/base/module/AbstractCIDModule.h"
 #include "opendavinci/odcore/wrapper/Zip/ZipDecompressedData.h"
 
@@ -38,118 +44,504 @@ namespace odcore {
 
             using namespace std;
             using namespace odcore;
+            using namespace odcore::base;
             using namespace odcore::strings;
 
-            ZipDecompressedData::ZipDecompressedData(istream &in) :
-                m_mapOfDecompressedEntries() {
-                decompressData(in);
+            // Signatures and sizes of the ZIP records that are evaluated.
+            static const uint32_t LOCAL_FILE_HEADER_SIGNATURE = 0x04034b50;
+            static const uint32_t CENTRAL_DIRECTORY_HEADER_SIGNATURE = 0x02014b50;
+            static const uint32_t END_OF_CENTRAL_DIRECTORY_SIGNATURE = 0x06054b50;
+            static const uint32_t ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIGNATURE = 0x07064b50;
+            static const uint32_t LOCAL_FILE_HEADER_SIZE = 30;
+            static const uint32_t CENTRAL_DIRECTORY_HEADER_SIZE = 46;
+            static const uint32_t END_OF_CENTRAL_DIRECTORY_SIZE = 22;
+            static const uint32_t ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIZE = 20;
+            static const uint32_t MAXIMUM_COMMENT_SIZE = 65535;
+
+            static const uint16_t COMPRESSION_METHOD_STORED = 0;
+            static const uint16_t COMPRESSION_METHOD_DEFLATED = 8;
+
+            // Archives and entries are addressed with 32 bit; Zip64 is not supported.
+            static const uint64_t MAXIMUM_ARCHIVE_SIZE = 0xFFFFFFFF;
+            static const uint16_t ZIP64_NUMBER_OF_ENTRIES = 0xFFFF;
+            static const uint32_t ZIP64_SIZE_OR_OFFSET = 0xFFFFFFFF;
+
+            static uint16_t readUInt16(const char *p) {
+                const unsigned char *b = reinterpret_cast<const unsigned char*>(p);
+                return static_cast<uint16_t>(b[0] | (b[1] << 8));
             }
 
-            ZipDecompressedData::~ZipDecompressedData() {
-                // Cleaning up the decompressed data entries.
-                m_mapOfDecompressedEntries.clear();
+            static uint32_t readUInt32(const char *p) {
+                const unsigned char *b = reinterpret_cast<const unsigned char*>(p);
+                return static_cast<uint32_t>(b[0]) | (static_cast<uint32_t>(b[1]) << 8) |
+                       (static_cast<uint32_t>(b[2]) << 16) | (static_cast<uint32_t>(b[3]) << 24);
             }
 
-            void ZipDecompressedData::decompressData(istream &in) {
-                // TODO: libzip needs a file to read from. Therefore, we need to buffer the istream...
-                char *tempFileName;
+            /**
+             * This class holds the complete archive either as copy
+             * in memory or as memory-mapped file.
+             */
+            class ZipArchiveMemory {
+                private:
+                    ZipArchiveMemory(const ZipArchiveMemory &);
+                    ZipArchiveMemory& operator=(const ZipArchiveMemory &);
+
+                public:
+                    ZipArchiveMemory(istream &in) :
+                        m_buffer(),
+                        m_mappedMemory(NULL),
+                        m_data(NULL),
+                        m_size(0) {
+                        m_buffer.assign(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+                        if (static_cast<uint64_t>(m_buffer.size()) > MAXIMUM_ARCHIVE_SIZE) {
+                            CLOG3 << "ZipDecompressedData: archives of 4 GB or larger are not supported" << endl;
+                            vector<char>().swap(m_buffer);
+                        }
+                        if (!m_buffer.empty()) {
+                            m_data = &m_buffer[0];
+                            m_size = m_buffer.size();
+                        }
+                    }
+
+                    ZipArchiveMemory(const string &fileName) :
+                        m_buffer(),
+                        m_mappedMemory(NULL),
+                        m_data(NULL),
+                        m_size(0) {
 #ifdef WIN32
-                tempFileName = _tempnam("test", NULL);
+                        fstream fin(fileName.c_str(), ios::binary | ios::in);
+                        m_buffer.assign(istreambuf_iterator<char>(fin), istreambuf_iterator<char>());
+                        if (static_cast<uint64_t>(m_buffer.size()) > MAXIMUM_ARCHIVE_SIZE) {
+                            CLOG3 << "ZipDecompressedData: " << fileName << " is 4 GB or larger, which is not supported" << endl;
+                            vector<char>().swap(m_buffer);
+                        }
+                        if (!m_buffer.empty()) {
+                            m_data = &m_buffer[0];
+                            m_size = m_buffer.size();
+                        }
 #else
-                tempFileName = strdup("tmpfileXXXXXX");
-                if (mkstemp(tempFileName) == -1) {
-                    CLOG3 << "ZipDecompressedData: temporary file cannot be created" << endl;
-                }
+                        const int fd = ::open(fileName.c_str(), O_RDONLY);
+                        if (fd < 0) {
+                            CLOG3 << "ZipDecompressedData: " << fileName << " cannot be opened" << endl;
+                            return;
+                        }
+
+                        struct stat fileStatus;
+                        if (::fstat(fd, &fileStatus) == 0) {
+                            if (static_cast<uint64_t>(fileStatus.st_size) > MAXIMUM_ARCHIVE_SIZE) {
+                                CLOG3 << "ZipDecompressedData: " << fileName << " is 4 GB or larger, which is not supported" << endl;
+                            }
+                            else if (fileStatus.st_size > 0) {
+                                void *p = ::mmap(NULL, fileStatus.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                                if (p != MAP_FAILED) {
+                                    m_mappedMemory = p;
+                                    m_data = static_cast<const char*>(p);
+                                    m_size = static_cast<uint32_t>(fileStatus.st_size);
+                                }
+                            }
+                        }
+                        // The mapping remains valid after closing the file descriptor.
+                        ::close(fd);
+#endif
+                    }
+
+                    ~ZipArchiveMemory() {
+#ifndef WIN32
+                        if (m_mappedMemory != NULL) {
+                            ::munmap(m_mappedMemory, m_size);
+                        }
 #endif
-                fstream fout(tempFileName, ios::binary | ios::out);
-
-                if (fout.good()) {
-                    char c = 0;
-                    while (in.get(c)) {
-                        fout << c;
-                    }
-                    fout.flush();
-                    fout.close();
-
-                    // Do decompression.
-                    struct zip *zipArchive = NULL;
-
-                    // Open the ZIP archive.
-                    zipArchive = zip_open(tempFileName, 0, NULL);
-                    if (zipArchive != NULL) {
-
-                        // Get the number of compressed entries.
-                        int32_t numberOfEntries = zip_get_num_files(zipArchive);
-                        if (numberOfEntries > 0) {
-
-                            // Allocate memory for decompression.
-                            char *buffer = new char[ZipDecompressedData::BUFFER_SIZE];
-                            if (buffer != NULL) {
-
-                                // Start decompression.
-                                for (int32_t i = 0; i < numberOfEntries; i++) {
-
-                                    // Get i-th entry.
-                                    const char *nameOfEntry = zip_get_name(zipArchive, i, 0);
-                                    if (nameOfEntry != NULL) {
-                                        string name(nameOfEntry);
-
-                                        // Remove leading ./
-                                        if ( (name.length() > 2) && (name.at(0) == '.') && (name.at(1) == '/') ) {
-                                            name = string(nameOfEntry+2);
-                                        }
-
-                                        // Transform to lower case for case insensitive searches.
-                                        transform(name.begin(), name.end(), name.begin(), ptr_fun(::tolower));
-
-                                        // Get entry from zip file.
-                                        struct zip_file *entry = zip_fopen_index(zipArchive, i, ZIP_FL_NOCASE);
-                                        if (entry != NULL) {
-
-                                            // Create stream for storing content.
-                                            stringstream *stream = new stringstream();
-                                            if (stream != NULL) {
-
-                                                // Decompress data.
-                                                int32_t nbytes = 0;
-                                                while ( (nbytes = zip_fread(entry, buffer, ZipDecompressedData::BUFFER_SIZE)) > 0) {
-                                                    string s(buffer, nbytes);
-                                                    (*stream) << s;
-                                                }
-
-                                                // Store read content into map.
-                                                m_mapOfDecompressedEntries[name] = std::shared_ptr<istream>(stream);
-                                            }
-
-                                            // Close entry.
-                                            zip_fclose(entry);
-                                        }
-                                    }
+                    }
+
+                    const char* getData() const {
+                        return m_data;
+                    }
+
+                    uint32_t getSize() const {
+                        return m_size;
+                    }
+
+                private:
+                    vector<char> m_buffer;
+                    void *m_mappedMemory;
+                    const char *m_data;
+                    uint32_t m_size;
+            };
+
+            /**
+             * This stream buffer reads from a memory area that is kept
+             * alive by the given owner.
+             */
+            class MemoryStreamBuffer : public streambuf {
+                private:
+                    MemoryStreamBuffer(const MemoryStreamBuffer &);
+                    MemoryStreamBuffer& operator=(const MemoryStreamBuffer &);
+
+                public:
+                    MemoryStreamBuffer(std::shared_ptr<void> owner, const char *data, const uint32_t &size) :
+                        m_owner(owner) {
+                        char *begin = const_cast<char*>(data);
+                        setg(begin, begin, begin + size);
+                    }
+
+                protected:
+                    virtual pos_type seekoff(off_type off, ios_base::seekdir dir, ios_base::openmode /*which*/) {
+                        off_type position = off;
+                        if (dir == ios_base::cur) {
+                            position += gptr() - eback();
+                        }
+                        else if (dir == ios_base::end) {
+                            position += egptr() - eback();
+                        }
+                        if ( (position < 0) || (position > (egptr() - eback())) ) {
+                            return pos_type(off_type(-1));
+                        }
+                        setg(eback(), eback() + position, egptr());
+                        return pos_type(position);
+                    }
+
+                    virtual pos_type seekpos(pos_type pos, ios_base::openmode which) {
+                        return seekoff(off_type(pos), ios_base::beg, which);
+                    }
+
+                private:
+                    std::shared_ptr<void> m_owner;
+            };
+
+            /**
+             * This stream buffer inflates a deflated entry while it is
+             * read. Only rewinding to the beginning is supported.
+             */
+            class InflatingStreamBuffer : public streambuf {
+                private:
+                    enum {
+                        BUFFER_SIZE = 16384
+                    };
+
+                private:
+                    InflatingStreamBuffer(const InflatingStreamBuffer &);
+                    InflatingStreamBuffer& operator=(const InflatingStreamBuffer &);
+
+                public:
+                    InflatingStreamBuffer(std::shared_ptr<ZipArchiveMemory> archive, const char *data, const uint32_t &size) :
+                        m_archive(archive),
+                        m_data(data),
+                        m_size(size),
+                        m_stream(),
+                        m_buffer(BUFFER_SIZE),
+                        m_position(0),
+                        m_finished(false) {
+                        m_stream.zalloc = Z_NULL;
+                        m_stream.zfree = Z_NULL;
+                        m_stream.opaque = Z_NULL;
+                        // Negative window bits: Raw deflate data without zlib header.
+                        m_finished = (inflateInit2(&m_stream, -MAX_WBITS) != Z_OK);
+                        reset();
+                    }
+
+                    virtual ~InflatingStreamBuffer() {
+                        inflateEnd(&m_stream);
+                    }
+
+                protected:
+                    virtual int_type underflow() {
+                        if (gptr() < egptr()) {
+                            return traits_type::to_int_type(*gptr());
+                        }
+
+                        uint32_t have = 0;
+                        while ( (have == 0) && !m_finished ) {
+                            m_stream.next_out = reinterpret_cast<Bytef*>(&m_buffer[0]);
+                            m_stream.avail_out = BUFFER_SIZE;
+                            const int retVal = inflate(&m_stream, Z_NO_FLUSH);
+                            have = BUFFER_SIZE - m_stream.avail_out;
+                            if (retVal != Z_OK) {
+                                if (retVal != Z_STREAM_END) {
+                                    CLOG3 << "ZipDecompressedData: inflating entry failed: " << retVal << endl;
                                 }
+                                m_finished = true;
+                            }
+                        }
 
-                                // De-allocate memory.
-                                delete [] buffer;
+                        m_position += egptr() - eback();
+                        setg(&m_buffer[0], &m_buffer[0], &m_buffer[0] + have);
+                        if (have == 0) {
+                            return traits_type::eof();
+                        }
+                        return traits_type::to_int_type(*gptr());
+                    }
+
+                    virtual pos_type seekoff(off_type off, ios_base::seekdir dir, ios_base::openmode /*which*/) {
+                        if ( (dir == ios_base::cur) && (off == 0) ) {
+                            return pos_type(m_position + (gptr() - eback()));
+                        }
+                        if ( (dir == ios_base::beg) && (off == 0) ) {
+                            if (inflateReset(&m_stream) != Z_OK) {
+                                return pos_type(off_type(-1));
                             }
+                            m_finished = false;
+                            reset();
+                            return pos_type(0);
                         }
+                        return pos_type(off_type(-1));
+                    }
+
+                    virtual pos_type seekpos(pos_type pos, ios_base::openmode which) {
+                        return seekoff(off_type(pos), ios_base::beg, which);
+                    }
+
+                private:
+                    void reset() {
+                        m_stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(m_data));
+                        m_stream.avail_in = m_size;
+                        m_position = 0;
+                        setg(&m_buffer[0], &m_buffer[0], &m_buffer[0]);
+                    }
+
+                private:
+                    std::shared_ptr<ZipArchiveMemory> m_archive;
+                    const char *m_data;
+                    uint32_t m_size;
+                    z_stream m_stream;
+                    vector<char> m_buffer;
+                    off_type m_position;
+                    bool m_finished;
+            };
+
+            /**
+             * This input stream owns its stream buffer.
+             */
+            class ZipEntryInputStream : public istream {
+                private:
+                    ZipEntryInputStream(const ZipEntryInputStream &);
+                    ZipEntryInputStream& operator=(const ZipEntryInputStream &);
+
+                public:
+                    ZipEntryInputStream(streambuf *sb) :
+                        istream(sb),
+                        m_streamBuffer(sb) {}
+
+                    virtual ~ZipEntryInputStream() {
+                        delete m_streamBuffer;
+                    }
+
+                private:
+                    streambuf *m_streamBuffer;
+            };
+
+            ZipDecompressedData::Entry::Entry() :
+                m_compressionMethod(0),
+                m_crc32(0),
+                m_compressedSize(0),
+                m_uncompressedSize(0),
+                m_localHeaderOffset(0) {}
+
+            ZipDecompressedData::CachedEntry::CachedEntry() :
+                m_data(),
+                m_positionInLRU() {}
+
+            ZipDecompressedData::ZipDecompressedData(istream &in) :
+                m_archive(new ZipArchiveMemory(in)),
+                m_mapOfEntries(),
+                m_cacheMutex(),
+                m_cache(),
+                m_listOfRecentlyUsedEntries(),
+                m_cacheSize(0) {
+                readCentralDirectory();
+            }
+
+            ZipDecompressedData::ZipDecompressedData(const string &fileName) :
+                m_archive(new ZipArchiveMemory(fileName)),
+                m_mapOfEntries(),
+                m_cacheMutex(),
+                m_cache(),
+                m_listOfRecentlyUsedEntries(),
+                m_cacheSize(0) {
+                readCentralDirectory();
+            }
+
+            ZipDecompressedData::~ZipDecompressedData() {
+                // Streams handed out keep the archive memory alive on their own.
+                m_cache.clear();
+                m_mapOfEntries.clear();
+            }
+
+            void ZipDecompressedData::readCentralDirectory() {
+                const char *archive = m_archive->getData();
+                const uint32_t size = m_archive->getSize();
+                if ( (archive == NULL) || (size < END_OF_CENTRAL_DIRECTORY_SIZE) ) {
+                    CLOG3 << "ZipDecompressedData: archive is empty" << endl;
+                    return;
+                }
 
-                        // Close given archive.
-                        zip_close(zipArchive);
+                // Find the end of central directory record that might be followed by a comment.
+                const char *endOfCentralDirectory = NULL;
+                const uint32_t lowestPosition = (size > END_OF_CENTRAL_DIRECTORY_SIZE + MAXIMUM_COMMENT_SIZE) ? (size - END_OF_CENTRAL_DIRECTORY_SIZE - MAXIMUM_COMMENT_SIZE) : 0;
+                for (int64_t i = size - END_OF_CENTRAL_DIRECTORY_SIZE; i >= static_cast<int64_t>(lowestPosition); i--) {
+                    if (readUInt32(archive + i) == END_OF_CENTRAL_DIRECTORY_SIGNATURE) {
+                        endOfCentralDirectory = archive + i;
+                        break;
                     }
                 }
+                if (endOfCentralDirectory == NULL) {
+                    CLOG3 << "ZipDecompressedData: no central directory found" << endl;
+                    return;
+                }
 
-#ifdef WIN32
-                _unlink(tempFileName);
-#else
-                unlink(tempFileName);
-#endif
-                free(tempFileName);
+                const uint16_t numberOfEntries = readUInt16(endOfCentralDirectory + 10);
+                const uint32_t sizeOfCentralDirectory = readUInt32(endOfCentralDirectory + 12);
+                const uint32_t offsetOfCentralDirectory = readUInt32(endOfCentralDirectory + 16);
+
+                // Zip64 archives store the actual values in a Zip64 end of central directory record.
+                const bool hasZip64Locator = (endOfCentralDirectory - archive >= static_cast<int64_t>(ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIZE)) &&
+                                             (readUInt32(endOfCentralDirectory - ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIZE) == ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIGNATURE);
+                if ( hasZip64Locator || (numberOfEntries == ZIP64_NUMBER_OF_ENTRIES) ||
+                     (sizeOfCentralDirectory == ZIP64_SIZE_OR_OFFSET) || (offsetOfCentralDirectory == ZIP64_SIZE_OR_OFFSET) ) {
+                    CLOG3 << "ZipDecompressedData: Zip64 archives are not supported" << endl;
+                    return;
+                }
+                if (static_cast<uint64_t>(offsetOfCentralDirectory) + sizeOfCentralDirectory > size) {
+                    CLOG3 << "ZipDecompressedData: invalid central directory" << endl;
+                    return;
+                }
+
+                const char *p = archive + offsetOfCentralDirectory;
+                const char *end = p + sizeOfCentralDirectory;
+                for (uint16_t i = 0; i < numberOfEntries; i++) {
+                    if ( (p + CENTRAL_DIRECTORY_HEADER_SIZE > end) || (readUInt32(p) != CENTRAL_DIRECTORY_HEADER_SIGNATURE) ) {
+                        CLOG3 << "ZipDecompressedData: invalid central directory entry " << i << endl;
+                        break;
+                    }
+
+                    Entry entry;
+                    entry.m_compressionMethod = readUInt16(p + 10);
+                    entry.m_crc32 = readUInt32(p + 16);
+                    entry.m_compressedSize = readUInt32(p + 20);
+                    entry.m_uncompressedSize = readUInt32(p + 24);
+                    const uint16_t lengthOfName = readUInt16(p + 28);
+                    const uint16_t lengthOfExtraField = readUInt16(p + 30);
+                    const uint16_t lengthOfComment = readUInt16(p + 32);
+                    entry.m_localHeaderOffset = readUInt32(p + 42);
+                    if ( (entry.m_compressedSize == ZIP64_SIZE_OR_OFFSET) || (entry.m_uncompressedSize == ZIP64_SIZE_OR_OFFSET) ||
+                         (entry.m_localHeaderOffset == ZIP64_SIZE_OR_OFFSET) ) {
+                        CLOG3 << "ZipDecompressedData: Zip64 entry " << i << " is not supported" << endl;
+                        break;
+                    }
+
+                    const char *nameOfEntry = p + CENTRAL_DIRECTORY_HEADER_SIZE;
+                    if (nameOfEntry + lengthOfName > end) {
+                        break;
+                    }
+                    string name(nameOfEntry, lengthOfName);
+
+                    // Remove leading ./
+                    if ( (name.length() > 2) && (name.at(0) == '.') && (name.at(1) == '/') ) {
+                        name = name.substr(2);
+                    }
+
+                    // Transform to lower case for case insensitive searches.
+                    transform(name.begin(), name.end(), name.begin(), ptr_fun(::tolower));
+
+                    m_mapOfEntries[name] = entry;
+
+                    p += CENTRAL_DIRECTORY_HEADER_SIZE + lengthOfName + lengthOfExtraField + lengthOfComment;
+                }
+            }
+
+            const char* ZipDecompressedData::getDataFor(const Entry &entry) const {
+                const char *archive = m_archive->getData();
+                const uint64_t size = m_archive->getSize();
+
+                // The local header's extra field may differ from the one in the central directory.
+                if ( (static_cast<uint64_t>(entry.m_localHeaderOffset) + LOCAL_FILE_HEADER_SIZE > size) ||
+                     (readUInt32(archive + entry.m_localHeaderOffset) != LOCAL_FILE_HEADER_SIGNATURE) ) {
+                    return NULL;
+                }
+                const char *localHeader = archive + entry.m_localHeaderOffset;
+                const uint64_t offset = static_cast<uint64_t>(entry.m_localHeaderOffset) + LOCAL_FILE_HEADER_SIZE + readUInt16(localHeader + 26) + readUInt16(localHeader + 28);
+                if (offset + entry.m_compressedSize > size) {
+                    return NULL;
+                }
+                return archive + offset;
+            }
+
+            std::shared_ptr<string> ZipDecompressedData::inflateEntry(const Entry &entry, const char *data) const {
+                std::shared_ptr<string> result;
+
+                z_stream strm;
+                strm.zalloc = Z_NULL;
+                strm.zfree = Z_NULL;
+                strm.opaque = Z_NULL;
+                if (inflateInit2(&strm, -MAX_WBITS) != Z_OK) {
+                    return result;
+                }
+
+                std::shared_ptr<string> decompressed(new string(entry.m_uncompressedSize, '\0'));
+                strm.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+                strm.avail_in = entry.m_compressedSize;
+                strm.next_out = reinterpret_cast<Bytef*>(decompressed->empty() ? NULL : &(*decompressed)[0]);
+                strm.avail_out = entry.m_uncompressedSize;
+                const int retVal = inflate(&strm, Z_FINISH);
+                const uint32_t have = entry.m_uncompressedSize - strm.avail_out;
+                inflateEnd(&strm);
+
+                if ( (retVal == Z_STREAM_END) && (have == entry.m_uncompressedSize) &&
+                     (crc32(crc32(0, Z_NULL, 0), reinterpret_cast<const Bytef*>(decompressed->data()), have) == entry.m_crc32) ) {
+                    result = decompressed;
+                }
+                else {
+                    CLOG3 << "ZipDecompressedData: entry is corrupt: " << retVal << endl;
+                }
+
+                return result;
+            }
+
+            std::shared_ptr<string> ZipDecompressedData::getCachedEntry(const string &name, const Entry &entry, const char *data) {
+                {
+                    Lock l(m_cacheMutex);
+                    map<string, CachedEntry, StringComparator>::iterator it = m_cache.find(name);
+                    if (it != m_cache.end()) {
+                        // Mark as most recently used.
+                        m_listOfRecentlyUsedEntries.splice(m_listOfRecentlyUsedEntries.begin(), m_listOfRecentlyUsedEntries, it->second.m_positionInLRU);
+                        return it->second.m_data;
+                    }
+                }
+
+                // Decompress outside the lock to not block concurrent readers.
+                std::shared_ptr<string> decompressed = inflateEntry(entry, data);
+                if (decompressed.get() == NULL) {
+                    return decompressed;
+                }
+
+                Lock l(m_cacheMutex);
+                map<string, CachedEntry, StringComparator>::iterator it = m_cache.find(name);
+                if (it != m_cache.end()) {
+                    // Another thread was faster.
+                    return it->second.m_data;
+                }
+
+                // Evict the least recently used entries; streams still using them keep their data.
+                while ( (m_cacheSize + decompressed->size() > MAXIMUM_CACHE_SIZE) && !m_listOfRecentlyUsedEntries.empty() ) {
+                    map<string, CachedEntry, StringComparator>::iterator victim = m_cache.find(m_listOfRecentlyUsedEntries.back());
+                    m_cacheSize -= victim->second.m_data->size();
+                    m_cache.erase(victim);
+                    m_listOfRecentlyUsedEntries.pop_back();
+                }
+
+                m_listOfRecentlyUsedEntries.push_front(name);
+                CachedEntry &cachedEntry = m_cache[name];
+                cachedEntry.m_data = decompressed;
+                cachedEntry.m_positionInLRU = m_listOfRecentlyUsedEntries.begin();
+                m_cacheSize += decompressed->size();
+
+                return decompressed;
             }
 
             vector<string> ZipDecompressedData::getListOfEntries() {
                 vector<string> listOfEntries;
 
-                map<string, std::shared_ptr<istream>, StringComparator>::const_iterator it = m_mapOfDecompressedEntries.begin();
-                while (it != m_mapOfDecompressedEntries.end()) {
+                map<string, Entry, StringComparator>::const_iterator it = m_mapOfEntries.begin();
+                while (it != m_mapOfEntries.end()) {
                     listOfEntries.push_back(it->first);
                     ++it;
                 }
@@ -165,9 +557,36 @@ namespace odcore {
                 transform(key.begin(), key.end(), key.begin(), ptr_fun(::tolower));
 
                 // Try to find the key/value.
-                map<string, std::shared_ptr<istream>, StringComparator>::const_iterator it = m_mapOfDecompressedEntries.find(key);
-                if (it != m_mapOfDecompressedEntries.end()) {
-                    stream = it->second;
+                map<string, Entry, StringComparator>::const_iterator it = m_mapOfEntries.find(key);
+                if (it == m_mapOfEntries.end()) {
+                    return stream;
+                }
+
+                const Entry &e = it->second;
+                const char *data = getDataFor(e);
+                if (data == NULL) {
+                    CLOG3 << "ZipDecompressedData: invalid entry " << key << endl;
+                    return stream;
+                }
+
+                if (e.m_compressionMethod == COMPRESSION_METHOD_STORED) {
+                    // Read directly from the archive.
+                    stream = std::shared_ptr<istream>(new ZipEntryInputStream(new MemoryStreamBuffer(m_archive, data, e.m_compressedSize)));
+                }
+                else if (e.m_compressionMethod == COMPRESSION_METHOD_DEFLATED) {
+                    if (e.m_uncompressedSize > MAXIMUM_CACHE_SIZE) {
+                        // Do not materialize entries larger than the cache.
+                        stream = std::shared_ptr<istream>(new ZipEntryInputStream(new InflatingStreamBuffer(m_archive, data, e.m_compressedSize)));
+                    }
+                    else {
+                        std::shared_ptr<string> decompressed = getCachedEntry(key, e, data);
+                        if (decompressed.get() != NULL) {
+                            stream = std::shared_ptr<istream>(new ZipEntryInputStream(new MemoryStreamBuffer(decompressed, decompressed->data(), decompressed->size())));
+                        }
+                    }
+                }
+                else {
+                    CLOG3 << "ZipDecompressedData: unsupported compression method " << e.m_compressionMethod << " for " << key << endl;
                 }
 
                 return stream;
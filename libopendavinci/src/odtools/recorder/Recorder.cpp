@@ -150,7 +150,8 @@ namespace odtools {
                         auto delegate = m_mapOfRecorderDelegates.find(c.getDataType());
                         if (delegate != m_mapOfRecorderDelegates.end()) {
                             Container replacementContainer = delegate->second->process(c);
-                            if (m_out.get()) {
+                            // Delegates processing asynchronously return an empty container.
+                            if ( m_out.get() && (replacementContainer.getDataType() != Container::UNDEFINEDDATA) ) {
                                 (*m_out) << replacementContainer;
                             }
 
@@ -37,6 +37,7 @@ namespace odtools {
         using namespace odtools;
 
         SharedDataWriter::SharedDataWriter(std::shared_ptr<ostream> out, map<uint32_t, char*> &mapOfMemories, FIFOQueue &bufferIn, FIFOQueue &bufferOut) :
+            Service("recorder"),
             m_out(out),
             m_mapOfMemories(mapOfMemories),
             m_bufferIn(bufferIn),
@@ -0,0 +1,167 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_CONTAINERDISPATCHERTESTSUITE_H_
+#define CORE_CONTAINERDISPATCHERTESTSUITE_H_
+
+#include <map>
+#include <vector>
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Lock.h"             // for Lock
+#include "opendavinci/odcore/base/Mutex.h"            // for Mutex
+#include "opendavinci/odcore/base/Service.h"          // for Service
+#include "opendavinci/odcore/base/Thread.h"           // for Thread
+#include "opendavinci/odcore/data/Container.h"        // for Container
+#include "opendavinci/odcore/data/TimeStamp.h"        // for TimeStamp
+#include "opendavinci/odcore/io/conference/ContainerDispatcher.h"
+#include "opendavinci/odcore/io/conference/ContainerListener.h"
+
+using namespace std;
+using namespace odcore::base;
+using namespace odcore::data;
+using namespace odcore::io::conference;
+
+class ContainerDispatcherTestListener : public ContainerListener {
+    public:
+        ContainerDispatcherTestListener() :
+            m_sequencesMutex(),
+            m_sequences(),
+            m_numberOfContainers(0),
+            m_correctOrder(true) {}
+
+        virtual void nextContainer(Container &c) {
+            // The sequence number of a container is stored in the seconds of its TimeStamp.
+            const int32_t sequence = c.getData<TimeStamp>().getSeconds();
+
+            Lock l(m_sequencesMutex);
+            if (m_sequences.count(c.getDataType()) > 0) {
+                m_correctOrder &= (m_sequences[c.getDataType()] + 1 == sequence);
+            }
+            m_sequences[c.getDataType()] = sequence;
+            m_numberOfContainers++;
+        }
+
+        uint32_t getNumberOfContainers() {
+            Lock l(m_sequencesMutex);
+            return m_numberOfContainers;
+        }
+
+        Mutex m_sequencesMutex;
+        map<int32_t, int32_t> m_sequences;
+        uint32_t m_numberOfContainers;
+        bool m_correctOrder;
+};
+
+class ContainerDispatcherTestWakeUpService : public Service {
+    public:
+        ContainerDispatcherTestWakeUpService(ContainerDispatcher &cd) :
+            m_cd(cd) {}
+
+        virtual void beforeStop() {}
+
+        virtual void run() {
+            serviceReady();
+            Thread::usleepFor(100 * 1000);
+            m_cd.wakeUp();
+        }
+
+    private:
+        ContainerDispatcher &m_cd;
+};
+
+class ContainerDispatcherTest : public CxxTest::TestSuite {
+    public:
+        void testDispatchOnCallingThread() {
+            ContainerDispatcherTestListener listener;
+            ContainerDispatcher cd(listener, 10, 0);
+
+            for (int32_t i = 0; i < 5; i++) {
+                Container c(TimeStamp(i, 0), 1234);
+                cd.nextContainer(c);
+            }
+            TS_ASSERT(listener.getNumberOfContainers() == 0);
+
+            cd.dispatchFor(0);
+            TS_ASSERT(listener.getNumberOfContainers() == 5);
+            TS_ASSERT(listener.m_sequences[1234] == 4);
+            TS_ASSERT(listener.m_correctOrder);
+            TS_ASSERT(cd.getNumberOfDroppedContainers() == 0);
+        }
+
+        void testDropOldestContainers() {
+            ContainerDispatcherTestListener listener;
+            ContainerDispatcher cd(listener, 3, 0);
+
+            for (int32_t i = 0; i < 5; i++) {
+                Container c(TimeStamp(i, 0), 1234);
+                cd.nextContainer(c);
+            }
+
+            cd.dispatchFor(0);
+            TS_ASSERT(listener.getNumberOfContainers() == 3);
+            TS_ASSERT(listener.m_sequences[1234] == 4);
+            TS_ASSERT(listener.m_correctOrder);
+            TS_ASSERT(cd.getNumberOfDroppedContainers() == 2);
+        }
+
+        void testWakeUp() {
+            ContainerDispatcherTestListener listener;
+            ContainerDispatcher cd(listener, 10, 0);
+
+            ContainerDispatcherTestWakeUpService wakeUp(cd);
+            const TimeStamp before;
+            wakeUp.start();
+            cd.dispatchFor(5 * 1000 * 1000);
+            const TimeStamp after;
+            wakeUp.stop();
+
+            TS_ASSERT((after - before).toMicroseconds() < 4 * 1000 * 1000);
+        }
+
+        void testWorkersPreservePerTypeOrder() {
+            ContainerDispatcherTestListener listener;
+            ContainerDispatcher cd(listener, 1000, 3);
+            cd.start();
+
+            const int32_t NUMBER_OF_DATA_TYPES = 5;
+            const int32_t NUMBER_OF_CONTAINERS_PER_DATA_TYPE = 100;
+            for (int32_t i = 0; i < NUMBER_OF_CONTAINERS_PER_DATA_TYPE; i++) {
+                for (int32_t dataType = 0; dataType < NUMBER_OF_DATA_TYPES; dataType++) {
+                    Container c(TimeStamp(i, 0), 1000 + dataType);
+                    cd.nextContainer(c);
+                }
+            }
+
+            uint32_t timeout = 500;
+            while ( (listener.getNumberOfContainers() < static_cast<uint32_t>(NUMBER_OF_DATA_TYPES * NUMBER_OF_CONTAINERS_PER_DATA_TYPE)) && (timeout-- > 0) ) {
+                Thread::usleepFor(10 * 1000);
+            }
+            cd.stop();
+
+            TS_ASSERT(listener.getNumberOfContainers() == static_cast<uint32_t>(NUMBER_OF_DATA_TYPES * NUMBER_OF_CONTAINERS_PER_DATA_TYPE));
+            TS_ASSERT(listener.m_sequences.size() == static_cast<uint32_t>(NUMBER_OF_DATA_TYPES));
+            TS_ASSERT(listener.m_correctOrder);
+            TS_ASSERT(cd.getNumberOfDroppedContainers() == 0);
+        }
+};
+
+#endif /*CORE_CONTAINERDISPATCHERTESTSUITE_H_*/
@@ -143,6 +143,29 @@ class ContainerTest : public CxxTest::TestSuite {
             TS_ASSERT(c2.getReceivedTimeStamp().toString() == c1.getReceivedTimeStamp().toString());
             TS_ASSERT(c2.getSampleTimeStamp().toString() == c1.getSampleTimeStamp().toString());
         }
+
+        void testSizeOfData() {
+            TimeStamp ts(11, 12);
+            Container c1(ts);
+            const uint32_t size = c1.getSizeOfData();
+            TS_ASSERT(size > 0);
+
+            stringstream s;
+            s << c1;
+            s.flush();
+
+            Container c2;
+            s >> c2;
+            TS_ASSERT(c2.getSizeOfData() == size);
+
+            // Reading the data must neither change the size nor be affected by querying it.
+            TS_ASSERT(c2.getData<TimeStamp>().toString() == ts.toString());
+            TS_ASSERT(c2.getSizeOfData() == size);
+            TS_ASSERT(c2.getData<TimeStamp>().toString() == ts.toString());
+
+            Container c3;
+            TS_ASSERT(c3.getSizeOfData() == 0);
+        }
 };
 
 #endif /*CORE_CONTAINERTESTSUITE_H_*/
@@ -0,0 +1,141 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_CYCLEPROFILETESTSUITE_H_
+#define CORE_CYCLEPROFILETESTSUITE_H_
+
+#include <vector>
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/CycleProfile.h"     // for CycleProfile
+#include "opendavinci/odcore/data/Container.h"        // for Container
+#include "opendavinci/generated/odcore/data/dmcp/CycleRecord.h"
+#include "opendavinci/generated/odcore/data/dmcp/CycleStatistics.h"
+
+using namespace std;
+using namespace odcore::base;
+using namespace odcore::data;
+
+class CycleProfileTest : public CxxTest::TestSuite {
+    public:
+        void testBuckets() {
+            TS_ASSERT(CycleProfile::getBucket(-5) == 0);
+            TS_ASSERT(CycleProfile::getBucket(0) == 0);
+            TS_ASSERT(CycleProfile::getBucket(1) == 1);
+            TS_ASSERT(CycleProfile::getBucket(2) == 2);
+            TS_ASSERT(CycleProfile::getBucket(3) == 2);
+            TS_ASSERT(CycleProfile::getBucket(4) == 3);
+            TS_ASSERT(CycleProfile::getBucket(1023) == 10);
+            TS_ASSERT(CycleProfile::getBucket(1024) == 11);
+            TS_ASSERT(CycleProfile::getBucket(static_cast<int64_t>(1) << 40) == (CycleProfile::NUMBER_OF_BUCKETS - 1));
+        }
+
+        void testOverrunsAndHistograms() {
+            CycleProfile cp;
+            TS_ASSERT(cp.getNumberOfCycles() == 0);
+            TS_ASSERT(cp.getAveragePeriodDeviation() == 0);
+
+            cp.add(1000, 5000, 20, 10000);
+            cp.add(11000, 12000, -300, 10000);
+            cp.add(23000, 3000, 2000, 10000);
+
+            TS_ASSERT(cp.getNumberOfCycles() == 3);
+            TS_ASSERT(cp.getNumberOfOverruns() == 1);
+            TS_ASSERT(cp.getNominalDuration() == 10000);
+            TS_ASSERT(cp.getMinimumPeriodDeviation() == -300);
+            TS_ASSERT(cp.getMaximumPeriodDeviation() == 2000);
+            TS_ASSERT(cp.getMaximumExecutionTime() == 12000);
+            TS_ASSERT_DELTA(cp.getAveragePeriodDeviation(), 1720.0 / 3, 1e-9);
+            TS_ASSERT_DELTA(cp.getAverageAbsolutePeriodDeviation(), 2320.0 / 3, 1e-9);
+
+            TS_ASSERT(cp.getPeriodDeviationHistogram(CycleProfile::getBucket(20)) == 1);
+            TS_ASSERT(cp.getPeriodDeviationHistogram(CycleProfile::getBucket(300)) == 1);
+            TS_ASSERT(cp.getPeriodDeviationHistogram(CycleProfile::getBucket(2000)) == 1);
+            TS_ASSERT(cp.getExecutionTimeHistogram(CycleProfile::getBucket(5000)) == 1);
+            TS_ASSERT(cp.getExecutionTimeHistogram(CycleProfile::getBucket(3000)) == 1);
+            TS_ASSERT(cp.getExecutionTimeHistogram(CycleProfile::getBucket(12000)) == 1);
+
+            uint32_t sum = 0;
+            for (uint32_t i = 0; i < CycleProfile::NUMBER_OF_BUCKETS; i++) {
+                sum += cp.getExecutionTimeHistogram(i);
+            }
+            TS_ASSERT(sum == 3);
+
+            CycleProfile cp2;
+            cp2 = cp;
+            cp.reset();
+            TS_ASSERT(cp.getNumberOfCycles() == 0);
+            TS_ASSERT(cp.getNumberOfOverruns() == 0);
+            TS_ASSERT(cp.getAverageAbsolutePeriodDeviation() == 0);
+            TS_ASSERT(cp.getNumberOfWorstCycles() == 0);
+            TS_ASSERT(cp.getExecutionTimeHistogram(CycleProfile::getBucket(12000)) == 0);
+            TS_ASSERT(cp2.getNumberOfCycles() == 3);
+            TS_ASSERT_DELTA(cp2.getAveragePeriodDeviation(), 1720.0 / 3, 1e-9);
+            TS_ASSERT(cp2.getExecutionTimeHistogram(CycleProfile::getBucket(12000)) == 1);
+        }
+
+        void testWorstCycles() {
+            CycleProfile cp;
+            const uint32_t NUMBER_OF_CYCLES = 3 * CycleProfile::NUMBER_OF_WORST_CYCLES;
+            for (uint32_t i = 0; i < NUMBER_OF_CYCLES; i++) {
+                // Execution times are a permutation of 0..NUMBER_OF_CYCLES-1.
+                const int64_t executionTime = (i * 7) % NUMBER_OF_CYCLES;
+                cp.add(i * 100, executionTime, i, 100);
+            }
+
+            TS_ASSERT(cp.getNumberOfWorstCycles() == CycleProfile::NUMBER_OF_WORST_CYCLES);
+            for (uint32_t i = 0; i < cp.getNumberOfWorstCycles(); i++) {
+                const CycleProfile::Cycle &c = cp.getWorstCycle(i);
+                TS_ASSERT(c.m_executionTime == static_cast<int64_t>(NUMBER_OF_CYCLES - 1 - i));
+                TS_ASSERT(c.m_start == c.m_periodDeviation * 100);
+                TS_ASSERT(((c.m_periodDeviation * 7) % NUMBER_OF_CYCLES) == c.m_executionTime);
+            }
+        }
+
+        void testCycleStatistics() {
+            CycleProfile cp;
+            cp.add(1000000, 5000, 20, 10000);
+            cp.add(1011000, 12000, -300, 10000);
+
+            odcore::data::dmcp::CycleStatistics cs = cp.getCycleStatistics();
+            Container c(cs);
+            odcore::data::dmcp::CycleStatistics cs2 = c.getData<odcore::data::dmcp::CycleStatistics>();
+
+            TS_ASSERT(cs2.getNominalDuration() == 10000);
+            TS_ASSERT(cs2.getNumberOfCycles() == 2);
+            TS_ASSERT(cs2.getNumberOfOverruns() == 1);
+            TS_ASSERT(cs2.getMinimumPeriodDeviation() == -300);
+            TS_ASSERT(cs2.getMaximumPeriodDeviation() == 20);
+            TS_ASSERT(cs2.getMaximumExecutionTime() == 12000);
+            TS_ASSERT(cs2.getSize_ListOfPeriodDeviationHistogram() == CycleProfile::NUMBER_OF_BUCKETS);
+            TS_ASSERT(cs2.getSize_ListOfExecutionTimeHistogram() == CycleProfile::NUMBER_OF_BUCKETS);
+            TS_ASSERT(cs2.getListOfExecutionTimeHistogram()[CycleProfile::getBucket(5000)] == 1);
+
+            vector<odcore::data::dmcp::CycleRecord> worstCycles = cs2.getListOfWorstCycles();
+            TS_ASSERT(worstCycles.size() == 2);
+            TS_ASSERT(worstCycles[0].getExecutionTime() == 12000);
+            TS_ASSERT(worstCycles[0].getPeriodDeviation() == -300);
+            TS_ASSERT(worstCycles[0].getStart().toMicroseconds() == 1011000);
+            TS_ASSERT(worstCycles[1].getExecutionTime() == 5000);
+        }
+};
+
+#endif /*CORE_CYCLEPROFILETESTSUITE_H_*/
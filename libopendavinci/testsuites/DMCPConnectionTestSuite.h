@@ -23,11 +23,14 @@
 #include <memory>
 #include <sstream>                      // for basic_ostream, operator<<, etc
 #include <string>                       // for string, operator==, etc
+#include <vector>
 
 #include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
 
 #include "opendavinci/odcore/base/KeyValueConfiguration.h"  // for KeyValueConfiguration
+#include "opendavinci/odcore/base/Thread.h"
 #include "opendavinci/odcore/dmcp/connection/Client.h"  // for Client
+#include "opendavinci/odcore/dmcp/connection/ModuleConnection.h"
 #include "opendavinci/odcore/dmcp/connection/ConnectionHandler.h"
 #include "opendavinci/odcore/dmcp/connection/Server.h"  // for Server
 #include "opendavinci/generated/odcore/data/dmcp/ModuleDescriptor.h"
@@ -88,6 +91,24 @@ class DMCPConnectionTestsuite : public CxxTest::TestSuite,
 
             TS_ASSERT(client.getConfiguration().getValue<string>("NAME.Key") == "Test");
             TS_ASSERT(client.getConfiguration().getValue<string>("global.exampleKey") == "exampleValue");
+
+            // Subscriptions are reported sorted and without duplicates.
+            TS_ASSERT(connectionHandler.connection->getListOfSubscribedDataTypes().empty());
+
+            vector<int32_t> listOfDataTypes;
+            listOfDataTypes.push_back(19);
+            listOfDataTypes.push_back(7);
+            listOfDataTypes.push_back(19);
+            client.sendSubscribedDataTypes(listOfDataTypes);
+
+            uint32_t timeout = 100;
+            while ( (connectionHandler.connection->getListOfSubscribedDataTypes().size() == 0) && (timeout-- > 0) ) {
+                Thread::usleepFor(10000);
+            }
+
+            vector<int32_t> subscribedDataTypes = connectionHandler.connection->getListOfSubscribedDataTypes();
+            TS_ASSERT(subscribedDataTypes.size() == 2);
+            TS_ASSERT(subscribedDataTypes.size() == 2 && subscribedDataTypes[0] == 7 && subscribedDataTypes[1] == 19);
         }
 
         virtual void onNewModule(std::shared_ptr<odcore::dmcp::connection::ModuleConnection> mc)
@@ -605,6 +605,115 @@ class DataTriggeredConferenceClientModuleTest : public CxxTest::TestSuite,
             Thread::usleepFor(1000 * 1);
         }
 
+        void testDataTriggeredTimeTriggeredConferenceClientModulesFreq10EventDriven() {
+            // Setup ContainerConference.
+            std::shared_ptr<ContainerConference> conference = ContainerConferenceFactory::getInstance().getContainerConference("225.0.0.105");
+
+#if !defined(__OpenBSD__) && !defined(__APPLE__)
+            // Setup DMCP.
+            stringstream sstr;
+            sstr << "global.config=example" << endl
+            << "TimeTriggeredConferenceClientModuleTestModule.config1=example1" << endl
+            << "TimeTriggeredConferenceClientModuleTestModule:ABC.config1=example2" << endl
+            << "TimeTriggeredConferenceClientModuleTestModule:DEF.config1=example3" << endl
+            << "TimeTriggeredConferenceClientModuleTestModule2.config2=example4" << endl
+            << "DataTriggeredConferenceClientModuleTestModule.datatriggered.eventdriven=1" << endl
+            << "DataTriggeredConferenceClientModuleTestModule.datatriggered.capacity=100" << endl
+            << "DataTriggeredConferenceClientModuleTestModule.datatriggered.workers=2" << endl;
+
+            m_configuration = KeyValueConfiguration();
+            m_configuration.readFrom(sstr);
+
+            vector<string> noModulesToIgnore;
+            ServerInformation serverInformation("127.0.0.1", 19000, ServerInformation::ML_NONE);
+            discoverer::Server dmcpDiscovererServer(serverInformation,
+                                                    "225.0.0.105",
+                                                    odcore::data::dmcp::Constants::BROADCAST_PORT_SERVER,
+                                                    odcore::data::dmcp::Constants::BROADCAST_PORT_CLIENT,
+                                                    noModulesToIgnore);
+            dmcpDiscovererServer.startResponding();
+
+            connection::Server dmcpConnectionServer(serverInformation, *this);
+            dmcpConnectionServer.setConnectionHandler(this);
+
+            Thread::usleepFor(1000 * 1);
+
+            string argv0("TimeTriggeredConferenceClientModuleTestModule");
+            string argv1("--id=ABC");
+            string argv2("--cid=105");
+            string argv3("--freq=10");
+            int argc = 4;
+            char **argv;
+            argv = new char*[argc];
+            argv[0] = const_cast<char*>(argv0.c_str());
+            argv[1] = const_cast<char*>(argv1.c_str());
+            argv[2] = const_cast<char*>(argv2.c_str());
+            argv[3] = const_cast<char*>(argv3.c_str());
+
+            int counter = 100;
+            Condition module1;
+            TimeTriggeredConferenceClientModuleTestModule ttccmtm(argc, argv, module1, counter);
+
+
+            string argv0_2("DataTriggeredConferenceClientModuleTestModule");
+            string argv1_2("--id=ABC");
+            string argv2_2("--cid=105");
+            string argv3_2("--freq=1");
+            int argc_2 = 4;
+            char **argv_2;
+            argv_2 = new char*[argc_2];
+            argv_2[0] = const_cast<char*>(argv0_2.c_str());
+            argv_2[1] = const_cast<char*>(argv1_2.c_str());
+            argv_2[2] = const_cast<char*>(argv2_2.c_str());
+            argv_2[3] = const_cast<char*>(argv3_2.c_str());
+
+            Condition dataTriggeredCondition;
+            int stopCounter = 30;
+
+            DataTriggeredConferenceClientModuleTestModule dtccmtm(argc_2, argv_2, dataTriggeredCondition, stopCounter);
+
+            ConferenceClientModuleTestService ccmts_d(dtccmtm);
+            ccmts_d.start();
+
+            Thread::usleepFor(1000 * 3);
+
+            ConferenceClientModuleTestService ccmts(ttccmtm);
+            ccmts.start();
+
+            Lock l(dataTriggeredCondition);
+            dataTriggeredCondition.waitOnSignal();
+
+            ccmts_d.stop();
+            ccmts.stop();
+
+            Thread::usleepFor(1000 * 3);
+
+            TS_ASSERT(ttccmtm.correctOrder);
+            TS_ASSERT(ttccmtm.setUpCalled);
+            TS_ASSERT(ttccmtm.bodyCalled);
+            TS_ASSERT(ttccmtm.tearDownCalled);
+
+            TS_ASSERT(dtccmtm.correctOrder);
+            TS_ASSERT(dtccmtm.setUpCalled);
+            TS_ASSERT(dtccmtm.nextContainerCalled);
+            TS_ASSERT(dtccmtm.counter >= 20);
+#ifndef _WIN32
+            TS_ASSERT(dtccmtm.counter < 50);
+#endif
+            TS_ASSERT(dtccmtm.tearDownCalled);
+#if !defined(__FreeBSD__)
+            TS_ASSERT(dtccmtm.correctOrder);
+#endif
+#endif
+
+            // Ugly cleanup.
+            ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
+            ContainerConferenceFactory *ccf2 = &ccf;
+            OPENDAVINCI_CORE_DELETE_POINTER(ccf2);
+
+            Thread::usleepFor(1000 * 1);
+        }
+
         void testDataTriggeredTimeTriggeredConferenceClientModulesFreq10WaitForSetupCompleted() {
             // Setup ContainerConference.
             std::shared_ptr<ContainerConference> conference = ContainerConferenceFactory::getInstance().getContainerConference("225.0.0.104");
@@ -0,0 +1,182 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_JSONFROMVISITABLEVISITORTESTSUITE_H_
+#define CORE_JSONFROMVISITABLEVISITORTESTSUITE_H_
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/serialization/Serializable.h"     // for Serializable
+#include "opendavinci/odcore/base/Visitable.h"        // for Visitable
+#include "opendavinci/odcore/base/Visitor.h"          // for Visitor
+#include "opendavinci/odcore/data/TimeStamp.h"        // for TimeStamp
+#include "opendavinci/odcore/reflection/CSVFromVisitableVisitor.h"
+#include "opendavinci/odcore/reflection/ExportBuffer.h"
+#include "opendavinci/odcore/reflection/JSONFromVisitableVisitor.h"
+
+using namespace std;
+using namespace odcore;
+using namespace odcore::base;
+using namespace odcore::data;
+using namespace odcore::reflection;
+using namespace odcore::serialization;
+
+class MyNestedVisitable : public Serializable, public Visitable {
+    public:
+        MyNestedVisitable() :
+            Serializable(),
+            Visitable(),
+            m_att1(0),
+            m_att2(false),
+            m_att3(0),
+            m_att4(""),
+            m_att5(),
+            m_att6(0) {}
+
+        ~MyNestedVisitable() {}
+
+        virtual ostream& operator<<(ostream &out) const {
+            return out;
+        }
+
+        virtual istream& operator>>(istream &in) {
+            return in;
+        }
+
+        virtual void accept(odcore::base::Visitor &v) {
+            v.beginVisit(1, "MyNestedVisitable", "MyNestedVisitable");
+            v.visit(1, "MyNestedVisitable::att1", "att1", m_att1);
+            v.visit(2, "MyNestedVisitable::att2", "att2", m_att2);
+            v.visit(3, "MyNestedVisitable::att3", "att3", m_att3);
+            v.visit(4, "MyNestedVisitable::att4", "att4", m_att4);
+            v.visit(5, "MyNestedVisitable::att5", "att5", m_att5);
+            v.visit(6, "MyNestedVisitable::att6", "att6", m_att6);
+            v.endVisit();
+        }
+
+    public:
+        int32_t m_att1;
+        bool m_att2;
+        double m_att3;
+        string m_att4;
+        TimeStamp m_att5;
+        float m_att6;
+};
+
+class JSONFromVisitableVisitorTest : public CxxTest::TestSuite {
+    public:
+        void testJSON() {
+            MyNestedVisitable mv;
+            mv.m_att1 = -3;
+            mv.m_att2 = true;
+            mv.m_att3 = 12.3456;
+            mv.m_att4 = "Hello \"World\"\n";
+            mv.m_att5 = TimeStamp(1, 2);
+            mv.m_att6 = numeric_limits<float>::quiet_NaN();
+
+            stringstream output;
+            JSONFromVisitableVisitor json(output);
+            mv.accept(json);
+
+            mv.m_att1 = 4;
+            mv.m_att6 = -1.234f;
+            mv.accept(json);
+
+            stringstream expected;
+            expected << "{\"att1\":-3,\"att2\":true,\"att3\":12.3456,\"att4\":\"Hello \\\"World\\\"\\u000a\",\"att5\":{\"seconds\":1,\"microseconds\":2},\"att6\":null}" << endl;
+            expected << "{\"att1\":4,\"att2\":true,\"att3\":12.3456,\"att4\":\"Hello \\\"World\\\"\\u000a\",\"att5\":{\"seconds\":1,\"microseconds\":2},\"att6\":-1.234}" << endl;
+
+            TS_ASSERT(output.str() == expected.str());
+        }
+
+        void testExportBufferFormatsLikeOstream() {
+            const double values[] = { 0.0, -0.0, 1, -1.234f, 12.3456, 0.0001, 0.00001, 1.5e-7, 123456, 1234567, 999999.5, 0.1 + 0.2,
+                                      1e22, 1e100, -2.5e-300, 3.14159265358979, numeric_limits<double>::max(), numeric_limits<double>::min(),
+                                      numeric_limits<double>::infinity(), -numeric_limits<double>::infinity() };
+
+            ExportBuffer b;
+            for (uint32_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+                stringstream expected;
+                expected << values[i];
+
+                b.clear();
+                b.appendDouble(values[i]);
+                TS_ASSERT(b.toString() == expected.str());
+            }
+
+            const int64_t integers[] = { 0, -1, 42, numeric_limits<int64_t>::min(), numeric_limits<int64_t>::max() };
+            for (uint32_t i = 0; i < sizeof(integers) / sizeof(integers[0]); i++) {
+                stringstream expected;
+                expected << integers[i];
+
+                b.clear();
+                b.appendInteger(integers[i]);
+                TS_ASSERT(b.toString() == expected.str());
+            }
+
+            b.clear();
+            b.appendUnsignedInteger(numeric_limits<uint64_t>::max());
+            TS_ASSERT(b.toString() == "18446744073709551615");
+        }
+
+        void testExportBenchmark() {
+            const uint32_t SIZE = 100000;
+            MyNestedVisitable mv;
+            mv.m_att4 = "Hello World";
+
+            stringstream csvOutput;
+            TimeStamp before;
+            {
+                CSVFromVisitableVisitor csv(csvOutput);
+                for (uint32_t i = 0; i < SIZE; i++) {
+                    mv.m_att1 = i;
+                    mv.m_att3 = i * 0.123;
+                    mv.accept(csv);
+                }
+            }
+            TimeStamp afterCSV;
+
+            stringstream jsonOutput;
+            {
+                JSONFromVisitableVisitor json(jsonOutput);
+                for (uint32_t i = 0; i < SIZE; i++) {
+                    mv.m_att1 = i;
+                    mv.m_att3 = i * 0.123;
+                    mv.accept(json);
+                }
+            }
+            TimeStamp afterJSON;
+
+            TS_ASSERT(csvOutput.str().size() > 0);
+            TS_ASSERT(jsonOutput.str().size() > 0);
+
+            cout << endl << "Export of " << SIZE << " messages: CSV " << (afterCSV - before).toMicroseconds() / 1000 << "ms ("
+                 << csvOutput.str().size() / 1024 << "kB), JSON " << (afterJSON - afterCSV).toMicroseconds() / 1000 << "ms ("
+                 << jsonOutput.str().size() / 1024 << "kB)." << endl;
+        }
+};
+
+#endif /*CORE_JSONFROMVISITABLEVISITORTESTSUITE_H_*/
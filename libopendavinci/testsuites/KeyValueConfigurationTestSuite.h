@@ -26,6 +26,7 @@
 #include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
 
 #include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/ConfigKey.h"  // for ConfigKey
 #include "opendavinci/odcore/base/KeyValueConfiguration.h"  // for KeyValueConfiguration
 #include "opendavinci/odcore/exceptions/Exceptions.h"
 
@@ -234,6 +235,46 @@ class ConfigurationTest : public CxxTest::TestSuite {
 
             TS_ASSERT_DELTA(key4, 3.1415, 1e-3);
         }
+
+        void testParsedValuesAndBoundKeys() {
+            stringstream s;
+            s << "Section1.key1=42 is the answer" << endl
+            << "Section1.Key2=2.5" << endl
+            << "Section1.key2=3.5" << endl;
+
+            KeyValueConfiguration kvc;
+            kvc.readFrom(s);
+            TS_ASSERT(kvc.getListOfKeys().size() == 2);
+
+            // The same value parsed as different types.
+            TS_ASSERT(kvc.getValue<string>("Section1.key1") == "42");
+            TS_ASSERT(kvc.getValue<int32_t>("Section1.key1") == 42);
+            TS_ASSERT_DELTA(kvc.getValue<double>("Section1.key1"), 42, 1e-9);
+            TS_ASSERT(kvc.getValue<string>("SECTION1.KEY1") == "42");
+
+            // The last occurrence of a key wins.
+            ConfigKey<double> k = kvc.bind<double>("Section1.key2");
+            TS_ASSERT_DELTA(k.get(), 3.5, 1e-9);
+
+            // Copies share the values; reading new data does not change existing copies and handles.
+            KeyValueConfiguration kvc2 = kvc;
+            stringstream s2;
+            s2 << "Section1.key2=4.5" << endl;
+            kvc.readFrom(s2);
+            TS_ASSERT_DELTA(kvc.getValue<double>("Section1.key2"), 4.5, 1e-9);
+            TS_ASSERT_DELTA(kvc2.getValue<double>("Section1.key2"), 3.5, 1e-9);
+            TS_ASSERT_DELTA(k.get(), 3.5, 1e-9);
+
+            bool keyNotFound = false;
+            try {
+                ConfigKey<int32_t> k2 = kvc.bind<int32_t>("Section1.key1");
+                TS_ASSERT(k2.get() == 0);
+            }
+            catch(ValueForKeyNotFoundException &vfknfe) {
+                keyNotFound = true;
+            }
+            TS_ASSERT(keyNotFound);
+        }
 };
 
 #endif /*CORE_KEYVALUECONFIGURATIONTESTSUITE_H_*/
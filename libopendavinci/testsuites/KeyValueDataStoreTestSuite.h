@@ -0,0 +1,239 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_KEYVALUEDATASTORETESTSUITE_H_
+#define CORE_KEYVALUEDATASTORETESTSUITE_H_
+
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/KeyValueDataStore.h"  // for KeyValueDataStore
+#include "opendavinci/odcore/base/Service.h"          // for Service
+#include "opendavinci/odcore/data/Container.h"        // for Container
+#include "opendavinci/odcore/data/TimeStamp.h"        // for TimeStamp
+#include "opendavinci/odcore/wrapper/KeyValueDatabaseFactory.h"  // for KeyValueDatabaseFactory
+
+using namespace std;
+using namespace odcore::base;
+using namespace odcore::data;
+
+class KeyValueDataStoreTestReader : public Service {
+    public:
+        KeyValueDataStoreTestReader(KeyValueDataStore &kvds) :
+            m_kvds(kvds),
+            m_numberOfReads(0),
+            m_numberOfErrors(0) {}
+
+        virtual void beforeStop() {}
+
+        virtual void run() {
+            serviceReady();
+            int64_t last = 0;
+            while (isRunning()) {
+                std::shared_ptr<const Container> c = m_kvds.getShared(0);
+                if (c->getDataType() == TimeStamp::ID()) {
+                    const int64_t current = c->getData<TimeStamp>().toMicroseconds();
+                    // The writer only stores increasing values.
+                    if (current < last) {
+                        m_numberOfErrors++;
+                    }
+                    last = current;
+                    m_numberOfReads++;
+                }
+                else if (c->getDataType() != Container::UNDEFINEDDATA) {
+                    m_numberOfErrors++;
+                }
+            }
+        }
+
+    public:
+        KeyValueDataStore &m_kvds;
+        uint32_t m_numberOfReads;
+        uint32_t m_numberOfErrors;
+};
+
+class KeyValueDataStoreTest : public CxxTest::TestSuite {
+    public:
+        void testLatestValue() {
+            KeyValueDataStore kvds;
+
+            // Test for no entry.
+            TS_ASSERT(kvds.get(1).getDataType() == Container::UNDEFINEDDATA);
+            TS_ASSERT(kvds.getShared(1)->getDataType() == Container::UNDEFINEDDATA);
+            TS_ASSERT(kvds.getHistory(1, 5).empty());
+
+            TimeStamp ts1(1, 2);
+            Container c1(ts1);
+            kvds.put(1, c1);
+
+            std::shared_ptr<const Container> v1 = kvds.getShared(1);
+            TS_ASSERT(v1->getDataType() == TimeStamp::ID());
+            TS_ASSERT(v1.get() == kvds.getShared(1).get());
+            TS_ASSERT(kvds.get(1).getData<TimeStamp>().toMicroseconds() == ts1.toMicroseconds());
+
+            TimeStamp ts2(3, 4);
+            Container c2(ts2);
+            kvds.put(1, c2);
+
+            // A previously returned value is not modified by put.
+            TS_ASSERT(v1->getData<TimeStamp>().toMicroseconds() == ts1.toMicroseconds());
+            TS_ASSERT(kvds.get(1).getData<TimeStamp>().toMicroseconds() == ts2.toMicroseconds());
+            TS_ASSERT(kvds.getHistory(1, 5).size() == 1);
+
+            // Other keys are not affected.
+            TS_ASSERT(kvds.get(1 + KeyValueDataStore::NUMBER_OF_SHARDS).getDataType() == Container::UNDEFINEDDATA);
+            TS_ASSERT(kvds.get(-1).getDataType() == Container::UNDEFINEDDATA);
+        }
+
+        void testManyKeys() {
+            KeyValueDataStore kvds;
+
+            const int32_t size = 4096;
+            for (int32_t i = 0; i < size; i++) {
+                TimeStamp ts(i, 0);
+                Container c(ts);
+                kvds.put(i - size / 2, c);
+            }
+            for (int32_t i = 0; i < size; i++) {
+                TS_ASSERT(kvds.get(i - size / 2).getData<TimeStamp>().getSeconds() == i);
+            }
+        }
+
+        void testHistory() {
+            KeyValueDataStore kvds;
+
+            TimeStamp ts0(10, 0);
+            Container c0(ts0);
+            kvds.put(7, c0);
+
+            // The latest value is kept when enabling the history.
+            kvds.setHistoryDepth(7, 3);
+            TS_ASSERT(kvds.getHistory(7, 10).size() == 1);
+
+            for (int32_t i = 11; i < 15; i++) {
+                TimeStamp ts(i, 0);
+                Container c(ts);
+                kvds.put(7, c);
+            }
+
+            vector<std::shared_ptr<const Container> > history = kvds.getHistory(7, 10);
+            TS_ASSERT(history.size() == 3);
+            TS_ASSERT(history[0]->getData<TimeStamp>().getSeconds() == 14);
+            TS_ASSERT(history[1]->getData<TimeStamp>().getSeconds() == 13);
+            TS_ASSERT(history[2]->getData<TimeStamp>().getSeconds() == 12);
+            TS_ASSERT(history[0].get() == kvds.getShared(7).get());
+
+            history = kvds.getHistory(7, 2);
+            TS_ASSERT(history.size() == 2);
+            TS_ASSERT(history[1]->getData<TimeStamp>().getSeconds() == 13);
+
+            // Shrinking the history keeps the latest values.
+            kvds.setHistoryDepth(7, 2);
+            history = kvds.getHistory(7, 10);
+            TS_ASSERT(history.size() == 2);
+            TS_ASSERT(history[0]->getData<TimeStamp>().getSeconds() == 14);
+            TS_ASSERT(history[1]->getData<TimeStamp>().getSeconds() == 13);
+
+            TimeStamp ts15(15, 0);
+            Container c15(ts15);
+            kvds.put(7, c15);
+            history = kvds.getHistory(7, 10);
+            TS_ASSERT(history.size() == 2);
+            TS_ASSERT(history[0]->getData<TimeStamp>().getSeconds() == 15);
+            TS_ASSERT(history[1]->getData<TimeStamp>().getSeconds() == 14);
+
+            kvds.setHistoryDepth(7, 1);
+            history = kvds.getHistory(7, 10);
+            TS_ASSERT(history.size() == 1);
+            TS_ASSERT(history[0]->getData<TimeStamp>().getSeconds() == 15);
+            TS_ASSERT(kvds.getHistory(7, 0).empty());
+
+            // A history can be configured before the first value.
+            kvds.setHistoryDepth(8, 4);
+            TS_ASSERT(kvds.getHistory(8, 4).empty());
+            TS_ASSERT(kvds.get(8).getDataType() == Container::UNDEFINEDDATA);
+        }
+
+        void testConcurrentReaderAndWriter() {
+            KeyValueDataStore kvds;
+            KeyValueDataStoreTestReader reader(kvds);
+            reader.start();
+
+            for (int32_t i = 1; i < 20000; i++) {
+                TimeStamp ts(i, 0);
+                Container c(ts);
+                kvds.put(0, c);
+                // Add other keys to the same shard while reading.
+                if ((i % 100) == 0) {
+                    kvds.put(i * KeyValueDataStore::NUMBER_OF_SHARDS, c);
+                }
+            }
+
+            reader.stop();
+
+            TS_ASSERT(reader.m_numberOfReads > 0);
+            TS_ASSERT(reader.m_numberOfErrors == 0);
+            TS_ASSERT(kvds.get(0).getData<TimeStamp>().getSeconds() == 19999);
+        }
+
+        void testKeyValueDataStoreBenchmark() {
+            const uint32_t READS = 100000;
+            const int32_t KEYS = 8;
+
+            KeyValueDataStore simpleDB(odcore::wrapper::KeyValueDatabaseFactory::createKeyValueDatabase());
+            KeyValueDataStore inMemory;
+            for (int32_t i = 0; i < KEYS; i++) {
+                TimeStamp ts(i, 0);
+                Container c(ts);
+                simpleDB.put(i, c);
+                inMemory.put(i, c);
+            }
+
+            int64_t sum = 0;
+            TimeStamp beforeSimpleDB;
+            for (uint32_t i = 0; i < READS; i++) {
+                sum += simpleDB.get(i % KEYS).getData<TimeStamp>().getSeconds();
+            }
+            TimeStamp afterSimpleDB;
+
+            TimeStamp beforeGet;
+            for (uint32_t i = 0; i < READS; i++) {
+                sum -= inMemory.get(i % KEYS).getData<TimeStamp>().getSeconds();
+            }
+            TimeStamp afterGet;
+
+            TimeStamp beforeGetShared;
+            for (uint32_t i = 0; i < READS; i++) {
+                sum += inMemory.getShared(i % KEYS)->getData<TimeStamp>().getSeconds();
+            }
+            TimeStamp afterGetShared;
+            TS_ASSERT(sum == static_cast<int64_t>(READS / KEYS) * (KEYS * (KEYS - 1) / 2));
+
+            cout << endl << "KeyValueDataStore: " << READS << " reads: "
+                 << "SimpleDB " << (afterSimpleDB - beforeSimpleDB).toMicroseconds() * 1000 / READS << "ns/read, "
+                 << "get " << (afterGet - beforeGet).toMicroseconds() * 1000 / READS << "ns/read, "
+                 << "getShared " << (afterGetShared - beforeGetShared).toMicroseconds() * 1000 / READS << "ns/read." << endl;
+        }
+};
+
+#endif /*CORE_KEYVALUEDATASTORETESTSUITE_H_*/
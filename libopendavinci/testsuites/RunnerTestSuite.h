@@ -63,6 +63,41 @@ class RunnerTest : public CxxTest::TestSuite {
             TS_ASSERT(!r3.needsExecution(ControlledTime(1, 999999)));
             TS_ASSERT(r3.needsExecution(ControlledTime(2, 0)));
         }
+
+        void testTimeUntilNextExecution() {
+            RunnerTestApp r1(2);
+            TS_ASSERT(r1.getTimeUntilNextExecution(ControlledTime(0, 0)) == 500);
+            TS_ASSERT(r1.getTimeUntilNextExecution(ControlledTime(1, 499000)) == 1);
+            TS_ASSERT(r1.getTimeUntilNextExecution(ControlledTime(1, 500000)) == 500);
+
+            RunnerTestApp r2(0.5);
+            TS_ASSERT(r2.getTimeUntilNextExecution(ControlledTime(0, 0)) == 2000);
+            TS_ASSERT(r2.getTimeUntilNextExecution(ControlledTime(1, 0)) == 1000);
+
+            RunnerTestApp r3(0);
+            TS_ASSERT(r3.getTimeUntilNextExecution(ControlledTime(0, 0)) == 0);
+
+            // Jumping from execution to execution must visit the same points in time as stepping every millisecond.
+            const float frequencies[] = { 7, 3, 100, 0.3f };
+            for (uint32_t i = 0; i < 4; i++) {
+                RunnerTestApp r(frequencies[i]);
+
+                uint32_t executionsByStepping = 0;
+                for (uint32_t ms = 0; ms < 10000; ms++) {
+                    if (r.needsExecution(ControlledTime(ms / 1000, (ms % 1000) * 1000))) {
+                        executionsByStepping++;
+                    }
+                }
+
+                uint32_t executionsByJumping = 0;
+                for (uint32_t ms = 0; ms < 10000; ms += r.getTimeUntilNextExecution(ControlledTime(ms / 1000, (ms % 1000) * 1000))) {
+                    TS_ASSERT(r.needsExecution(ControlledTime(ms / 1000, (ms % 1000) * 1000)));
+                    executionsByJumping++;
+                }
+
+                TS_ASSERT(executionsByStepping == executionsByJumping);
+            }
+        }
 };
 
 #endif /*CONTEXT_RUNNERTESTSUITE_H_*/
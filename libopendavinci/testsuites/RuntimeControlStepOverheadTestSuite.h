@@ -0,0 +1,139 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CONTEXT_RUNTIMECONTROLSTEPOVERHEADTESTSUITE_H_
+#define CONTEXT_RUNTIMECONTROLSTEPOVERHEADTESTSUITE_H_
+
+#include <chrono>                       // for steady_clock
+#include <iostream>                     // for operator<<, basic_ostream, etc
+#include <string>                       // for string, operator<<, etc
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcontext/base/DirectInterface.h"  // for DirectInterface
+#include "opendavinci/odcontext/base/RuntimeControl.h"  // for RuntimeControl, etc
+#include "opendavinci/odcontext/base/RuntimeEnvironment.h"  // for RuntimeEnvironment
+#include "opendavinci/odcontext/base/SystemFeedbackComponent.h"
+#include "opendavinci/odcore/base/module/TimeTriggeredConferenceClientModule.h"
+#include "opendavinci/generated/odcore/data/dmcp/ModuleExitCodeMessage.h"
+
+namespace odcontext { namespace base { class SendContainerToSystemsUnderTest; } }
+namespace odcore { namespace wrapper { class Time; } }
+
+using namespace std;
+using namespace odcore::base;
+using namespace odcore::base::module;
+using namespace odcontext::base;
+
+class RuntimeControlStepOverheadTestModule : public TimeTriggeredConferenceClientModule {
+    public:
+        RuntimeControlStepOverheadTestModule(const int32_t &argc, char **argv) :
+            TimeTriggeredConferenceClientModule(argc, argv, "RuntimeControlStepOverheadTestModule"),
+            m_cycleCounter(0) {}
+
+        virtual void setUp() {}
+
+        virtual void tearDown() {}
+
+        virtual odcore::data::dmcp::ModuleExitCodeMessage::ModuleExitCode body() {
+            while (getModuleStateAndWaitForRemainingTimeInTimeslice() == odcore::data::dmcp::ModuleStateMessage::RUNNING) {
+                m_cycleCounter++;
+            }
+
+            return odcore::data::dmcp::ModuleExitCodeMessage::OKAY;
+        }
+
+        uint32_t getCycleCounter() const {
+            return m_cycleCounter;
+        }
+
+    private:
+        uint32_t m_cycleCounter;
+};
+
+class RuntimeControlStepOverheadTestDummySystemPart : public SystemFeedbackComponent {
+    public:
+        RuntimeControlStepOverheadTestDummySystemPart() :
+            m_freq(1) {}
+
+        float getFrequency() const {
+            return m_freq;
+        }
+
+        virtual void setup() {}
+
+        virtual void tearDown() {}
+
+        virtual void step(const odcore::wrapper::Time &/*t*/, SendContainerToSystemsUnderTest &/*sender*/) {}
+
+        const float m_freq;
+};
+
+class RuntimeControlStepOverheadTest : public CxxTest::TestSuite {
+    public:
+        void testRuntimeControlStepOverhead() {
+            const uint32_t SECONDS = 20;
+            const uint32_t FREQ = 100;
+
+            stringstream sstr;
+            sstr << "runtimecontrolstepoverheadtestmodule.key1 = value1" << endl;
+
+            DirectInterface di("225.0.0.106", 106, sstr.str());
+            RuntimeControl sc(di);
+            sc.setup(RuntimeControl::TAKE_CONTROL);
+
+            // Setup application.
+            string argv0("runtimecontrolstepoverheadtestmodule");
+            string argv1("--cid=106");
+            string argv2("--freq=100");
+            int32_t argc = 3;
+            char **argv;
+            argv = new char*[3];
+            argv[0] = const_cast<char*>(argv0.c_str());
+            argv[1] = const_cast<char*>(argv1.c_str());
+            argv[2] = const_cast<char*>(argv2.c_str());
+
+            RuntimeControlStepOverheadTestModule rctm(argc, argv);
+
+            RuntimeControlStepOverheadTestDummySystemPart rctdsc;
+
+            RuntimeEnvironment rte;
+            rte.add(rctm);
+            rte.add(rctdsc);
+
+            // TimeStamp is controlled by RuntimeControl; thus, measure the wall time with steady_clock.
+            const std::chrono::steady_clock::time_point before = std::chrono::steady_clock::now();
+            TS_ASSERT(sc.run(rte, SECONDS) == RuntimeControl::RUNTIME_TIMEOUT);
+            const std::chrono::steady_clock::time_point after = std::chrono::steady_clock::now();
+
+            sc.tearDown();
+
+            // The first cycle is the head of the app's while-loop.
+            TS_ASSERT(rctm.getCycleCounter() == SECONDS * FREQ - 1);
+
+            const int64_t duration = std::chrono::duration_cast<std::chrono::microseconds>(after - before).count();
+            cout << endl << "RuntimeControl: " << SECONDS * FREQ << " steps of a " << FREQ << "Hz module in "
+                 << duration / 1000 << "ms, " << duration / (SECONDS * FREQ) << "us/step." << endl;
+
+            delete [] argv;
+        }
+};
+
+#endif /*CONTEXT_RUNTIMECONTROLSTEPOVERHEADTESTSUITE_H_*/
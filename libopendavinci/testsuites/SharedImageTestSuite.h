@@ -0,0 +1,259 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_SHAREDIMAGETESTSUITE_H_
+#define CORE_SHAREDIMAGETESTSUITE_H_
+
+#include <cstring>                      // for memcpy
+#include <iostream>                     // for cout, endl
+#include <memory>
+#include <vector>                       // for vector
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/data/TimeStamp.h"  // for TimeStamp
+#include "opendavinci/odcore/data/image/ImageKernels.h"  // for ImageKernels
+#include "opendavinci/odcore/data/image/SharedImageReader.h"  // for SharedImageReader
+#include "opendavinci/odcore/data/image/SharedImageWriter.h"  // for SharedImageWriter
+#include "opendavinci/odcore/wrapper/SharedMemory.h"  // for SharedMemory
+#include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"  // for SharedMemoryFactory
+#include "opendavinci/generated/odcore/data/image/SharedImage.h"  // for SharedImage
+
+using namespace std;
+using namespace odcore::data;
+using namespace odcore::data::image;
+
+class SharedImageTest : public CxxTest::TestSuite {
+    private:
+        static vector<uint8_t> createImage(const uint32_t &stride, const uint32_t &height) {
+            vector<uint8_t> image(stride * height);
+            for (uint32_t i = 0; i < image.size(); i++) {
+                image[i] = static_cast<uint8_t>((i * 7 + i / 251) & 0xFF);
+            }
+            return image;
+        }
+
+        // Reference implementation of the flip.
+        static void flip(const uint8_t *src, const uint32_t &srcStride, uint8_t *dst, const uint32_t &dstStride, const uint32_t &width, const uint32_t &height, const uint32_t &bpp, const ImageKernels::FLIPMODE &mode) {
+            for (uint32_t y = 0; y < height; y++) {
+                for (uint32_t x = 0; x < width; x++) {
+                    const uint32_t dx = (mode == ImageKernels::VERTICAL) ? x : (width - 1 - x);
+                    const uint32_t dy = (mode == ImageKernels::HORIZONTAL) ? y : (height - 1 - y);
+                    for (uint32_t c = 0; c < bpp; c++) {
+                        dst[dy * dstStride + dx * bpp + c] = src[y * srcStride + x * bpp + c];
+                    }
+                }
+            }
+        }
+
+    public:
+        void testFlip() {
+            const ImageKernels::FLIPMODE modes[] = { ImageKernels::VERTICAL, ImageKernels::HORIZONTAL, ImageKernels::BOTH };
+            const uint32_t bpps[] = { 1, 2, 3, 4 };
+            const uint32_t HEIGHT = 3;
+            for (uint32_t m = 0; m < 3; m++) {
+                for (uint32_t b = 0; b < 4; b++) {
+                    for (uint32_t width = 1; width < 70; width++) {
+                        const uint32_t bpp = bpps[b];
+                        const uint32_t srcStride = width * bpp + 5;
+                        const uint32_t dstStride = width * bpp + 3;
+                        const vector<uint8_t> src = createImage(srcStride, HEIGHT);
+
+                        vector<uint8_t> expected(dstStride * HEIGHT, 0xAB);
+                        vector<uint8_t> actual(dstStride * HEIGHT, 0xAB);
+                        flip(&src[0], srcStride, &expected[0], dstStride, width, HEIGHT, bpp, modes[m]);
+                        ImageKernels::flip(&src[0], srcStride, &actual[0], dstStride, width, HEIGHT, bpp, modes[m]);
+                        TS_ASSERT(actual == expected);
+                    }
+                }
+            }
+        }
+
+        void testSwapRedBlue() {
+            const uint32_t HEIGHT = 2;
+            for (uint32_t width = 1; width < 40; width++) {
+                const uint32_t stride = width * 3 + 1;
+                const vector<uint8_t> src = createImage(stride, HEIGHT);
+
+                vector<uint8_t> expected(src);
+                for (uint32_t y = 0; y < HEIGHT; y++) {
+                    for (uint32_t x = 0; x < width; x++) {
+                        expected[y * stride + 3 * x] = src[y * stride + 3 * x + 2];
+                        expected[y * stride + 3 * x + 2] = src[y * stride + 3 * x];
+                    }
+                }
+
+                vector<uint8_t> actual(src);
+                ImageKernels::swapRedBlue(&src[0], stride, &actual[0], stride, width, HEIGHT);
+                TS_ASSERT(actual == expected);
+
+                // In place.
+                vector<uint8_t> inPlace(src);
+                ImageKernels::swapRedBlue(&inPlace[0], stride, &inPlace[0], stride, width, HEIGHT);
+                TS_ASSERT(inPlace == expected);
+            }
+        }
+
+        void testGrayscale() {
+            const uint8_t bgr[] = { 255, 255, 255, 0, 0, 0, 255, 0, 0, 0, 0, 255 };
+            uint8_t gray[4] = { 0, 0, 0, 0 };
+            ImageKernels::toGrayscale(bgr, 12, gray, 4, 4, 1, true);
+            TS_ASSERT(gray[0] == 255);
+            TS_ASSERT(gray[1] == 0);
+            TS_ASSERT(gray[2] == 29);
+            TS_ASSERT(gray[3] == 77);
+
+            ImageKernels::toGrayscale(bgr, 12, gray, 4, 4, 1, false);
+            TS_ASSERT(gray[2] == 77);
+            TS_ASSERT(gray[3] == 29);
+        }
+
+        void testDownscale() {
+            // 4x2 pixels with 2 bytes per pixel to 2x1 pixels.
+            const uint8_t src[] = { 0, 10,  2, 10,  100, 0,  200, 0,
+                                    4, 10,  6, 11,  100, 0,  201, 255 };
+            uint8_t dst[4] = { 0, 0, 0, 0 };
+            ImageKernels::downscale(src, 8, dst, 4, 4, 2, 2, 2);
+            TS_ASSERT(dst[0] == 3);
+            TS_ASSERT(dst[1] == 10);
+            TS_ASSERT(dst[2] == 150);
+            TS_ASSERT(dst[3] == 64);
+        }
+
+        void testReaderAndWriter() {
+            const uint32_t WIDTH = 64;
+            const uint32_t HEIGHT = 48;
+            SharedImageWriter writer("SharedImageTest", WIDTH, HEIGHT, 3);
+            TS_ASSERT(writer.isValid());
+            TS_ASSERT(writer.getSharedImage().getSize() == WIDTH * HEIGHT * 3);
+
+            const vector<uint8_t> image = createImage(WIDTH * 3, HEIGHT);
+            TS_ASSERT(writer.write(&image[0], WIDTH * 3));
+
+            SharedImageReader reader;
+            {
+                SharedImageReader::View view(reader, writer.getSharedImage());
+                TS_ASSERT(view.isValid());
+                TS_ASSERT(view.getSize() == image.size());
+                TS_ASSERT(::memcmp(view.getData(), &image[0], image.size()) == 0);
+
+                view.release();
+                TS_ASSERT(!view.isValid());
+                TS_ASSERT(view.getData() == NULL);
+            }
+
+            vector<uint8_t> buffer;
+            TS_ASSERT(reader.copy(writer.getSharedImage(), buffer));
+            TS_ASSERT(buffer == image);
+
+            // Copy into an image with padded rows.
+            const uint32_t STRIDE = WIDTH * 3 + 4;
+            vector<uint8_t> padded(STRIDE * HEIGHT);
+            TS_ASSERT(reader.copy(writer.getSharedImage(), &padded[0], STRIDE));
+            TS_ASSERT(::memcmp(&padded[(HEIGHT - 1) * STRIDE], &image[(HEIGHT - 1) * WIDTH * 3], WIDTH * 3) == 0);
+
+            // The attachment is reused.
+            TS_ASSERT(reader.getNumberOfAttachments() == 1);
+
+            // Unknown shared memory.
+            SharedImage unknown;
+            unknown.setName("UnknownImage");
+            unknown.setWidth(2);
+            unknown.setHeight(2);
+            unknown.setBytesPerPixel(1);
+            TS_ASSERT(!reader.copy(unknown, buffer));
+            SharedImageReader::View invalid(reader, unknown);
+            TS_ASSERT(!invalid.isValid());
+            TS_ASSERT(reader.getNumberOfAttachments() == 1);
+
+            reader.detach("SharedImageTest");
+            TS_ASSERT(reader.getNumberOfAttachments() == 0);
+        }
+
+        void testSharedImageBenchmark() {
+            const uint32_t WIDTH = 640;
+            const uint32_t HEIGHT = 480;
+            const uint32_t STRIDE = WIDTH * 3;
+            const uint32_t FRAMES = 200;
+            SharedImageWriter writer("SharedImageBenchmark", WIDTH, HEIGHT, 3);
+            const vector<uint8_t> image = createImage(STRIDE, HEIGHT);
+            TS_ASSERT(writer.write(&image[0], STRIDE));
+
+            vector<uint8_t> expected(image.size());
+            flip(&image[0], STRIDE, &expected[0], STRIDE, WIDTH, HEIGHT, 3, ImageKernels::BOTH);
+
+            // Previous pattern: Attach, lock, memcpy, and mirror in place using cvFlip(img, 0, -1) while locked.
+            vector<uint8_t> frame(image.size());
+            int64_t lockedBefore = 0;
+            TimeStamp beforeMemcpy;
+            for (uint32_t i = 0; i < FRAMES; i++) {
+                std::shared_ptr<odcore::wrapper::SharedMemory> sharedMemory = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory("SharedImageBenchmark");
+                TimeStamp locked;
+                sharedMemory->lock();
+                ::memcpy(&frame[0], sharedMemory->getSharedMemory(), image.size());
+                for (uint32_t y = 0; y < HEIGHT / 2; y++) {
+                    uint8_t *a = &frame[y * STRIDE];
+                    uint8_t *b = &frame[(HEIGHT - 1 - y) * STRIDE];
+                    for (uint32_t x = 0; x < WIDTH; x++) {
+                        for (uint32_t c = 0; c < 3; c++) {
+                            const uint8_t tmp = a[3 * x + c];
+                            a[3 * x + c] = b[3 * (WIDTH - 1 - x) + c];
+                            b[3 * (WIDTH - 1 - x) + c] = tmp;
+                        }
+                    }
+                }
+                sharedMemory->unlock();
+                lockedBefore += (TimeStamp() - locked).toMicroseconds();
+            }
+            TimeStamp afterMemcpy;
+            TS_ASSERT(frame == expected);
+
+            // SharedImageReader: Cached attachment, copy while locked, flip afterwards.
+            SharedImageReader reader;
+            vector<uint8_t> buffer;
+            vector<uint8_t> flipped(image.size());
+            int64_t lockedAfter = 0;
+            TimeStamp beforeReader;
+            for (uint32_t i = 0; i < FRAMES; i++) {
+                TimeStamp locked;
+                TS_ASSERT(reader.copy(writer.getSharedImage(), buffer));
+                lockedAfter += (TimeStamp() - locked).toMicroseconds();
+                ImageKernels::flip(&buffer[0], STRIDE, &flipped[0], STRIDE, WIDTH, HEIGHT, 3, ImageKernels::BOTH);
+            }
+            TimeStamp afterReader;
+            TS_ASSERT(flipped == expected);
+
+            // SharedImageReader: Flip directly from the view without an intermediate copy.
+            TimeStamp beforeView;
+            for (uint32_t i = 0; i < FRAMES; i++) {
+                SharedImageReader::View view(reader, writer.getSharedImage());
+                ImageKernels::flip(view.getData(), STRIDE, &flipped[0], STRIDE, WIDTH, HEIGHT, 3, ImageKernels::BOTH);
+            }
+            TimeStamp afterView;
+            TS_ASSERT(flipped == expected);
+
+            cout << endl << "SharedImage: " << FRAMES << " frames of " << WIDTH << "x" << HEIGHT << "x3: "
+                 << "memcpy+flip " << (afterMemcpy - beforeMemcpy).toMicroseconds() / FRAMES << "us/frame (locked " << lockedBefore / FRAMES << "us), "
+                 << "copy+ImageKernels::flip " << (afterReader - beforeReader).toMicroseconds() / FRAMES << "us/frame (locked " << lockedAfter / FRAMES << "us), "
+                 << "View+ImageKernels::flip " << (afterView - beforeView).toMicroseconds() / FRAMES << "us/frame." << endl;
+        }
+};
+
+#endif /*CORE_SHAREDIMAGETESTSUITE_H_*/
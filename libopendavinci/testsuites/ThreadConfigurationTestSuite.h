@@ -0,0 +1,177 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_THREADCONFIGURATIONTESTSUITE_H_
+#define CORE_THREADCONFIGURATIONTESTSUITE_H_
+
+#ifdef __linux__
+    #include <sched.h>
+#endif
+
+#include <vector>
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Lock.h"             // for Lock
+#include "opendavinci/odcore/base/Mutex.h"            // for Mutex
+#include "opendavinci/odcore/base/Service.h"          // for Service
+#include "opendavinci/odcore/base/Thread.h"
+#include "opendavinci/odcore/wrapper/ConcurrencyFactory.h"
+#include "opendavinci/odcore/wrapper/ThreadConfiguration.h"
+
+using namespace std;
+using namespace odcore::base;
+using odcore::wrapper::ConcurrencyFactory;
+using odcore::wrapper::ThreadConfiguration;
+
+class ThreadConfigurationTestService : public Service {
+    public:
+        ThreadConfigurationTestService(const string &role) :
+            Service(role),
+            m_affinityMutex(),
+            m_cpus() {}
+
+        void beforeStop() {}
+
+        void run() {
+            serviceReady();
+            while (isRunning()) {
+#ifdef __linux__
+                cpu_set_t cpuset;
+                CPU_ZERO(&cpuset);
+                if (::sched_getaffinity(0, sizeof(cpu_set_t), &cpuset) == 0) {
+                    Lock l(m_affinityMutex);
+                    m_cpus.clear();
+                    for (uint32_t i = 0; i < CPU_SETSIZE; i++) {
+                        if (CPU_ISSET(i, &cpuset)) {
+                            m_cpus.push_back(i);
+                        }
+                    }
+                }
+#endif
+                Thread::usleepFor(1000);
+            }
+        }
+
+        vector<uint32_t> getCPUs() {
+            Lock l(m_affinityMutex);
+            return m_cpus;
+        }
+
+    private:
+        Mutex m_affinityMutex;
+        vector<uint32_t> m_cpus;
+};
+
+class ThreadConfigurationTest : public CxxTest::TestSuite {
+    public:
+        void testParseCPUs() {
+            vector<uint32_t> cpus = ThreadConfiguration::parseCPUs("1,3-5");
+            TS_ASSERT(cpus.size() == 4);
+            TS_ASSERT(cpus[0] == 1);
+            TS_ASSERT(cpus[1] == 3);
+            TS_ASSERT(cpus[2] == 4);
+            TS_ASSERT(cpus[3] == 5);
+
+            cpus = ThreadConfiguration::parseCPUs(" 7 ");
+            TS_ASSERT(cpus.size() == 1);
+            TS_ASSERT(cpus[0] == 7);
+
+            cpus = ThreadConfiguration::parseCPUs("x,2,-1,");
+            TS_ASSERT(cpus.size() == 1);
+            TS_ASSERT(cpus[0] == 2);
+
+            TS_ASSERT(ThreadConfiguration::parseCPUs("").empty());
+        }
+
+        void testParseSchedulingPolicy() {
+            TS_ASSERT(ThreadConfiguration::parseSchedulingPolicy("fifo") == ThreadConfiguration::FIFO);
+            TS_ASSERT(ThreadConfiguration::parseSchedulingPolicy("RR") == ThreadConfiguration::ROUND_ROBIN);
+            TS_ASSERT(ThreadConfiguration::parseSchedulingPolicy(" other") == ThreadConfiguration::OTHER);
+            TS_ASSERT(ThreadConfiguration::parseSchedulingPolicy("deadline") == ThreadConfiguration::INHERIT);
+        }
+
+        void testDefaultConfiguration() {
+            ThreadConfiguration tc;
+            TS_ASSERT(tc.isDefault());
+            TS_ASSERT(ConcurrencyFactory::configureCurrentThread(tc));
+            TS_ASSERT(ConcurrencyFactory::getThreadConfiguration("unknownRole").isDefault());
+
+            tc.setPriority(10);
+            TS_ASSERT(tc.isDefault());
+
+            tc.setSchedulingPolicy(ThreadConfiguration::OTHER);
+            TS_ASSERT(!tc.isDefault());
+
+            ThreadConfiguration tc2(tc);
+            TS_ASSERT(tc2.getSchedulingPolicy() == ThreadConfiguration::OTHER);
+            TS_ASSERT(tc2.getPriority() == 10);
+            TS_ASSERT(tc2.toString() == "cpus: all, policy: other, priority: 10");
+        }
+
+        void testCPUAffinityForRole() {
+#ifdef __linux__
+            // Use the last CPU this process may run on.
+            cpu_set_t cpuset;
+            CPU_ZERO(&cpuset);
+            TS_ASSERT(::sched_getaffinity(0, sizeof(cpu_set_t), &cpuset) == 0);
+            uint32_t lastCPU = 0;
+            for (uint32_t i = 0; i < CPU_SETSIZE; i++) {
+                if (CPU_ISSET(i, &cpuset)) {
+                    lastCPU = i;
+                }
+            }
+
+            vector<uint32_t> cpus;
+            cpus.push_back(lastCPU);
+            ThreadConfiguration tc;
+            tc.setCPUs(cpus);
+
+            // Configuration registered before the thread is created.
+            TS_ASSERT(ConcurrencyFactory::setThreadConfiguration("threadConfigurationTestA", tc));
+            ThreadConfigurationTestService s1("threadConfigurationTestA");
+            s1.start();
+
+            // Configuration registered while the thread is running.
+            ThreadConfigurationTestService s2("threadConfigurationTestB");
+            s2.start();
+            Thread::usleepFor(10 * 1000);
+            TS_ASSERT(ConcurrencyFactory::setThreadConfiguration("threadConfigurationTestB", tc));
+            Thread::usleepFor(10 * 1000);
+
+            vector<uint32_t> cpus1 = s1.getCPUs();
+            vector<uint32_t> cpus2 = s2.getCPUs();
+
+            s1.stop();
+            s2.stop();
+
+            TS_ASSERT(cpus1.size() == 1);
+            TS_ASSERT(!cpus1.empty() && (cpus1[0] == lastCPU));
+            TS_ASSERT(cpus2.size() == 1);
+            TS_ASSERT(!cpus2.empty() && (cpus2[0] == lastCPU));
+
+            // Reset for other tests.
+            ConcurrencyFactory::setThreadConfiguration("threadConfigurationTestA", ThreadConfiguration());
+            ConcurrencyFactory::setThreadConfiguration("threadConfigurationTestB", ThreadConfiguration());
+#endif
+        }
+};
+
+#endif /*CORE_THREADCONFIGURATIONTESTSUITE_H_*/
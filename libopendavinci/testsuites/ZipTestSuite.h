@@ -21,6 +21,7 @@
 #define CORE_ZIPTESTSUITE_H_
 
 #include <fstream>                      // for stringstream, operator<<, etc
+#include <iterator>                     // for istreambuf_iterator
 #include <memory>
 #include <string>                       // for string, operator==, etc
 #include <vector>                       // for vector
@@ -96,6 +97,88 @@ class ZipTest : public CxxTest::TestSuite {
             UNLINK("ZipTest.zip");
         }
 
+        void testDecompressionFromFileWithStoredAndDeflatedEntries() {
+            // Create zip file with one stored and one deflated entry.
+            stringstream archiveData;
+            archiveData.str("80 75 3 4 20 0 0 0 0 0 0 0 33 0 -113 116 -59 85 14 0 0 0 14 0 0 0 10 0 0 0 83 116 111 114 101 100 46 116 120 116 83 116 111 114 101 100 32 101 110 116 114 121 46 10 80 75 3 4 20 0 0 0 8 0 0 0 33 0 -40 -49 38 101 22 0 0 0 48 0 0 0 14 0 0 0 46 47 100 101 102 108 97 116 101 100 46 116 120 116 115 73 77 -53 73 44 73 77 81 72 -51 43 41 -86 -44 83 112 -63 -49 -25 2 0 80 75 1 2 20 3 20 0 0 0 0 0 0 0 33 0 -113 116 -59 85 14 0 0 0 14 0 0 0 10 0 0 0 0 0 0 0 0 0 0 0 -128 1 0 0 0 0 83 116 111 114 101 100 46 116 120 116 80 75 1 2 20 3 20 0 0 0 8 0 0 0 33 0 -40 -49 38 101 22 0 0 0 48 0 0 0 14 0 0 0 0 0 0 0 0 0 0 0 -128 1 54 0 0 0 46 47 100 101 102 108 97 116 101 100 46 116 120 116 80 75 5 6 0 0 0 0 2 0 2 0 116 0 0 0 120 0 0 0 0 0");
+            int32_t data = 0;
+            fstream fout("ZipTest2.zip", ios::binary | ios::out);
+            while (archiveData >> data) {
+                fout << (char)data;
+            }
+            fout.close();
+
+            std::shared_ptr<odcore::wrapper::DecompressedData> dd = odcore::wrapper::CompressionFactory::getContents(string("ZipTest2.zip"));
+            TS_ASSERT(dd.get());
+
+            vector<string> entries = dd->getListOfEntries();
+            TS_ASSERT(entries.size() == 2);
+            TS_ASSERT(entries.at(0) == "deflated.txt");
+            TS_ASSERT(entries.at(1) == "stored.txt");
+
+            // Each request returns an independent stream.
+            for (uint32_t i = 0; i < 2; i++) {
+                std::shared_ptr<istream> stream = dd->getInputStreamFor("Deflated.txt");
+                TS_ASSERT(stream.get());
+                if (stream.get()) {
+                    string s((istreambuf_iterator<char>(*stream)), istreambuf_iterator<char>());
+                    TS_ASSERT(s == "Deflated entry. Deflated entry. Deflated entry.\n");
+                }
+            }
+
+            std::shared_ptr<istream> stream = dd->getInputStreamFor("stored.txt");
+            TS_ASSERT(stream.get());
+            if (stream.get()) {
+                string s;
+                getline(*stream, s);
+                TS_ASSERT(s == "Stored entry.");
+
+                // Rewind.
+                stream->clear();
+                stream->seekg(7, ios::beg);
+                getline(*stream, s);
+                TS_ASSERT(s == "entry.");
+            }
+
+            // Streams remain valid after releasing the archive.
+            dd.reset();
+            if (stream.get()) {
+                stream->clear();
+                stream->seekg(0, ios::beg);
+                string s;
+                getline(*stream, s);
+                TS_ASSERT(s == "Stored entry.");
+            }
+
+            UNLINK("ZipTest2.zip");
+        }
+
+        void testZip64ArchiveIsRejected() {
+            // Same archive as above with a Zip64 end of central directory locator.
+            stringstream archiveData;
+            archiveData.str("80 75 3 4 20 0 0 0 0 0 0 0 33 0 -113 116 -59 85 14 0 0 0 14 0 0 0 10 0 0 0 83 116 111 114 101 100 46 116 120 116 83 116 111 114 101 100 32 101 110 116 114 121 46 10 80 75 3 4 20 0 0 0 8 0 0 0 33 0 -40 -49 38 101 22 0 0 0 48 0 0 0 14 0 0 0 46 47 100 101 102 108 97 116 101 100 46 116 120 116 115 73 77 -53 73 44 73 77 81 72 -51 43 41 -86 -44 83 112 -63 -49 -25 2 0 80 75 1 2 20 3 20 0 0 0 0 0 0 0 33 0 -113 116 -59 85 14 0 0 0 14 0 0 0 10 0 0 0 0 0 0 0 0 0 0 0 -128 1 0 0 0 0 83 116 111 114 101 100 46 116 120 116 80 75 1 2 20 3 20 0 0 0 8 0 0 0 33 0 -40 -49 38 101 22 0 0 0 48 0 0 0 14 0 0 0 0 0 0 0 0 0 0 0 -128 1 54 0 0 0 46 47 100 101 102 108 97 116 101 100 46 116 120 116 80 75 6 7 0 0 0 0 0 0 0 0 0 0 0 0 1 0 0 0 80 75 5 6 0 0 0 0 2 0 2 0 116 0 0 0 120 0 0 0 0 0");
+            int32_t data = 0;
+            fstream fout("ZipTest3.zip", ios::binary | ios::out);
+            while (archiveData >> data) {
+                fout << (char)data;
+            }
+            fout.close();
+
+            std::shared_ptr<odcore::wrapper::DecompressedData> dd = odcore::wrapper::CompressionFactory::getContents(string("ZipTest3.zip"));
+            TS_ASSERT(dd.get());
+            TS_ASSERT(dd->getListOfEntries().size() == 0);
+            TS_ASSERT(!dd->getInputStreamFor("stored.txt").get());
+
+            UNLINK("ZipTest3.zip");
+        }
+
+        void testDecompressionOfMissingFile() {
+            std::shared_ptr<odcore::wrapper::DecompressedData> dd = odcore::wrapper::CompressionFactory::getContents(string("ZipTestMissing.zip"));
+            TS_ASSERT(dd.get());
+            TS_ASSERT(dd->getListOfEntries().size() == 0);
+            TS_ASSERT(!dd->getInputStreamFor("file1").get());
+        }
+
 };
 
 #endif /*CORE_ZIPTESTSUITE_H_*/
@@ -0,0 +1,200 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#ifndef HESPERIA_WRAPPER_GRAPH_COMPACTGRAPH_H_
+#define HESPERIA_WRAPPER_GRAPH_COMPACTGRAPH_H_
+
+#include <utility>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+namespace core {
+    namespace wrapper {
+        namespace graph {
+
+class DirectedGraph;
+class Vertex;
+
+            using namespace std;
+
+            /**
+             * This class is a read-only copy of a DirectedGraph in compressed
+             * sparse row format: The outgoing edges of all vertices are stored
+             * consecutively in one array and vertices are addressed by their
+             * index. As the graph is never modified after construction, it
+             * can be queried from several threads concurrently without locks
+             * as long as every thread uses its own Workspace.
+             *
+             * The vertices are not copied; thus, the DirectedGraph must not
+             * be destroyed before this graph.
+             */
+            class OPENDAVINCI_API CompactGraph {
+                public:
+                    /**
+                     * This class contains all memory needed for computing
+                     * a shortest path. It is created once per thread and
+                     * reused for all queries; thus, queries do not allocate
+                     * memory.
+                     */
+                    class OPENDAVINCI_API Workspace {
+                        private:
+                            friend class CompactGraph;
+
+                            /**
+                             * "Forbidden" copy constructor. Goal: The compiler should warn
+                             * already at compile time for unwanted bugs caused by any misuse
+                             * of the copy constructor.
+                             */
+                            Workspace(const Workspace &);
+
+                            /**
+                             * "Forbidden" assignment operator. Goal: The compiler should warn
+                             * already at compile time for unwanted bugs caused by any misuse
+                             * of the assignment operator.
+                             */
+                            Workspace& operator=(const Workspace &);
+
+                        public:
+                            /**
+                             * Constructor.
+                             *
+                             * @param g Graph to be queried with this workspace.
+                             */
+                            Workspace(const CompactGraph &g);
+
+                        private:
+                            // Vertices were reached (or finished) in the current query iff their entry equals m_generation.
+                            uint32_t m_generation;
+                            vector<uint32_t> m_reached;
+                            vector<uint32_t> m_finished;
+                            vector<double> m_distances;
+                            vector<uint32_t> m_predecessors;
+
+                            // Priority queue of (estimated costs, vertex).
+                            vector<pair<double, uint32_t> > m_queue;
+                    };
+
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     */
+                    CompactGraph(const CompactGraph &);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     */
+                    CompactGraph& operator=(const CompactGraph &);
+
+                public:
+                    /**
+                     * Constructor.
+                     *
+                     * @param g Graph to copy.
+                     */
+                    CompactGraph(const DirectedGraph &g);
+
+                    virtual ~CompactGraph();
+
+                    /**
+                     * @return Number of vertices.
+                     */
+                    uint32_t getNumberOfVertices() const;
+
+                    /**
+                     * @return Number of edges.
+                     */
+                    uint32_t getNumberOfEdges() const;
+
+                    /**
+                     * This method returns the index of the vertex having the
+                     * same identifier as v.
+                     *
+                     * @param v Vertex to search for.
+                     * @return Index or -1 if the graph does not contain v.
+                     */
+                    int32_t getIndex(const Vertex &v) const;
+
+                    /**
+                     * @param index Index of a vertex.
+                     * @return Vertex or NULL if the index is invalid.
+                     */
+                    const Vertex* getVertex(const uint32_t &index) const;
+
+                    /**
+                     * This method computes the shortest path between two given
+                     * vertices using A* where the distance between vertices
+                     * serves as heuristic.
+                     *
+                     * @param v1 Start vertex.
+                     * @param v2 End vertex.
+                     * @param ws Workspace of the calling thread.
+                     * @param route List of vertices to choose to reach v2 from v1; empty if there is no path.
+                     * @return true if a path was found.
+                     */
+                    bool getShortestPath(const Vertex &v1, const Vertex &v2, Workspace &ws, vector<const Vertex*> &route) const;
+
+                    /**
+                     * This method computes the shortest path between two given
+                     * vertices using A* where the distance between vertices
+                     * serves as heuristic.
+                     *
+                     * @param from Index of the start vertex.
+                     * @param to Index of the end vertex.
+                     * @param ws Workspace of the calling thread.
+                     * @param route Indices of the vertices to choose to reach to from from; empty if there is no path.
+                     * @return true if a path was found.
+                     */
+                    bool getShortestPath(const uint32_t &from, const uint32_t &to, Workspace &ws, vector<uint32_t> &route) const;
+
+                private:
+                    /**
+                     * This method runs A* from vertex from until vertex to
+                     * is reached; the path is stored as predecessors in ws.
+                     *
+                     * @param from Index of the start vertex.
+                     * @param to Index of the end vertex.
+                     * @param ws Workspace of the calling thread.
+                     * @return true if to was reached.
+                     */
+                    bool search(const uint32_t &from, const uint32_t &to, Workspace &ws) const;
+
+                    /**
+                     * @return Heuristic for the remaining costs from vertex u to vertex goal.
+                     */
+                    double getEstimatedCosts(const uint32_t &u, const uint32_t &goal) const;
+
+                private:
+                    vector<const Vertex*> m_vertices;
+                    vector<pair<int32_t, uint32_t> > m_identifiers; // Pairs of (identifier, index) sorted by identifier.
+                    vector<uint32_t> m_offsets; // Outgoing edges of vertex i are [m_offsets[i], m_offsets[i+1]).
+                    vector<uint32_t> m_targets;
+                    vector<double> m_costs;
+            };
+
+        }
+    }
+} // core::wrapper::graph
+
+#endif /*HESPERIA_WRAPPER_GRAPH_COMPACTGRAPH_H_*/
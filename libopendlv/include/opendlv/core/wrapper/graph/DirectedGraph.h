@@ -33,6 +33,7 @@ namespace core {
     namespace wrapper {
         namespace graph {
 
+class CompactGraph;
 class Edge;
 class Vertex;
 
@@ -43,6 +44,8 @@ class Vertex;
              */
             class OPENDAVINCI_API DirectedGraph {
                 private:
+                    friend class CompactGraph;
+
                     /**
                      * "Forbidden" copy constructor. Goal: The compiler should warn
                      * already at compile time for unwanted bugs caused by any misuse
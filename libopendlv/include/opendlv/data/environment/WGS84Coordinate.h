@@ -21,6 +21,7 @@
 #define HESPERIA_DATA_ENVIRONMENT_WGS84COORDINATE_H_
 
 #include <map>
+#include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
 
@@ -187,6 +188,52 @@ namespace opendlv {
                      */
                     const WGS84Coordinate transform(const Point3 &coordinate, const double &accuracy) const;
 
+                    /**
+                     * This method transforms the given WGS84 coordinates
+                     * using this as reference coordinate. It computes the
+                     * same projection as transform(const WGS84Coordinate&)
+                     * but processes all coordinates in one pass.
+                     * @param coordinates WGS84 coordinates to transform.
+                     * @param result Cartesian coordinates.
+                     */
+                    void transform(const vector<WGS84Coordinate> &coordinates, vector<Point3> &result) const;
+
+                    /**
+                     * This method transforms the given Point3 coordinates
+                     * using this as reference coordinate.
+                     * @param coordinates Point3 coordinates to transform.
+                     * @param result WGS84 coordinates.
+                     * @param accuracy Required accuracy in meters.
+                     */
+                    void transform(const vector<Point3> &coordinates, vector<WGS84Coordinate> &result, const double &accuracy) const;
+
+                    /**
+                     * This method transforms arrays of latitudes and
+                     * longitudes in degrees to Cartesian coordinates using
+                     * this as reference coordinate.
+                     * @param latitudes Latitudes.
+                     * @param longitudes Longitudes.
+                     * @param x Resulting x coordinates.
+                     * @param y Resulting y coordinates.
+                     * @param size Number of coordinates.
+                     */
+                    void transformToCartesian(const double *latitudes, const double *longitudes, double *x, double *y, const uint32_t &size) const;
+
+                    /**
+                     * This method transforms arrays of Cartesian coordinates
+                     * to latitudes and longitudes in degrees using this as
+                     * reference coordinate by iteratively refining the
+                     * position until the projected position deviates less
+                     * than accuracy.
+                     * @param x x coordinates.
+                     * @param y y coordinates.
+                     * @param latitudes Resulting latitudes.
+                     * @param longitudes Resulting longitudes.
+                     * @param size Number of coordinates.
+                     * @param accuracy Required accuracy in meters.
+                     */
+                    void transformToWGS84(const double *x, const double *y, double *latitudes, double *longitudes, const uint32_t &size, const double &accuracy) const;
+
                     virtual ostream& operator<<(ostream &out) const;
                     virtual istream& operator>>(istream &in);
 
@@ -243,6 +290,18 @@ namespace opendlv {
                      * @return fwd
                      */
                     pair<double, double> project(double lat, double lon) const;
+
+                    /**
+                     * This method projects arrays of latitudes and
+                     * longitudes in radians; it computes the same as
+                     * fwd() but without branches to allow vectorization.
+                     * @param latitudes Latitudes.
+                     * @param longitudes Longitudes.
+                     * @param x Resulting x coordinates.
+                     * @param y Resulting y coordinates.
+                     * @param size Number of coordinates.
+                     */
+                    void fwd(const double *latitudes, const double *longitudes, double *x, double *y, const uint32_t &size) const;
             };
 
         }
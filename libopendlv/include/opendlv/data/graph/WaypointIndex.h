@@ -0,0 +1,122 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#ifndef HESPERIA_DATA_GRAPH_WAYPOINTINDEX_H_
+#define HESPERIA_DATA_GRAPH_WAYPOINTINDEX_H_
+
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+namespace core { namespace wrapper { namespace graph { class CompactGraph; } } }
+
+namespace opendlv {
+    namespace data {
+        namespace environment { class Point3; }
+
+        namespace graph {
+
+            using namespace std;
+
+            /**
+             * This class is a spatial index for finding the waypoint nearest
+             * to a given position, e.g. to snap a vehicle's position to the
+             * route network. The WaypointVertices of a CompactGraph are sorted
+             * once into a uniform grid in the XY plane; the grid is not
+             * modified afterwards and can be queried concurrently.
+             */
+            class OPENDAVINCI_API WaypointIndex {
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     *
+                     * @param obj Reference to an object of this class.
+                     */
+                    WaypointIndex(const WaypointIndex &/*obj*/);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     *
+                     * @param obj Reference to an object of this class.
+                     * @return Reference to this instance.
+                     */
+                    WaypointIndex& operator=(const WaypointIndex &/*obj*/);
+
+                public:
+                    /**
+                     * Constructor.
+                     *
+                     * @param g Graph containing WaypointVertices.
+                     * @param cellSize Edge length of the grid cells in meters.
+                     */
+                    WaypointIndex(const core::wrapper::graph::CompactGraph &g, const double &cellSize);
+
+                    virtual ~WaypointIndex();
+
+                    /**
+                     * @return Number of indexed waypoints.
+                     */
+                    uint32_t getSize() const;
+
+                    /**
+                     * This method returns the waypoint nearest to the given
+                     * position in the XY plane.
+                     *
+                     * @param position Position.
+                     * @return Index of the nearest waypoint in the graph or -1 if there is none.
+                     */
+                    int32_t findNearest(const opendlv::data::environment::Point3 &position) const;
+
+                private:
+                    /**
+                     * This method updates nearest and minimumDistance with
+                     * the waypoints in the given cell.
+                     *
+                     * @param cell Cell.
+                     * @param x X coordinate of the position.
+                     * @param y Y coordinate of the position.
+                     * @param nearest Nearest waypoint found so far.
+                     * @param minimumDistance Squared distance to the nearest waypoint.
+                     */
+                    void scanCell(const uint32_t &cell, const double &x, const double &y, int32_t &nearest, double &minimumDistance) const;
+
+                private:
+                    double m_cellSize;
+                    double m_minimumX;
+                    double m_minimumY;
+                    uint32_t m_columns;
+                    uint32_t m_rows;
+
+                    // Waypoints in cell i are [m_cellOffsets[i], m_cellOffsets[i+1]) in the following arrays.
+                    vector<uint32_t> m_cellOffsets;
+                    vector<uint32_t> m_vertices;
+                    vector<double> m_x;
+                    vector<double> m_y;
+            };
+
+        }
+    }
+} // opendlv::data::graph
+
+#endif /*HESPERIA_DATA_GRAPH_WAYPOINTINDEX_H_*/
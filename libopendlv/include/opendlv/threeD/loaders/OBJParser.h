@@ -0,0 +1,90 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_CORE_THREED_LOADERS_OBJPARSER_H_
+#define HESPERIA_CORE_THREED_LOADERS_OBJPARSER_H_
+
+#include <map>
+#include <string>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/strings/StringComparator.h"
+
+#include "opendlv/threeD/Material.h"
+#include "opendlv/threeD/models/TriangleMesh.h"
+
+namespace opendlv {
+    namespace threeD {
+        namespace loaders {
+
+            using namespace std;
+
+            /**
+             * This class parses Wavefront OBJ and MTL files in a single
+             * pass directly from memory without creating temporary strings
+             * or streams per token. It does not depend on OpenGL.
+             */
+            class OPENDAVINCI_API OBJParser {
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     */
+                    OBJParser(const OBJParser &);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     */
+                    OBJParser& operator=(const OBJParser &);
+
+                private:
+                    OBJParser();
+
+                public:
+                    /**
+                     * This method parses the given OBJ file into the given mesh.
+                     * Faces with more than three vertices are triangulated,
+                     * vertices are shared between faces using the same
+                     * position, texture coordinate, and normal, and a new
+                     * group is started for every "g" and "usemtl" statement.
+                     *
+                     * @param data Contents of the OBJ file.
+                     * @param length Length of the contents.
+                     * @param mesh Mesh to be filled.
+                     */
+                    static void parseOBJ(const char *data, const uint32_t &length, models::TriangleMesh &mesh);
+
+                    /**
+                     * This method parses the given MTL file.
+                     *
+                     * @param data Contents of the MTL file.
+                     * @param length Length of the contents.
+                     * @param mapOfMaterials Map to which the materials are added.
+                     */
+                    static void parseMTL(const char *data, const uint32_t &length, map<string, Material, odcore::strings::StringComparator> &mapOfMaterials);
+            };
+
+        }
+    }
+} // opendlv::threeD::loaders
+
+#endif /*HESPERIA_CORE_THREED_LOADERS_OBJPARSER_H_*/
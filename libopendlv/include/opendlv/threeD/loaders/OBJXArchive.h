@@ -117,6 +117,15 @@ namespace opendlv {
                      */
                     const stringstream& getContentsOfMtlFile() const;
 
+                    /**
+                     * This method sets the name of the binary mesh cache file
+                     * that is used by createTransformGroup to skip parsing
+                     * the obj-file if the cache is up to date.
+                     *
+                     * @param meshCacheFileName Name of the cache file or "" to disable caching.
+                     */
+                    void setMeshCacheFileName(const string &meshCacheFileName);
+
                     /**
                      * This method creates a displayable node for the scene graph
                      * based on the data of an instance of this class.
@@ -130,6 +139,7 @@ namespace opendlv {
                     map<string, Material, odcore::strings::StringComparator> m_mapOfMaterials;
                     stringstream m_objFile;
                     stringstream m_mtlFile;
+                    string m_meshCacheFileName;
 
                     /**
                      * This method creates the material's map.
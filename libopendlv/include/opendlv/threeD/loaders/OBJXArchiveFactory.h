@@ -21,10 +21,13 @@
 #define HESPERIA_CORE_THREED_LOADERS_OBJXARCHIVEFACTORY_H_
 
 #include <iostream>
+#include <memory>
+#include <string>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/base/Mutex.h"
 #include "opendavinci/odcore/exceptions/Exceptions.h"
+#include "opendavinci/odcore/wrapper/DecompressedData.h"
 
 #include "opendlv/threeD/loaders/OBJXArchive.h"
 
@@ -85,6 +88,27 @@ namespace opendlv {
                      */
                     OBJXArchive* getOBJXArchive(istream &in) throw (odcore::exceptions::InvalidArgumentException);
 
+                    /**
+                     * This method returns the OBJXArchive data structure for
+                     * the given file, which is memory-mapped for reading. The
+                     * parsed mesh is cached in a file next to the given one.
+                     *
+                     * @param fileName OBJX archive file.
+                     * @return OBJXArchive.
+                     * @throws InvalidArgumentException if the file could not be used to create the data structure.
+                     */
+                    OBJXArchive* getOBJXArchive(const string &fileName) throw (odcore::exceptions::InvalidArgumentException);
+
+                private:
+                    /**
+                     * This method creates the OBJXArchive data structure from
+                     * the decompressed archive.
+                     *
+                     * @param data Decompressed archive.
+                     * @return OBJXArchive.
+                     */
+                    OBJXArchive* getOBJXArchive(std::shared_ptr<odcore::wrapper::DecompressedData> data);
+
                 private:
                     static odcore::base::Mutex m_singletonMutex;
                     static OBJXArchiveFactory* m_singleton;
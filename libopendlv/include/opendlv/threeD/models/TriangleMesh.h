@@ -0,0 +1,190 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_CORE_THREED_MODELS_TRIANGLEMESH_H_
+#define HESPERIA_CORE_THREED_MODELS_TRIANGLEMESH_H_
+
+#include <string>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+namespace opendlv {
+    namespace threeD {
+        namespace models {
+
+            using namespace std;
+
+            /**
+             * This class represents an indexed triangle mesh with packed
+             * arrays for positions, normals, and texture coordinates. The
+             * indices are organized in groups sharing the same material.
+             * A mesh can be stored to and loaded from a binary cache file.
+             */
+            class OPENDAVINCI_API TriangleMesh {
+                public:
+                    enum {
+                        CACHE_VERSION = 1
+                    };
+
+                    /**
+                     * This class describes a range of indices sharing the same material.
+                     */
+                    class OPENDAVINCI_API Group {
+                        public:
+                            Group();
+
+                            Group(const string &materialName, const uint32_t &firstIndex);
+
+                        public:
+                            string m_materialName;
+                            uint32_t m_firstIndex;
+                            uint32_t m_numberOfIndices;
+                    };
+
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     */
+                    TriangleMesh(const TriangleMesh &);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     */
+                    TriangleMesh& operator=(const TriangleMesh &);
+
+                public:
+                    TriangleMesh();
+
+                    virtual ~TriangleMesh();
+
+                    /**
+                     * This method removes all vertices, indices, and groups.
+                     */
+                    void clear();
+
+                    /**
+                     * This method adds a vertex.
+                     *
+                     * @param position Three coordinates.
+                     * @param normal Three coordinates or NULL.
+                     * @param textureCoordinate Two coordinates or NULL.
+                     * @return Index of the vertex.
+                     */
+                    uint32_t addVertex(const float *position, const float *normal, const float *textureCoordinate);
+
+                    /**
+                     * This method starts a new group that is using the given
+                     * material. If the current group is empty, it is reused.
+                     *
+                     * @param materialName Name of the material.
+                     */
+                    void addGroup(const string &materialName);
+
+                    /**
+                     * This method adds a triangle to the current group.
+                     *
+                     * @param a Index of the first vertex.
+                     * @param b Index of the second vertex.
+                     * @param c Index of the third vertex.
+                     */
+                    void addTriangle(const uint32_t &a, const uint32_t &b, const uint32_t &c);
+
+                    uint32_t getNumberOfVertices() const;
+
+                    uint32_t getNumberOfTriangles() const;
+
+                    const vector<float>& getPositions() const;
+
+                    const vector<float>& getNormals() const;
+
+                    const vector<float>& getTextureCoordinates() const;
+
+                    const vector<uint32_t>& getIndices() const;
+
+                    /**
+                     * @return List of non-empty groups.
+                     */
+                    vector<Group> getGroups() const;
+
+                    bool hasNormals() const;
+
+                    bool hasTextureCoordinates() const;
+
+                    /**
+                     * This method writes this mesh to a binary cache file.
+                     *
+                     * @param fileName Name of the cache file.
+                     * @param key Key identifying the source data (cf. getKey).
+                     * @return true if the cache file was written.
+                     */
+                    bool writeCache(const string &fileName, const uint64_t &key) const;
+
+                    /**
+                     * This method replaces this mesh by the contents of the
+                     * given binary cache file, which is memory-mapped if
+                     * supported by the platform.
+                     *
+                     * @param fileName Name of the cache file.
+                     * @param key Key identifying the source data (cf. getKey).
+                     * @return true if the cache file exists, matches the key and
+                     *         the current cache version, and was read completely.
+                     */
+                    bool readCache(const string &fileName, const uint64_t &key);
+
+                    /**
+                     * This method computes a key for the source data of a mesh
+                     * to detect outdated cache files.
+                     *
+                     * @param data Source data.
+                     * @param length Length of the source data.
+                     * @return Key.
+                     */
+                    static uint64_t getKey(const char *data, const uint32_t &length);
+
+                private:
+                    /**
+                     * This method reads a mesh from the given memory.
+                     *
+                     * @param data Contents of a cache file.
+                     * @param length Length of the contents.
+                     * @param key Expected key.
+                     * @return true if the contents were valid.
+                     */
+                    bool readCache(const char *data, const uint32_t &length, const uint64_t &key);
+
+                private:
+                    vector<float> m_positions;
+                    vector<float> m_normals;
+                    vector<float> m_textureCoordinates;
+                    vector<uint32_t> m_indices;
+                    vector<Group> m_groups;
+                    bool m_hasNormals;
+                    bool m_hasTextureCoordinates;
+            };
+
+        }
+    }
+} // opendlv::threeD::models
+
+#endif /*HESPERIA_CORE_THREED_MODELS_TRIANGLEMESH_H_*/
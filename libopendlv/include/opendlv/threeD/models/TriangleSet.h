@@ -20,6 +20,7 @@
 #ifndef HESPERIA_CORE_THREED_MODELS_TRIANGLESET_H_
 #define HESPERIA_CORE_THREED_MODELS_TRIANGLESET_H_
 
+#include <memory>
 #include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
@@ -29,6 +30,7 @@
 #include "opendlv/threeD/Node.h"
 #include "opendlv/threeD/NodeDescriptor.h"
 #include "opendlv/threeD/models/Triangle.h"
+#include "opendlv/threeD/models/TriangleMesh.h"
 
 namespace opendlv {
     namespace threeD {
@@ -50,6 +52,16 @@ namespace opendlv {
                      */
                     TriangleSet(const NodeDescriptor &nodeDescriptor);
 
+                    /**
+                     * Constructor for rendering one group of an indexed
+                     * triangle mesh using vertex arrays.
+                     *
+                     * @param nodeDesciptor Description for this node.
+                     * @param mesh Mesh that might be shared with other triangle sets.
+                     * @param group Group of the mesh to be rendered.
+                     */
+                    TriangleSet(const NodeDescriptor &nodeDescriptor, std::shared_ptr<TriangleMesh> mesh, const TriangleMesh::Group &group);
+
                     /**
                      * Copy constructor.
                      *
@@ -90,6 +102,8 @@ namespace opendlv {
                     vector<opendlv::data::environment::Point3> m_vertices;
                     vector<opendlv::data::environment::Point3> m_normals;
                     vector<opendlv::data::environment::Point3> m_textureCoordinates;
+                    std::shared_ptr<TriangleMesh> m_mesh;
+                    TriangleMesh::Group m_group;
 
                     /**
                      * This method compiles this triangle set using OpenGL
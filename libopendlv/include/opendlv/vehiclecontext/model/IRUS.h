@@ -20,6 +20,7 @@
 #ifndef VEHICLECONTEXT_MODEL_IRUS_H_
 #define VEHICLECONTEXT_MODEL_IRUS_H_
 
+#include <memory>
 #include <string>
 
 #include "opendavinci/odcore/base/KeyValueConfiguration.h"
@@ -32,6 +33,7 @@
 #include "opendlv/data/environment/Polygon.h"
 
 #include "opendlv/vehiclecontext/model/PointSensor.h"
+#include "opendlv/vehiclecontext/model/PolygonIndex.h"
 
 namespace opendlv { namespace vehiclecontext {
     namespace model {
@@ -100,6 +102,7 @@ namespace opendlv { namespace vehiclecontext {
 
                 uint32_t m_numberOfPolygons;
                 map<uint32_t, opendlv::data::environment::Polygon> m_mapOfPolygons;
+                unique_ptr<PolygonIndex> m_polygonIndex;
                 vector<uint32_t> m_listOfPolygonsInsideFOV;
                 map<string, PointSensor*> m_mapOfPointSensors;
                 map<string, double> m_distances;
@@ -22,6 +22,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 #include "opendlv/data/environment/Point3.h"
 #include "opendlv/data/environment/Polygon.h"
@@ -31,6 +32,8 @@ namespace opendlv { namespace vehiclecontext {
 
         using namespace std;
 
+        class PolygonIndex;
+
         /**
          * This class encapsulates a point providing sensor using polygon data from an SCNX file.
          */
@@ -90,6 +93,20 @@ namespace opendlv { namespace vehiclecontext {
                  */
                 double getDistance(map<uint32_t, opendlv::data::environment::Polygon> &mapOfPolygons);
 
+                /**
+                 * This methods calculates the distance using only the polygons
+                 * from the index that overlap with the current FOV.
+                 *
+                 * @param polygonIndex Spatial index of polygons to query.
+                 * @return distance to the closest line or -1.
+                 */
+                double getDistance(const PolygonIndex &polygonIndex);
+
+                /**
+                 * @return Range of the FOV.
+                 */
+                double getDistanceFOV() const;
+
                 bool hasShowFOV() const;
 
                 const string getName() const;
@@ -117,6 +134,12 @@ namespace opendlv { namespace vehiclecontext {
                 opendlv::data::environment::Point3 m_sensorPosition;
 
                 bool isInFOV(const opendlv::data::environment::Point3 &pt) const;
+
+                void updateDistance(const opendlv::data::environment::Polygon &p, double &distanceToSensor) const;
+
+                double applyFaultModel(double distanceToSensor);
+
+                vector<const opendlv::data::environment::Polygon*> m_listOfCandidates;
         };
 
     }
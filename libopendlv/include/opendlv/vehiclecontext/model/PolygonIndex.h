@@ -0,0 +1,136 @@
+/**
+ * libvehiclecontext - Models for simulating automotive systems.
+ * Copyright (C) 2012 - 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef VEHICLECONTEXT_MODEL_POLYGONINDEX_H_
+#define VEHICLECONTEXT_MODEL_POLYGONINDEX_H_
+
+#include <stdint.h>
+
+#include <map>
+#include <vector>
+
+#include "opendlv/data/environment/Polygon.h"
+
+namespace opendlv { namespace vehiclecontext {
+    namespace model {
+
+        using namespace std;
+
+        /**
+         * This class is a uniform grid over static polygons in the XY-plane
+         * to query the polygons whose bounding boxes overlap with a given
+         * area (e.g. the FOV of a sensor) without iterating all polygons.
+         */
+        class PolygonIndex {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                PolygonIndex(const PolygonIndex &/*obj*/);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                PolygonIndex& operator=(const PolygonIndex &/*obj*/);
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param cellSize Edge length of a grid cell in m.
+                 */
+                PolygonIndex(const double &cellSize);
+
+                virtual ~PolygonIndex();
+
+                /**
+                 * This method adds a polygon to the index.
+                 *
+                 * @param polygon Polygon to be added.
+                 */
+                void add(const opendlv::data::environment::Polygon &polygon);
+
+                /**
+                 * This method removes all polygons.
+                 */
+                void clear();
+
+                /**
+                 * @return Number of indexed polygons.
+                 */
+                uint32_t getSize() const;
+
+                /**
+                 * This method returns all polygons whose bounding boxes overlap
+                 * with the bounding box of the given area. Every polygon is
+                 * returned at most once.
+                 *
+                 * @param area Area to query for.
+                 * @param candidates List to be filled with pointers to the candidates;
+                 *                   the pointers are valid until the index is modified.
+                 */
+                void getCandidates(const opendlv::data::environment::Polygon &area, vector<const opendlv::data::environment::Polygon*> &candidates) const;
+
+            private:
+                /**
+                 * Axis-aligned bounding box in the XY-plane.
+                 */
+                class BoundingBox {
+                    public:
+                        BoundingBox();
+                        BoundingBox(const opendlv::data::environment::Polygon &polygon);
+
+                        bool overlaps(const BoundingBox &other) const;
+
+                    public:
+                        double m_minX;
+                        double m_minY;
+                        double m_maxX;
+                        double m_maxY;
+                };
+
+                int32_t getCell(const double &v) const;
+
+                void addCandidates(const vector<uint32_t> &cell, const BoundingBox &bb, vector<const opendlv::data::environment::Polygon*> &candidates) const;
+
+                static int64_t getKey(const int32_t &x, const int32_t &y);
+
+            private:
+                double m_cellSize;
+                vector<opendlv::data::environment::Polygon> m_listOfPolygons;
+                vector<BoundingBox> m_listOfBoundingBoxes;
+                map<int64_t, vector<uint32_t> > m_cells;
+                vector<uint32_t> m_listOfLargePolygons;
+                mutable vector<uint32_t> m_visited;
+                mutable uint32_t m_query;
+        };
+
+    }
+} } // opendlv::vehiclecontext::model
+
+#endif /*VEHICLECONTEXT_MODEL_POLYGONINDEX_H_*/
@@ -0,0 +1,212 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <algorithm>
+#include <functional>
+
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/adjacency_list.hpp>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendlv/core/wrapper/graph/CompactGraph.h"
+#include "opendlv/core/wrapper/graph/DirectedGraph.h"
+#include "opendlv/core/wrapper/graph/Vertex.h"
+
+namespace core {
+    namespace wrapper {
+        namespace graph {
+
+            using namespace std;
+
+            CompactGraph::Workspace::Workspace(const CompactGraph &g) :
+                m_generation(0),
+                m_reached(g.getNumberOfVertices(), 0),
+                m_finished(g.getNumberOfVertices(), 0),
+                m_distances(g.getNumberOfVertices(), 0),
+                m_predecessors(g.getNumberOfVertices(), 0),
+                m_queue() {
+                // Every edge is relaxed at most once per query.
+                m_queue.reserve(g.getNumberOfEdges() + 1);
+            }
+
+            ////////////////////////////////////////////////////////////////////
+
+            CompactGraph::CompactGraph(const DirectedGraph &g) :
+                m_vertices(),
+                m_identifiers(),
+                m_offsets(),
+                m_targets(),
+                m_costs() {
+                const uint32_t NUMBER_OF_VERTICES = boost::num_vertices(g.m_graph);
+                const uint32_t NUMBER_OF_EDGES = boost::num_edges(g.m_graph);
+
+                m_vertices.reserve(NUMBER_OF_VERTICES);
+                m_identifiers.reserve(NUMBER_OF_VERTICES);
+                m_offsets.reserve(NUMBER_OF_VERTICES + 1);
+                m_targets.reserve(NUMBER_OF_EDGES);
+                m_costs.reserve(NUMBER_OF_EDGES);
+
+                for (uint32_t u = 0; u < NUMBER_OF_VERTICES; u++) {
+                    const Vertex *v = g.m_graph[u];
+                    m_vertices.push_back(v);
+                    if (v != NULL) {
+                        m_identifiers.push_back(make_pair(v->getIdentifier(), u));
+                    }
+
+                    m_offsets.push_back(m_targets.size());
+                    DirectedGraph::GraphDefinition::out_edge_iterator ei, ei_end;
+                    for (boost::tie(ei, ei_end) = boost::out_edges(u, g.m_graph); ei != ei_end; ei++) {
+                        m_targets.push_back(boost::target(*ei, g.m_graph));
+                        m_costs.push_back(g.m_weightMap[*ei]);
+                    }
+                }
+                m_offsets.push_back(m_targets.size());
+
+                sort(m_identifiers.begin(), m_identifiers.end());
+            }
+
+            CompactGraph::~CompactGraph() {}
+
+            uint32_t CompactGraph::getNumberOfVertices() const {
+                return m_vertices.size();
+            }
+
+            uint32_t CompactGraph::getNumberOfEdges() const {
+                return m_targets.size();
+            }
+
+            int32_t CompactGraph::getIndex(const Vertex &v) const {
+                const pair<int32_t, uint32_t> key(v.getIdentifier(), 0);
+                vector<pair<int32_t, uint32_t> >::const_iterator it = lower_bound(m_identifiers.begin(), m_identifiers.end(), key);
+                if ( (it != m_identifiers.end()) && (it->first == key.first) ) {
+                    return static_cast<int32_t>(it->second);
+                }
+                return -1;
+            }
+
+            const Vertex* CompactGraph::getVertex(const uint32_t &index) const {
+                return (index < m_vertices.size()) ? m_vertices[index] : NULL;
+            }
+
+            double CompactGraph::getEstimatedCosts(const uint32_t &u, const uint32_t &goal) const {
+                double value = 0;
+                if ( (m_vertices[u] != NULL) && (m_vertices[goal] != NULL) ) {
+                    value = m_vertices[u]->getDistanceTo(*m_vertices[goal]);
+                }
+                return (value > 0) ? value : 0;
+            }
+
+            bool CompactGraph::search(const uint32_t &from, const uint32_t &to, Workspace &ws) const {
+                if ( (from >= m_vertices.size()) || (to >= m_vertices.size()) || (ws.m_reached.size() != m_vertices.size()) ) {
+                    return false;
+                }
+
+                // Start a new generation instead of clearing the workspace.
+                ws.m_generation++;
+                if (ws.m_generation == 0) {
+                    fill(ws.m_reached.begin(), ws.m_reached.end(), 0);
+                    fill(ws.m_finished.begin(), ws.m_finished.end(), 0);
+                    ws.m_generation = 1;
+                }
+                const uint32_t GENERATION = ws.m_generation;
+
+                vector<pair<double, uint32_t> > &queue = ws.m_queue;
+                queue.clear();
+
+                ws.m_reached[from] = GENERATION;
+                ws.m_distances[from] = 0;
+                ws.m_predecessors[from] = from;
+                queue.push_back(make_pair(getEstimatedCosts(from, to), from));
+
+                while (!queue.empty()) {
+                    pop_heap(queue.begin(), queue.end(), greater<pair<double, uint32_t> >());
+                    const uint32_t u = queue.back().second;
+                    queue.pop_back();
+
+                    // Vertices are queued again instead of decreasing their key; skip outdated entries.
+                    if (ws.m_finished[u] == GENERATION) {
+                        continue;
+                    }
+                    ws.m_finished[u] = GENERATION;
+
+                    if (u == to) {
+                        return true;
+                    }
+
+                    const double distance = ws.m_distances[u];
+                    for (uint32_t i = m_offsets[u]; i < m_offsets[u + 1]; i++) {
+                        const uint32_t v = m_targets[i];
+                        const double d = distance + m_costs[i];
+                        if ( (ws.m_finished[v] != GENERATION) &&
+                             ( (ws.m_reached[v] != GENERATION) || (d < ws.m_distances[v]) ) ) {
+                            ws.m_reached[v] = GENERATION;
+                            ws.m_distances[v] = d;
+                            ws.m_predecessors[v] = u;
+
+                            queue.push_back(make_pair(d + getEstimatedCosts(v, to), v));
+                            push_heap(queue.begin(), queue.end(), greater<pair<double, uint32_t> >());
+                        }
+                    }
+                }
+
+                return false;
+            }
+
+            bool CompactGraph::getShortestPath(const Vertex &v1, const Vertex &v2, Workspace &ws, vector<const Vertex*> &route) const {
+                route.clear();
+
+                const int32_t from = getIndex(v1);
+                const int32_t to = getIndex(v2);
+                if ( (from < 0) || (to < 0) || !search(static_cast<uint32_t>(from), static_cast<uint32_t>(to), ws) ) {
+                    return false;
+                }
+
+                for (uint32_t v = static_cast<uint32_t>(to); ; v = ws.m_predecessors[v]) {
+                    route.push_back(m_vertices[v]);
+                    if (v == ws.m_predecessors[v]) {
+                        break;
+                    }
+                }
+                reverse(route.begin(), route.end());
+
+                return true;
+            }
+
+            bool CompactGraph::getShortestPath(const uint32_t &from, const uint32_t &to, Workspace &ws, vector<uint32_t> &route) const {
+                route.clear();
+
+                if (!search(from, to, ws)) {
+                    return false;
+                }
+
+                for (uint32_t v = to; ; v = ws.m_predecessors[v]) {
+                    route.push_back(v);
+                    if (v == ws.m_predecessors[v]) {
+                        break;
+                    }
+                }
+                reverse(route.begin(), route.end());
+
+                return true;
+            }
+
+        }
+    }
+} // core::wrapper::graph
@@ -58,7 +58,6 @@ class Edge;
                         if ( (m_graph[m_goal] != NULL) && (m_graph[u] != NULL) ) {
                             value = m_graph[m_goal]->getDistanceTo(*(m_graph[u]));
                         }
-                        cerr << "Value = " << value << endl;
                         return value;
                     }
 
@@ -154,8 +153,6 @@ class Edge;
                     GraphDefinition::edge_descriptor edge;
                     boost::tie(edge, found) = boost::add_edge(vertex1, vertex2, m_graph);
                     m_weightMap[edge] = e->getCosts();
-
-                    clog << "Edge " << e->toString() << " between " << v1->toString() << " and " << v2->toString() << " added to graph." << endl;
                 }
             }
 
@@ -17,11 +17,13 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <limits>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/serialization/Deserializer.h"
@@ -66,6 +68,52 @@ namespace opendlv {
             const double WGS84Coordinate::R3 = WGS84Coordinate::R3T * (WGS84Coordinate::C66 - WGS84Coordinate::SQUARED_ECCENTRICITY * WGS84Coordinate::C68);;
             const double WGS84Coordinate::R4 = WGS84Coordinate::R3T * WGS84Coordinate::SQUARED_ECCENTRICITY * WGS84Coordinate::C88;
 
+            // Number of coordinates processed at once by the batch transformations.
+            static const uint32_t CHUNK_SIZE = 256;
+
+            // Maximum number of refinements for the inverse batch transformation.
+            static const uint32_t MAX_ITERATIONS = 20;
+
+            // pi/2 split into two parts for an accurate argument reduction.
+            static const double HALF_PI_A = 1.5707963267948966;
+            static const double HALF_PI_B = 6.123233995736766e-17;
+
+            /**
+             * This function computes sine and cosine using their Taylor
+             * series on [-pi/4, pi/4] after reducing x = r + k * pi/2; the
+             * error is below 1e-15 and the code has no branches that
+             * prevent vectorization.
+             */
+            static inline void sinCos(const double &x, double &s, double &c) {
+                const double kd = x / HALF_PI_A;
+                const int32_t k = static_cast<int32_t>(kd + ((kd < 0) ? -0.5 : 0.5));
+                const double r = (x - k * HALF_PI_A) - k * HALF_PI_B;
+                const double r2 = r * r;
+
+                const double sr = r * (1.0 + r2 * (-1.6666666666666666e-01 + r2 * (8.3333333333333332e-03 + r2 * (-1.9841269841269841e-04
+                                + r2 * (2.7557319223985893e-06 + r2 * (-2.5052108385441720e-08 + r2 * (1.6059043836821613e-10
+                                + r2 * -7.6471637318198164e-13)))))));
+                const double cr = 1.0 + r2 * (-0.5 + r2 * (4.1666666666666664e-02 + r2 * (-1.3888888888888889e-03
+                                + r2 * (2.4801587301587302e-05 + r2 * (-2.7557319223985888e-07 + r2 * (2.0876756987868100e-09
+                                + r2 * (-1.1470745597729725e-11 + r2 * 4.7794773323873853e-14)))))));
+
+                // Quadrant k: sin(r + k * pi/2) is sin(r), cos(r), -sin(r), or -cos(r).
+                const double swap = static_cast<double>(k & 1);
+                const double sinSign = 1.0 - static_cast<double>(k & 2);
+                const double cosSign = 1.0 - static_cast<double>((k + 1) & 2);
+                s = sinSign * (sr + swap * (cr - sr));
+                c = cosSign * (cr + swap * (sr - cr));
+            }
+
+            /**
+             * This function computes 1/sqrt(1 - u) for 0 <= u <= e^2 using
+             * its binomial series; as e^2 < 0.0067, the error of eight terms
+             * is below 1e-17. In contrast to sqrt, it can be vectorized.
+             */
+            static inline double inverseSqrtOfOneMinus(const double &u) {
+                return 1.0 + u * (0.5 + u * (0.375 + u * (0.3125 + u * (0.2734375 + u * (0.24609375 + u * (0.2255859375 + u * 0.20947265625))))));
+            }
+
             WGS84Coordinate::WGS84Coordinate() :
                     m_lat(0),
                     m_lon(0),
@@ -171,6 +219,152 @@ namespace opendlv {
                 return result;
             }
 
+            void WGS84Coordinate::fwd(const double *latitudes, const double *longitudes, double *x, double *y, const uint32_t &size) const {
+                const double HALF_PI = cartesian::Constants::PI / 2.0;
+
+                // Local copies as the results could alias the members.
+                const uint32_t length = size;
+                const double longitude = m_longitude;
+                const double ml0 = m_ml0;
+
+                for (uint32_t i = 0; i < length; i++) {
+                    const double t = fabs(latitudes[i]) - HALF_PI;
+                    const double valid = ( (t > 1.0e-12) | (fabs(longitudes[i]) > 10.0) ) ? 0.0 : 1.0;
+                    const double lat = (fabs(t) < 1.0e-12) ? ((latitudes[i] < 0.0) ? -HALF_PI : HALF_PI) : latitudes[i];
+                    const double lon = longitudes[i] - longitude;
+
+                    double sinPhi = 0;
+                    double cosPhi = 0;
+                    sinCos(lat, sinPhi, cosPhi);
+                    const double sin2Phi = sinPhi * sinPhi;
+                    const double ml = R0 * lat - cosPhi * sinPhi * (R1 + sin2Phi * (R2 + sin2Phi * (R3 + sin2Phi * R4)));
+
+                    // Instead of treating the equator separately, sin(lat) is limited to +/-1e-10 where
+                    // the projection equals its limit up to 1mm; thus, all values are computed for every
+                    // coordinate and the loop has no control flow.
+                    const double s = (fabs(sinPhi) > 1e-10) ? sinPhi : ((sinPhi < 0.0) ? -1e-10 : 1e-10);
+                    const double ms = cosPhi * inverseSqrtOfOneMinus(SQUARED_ECCENTRICITY * sin2Phi) / s;
+
+                    double sinE = 0;
+                    double cosE = 0;
+                    sinCos(lon * s, sinE, cosE);
+
+                    x[i] = valid * EQUATOR_RADIUS * ms * sinE;
+                    y[i] = valid * EQUATOR_RADIUS * ((ml - ml0) + ms * (1.0 - cosE));
+                }
+            }
+
+            void WGS84Coordinate::transformToCartesian(const double *latitudes, const double *longitudes, double *x, double *y, const uint32_t &size) const {
+                double lat[CHUNK_SIZE];
+                double lon[CHUNK_SIZE];
+
+                for (uint32_t first = 0; first < size; first += CHUNK_SIZE) {
+                    const uint32_t length = min(CHUNK_SIZE, size - first);
+                    for (uint32_t i = 0; i < length; i++) {
+                        lat[i] = latitudes[first + i] * cartesian::Constants::DEG2RAD;
+                        lon[i] = longitudes[first + i] * cartesian::Constants::DEG2RAD;
+                    }
+                    fwd(lat, lon, x + first, y + first, length);
+                }
+            }
+
+            void WGS84Coordinate::transformToWGS84(const double *x, const double *y, double *latitudes, double *longitudes, const uint32_t &size, const double &accuracy) const {
+                const double epsilon = (accuracy > 0) ? accuracy : 1e-2;
+                const double cosLatitude = cos(m_latitude);
+
+                double lat[CHUNK_SIZE];
+                double lon[CHUNK_SIZE];
+                double projectedX[CHUNK_SIZE];
+                double projectedY[CHUNK_SIZE];
+
+                for (uint32_t first = 0; first < size; first += CHUNK_SIZE) {
+                    const uint32_t length = min(CHUNK_SIZE, size - first);
+
+                    // Start at the position on a sphere around the reference coordinate.
+                    for (uint32_t i = 0; i < length; i++) {
+                        lat[i] = m_latitude + y[first + i] / EQUATOR_RADIUS;
+                        lon[i] = m_longitude + x[first + i] / (EQUATOR_RADIUS * cosLatitude);
+                    }
+
+                    // Correct the position by the deviation of its projection divided by the meridional and normal radii of curvature.
+                    for (uint32_t iteration = 0; iteration < MAX_ITERATIONS; iteration++) {
+                        fwd(lat, lon, projectedX, projectedY, length);
+
+                        double maximumDeviation = 0;
+                        for (uint32_t i = 0; i < length; i++) {
+                            const double dx = x[first + i] - projectedX[i];
+                            const double dy = y[first + i] - projectedY[i];
+                            maximumDeviation = max(maximumDeviation, max(fabs(dx), fabs(dy)));
+
+                            double sinPhi = 0;
+                            double cosPhi = 0;
+                            sinCos(lat[i], sinPhi, cosPhi);
+                            const double inverseW = inverseSqrtOfOneMinus(SQUARED_ECCENTRICITY * sinPhi * sinPhi);
+                            const double meridionalRadius = EQUATOR_RADIUS * (1.0 - SQUARED_ECCENTRICITY) * inverseW * inverseW * inverseW;
+                            const double normalRadius = EQUATOR_RADIUS * inverseW;
+
+                            projectedX[i] = lat[i] + dy / meridionalRadius;
+                            projectedY[i] = lon[i] + dx / (normalRadius * cosPhi);
+                        }
+
+                        if (maximumDeviation < epsilon) {
+                            break;
+                        }
+                        copy(projectedX, projectedX + length, lat);
+                        copy(projectedY, projectedY + length, lon);
+                    }
+
+                    for (uint32_t i = 0; i < length; i++) {
+                        latitudes[first + i] = lat[i] * cartesian::Constants::RAD2DEG;
+                        longitudes[first + i] = lon[i] * cartesian::Constants::RAD2DEG;
+                    }
+                }
+            }
+
+            void WGS84Coordinate::transform(const vector<WGS84Coordinate> &coordinates, vector<Point3> &result) const {
+                const uint32_t size = coordinates.size();
+                vector<double> latitudes(size);
+                vector<double> longitudes(size);
+                for (uint32_t i = 0; i < size; i++) {
+                    latitudes[i] = coordinates[i].getLatitude();
+                    longitudes[i] = coordinates[i].getLongitude();
+                }
+
+                vector<double> x(size);
+                vector<double> y(size);
+                if (size > 0) {
+                    transformToCartesian(&latitudes[0], &longitudes[0], &x[0], &y[0], size);
+                }
+
+                result.clear();
+                result.reserve(size);
+                for (uint32_t i = 0; i < size; i++) {
+                    result.push_back(Point3(x[i], y[i], 0));
+                }
+            }
+
+            void WGS84Coordinate::transform(const vector<Point3> &coordinates, vector<WGS84Coordinate> &result, const double &accuracy) const {
+                const uint32_t size = coordinates.size();
+                vector<double> x(size);
+                vector<double> y(size);
+                for (uint32_t i = 0; i < size; i++) {
+                    x[i] = coordinates[i].getX();
+                    y[i] = coordinates[i].getY();
+                }
+
+                vector<double> latitudes(size);
+                vector<double> longitudes(size);
+                if (size > 0) {
+                    transformToWGS84(&x[0], &y[0], &latitudes[0], &longitudes[0], size, accuracy);
+                }
+
+                result.clear();
+                result.reserve(size);
+                for (uint32_t i = 0; i < size; i++) {
+                    result.push_back(WGS84Coordinate(latitudes[i], getLATITUDE(), longitudes[i], getLONGITUDE()));
+                }
+            }
+
             const Point3 WGS84Coordinate::transform(const WGS84Coordinate &coordinate) const {
                 pair<double, double> result = fwd(coordinate.getLatitude() * cartesian::Constants::DEG2RAD, coordinate.getLongitude() * cartesian::Constants::DEG2RAD);
 
@@ -0,0 +1,173 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendlv/core/wrapper/graph/CompactGraph.h"
+#include "opendlv/data/environment/Point3.h"
+#include "opendlv/data/graph/WaypointIndex.h"
+#include "opendlv/data/graph/WaypointVertex.h"
+
+namespace opendlv {
+    namespace data {
+        namespace graph {
+
+            using namespace std;
+            using namespace core::wrapper::graph;
+            using namespace opendlv::data::environment;
+
+            WaypointIndex::WaypointIndex(const CompactGraph &g, const double &cellSize) :
+                m_cellSize((cellSize > 0) ? cellSize : 10.0),
+                m_minimumX(0),
+                m_minimumY(0),
+                m_columns(0),
+                m_rows(0),
+                m_cellOffsets(1, 0),
+                m_vertices(),
+                m_x(),
+                m_y() {
+                vector<uint32_t> vertices;
+                vector<double> x;
+                vector<double> y;
+                double maximumX = -numeric_limits<double>::max();
+                double maximumY = -numeric_limits<double>::max();
+                m_minimumX = numeric_limits<double>::max();
+                m_minimumY = numeric_limits<double>::max();
+
+                for (uint32_t i = 0; i < g.getNumberOfVertices(); i++) {
+                    const WaypointVertex *v = dynamic_cast<const WaypointVertex*>(g.getVertex(i));
+                    if (v != NULL) {
+                        const Point3 position = v->getPosition();
+                        vertices.push_back(i);
+                        x.push_back(position.getX());
+                        y.push_back(position.getY());
+
+                        m_minimumX = min(m_minimumX, position.getX());
+                        m_minimumY = min(m_minimumY, position.getY());
+                        maximumX = max(maximumX, position.getX());
+                        maximumY = max(maximumY, position.getY());
+                    }
+                }
+
+                const uint32_t SIZE = vertices.size();
+                if (SIZE == 0) {
+                    m_minimumX = m_minimumY = 0;
+                    return;
+                }
+
+                // Enlarge the cells for sparse networks to limit the size of the grid.
+                const double MAXIMUM_NUMBER_OF_CELLS = max(1024.0, 4.0 * SIZE);
+                while (((maximumX - m_minimumX) / m_cellSize + 1) * ((maximumY - m_minimumY) / m_cellSize + 1) > MAXIMUM_NUMBER_OF_CELLS) {
+                    m_cellSize *= 2.0;
+                }
+                m_columns = static_cast<uint32_t>((maximumX - m_minimumX) / m_cellSize) + 1;
+                m_rows = static_cast<uint32_t>((maximumY - m_minimumY) / m_cellSize) + 1;
+
+                // Sort the waypoints into the cells using counting sort.
+                vector<uint32_t> cells(SIZE);
+                m_cellOffsets.assign(m_columns * m_rows + 1, 0);
+                for (uint32_t i = 0; i < SIZE; i++) {
+                    const uint32_t column = min(m_columns - 1, static_cast<uint32_t>((x[i] - m_minimumX) / m_cellSize));
+                    const uint32_t row = min(m_rows - 1, static_cast<uint32_t>((y[i] - m_minimumY) / m_cellSize));
+                    cells[i] = row * m_columns + column;
+                    m_cellOffsets[cells[i] + 1]++;
+                }
+                for (uint32_t i = 1; i < m_cellOffsets.size(); i++) {
+                    m_cellOffsets[i] += m_cellOffsets[i - 1];
+                }
+
+                m_vertices.resize(SIZE);
+                m_x.resize(SIZE);
+                m_y.resize(SIZE);
+                vector<uint32_t> next(m_cellOffsets.begin(), m_cellOffsets.end() - 1);
+                for (uint32_t i = 0; i < SIZE; i++) {
+                    const uint32_t j = next[cells[i]]++;
+                    m_vertices[j] = vertices[i];
+                    m_x[j] = x[i];
+                    m_y[j] = y[i];
+                }
+            }
+
+            WaypointIndex::~WaypointIndex() {}
+
+            uint32_t WaypointIndex::getSize() const {
+                return m_vertices.size();
+            }
+
+            void WaypointIndex::scanCell(const uint32_t &cell, const double &x, const double &y, int32_t &nearest, double &minimumDistance) const {
+                for (uint32_t k = m_cellOffsets[cell]; k < m_cellOffsets[cell + 1]; k++) {
+                    const double distance = (m_x[k] - x) * (m_x[k] - x) + (m_y[k] - y) * (m_y[k] - y);
+                    if (distance < minimumDistance) {
+                        minimumDistance = distance;
+                        nearest = static_cast<int32_t>(m_vertices[k]);
+                    }
+                }
+            }
+
+            int32_t WaypointIndex::findNearest(const Point3 &position) const {
+                if (m_vertices.empty()) {
+                    return -1;
+                }
+
+                const double x = position.getX();
+                const double y = position.getY();
+                const int32_t COLUMNS = static_cast<int32_t>(m_columns);
+                const int32_t ROWS = static_cast<int32_t>(m_rows);
+                const int32_t column = static_cast<int32_t>(max(0.0, min(COLUMNS - 1.0, floor((x - m_minimumX) / m_cellSize))));
+                const int32_t row = static_cast<int32_t>(max(0.0, min(ROWS - 1.0, floor((y - m_minimumY) / m_cellSize))));
+
+                int32_t nearest = -1;
+                double minimumDistance = numeric_limits<double>::max();
+
+                // Search the rings of cells around the position's cell; all waypoints in ring
+                // r + 1 or beyond are at least r cells away from the position.
+                const int32_t MAXIMUM_RING = max(COLUMNS, ROWS);
+                for (int32_t r = 0; r <= MAXIMUM_RING; r++) {
+                    for (int32_t j = max(0, row - r); j <= min(ROWS - 1, row + r); j++) {
+                        if (abs(j - row) == r) {
+                            for (int32_t i = max(0, column - r); i <= min(COLUMNS - 1, column + r); i++) {
+                                scanCell(static_cast<uint32_t>(j * COLUMNS + i), x, y, nearest, minimumDistance);
+                            }
+                        }
+                        else {
+                            if (column - r >= 0) {
+                                scanCell(static_cast<uint32_t>(j * COLUMNS + column - r), x, y, nearest, minimumDistance);
+                            }
+                            if (column + r < COLUMNS) {
+                                scanCell(static_cast<uint32_t>(j * COLUMNS + column + r), x, y, nearest, minimumDistance);
+                            }
+                        }
+                    }
+
+                    const double radius = r * m_cellSize;
+                    if ( (nearest >= 0) && (minimumDistance <= radius * radius) ) {
+                        break;
+                    }
+                }
+
+                return nearest;
+            }
+
+        }
+    }
+} // opendlv::data::graph
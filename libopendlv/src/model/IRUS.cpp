@@ -17,6 +17,7 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <algorithm>
 #include <iostream>
 #include <map>
 #include <string>
@@ -60,6 +61,7 @@ namespace opendlv { namespace vehiclecontext {
             m_freq(0),
             m_numberOfPolygons(0),
             m_mapOfPolygons(),
+            m_polygonIndex(),
             m_listOfPolygonsInsideFOV(),
             m_mapOfPointSensors(),
             m_distances(),
@@ -76,6 +78,7 @@ namespace opendlv { namespace vehiclecontext {
             m_freq(freq),
             m_numberOfPolygons(0),
             m_mapOfPolygons(),
+            m_polygonIndex(),
             m_listOfPolygonsInsideFOV(),
             m_mapOfPointSensors(),
             m_distances(),
@@ -204,6 +207,19 @@ namespace opendlv { namespace vehiclecontext {
                     cout << "[IRUS] Registered point sensor " << ps->toString() << "." << endl;
                 }
             }
+
+            // Build the spatial index over all static polygons; a cell covers the longest FOV range.
+            double cellSize = 0;
+            map<string, PointSensor*, odcore::strings::StringComparator>::const_iterator sensorIterator = m_mapOfPointSensors.begin();
+            for (; sensorIterator != m_mapOfPointSensors.end(); sensorIterator++) {
+                cellSize = max(cellSize, sensorIterator->second->getDistanceFOV());
+            }
+            m_polygonIndex = unique_ptr<PolygonIndex>(new PolygonIndex(cellSize));
+
+            map<uint32_t, Polygon>::const_iterator polygonIterator = m_mapOfPolygons.begin();
+            for (; polygonIterator != m_mapOfPolygons.end(); polygonIterator++) {
+                m_polygonIndex->add(polygonIterator->second);
+            }
         }
 
         void IRUS::tearDown() {
@@ -214,6 +230,8 @@ namespace opendlv { namespace vehiclecontext {
                 OPENDAVINCI_CORE_DELETE_POINTER(sensor);
             }
             m_mapOfPointSensors.clear();
+
+            m_polygonIndex.reset();
         }
 
         vector<Container> IRUS::calculate(const EgoState &es) {
@@ -232,7 +250,7 @@ namespace opendlv { namespace vehiclecontext {
                 m_FOVs[sensor->getName()] = FOV;
 
                 // Calculate distance.
-                m_distances[sensor->getName()] = sensor->getDistance(m_mapOfPolygons);
+                m_distances[sensor->getName()] = (m_polygonIndex.get() != NULL) ? sensor->getDistance(*m_polygonIndex) : sensor->getDistance(m_mapOfPolygons);
                 cerr << sensor->getName() << ": " << m_distances[sensor->getName()] << endl;
 
                 // Store data for sensorboard.
@@ -29,6 +29,7 @@
 #include "opendlv/data/environment/Point3.h"
 #include "opendlv/data/environment/Polygon.h"
 #include "opendlv/vehiclecontext/model/PointSensor.h"
+#include "opendlv/vehiclecontext/model/PolygonIndex.h"
 
 namespace opendlv { namespace vehiclecontext {
     namespace model {
@@ -51,7 +52,8 @@ namespace opendlv { namespace vehiclecontext {
             m_faultModelNoise(faultModelNoise),
             m_totalRotation(0),
             m_FOV(),
-            m_sensorPosition()
+            m_sensorPosition(),
+            m_listOfCandidates()
         {}
 
         PointSensor::~PointSensor() {}
@@ -119,38 +121,56 @@ namespace opendlv { namespace vehiclecontext {
             return retVal;
         }
 
+        void PointSensor::updateDistance(const Polygon &p, double &distanceToSensor) const {
+            // Get overlapping parts of polygon...
+            Polygon contour = m_FOV.intersectIgnoreZ(p);
+
+            if (contour.getSize() > 0) {
+                // Get nearest point from contour.
+                const vector<Point3> listOfPoints = contour.getVertices();
+                vector<Point3>::const_iterator jt = listOfPoints.begin();
+
+                while (jt != listOfPoints.end()) {
+                    const Point3 &pt = (*jt++);
+                    double d = (pt - m_sensorPosition).lengthXY();
+
+                    if (isInFOV(pt)) {
+                        if ((distanceToSensor < 0) || (d < distanceToSensor)) {
+                            distanceToSensor = d;
+                        }
+                    }
+                }
+            }
+        }
+
         double PointSensor::getDistance(map<uint32_t, opendlv::data::environment::Polygon> &mapOfPolygons) {
-            Point3 nearest;
             double distanceToSensor = -1;
 
             map<uint32_t, opendlv::data::environment::Polygon>::const_iterator it = mapOfPolygons.begin();
             while (it != mapOfPolygons.end()) {
-                Polygon p = it->second;
-
-                // Get overlapping parts of polygon...
-                Polygon contour = m_FOV.intersectIgnoreZ(p);
+                updateDistance(it->second, distanceToSensor);
+                it++;
+            }
 
-                if (contour.getSize() > 0) {
-                    // Get nearest point from contour.
-                    const vector<Point3> listOfPoints = contour.getVertices();
-                    vector<Point3>::const_iterator jt = listOfPoints.begin();
+            return applyFaultModel(distanceToSensor);
+        }
 
-                    while (jt != listOfPoints.end()) {
-                        Point3 pt = (*jt++);
-                        double d = (pt - m_sensorPosition).lengthXY();
+        double PointSensor::getDistance(const PolygonIndex &polygonIndex) {
+            double distanceToSensor = -1;
 
-                        if (isInFOV(pt)) {
-                            if ((distanceToSensor < 0) || (d < distanceToSensor)) {
-                                nearest = pt;
-                                distanceToSensor = d;
-                            }
-                        }
-                    }
-                }
+            // Only polygons overlapping with the FOV's bounding box can be hit.
+            m_listOfCandidates.clear();
+            polygonIndex.getCandidates(m_FOV, m_listOfCandidates);
 
-                it++;
+            vector<const Polygon*>::const_iterator it = m_listOfCandidates.begin();
+            while (it != m_listOfCandidates.end()) {
+                updateDistance(*(*it++), distanceToSensor);
             }
 
+            return applyFaultModel(distanceToSensor);
+        }
+
+        double PointSensor::applyFaultModel(double distanceToSensor) {
             if (distanceToSensor > m_clampDistance) {
                 distanceToSensor = -1;
             }
@@ -196,6 +216,10 @@ namespace opendlv { namespace vehiclecontext {
             return distanceToSensor;
         } 
 
+        double PointSensor::getDistanceFOV() const {
+            return m_distanceFOV;
+        }
+
         const string PointSensor::getName() const {
             return m_name;    
         }
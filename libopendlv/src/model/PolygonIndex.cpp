@@ -0,0 +1,186 @@
+/**
+ * libvehiclecontext - Models for simulating automotive systems.
+ * Copyright (C) 2012 - 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <vector>
+
+#include "opendlv/data/environment/Point3.h"
+#include "opendlv/data/environment/Polygon.h"
+#include "opendlv/vehiclecontext/model/PolygonIndex.h"
+
+namespace opendlv { namespace vehiclecontext {
+    namespace model {
+
+        using namespace std;
+        using namespace opendlv::data::environment;
+
+        // Polygons covering more cells than this are always returned as candidates.
+        static const int64_t MAX_CELLS_PER_POLYGON = 1024;
+
+        PolygonIndex::BoundingBox::BoundingBox() :
+            m_minX(numeric_limits<double>::max()),
+            m_minY(numeric_limits<double>::max()),
+            m_maxX(-numeric_limits<double>::max()),
+            m_maxY(-numeric_limits<double>::max()) {}
+
+        PolygonIndex::BoundingBox::BoundingBox(const Polygon &polygon) :
+            m_minX(numeric_limits<double>::max()),
+            m_minY(numeric_limits<double>::max()),
+            m_maxX(-numeric_limits<double>::max()),
+            m_maxY(-numeric_limits<double>::max()) {
+            const vector<Point3> listOfVertices = polygon.getVertices();
+            vector<Point3>::const_iterator it = listOfVertices.begin();
+            while (it != listOfVertices.end()) {
+                m_minX = min(m_minX, it->getX());
+                m_minY = min(m_minY, it->getY());
+                m_maxX = max(m_maxX, it->getX());
+                m_maxY = max(m_maxY, it->getY());
+                it++;
+            }
+        }
+
+        bool PolygonIndex::BoundingBox::overlaps(const BoundingBox &other) const {
+            return !( (other.m_minX > m_maxX) || (other.m_maxX < m_minX) ||
+                      (other.m_minY > m_maxY) || (other.m_maxY < m_minY) );
+        }
+
+        PolygonIndex::PolygonIndex(const double &cellSize) :
+            m_cellSize((cellSize > 0) ? cellSize : 1.0),
+            m_listOfPolygons(),
+            m_listOfBoundingBoxes(),
+            m_cells(),
+            m_listOfLargePolygons(),
+            m_visited(),
+            m_query(0) {}
+
+        PolygonIndex::~PolygonIndex() {}
+
+        int32_t PolygonIndex::getCell(const double &v) const {
+            return static_cast<int32_t>(floor(v / m_cellSize));
+        }
+
+        int64_t PolygonIndex::getKey(const int32_t &x, const int32_t &y) {
+            return (static_cast<int64_t>(x) << 32) | static_cast<uint32_t>(y);
+        }
+
+        void PolygonIndex::add(const Polygon &polygon) {
+            const BoundingBox bb(polygon);
+            if (bb.m_minX > bb.m_maxX) {
+                // Skip polygons without vertices.
+                return;
+            }
+
+            const uint32_t index = m_listOfPolygons.size();
+            m_listOfPolygons.push_back(polygon);
+            m_listOfBoundingBoxes.push_back(bb);
+            m_visited.push_back(0);
+
+            const int32_t minX = getCell(bb.m_minX);
+            const int32_t minY = getCell(bb.m_minY);
+            const int32_t maxX = getCell(bb.m_maxX);
+            const int32_t maxY = getCell(bb.m_maxY);
+
+            if ( (static_cast<int64_t>(maxX - minX + 1) * (maxY - minY + 1)) > MAX_CELLS_PER_POLYGON) {
+                m_listOfLargePolygons.push_back(index);
+                return;
+            }
+
+            for (int32_t x = minX; x <= maxX; x++) {
+                for (int32_t y = minY; y <= maxY; y++) {
+                    m_cells[getKey(x, y)].push_back(index);
+                }
+            }
+        }
+
+        void PolygonIndex::clear() {
+            m_listOfPolygons.clear();
+            m_listOfBoundingBoxes.clear();
+            m_cells.clear();
+            m_listOfLargePolygons.clear();
+            m_visited.clear();
+            m_query = 0;
+        }
+
+        uint32_t PolygonIndex::getSize() const {
+            return m_listOfPolygons.size();
+        }
+
+        void PolygonIndex::getCandidates(const Polygon &area, vector<const Polygon*> &candidates) const {
+            const BoundingBox bb(area);
+            if (bb.m_minX > bb.m_maxX) {
+                return;
+            }
+
+            // Mark polygons already returned for this query to avoid duplicates.
+            m_query++;
+            if (m_query == 0) {
+                m_visited.assign(m_visited.size(), 0);
+                m_query = 1;
+            }
+
+            vector<uint32_t>::const_iterator it = m_listOfLargePolygons.begin();
+            while (it != m_listOfLargePolygons.end()) {
+                const uint32_t index = (*it++);
+                if (bb.overlaps(m_listOfBoundingBoxes[index])) {
+                    m_visited[index] = m_query;
+                    candidates.push_back(&m_listOfPolygons[index]);
+                }
+            }
+
+            const int32_t minX = getCell(bb.m_minX);
+            const int32_t minY = getCell(bb.m_minY);
+            const int32_t maxX = getCell(bb.m_maxX);
+            const int32_t maxY = getCell(bb.m_maxY);
+
+            if ((static_cast<int64_t>(maxX - minX + 1) * (maxY - minY + 1)) > static_cast<int64_t>(m_cells.size())) {
+                // The area covers more cells than are occupied; visit the occupied ones only.
+                map<int64_t, vector<uint32_t> >::const_iterator cell = m_cells.begin();
+                while (cell != m_cells.end()) {
+                    addCandidates(cell->second, bb, candidates);
+                    cell++;
+                }
+            }
+            else {
+                for (int32_t x = minX; x <= maxX; x++) {
+                    for (int32_t y = minY; y <= maxY; y++) {
+                        map<int64_t, vector<uint32_t> >::const_iterator cell = m_cells.find(getKey(x, y));
+                        if (cell != m_cells.end()) {
+                            addCandidates(cell->second, bb, candidates);
+                        }
+                    }
+                }
+            }
+        }
+
+        void PolygonIndex::addCandidates(const vector<uint32_t> &cell, const BoundingBox &bb, vector<const Polygon*> &candidates) const {
+            vector<uint32_t>::const_iterator it = cell.begin();
+            while (it != cell.end()) {
+                const uint32_t index = (*it++);
+                if ( (m_visited[index] != m_query) && bb.overlaps(m_listOfBoundingBoxes[index]) ) {
+                    m_visited[index] = m_query;
+                    candidates.push_back(&m_listOfPolygons[index]);
+                }
+            }
+        }
+
+    }
+} } // opendlv::vehiclecontext::model
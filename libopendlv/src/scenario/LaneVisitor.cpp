@@ -104,7 +104,6 @@ namespace opendlv {
                     v1->setLaneID(pm->getLane()->getIdentifier());
                     v1->setWaypointID(vt1.getIdentifier());
                     v1->setPosition(vt1);
-                    cerr << "Constructed node: " << pm->getLane()->getRoad()->getLayer()->getIdentifier() << "." << pm->getLane()->getRoad()->getIdentifier() << "." << pm->getLane()->getIdentifier() << "." << vt1.getIdentifier() << endl;
 
                     WaypointVertex *v2 = new WaypointVertex();
                     v2->setLayerID(pm->getLane()->getRoad()->getLayer()->getIdentifier());
@@ -113,8 +112,6 @@ namespace opendlv {
                     v2->setWaypointID(vt2.getIdentifier());
                     v2->setPosition(vt2);
 
-                    cerr << "Constructed node: " << pm->getLane()->getRoad()->getLayer()->getIdentifier() << "." << pm->getLane()->getRoad()->getIdentifier() << "." << pm->getLane()->getIdentifier() << "." << vt2.getIdentifier() << endl;
-
                     WaypointsEdge *edge = new WaypointsEdge();
                     edge->setCosts(vt1.getXYDistanceTo(vt2));
 
@@ -127,8 +124,6 @@ namespace opendlv {
                 vector<Connector>::const_iterator mt = listOfConnectors.begin();
                 while (mt != listOfConnectors.end()) {
                     Connector c = (*mt++);
-
-                    cerr << "Found connector: " << c.toString() << " to add." << endl;
                     try {
                         // Find start vertex.
                         FindNodeByPointIDVisitor startVertexFinder(c.getSource());
@@ -163,7 +158,6 @@ namespace opendlv {
                             edge->setCosts(startV.getXYDistanceTo(endV));
 
                             m_graph.updateEdge(v1, v2, edge);
-                            cerr << "Adding edge for connector between " << v1->toString() << " and " << v2->toString() << endl;
                         }
                     }
                     catch(...) {}
@@ -223,7 +217,6 @@ namespace opendlv {
                 v1->setLaneID(arc->getLane()->getIdentifier());
                 v1->setWaypointID(vt1.getIdentifier());
                 v1->setPosition(vt1);
-                cerr << "Constructed node: " << arc->getLane()->getRoad()->getLayer()->getIdentifier() << "." << arc->getLane()->getRoad()->getIdentifier() << "." << arc->getLane()->getIdentifier() << "." << vt1.getIdentifier() << endl;
 
                 WaypointVertex *v2 = new WaypointVertex();
                 v2->setLayerID(arc->getLane()->getRoad()->getLayer()->getIdentifier());
@@ -232,8 +225,6 @@ namespace opendlv {
                 v2->setWaypointID(vt2.getIdentifier());
                 v2->setPosition(vt2);
 
-                cerr << "Constructed node: " << arc->getLane()->getRoad()->getLayer()->getIdentifier() << "." << arc->getLane()->getRoad()->getIdentifier() << "." << arc->getLane()->getIdentifier() << "." << vt2.getIdentifier() << endl;
-
                 WaypointsEdge *edge = new WaypointsEdge();
                 edge->setCosts(vt1.getXYDistanceTo(vt2));
 
@@ -245,8 +236,6 @@ namespace opendlv {
                 vector<Connector>::const_iterator mt = listOfConnectors.begin();
                 while (mt != listOfConnectors.end()) {
                     Connector c = (*mt++);
-
-                    cerr << "Found connector: " << c.toString() << " to add." << endl;
                     try {
                         // Find start vertex.
                         FindNodeByPointIDVisitor startVertexFinder(c.getSource());
@@ -279,7 +268,6 @@ namespace opendlv {
                             edge->setCosts(startV.getXYDistanceTo(endV));
 
                             m_graph.updateEdge(v1, v2, edge);
-                            cerr << "Adding edge for connector between " << v1->toString() << " and " << v2->toString() << endl;
                         }
                     }
                     catch(...) {}
@@ -306,7 +294,6 @@ namespace opendlv {
                 v1->setLaneID(sl->getLane()->getIdentifier());
                 v1->setWaypointID(vt1.getIdentifier());
                 v1->setPosition(vt1);
-                cerr << "Constructed node: " << sl->getLane()->getRoad()->getLayer()->getIdentifier() << "." << sl->getLane()->getRoad()->getIdentifier() << "." << sl->getLane()->getIdentifier() << "." << vt1.getIdentifier() << endl;
 
                 WaypointVertex *v2 = new WaypointVertex();
                 v2->setLayerID(sl->getLane()->getRoad()->getLayer()->getIdentifier());
@@ -315,8 +302,6 @@ namespace opendlv {
                 v2->setWaypointID(vt2.getIdentifier());
                 v2->setPosition(vt2);
 
-                cerr << "Constructed node: " << sl->getLane()->getRoad()->getLayer()->getIdentifier() << "." << sl->getLane()->getRoad()->getIdentifier() << "." << sl->getLane()->getIdentifier() << "." << vt2.getIdentifier() << endl;
-
                 WaypointsEdge *edge = new WaypointsEdge();
                 edge->setCosts(vt1.getXYDistanceTo(vt2));
 
@@ -328,8 +313,6 @@ namespace opendlv {
                 vector<Connector>::const_iterator mt = listOfConnectors.begin();
                 while (mt != listOfConnectors.end()) {
                     Connector c = (*mt++);
-
-                    cerr << "Found connector: " << c.toString() << " to add." << endl;
                     try {
                         // Find start vertex.
                         FindNodeByPointIDVisitor startVertexFinder(c.getSource());
@@ -362,7 +345,6 @@ namespace opendlv {
                             edge->setCosts(startV.getXYDistanceTo(endV));
 
                             m_graph.updateEdge(v1, v2, edge);
-                            cerr << "Adding edge for connector between " << v1->toString() << " and " << v2->toString() << endl;
                         }
                     }
                     catch(...) {}
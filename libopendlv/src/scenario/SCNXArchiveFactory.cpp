@@ -93,10 +93,9 @@ namespace opendlv {
             if (scnxArchive == NULL) {
                 clog << "Creating new SCNXArchive from " << url.toString() << endl;
 
+                // The archive is memory-mapped and its entries are decompressed on demand.
                 string fileName = url.getResource();
-                fstream fin(fileName.c_str(), ios::binary | ios::in);
-                std::shared_ptr<odcore::wrapper::DecompressedData> data = odcore::wrapper::CompressionFactory::getContents(fin);
-                fin.close();
+                std::shared_ptr<odcore::wrapper::DecompressedData> data = odcore::wrapper::CompressionFactory::getContents(fileName);
 
                 if (data.get()) {
                     Scenario scenario;
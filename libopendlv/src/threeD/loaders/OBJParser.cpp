@@ -0,0 +1,407 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/strings/StringComparator.h"
+#include "opendlv/data/environment/Point3.h"
+#include "opendlv/threeD/Material.h"
+#include "opendlv/threeD/loaders/OBJParser.h"
+#include "opendlv/threeD/models/TriangleMesh.h"
+
+namespace opendlv {
+    namespace threeD {
+        namespace loaders {
+
+            using namespace std;
+            using namespace opendlv::data::environment;
+            using namespace threeD::models;
+
+            static const uint32_t NO_VARIANT = 0xffffffff;
+
+            static const double POWERS_OF_TEN[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                                    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+            /**
+             * Combination of position, texture coordinate, and normal that
+             * has been added as vertex to the mesh. All combinations for
+             * the same position form a singly linked list.
+             */
+            struct VertexVariant {
+                int32_t m_textureCoordinate;
+                int32_t m_normal;
+                uint32_t m_index;
+                uint32_t m_next;
+            };
+
+            static inline bool isBlank(const char &c) {
+                return (c == ' ') || (c == '\t') || (c == '\r');
+            }
+
+            static inline bool isDigit(const char &c) {
+                return (c >= '0') && (c <= '9');
+            }
+
+            static inline void skipBlanks(const char *&p, const char *end) {
+                while ( (p < end) && isBlank(*p) ) {
+                    p++;
+                }
+            }
+
+            static inline void skipLine(const char *&p, const char *end) {
+                const char *newLine = static_cast<const char*>(memchr(p, '\n', end - p));
+                p = (newLine != NULL) ? newLine + 1 : end;
+            }
+
+            static inline bool isKeyword(const char *p, const char *end, const char *keyword, const uint32_t &length) {
+                return (p + length <= end) && (memcmp(p, keyword, length) == 0) &&
+                       ( (p + length == end) || isBlank(p[length]) || (p[length] == '\n') );
+            }
+
+            /**
+             * This method parses a decimal floating point number in the
+             * C locale.
+             *
+             * @return true if a number was parsed.
+             */
+            static bool parseFloat(const char *&p, const char *end, float &value) {
+                skipBlanks(p, end);
+
+                const char *start = p;
+                bool negative = false;
+                if ( (p < end) && ((*p == '-') || (*p == '+')) ) {
+                    negative = (*p == '-');
+                    p++;
+                }
+
+                // Accumulate up to 17 significant digits; further digits only shift the exponent.
+                const uint64_t MAXIMUM_MANTISSA = static_cast<uint64_t>(100000000) * 1000000000;
+                uint64_t mantissa = 0;
+                int32_t exponent = 0;
+                bool hasDigits = false;
+                while ( (p < end) && isDigit(*p) ) {
+                    if (mantissa < MAXIMUM_MANTISSA) {
+                        mantissa = mantissa * 10 + (*p - '0');
+                    }
+                    else {
+                        exponent++;
+                    }
+                    hasDigits = true;
+                    p++;
+                }
+                if ( (p < end) && (*p == '.') ) {
+                    p++;
+                    while ( (p < end) && isDigit(*p) ) {
+                        if (mantissa < MAXIMUM_MANTISSA) {
+                            mantissa = mantissa * 10 + (*p - '0');
+                            exponent--;
+                        }
+                        hasDigits = true;
+                        p++;
+                    }
+                }
+                if (!hasDigits) {
+                    p = start;
+                    return false;
+                }
+                if ( (p < end) && ((*p == 'e') || (*p == 'E')) ) {
+                    const char *exponentStart = p;
+                    p++;
+                    bool negativeExponent = false;
+                    if ( (p < end) && ((*p == '-') || (*p == '+')) ) {
+                        negativeExponent = (*p == '-');
+                        p++;
+                    }
+                    if ( (p < end) && isDigit(*p) ) {
+                        int32_t e = 0;
+                        while ( (p < end) && isDigit(*p) ) {
+                            if (e < 10000) {
+                                e = e * 10 + (*p - '0');
+                            }
+                            p++;
+                        }
+                        exponent += (negativeExponent ? -e : e);
+                    }
+                    else {
+                        p = exponentStart;
+                    }
+                }
+
+                double v = static_cast<double>(mantissa);
+                if ( (exponent >= 0) && (exponent <= 22) ) {
+                    v *= POWERS_OF_TEN[exponent];
+                }
+                else if ( (exponent < 0) && (exponent >= -22) ) {
+                    v /= POWERS_OF_TEN[-exponent];
+                }
+                else {
+                    v *= pow(10.0, exponent);
+                }
+                value = static_cast<float>(negative ? -v : v);
+                return true;
+            }
+
+            /**
+             * This method parses an optionally negative integer.
+             *
+             * @return true if a number was parsed.
+             */
+            static bool parseIndex(const char *&p, const char *end, int32_t &value) {
+                const char *start = p;
+                bool negative = false;
+                if ( (p < end) && (*p == '-') ) {
+                    negative = true;
+                    p++;
+                }
+                if ( (p >= end) || !isDigit(*p) ) {
+                    p = start;
+                    return false;
+                }
+                int64_t v = 0;
+                while ( (p < end) && isDigit(*p) ) {
+                    if (v < 0x7fffffff) {
+                        v = v * 10 + (*p - '0');
+                    }
+                    p++;
+                }
+                value = static_cast<int32_t>(negative ? -v : v);
+                return true;
+            }
+
+            /**
+             * This method turns a one-based or negative (relative) index into
+             * a zero-based index.
+             *
+             * @return Zero-based index or -1 if the index is invalid.
+             */
+            static inline int32_t resolveIndex(const int32_t &index, const uint32_t &numberOfElements) {
+                const int64_t resolved = (index > 0) ? (static_cast<int64_t>(index) - 1) : (static_cast<int64_t>(numberOfElements) + index);
+                return ( (index != 0) && (resolved >= 0) && (resolved < static_cast<int64_t>(numberOfElements)) ) ? static_cast<int32_t>(resolved) : -1;
+            }
+
+            /**
+             * @return Remainder of the current line without surrounding blanks.
+             */
+            static string getRestOfLine(const char *p, const char *end) {
+                skipBlanks(p, end);
+                const char *lineEnd = p;
+                while ( (lineEnd < end) && (*lineEnd != '\n') ) {
+                    lineEnd++;
+                }
+                while ( (lineEnd > p) && isBlank(*(lineEnd - 1)) ) {
+                    lineEnd--;
+                }
+                return string(p, lineEnd - p);
+            }
+
+            static Point3 parsePoint3(const char *p, const char *end) {
+                float x = 0;
+                float y = 0;
+                float z = 0;
+                parseFloat(p, end, x);
+                parseFloat(p, end, y);
+                parseFloat(p, end, z);
+                return Point3(x, y, z);
+            }
+
+            OBJParser::OBJParser() {}
+
+            void OBJParser::parseOBJ(const char *data, const uint32_t &length, TriangleMesh &mesh) {
+                mesh.clear();
+
+                vector<float> positions;
+                vector<float> normals;
+                vector<float> textureCoordinates;
+                vector<uint32_t> firstVariant;
+                vector<VertexVariant> variants;
+                vector<uint32_t> face;
+                string currentMaterial;
+
+                const char *p = data;
+                const char *end = data + length;
+                while (p < end) {
+                    skipBlanks(p, end);
+                    if (p >= end) {
+                        break;
+                    }
+
+                    if (isKeyword(p, end, "v", 1)) {
+                        p += 1;
+                        float xyz[3] = { 0, 0, 0 };
+                        parseFloat(p, end, xyz[0]);
+                        parseFloat(p, end, xyz[1]);
+                        parseFloat(p, end, xyz[2]);
+                        positions.insert(positions.end(), xyz, xyz + 3);
+                        firstVariant.push_back(NO_VARIANT);
+                    }
+                    else if (isKeyword(p, end, "vn", 2)) {
+                        p += 2;
+                        float xyz[3] = { 0, 0, 0 };
+                        parseFloat(p, end, xyz[0]);
+                        parseFloat(p, end, xyz[1]);
+                        parseFloat(p, end, xyz[2]);
+                        normals.insert(normals.end(), xyz, xyz + 3);
+                    }
+                    else if (isKeyword(p, end, "vt", 2)) {
+                        p += 2;
+                        float xy[2] = { 0, 0 };
+                        parseFloat(p, end, xy[0]);
+                        parseFloat(p, end, xy[1]);
+                        textureCoordinates.insert(textureCoordinates.end(), xy, xy + 2);
+                    }
+                    else if (isKeyword(p, end, "f", 1)) {
+                        p += 1;
+                        face.clear();
+                        bool isValid = true;
+                        while (true) {
+                            skipBlanks(p, end);
+                            if ( (p >= end) || (*p == '\n') ) {
+                                break;
+                            }
+
+                            // Corner formats: v, v/t, v//n, v/t/n.
+                            int32_t v = 0;
+                            int32_t t = 0;
+                            int32_t n = 0;
+                            bool hasCorner = parseIndex(p, end, v);
+                            if ( hasCorner && (p < end) && (*p == '/') ) {
+                                p++;
+                                parseIndex(p, end, t);
+                                if ( (p < end) && (*p == '/') ) {
+                                    p++;
+                                    parseIndex(p, end, n);
+                                }
+                            }
+                            // Skip anything unexpected until the next corner.
+                            while ( (p < end) && !isBlank(*p) && (*p != '\n') ) {
+                                hasCorner = false;
+                                p++;
+                            }
+
+                            const int32_t positionIndex = resolveIndex(v, firstVariant.size());
+                            const int32_t textureCoordinateIndex = (t != 0) ? resolveIndex(t, textureCoordinates.size() / 2) : -1;
+                            const int32_t normalIndex = (n != 0) ? resolveIndex(n, normals.size() / 3) : -1;
+                            if ( !hasCorner || (positionIndex < 0) || ((t != 0) && (textureCoordinateIndex < 0)) || ((n != 0) && (normalIndex < 0)) ) {
+                                isValid = false;
+                                continue;
+                            }
+
+                            // Reuse an existing vertex with the same attributes.
+                            uint32_t variant = firstVariant[positionIndex];
+                            while ( (variant != NO_VARIANT) &&
+                                    ( (variants[variant].m_textureCoordinate != textureCoordinateIndex) ||
+                                      (variants[variant].m_normal != normalIndex) ) ) {
+                                variant = variants[variant].m_next;
+                            }
+                            if (variant == NO_VARIANT) {
+                                VertexVariant vv;
+                                vv.m_textureCoordinate = textureCoordinateIndex;
+                                vv.m_normal = normalIndex;
+                                vv.m_index = mesh.addVertex(&positions[3 * positionIndex],
+                                                            (normalIndex >= 0) ? &normals[3 * normalIndex] : NULL,
+                                                            (textureCoordinateIndex >= 0) ? &textureCoordinates[2 * textureCoordinateIndex] : NULL);
+                                vv.m_next = firstVariant[positionIndex];
+                                variant = variants.size();
+                                variants.push_back(vv);
+                                firstVariant[positionIndex] = variant;
+                            }
+                            face.push_back(variants[variant].m_index);
+                        }
+
+                        if (isValid) {
+                            // Triangulate as fan.
+                            for (uint32_t i = 1; (i + 1) < face.size(); i++) {
+                                mesh.addTriangle(face[0], face[i], face[i + 1]);
+                            }
+                        }
+                        else {
+                            clog << "OBJParser: Skipping invalid face." << endl;
+                        }
+                    }
+                    else if (isKeyword(p, end, "g", 1)) {
+                        mesh.addGroup(currentMaterial);
+                    }
+                    else if (isKeyword(p, end, "usemtl", 6)) {
+                        currentMaterial = getRestOfLine(p + 6, end);
+                        mesh.addGroup(currentMaterial);
+                    }
+
+                    skipLine(p, end);
+                }
+            }
+
+            void OBJParser::parseMTL(const char *data, const uint32_t &length, map<string, Material, odcore::strings::StringComparator> &mapOfMaterials) {
+                Material m;
+                bool hasMaterial = false;
+
+                const char *p = data;
+                const char *end = data + length;
+                while (p < end) {
+                    skipBlanks(p, end);
+                    if (p >= end) {
+                        break;
+                    }
+
+                    if (isKeyword(p, end, "newmtl", 6)) {
+                        // Store previous material description.
+                        if (hasMaterial) {
+                            mapOfMaterials[m.getName()] = m;
+                        }
+
+                        // Start next material description.
+                        m = Material(getRestOfLine(p + 6, end));
+                        hasMaterial = true;
+                    }
+                    else if (isKeyword(p, end, "Ns", 2)) {
+                        const char *q = p + 2;
+                        float s = 0;
+                        if (parseFloat(q, end, s)) {
+                            m.setShininess(s);
+                        }
+                    }
+                    else if (isKeyword(p, end, "Ka", 2)) {
+                        m.setAmbient(parsePoint3(p + 2, end));
+                    }
+                    else if (isKeyword(p, end, "Kd", 2)) {
+                        m.setDiffuse(parsePoint3(p + 2, end));
+                    }
+                    else if (isKeyword(p, end, "Ks", 2)) {
+                        m.setSpecular(parsePoint3(p + 2, end));
+                    }
+                    else if (isKeyword(p, end, "map_Kd", 6)) {
+                        m.setTextureName(getRestOfLine(p + 6, end));
+                    }
+
+                    skipLine(p, end);
+                }
+
+                if (hasMaterial) {
+                    mapOfMaterials[m.getName()] = m;
+                }
+            }
+
+        }
+    }
+} // opendlv::threeD::loaders
@@ -18,6 +18,7 @@
  */
 
 #include <iostream>
+#include <iterator>
 #include <string>
 #include <vector>
 
@@ -76,14 +77,7 @@ namespace opendlv {
                 }
 
                 OBJXArchive *objxArchive = new OBJXArchive();
-
-                char c;
-                stringstream s;
-                while (in.good()) {
-                    in.get(c);
-                    s << c;
-                }
-                objxArchive->setContentsOfObjFile(s.str());
+                objxArchive->setContentsOfObjFile(string((istreambuf_iterator<char>(in)), istreambuf_iterator<char>()));
 
                 return objxArchive;
             }
@@ -100,10 +94,26 @@ namespace opendlv {
                     }
                 }
 
-                OBJXArchive *objxArchive = NULL;
-
                 // Use CompressionFactory to read the contents of the OBJXArchive.
-                std::shared_ptr<odcore::wrapper::DecompressedData> data = odcore::wrapper::CompressionFactory::getContents(in);
+                return getOBJXArchive(odcore::wrapper::CompressionFactory::getContents(in));
+            }
+
+            OBJXArchive* OBJXArchiveFactory::getOBJXArchive(const string &fileName) throw (InvalidArgumentException) {
+                // Use CompressionFactory to read the contents of the memory-mapped OBJXArchive.
+                OBJXArchive *objxArchive = getOBJXArchive(odcore::wrapper::CompressionFactory::getContents(fileName));
+
+                if (objxArchive == NULL) {
+                    OPENDAVINCI_CORE_THROW_EXCEPTION(InvalidArgumentException, "Given file could not be read.");
+                }
+
+                // Store the parsed mesh next to the archive.
+                objxArchive->setMeshCacheFileName(fileName + ".meshcache");
+
+                return objxArchive;
+            }
+
+            OBJXArchive* OBJXArchiveFactory::getOBJXArchive(std::shared_ptr<odcore::wrapper::DecompressedData> data) {
+                OBJXArchive *objxArchive = NULL;
 
                 if (data.get()) {
                     // Create OBJXArchive.
@@ -119,25 +129,13 @@ namespace opendlv {
                             // Set object file.
                             std::shared_ptr<istream> stream = data->getInputStreamFor(entry);
                             if (stream.get()) {
-                                char c;
-                                stringstream s;
-                                while (stream->good()) {
-                                    stream->get(c);
-                                    s << c;
-                                }
-                                objxArchive->setContentsOfObjFile(s.str());
+                                objxArchive->setContentsOfObjFile(string((istreambuf_iterator<char>(*stream)), istreambuf_iterator<char>()));
                             }
                         } else if (entry.find(".mtl") != string::npos) {
                             // Set material file.
                             std::shared_ptr<istream> stream = data->getInputStreamFor(entry);
                             if (stream.get()) {
-                                char c;
-                                stringstream s;
-                                while (stream->good()) {
-                                    stream->get(c);
-                                    s << c;
-                                }
-                                objxArchive->setContentsOfMtlFile(s.str());
+                                objxArchive->setContentsOfMtlFile(string((istreambuf_iterator<char>(*stream)), istreambuf_iterator<char>()));
                             }
                         } else {
                             // Try to load an image.
@@ -0,0 +1,346 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendlv/threeD/models/TriangleMesh.h"
+
+namespace opendlv {
+    namespace threeD {
+        namespace models {
+
+            using namespace std;
+
+            // "ODVM" in little endian byte order; a mismatch indicates a different platform as well.
+            static const uint32_t CACHE_MAGIC = 0x4d56444f;
+
+            static const uint32_t HAS_NORMALS = 0x1;
+            static const uint32_t HAS_TEXTURE_COORDINATES = 0x2;
+
+            static void writeUInt32(string &s, const uint32_t &v) {
+                s.append(reinterpret_cast<const char*>(&v), sizeof(uint32_t));
+            }
+
+            static bool readUInt32(const char *&p, const char *end, uint32_t &v) {
+                if (p + sizeof(uint32_t) > end) {
+                    return false;
+                }
+                memcpy(&v, p, sizeof(uint32_t));
+                p += sizeof(uint32_t);
+                return true;
+            }
+
+            template<typename T>
+            static bool readArray(const char *&p, const char *end, const uint32_t &numberOfElements, vector<T> &v) {
+                const uint64_t length = static_cast<uint64_t>(numberOfElements) * sizeof(T);
+                if (static_cast<uint64_t>(end - p) < length) {
+                    return false;
+                }
+                v.resize(numberOfElements);
+                if (numberOfElements > 0) {
+                    memcpy(&v[0], p, length);
+                }
+                p += length;
+                return true;
+            }
+
+            TriangleMesh::Group::Group() :
+                m_materialName(),
+                m_firstIndex(0),
+                m_numberOfIndices(0) {}
+
+            TriangleMesh::Group::Group(const string &materialName, const uint32_t &firstIndex) :
+                m_materialName(materialName),
+                m_firstIndex(firstIndex),
+                m_numberOfIndices(0) {}
+
+            TriangleMesh::TriangleMesh() :
+                m_positions(),
+                m_normals(),
+                m_textureCoordinates(),
+                m_indices(),
+                m_groups(),
+                m_hasNormals(false),
+                m_hasTextureCoordinates(false) {}
+
+            TriangleMesh::~TriangleMesh() {}
+
+            void TriangleMesh::clear() {
+                m_positions.clear();
+                m_normals.clear();
+                m_textureCoordinates.clear();
+                m_indices.clear();
+                m_groups.clear();
+                m_hasNormals = false;
+                m_hasTextureCoordinates = false;
+            }
+
+            uint32_t TriangleMesh::addVertex(const float *position, const float *normal, const float *textureCoordinate) {
+                const uint32_t index = getNumberOfVertices();
+
+                m_positions.insert(m_positions.end(), position, position + 3);
+
+                if (normal != NULL) {
+                    m_normals.insert(m_normals.end(), normal, normal + 3);
+                    m_hasNormals = true;
+                }
+                else {
+                    m_normals.insert(m_normals.end(), 3, 0.0f);
+                }
+
+                if (textureCoordinate != NULL) {
+                    m_textureCoordinates.insert(m_textureCoordinates.end(), textureCoordinate, textureCoordinate + 2);
+                    m_hasTextureCoordinates = true;
+                }
+                else {
+                    m_textureCoordinates.insert(m_textureCoordinates.end(), 2, 0.0f);
+                }
+
+                return index;
+            }
+
+            void TriangleMesh::addGroup(const string &materialName) {
+                if (!m_groups.empty() && (m_groups.back().m_numberOfIndices == 0)) {
+                    m_groups.back().m_materialName = materialName;
+                }
+                else {
+                    m_groups.push_back(Group(materialName, m_indices.size()));
+                }
+            }
+
+            void TriangleMesh::addTriangle(const uint32_t &a, const uint32_t &b, const uint32_t &c) {
+                if (m_groups.empty()) {
+                    m_groups.push_back(Group("", m_indices.size()));
+                }
+                m_indices.push_back(a);
+                m_indices.push_back(b);
+                m_indices.push_back(c);
+                m_groups.back().m_numberOfIndices += 3;
+            }
+
+            uint32_t TriangleMesh::getNumberOfVertices() const {
+                return m_positions.size() / 3;
+            }
+
+            uint32_t TriangleMesh::getNumberOfTriangles() const {
+                return m_indices.size() / 3;
+            }
+
+            const vector<float>& TriangleMesh::getPositions() const {
+                return m_positions;
+            }
+
+            const vector<float>& TriangleMesh::getNormals() const {
+                return m_normals;
+            }
+
+            const vector<float>& TriangleMesh::getTextureCoordinates() const {
+                return m_textureCoordinates;
+            }
+
+            const vector<uint32_t>& TriangleMesh::getIndices() const {
+                return m_indices;
+            }
+
+            vector<TriangleMesh::Group> TriangleMesh::getGroups() const {
+                vector<Group> listOfGroups;
+                vector<Group>::const_iterator it = m_groups.begin();
+                while (it != m_groups.end()) {
+                    if (it->m_numberOfIndices > 0) {
+                        listOfGroups.push_back(*it);
+                    }
+                    it++;
+                }
+                return listOfGroups;
+            }
+
+            bool TriangleMesh::hasNormals() const {
+                return m_hasNormals;
+            }
+
+            bool TriangleMesh::hasTextureCoordinates() const {
+                return m_hasTextureCoordinates;
+            }
+
+            uint64_t TriangleMesh::getKey(const char *data, const uint32_t &length) {
+                // FNV-1a.
+                const uint64_t FNV_OFFSET_BASIS = (static_cast<uint64_t>(0xcbf29ce4) << 32) | 0x84222325;
+                const uint64_t FNV_PRIME = (static_cast<uint64_t>(0x100) << 32) | 0x000001b3;
+
+                uint64_t hash = FNV_OFFSET_BASIS;
+                for (uint32_t i = 0; i < length; i++) {
+                    hash ^= static_cast<unsigned char>(data[i]);
+                    hash *= FNV_PRIME;
+                }
+                return hash ^ length;
+            }
+
+            bool TriangleMesh::writeCache(const string &fileName, const uint64_t &key) const {
+                const vector<Group> listOfGroups = getGroups();
+
+                string header;
+                writeUInt32(header, CACHE_MAGIC);
+                writeUInt32(header, CACHE_VERSION);
+                writeUInt32(header, static_cast<uint32_t>(key & 0xffffffff));
+                writeUInt32(header, static_cast<uint32_t>(key >> 32));
+                writeUInt32(header, (m_hasNormals ? HAS_NORMALS : 0) | (m_hasTextureCoordinates ? HAS_TEXTURE_COORDINATES : 0));
+                writeUInt32(header, getNumberOfVertices());
+                writeUInt32(header, m_indices.size());
+                writeUInt32(header, listOfGroups.size());
+
+                vector<Group>::const_iterator it = listOfGroups.begin();
+                while (it != listOfGroups.end()) {
+                    writeUInt32(header, it->m_firstIndex);
+                    writeUInt32(header, it->m_numberOfIndices);
+                    writeUInt32(header, it->m_materialName.size());
+                    header.append(it->m_materialName);
+                    it++;
+                }
+
+                // Write to a temporary file first to not expose partially written caches to concurrent readers.
+                const string temporaryFileName = fileName + ".tmp";
+                {
+                    fstream fout(temporaryFileName.c_str(), ios::out | ios::binary | ios::trunc);
+                    if (!fout.good()) {
+                        return false;
+                    }
+
+                    fout.write(header.data(), header.size());
+                    if (!m_positions.empty()) {
+                        fout.write(reinterpret_cast<const char*>(&m_positions[0]), m_positions.size() * sizeof(float));
+                        fout.write(reinterpret_cast<const char*>(&m_normals[0]), m_normals.size() * sizeof(float));
+                        fout.write(reinterpret_cast<const char*>(&m_textureCoordinates[0]), m_textureCoordinates.size() * sizeof(float));
+                    }
+                    if (!m_indices.empty()) {
+                        fout.write(reinterpret_cast<const char*>(&m_indices[0]), m_indices.size() * sizeof(uint32_t));
+                    }
+                    fout.flush();
+                    if (!fout.good()) {
+                        fout.close();
+                        ::remove(temporaryFileName.c_str());
+                        return false;
+                    }
+                }
+
+#ifdef WIN32
+                ::remove(fileName.c_str());
+#endif
+                return (::rename(temporaryFileName.c_str(), fileName.c_str()) == 0);
+            }
+
+            bool TriangleMesh::readCache(const string &fileName, const uint64_t &key) {
+                bool retVal = false;
+#ifdef WIN32
+                fstream fin(fileName.c_str(), ios::in | ios::binary);
+                if (fin.good()) {
+                    const string contents((istreambuf_iterator<char>(fin)), istreambuf_iterator<char>());
+                    retVal = readCache(contents.data(), contents.size(), key);
+                }
+#else
+                const int fd = ::open(fileName.c_str(), O_RDONLY);
+                if (fd >= 0) {
+                    struct stat fileStatus;
+                    if ( (::fstat(fd, &fileStatus) == 0) && (fileStatus.st_size > 0) ) {
+                        void *p = ::mmap(NULL, fileStatus.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                        if (p != MAP_FAILED) {
+                            retVal = readCache(static_cast<const char*>(p), fileStatus.st_size, key);
+                            ::munmap(p, fileStatus.st_size);
+                        }
+                    }
+                    ::close(fd);
+                }
+#endif
+                if (!retVal) {
+                    clear();
+                }
+                return retVal;
+            }
+
+            bool TriangleMesh::readCache(const char *data, const uint32_t &length, const uint64_t &key) {
+                const char *p = data;
+                const char *end = data + length;
+
+                uint32_t magic = 0;
+                uint32_t version = 0;
+                uint32_t keyLow = 0;
+                uint32_t keyHigh = 0;
+                uint32_t flags = 0;
+                uint32_t numberOfVertices = 0;
+                uint32_t numberOfIndices = 0;
+                uint32_t numberOfGroups = 0;
+                if ( !readUInt32(p, end, magic) || (magic != CACHE_MAGIC) ||
+                     !readUInt32(p, end, version) || (version != CACHE_VERSION) ||
+                     !readUInt32(p, end, keyLow) || !readUInt32(p, end, keyHigh) ||
+                     (((static_cast<uint64_t>(keyHigh) << 32) | keyLow) != key) ||
+                     !readUInt32(p, end, flags) ||
+                     !readUInt32(p, end, numberOfVertices) ||
+                     !readUInt32(p, end, numberOfIndices) ||
+                     !readUInt32(p, end, numberOfGroups) ) {
+                    return false;
+                }
+
+                clear();
+                for (uint32_t i = 0; i < numberOfGroups; i++) {
+                    Group g;
+                    uint32_t lengthOfName = 0;
+                    if ( !readUInt32(p, end, g.m_firstIndex) || !readUInt32(p, end, g.m_numberOfIndices) ||
+                         !readUInt32(p, end, lengthOfName) || (static_cast<uint32_t>(end - p) < lengthOfName) ||
+                         (static_cast<uint64_t>(g.m_firstIndex) + g.m_numberOfIndices > numberOfIndices) ) {
+                        return false;
+                    }
+                    g.m_materialName = string(p, lengthOfName);
+                    p += lengthOfName;
+                    m_groups.push_back(g);
+                }
+
+                if ( !readArray(p, end, numberOfVertices * 3, m_positions) ||
+                     !readArray(p, end, numberOfVertices * 3, m_normals) ||
+                     !readArray(p, end, numberOfVertices * 2, m_textureCoordinates) ||
+                     !readArray(p, end, numberOfIndices, m_indices) ) {
+                    return false;
+                }
+
+                // Reject corrupt indices before they reach the graphics driver.
+                for (uint32_t i = 0; i < numberOfIndices; i++) {
+                    if (m_indices[i] >= numberOfVertices) {
+                        return false;
+                    }
+                }
+
+                m_hasNormals = ((flags & HAS_NORMALS) != 0);
+                m_hasTextureCoordinates = ((flags & HAS_TEXTURE_COORDINATES) != 0);
+                return true;
+            }
+
+        }
+    }
+} // opendlv::threeD::models
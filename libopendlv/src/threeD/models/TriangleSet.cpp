@@ -28,6 +28,7 @@
     #include <GL/gl.h>
 #endif
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -39,6 +40,7 @@
 #include "opendlv/threeD/NodeRenderingConfiguration.h"
 #include "opendlv/threeD/RenderingConfiguration.h"
 #include "opendlv/threeD/models/Triangle.h"
+#include "opendlv/threeD/models/TriangleMesh.h"
 #include "opendlv/threeD/models/TriangleSet.h"
 
 namespace opendlv {
@@ -54,7 +56,9 @@ namespace opendlv {
                     m_material(),
                     m_vertices(),
                     m_normals(),
-                    m_textureCoordinates() {}
+                    m_textureCoordinates(),
+                    m_mesh(),
+                    m_group() {}
 
             TriangleSet::TriangleSet(const NodeDescriptor &nodeDescriptor) :
                     Node(nodeDescriptor),
@@ -63,7 +67,20 @@ namespace opendlv {
                     m_material(),
                     m_vertices(),
                     m_normals(),
-                    m_textureCoordinates() {}
+                    m_textureCoordinates(),
+                    m_mesh(),
+                    m_group() {}
+
+            TriangleSet::TriangleSet(const NodeDescriptor &nodeDescriptor, std::shared_ptr<TriangleMesh> mesh, const TriangleMesh::Group &group) :
+                    Node(nodeDescriptor),
+                    m_compiled(false),
+                    m_callList(0),
+                    m_material(),
+                    m_vertices(),
+                    m_normals(),
+                    m_textureCoordinates(),
+                    m_mesh(mesh),
+                    m_group(group) {}
 
             TriangleSet::TriangleSet(const TriangleSet &obj) :
                     Node(obj.getNodeDescriptor()),
@@ -72,7 +89,9 @@ namespace opendlv {
                     m_material(obj.m_material),
                     m_vertices(obj.m_vertices),
                     m_normals(obj.m_normals),
-                    m_textureCoordinates(obj.m_textureCoordinates) {}
+                    m_textureCoordinates(obj.m_textureCoordinates),
+                    m_mesh(obj.m_mesh),
+                    m_group(obj.m_group) {}
 
             TriangleSet::~TriangleSet() {}
 
@@ -84,6 +103,8 @@ namespace opendlv {
                 m_vertices = obj.m_vertices;
                 m_normals = obj.m_normals;
                 m_textureCoordinates = obj.m_textureCoordinates;
+                m_mesh = obj.m_mesh;
+                m_group = obj.m_group;
 
                 return (*this);
             }
@@ -106,6 +127,32 @@ namespace opendlv {
                 m_callList = glGenLists(1);
                 glNewList(m_callList, GL_COMPILE);
 
+                if (m_mesh.get() != NULL) {
+                    // Vertex arrays are dereferenced while compiling the list.
+                    if ( (m_group.m_numberOfIndices > 0) && (m_group.m_firstIndex + m_group.m_numberOfIndices <= m_mesh->getIndices().size()) ) {
+                        glEnableClientState(GL_VERTEX_ARRAY);
+                        glVertexPointer(3, GL_FLOAT, 0, &m_mesh->getPositions()[0]);
+                        if (m_mesh->hasNormals()) {
+                            glEnableClientState(GL_NORMAL_ARRAY);
+                            glNormalPointer(GL_FLOAT, 0, &m_mesh->getNormals()[0]);
+                        }
+                        if (m_mesh->hasTextureCoordinates()) {
+                            glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+                            glTexCoordPointer(2, GL_FLOAT, 0, &m_mesh->getTextureCoordinates()[0]);
+                        }
+
+                        glDrawElements(GL_TRIANGLES, m_group.m_numberOfIndices, GL_UNSIGNED_INT, &m_mesh->getIndices()[m_group.m_firstIndex]);
+
+                        glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+                        glDisableClientState(GL_NORMAL_ARRAY);
+                        glDisableClientState(GL_VERTEX_ARRAY);
+                    }
+
+                    glEndList();
+                    m_compiled = true;
+                    return;
+                }
+
                 uint32_t normalIndexCounter = 0;
                 glBegin(GL_TRIANGLES);
                 for (uint32_t i = 0; i < m_vertices.size(); i++) {
@@ -0,0 +1,223 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_COMPACTGRAPHTESTSUITE_H_
+#define HESPERIA_COMPACTGRAPHTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "opendavinci/odcore/data/TimeStamp.h"
+#include "opendlv/core/wrapper/graph/CompactGraph.h"
+#include "opendlv/core/wrapper/graph/DirectedGraph.h"
+#include "opendlv/data/environment/Point3.h"
+#include "opendlv/data/graph/WaypointIndex.h"
+#include "opendlv/data/graph/WaypointVertex.h"
+#include "opendlv/data/graph/WaypointsEdge.h"
+
+using namespace std;
+using namespace core::wrapper::graph;
+using namespace odcore::data;
+using namespace opendlv::data::environment;
+using namespace opendlv::data::graph;
+
+class CompactGraphTest : public CxxTest::TestSuite {
+    public:
+        // Creates a grid of SIZE x SIZE waypoints with 10m distance connected in both directions; lane 1 is one-way.
+        vector<WaypointVertex*> createGrid(DirectedGraph &g, const uint32_t &SIZE) {
+            vector<WaypointVertex*> vertices;
+            for (uint32_t row = 0; row < SIZE; row++) {
+                for (uint32_t column = 0; column < SIZE; column++) {
+                    WaypointVertex *v = new WaypointVertex();
+                    v->setLayerID(1);
+                    v->setRoadID(1);
+                    v->setLaneID(row + 1);
+                    v->setWaypointID(column + 1);
+                    v->setPosition(Point3(column * 10.0, row * 10.0, 0));
+                    vertices.push_back(v);
+                    g.addVertex(v);
+                }
+            }
+
+            for (uint32_t row = 0; row < SIZE; row++) {
+                for (uint32_t column = 0; column < SIZE; column++) {
+                    WaypointVertex *v = vertices[row * SIZE + column];
+                    if (column + 1 < SIZE) {
+                        addEdge(g, v, vertices[row * SIZE + column + 1]);
+                        if (row > 0) {
+                            addEdge(g, vertices[row * SIZE + column + 1], v);
+                        }
+                    }
+                    if (row + 1 < SIZE) {
+                        addEdge(g, v, vertices[(row + 1) * SIZE + column]);
+                        addEdge(g, vertices[(row + 1) * SIZE + column], v);
+                    }
+                }
+            }
+            return vertices;
+        }
+
+        void addEdge(DirectedGraph &g, const WaypointVertex *v1, const WaypointVertex *v2) {
+            WaypointsEdge *e = new WaypointsEdge();
+            e->setCosts(v1->getPosition().getXYDistanceTo(v2->getPosition()));
+            g.updateEdge(v1, v2, e);
+        }
+
+        double getLength(const vector<const Vertex*> &route) {
+            double length = 0;
+            for (uint32_t i = 1; i < route.size(); i++) {
+                length += dynamic_cast<const WaypointVertex*>(route[i - 1])->getPosition().getXYDistanceTo(dynamic_cast<const WaypointVertex*>(route[i])->getPosition());
+            }
+            return length;
+        }
+
+        void testCompactGraph() {
+            const uint32_t SIZE = 10;
+            DirectedGraph g;
+            vector<WaypointVertex*> vertices = createGrid(g, SIZE);
+
+            CompactGraph cg(g);
+            TS_ASSERT(cg.getNumberOfVertices() == SIZE * SIZE);
+            TS_ASSERT(cg.getNumberOfEdges() == 4 * SIZE * (SIZE - 1) - (SIZE - 1));
+            for (uint32_t i = 0; i < vertices.size(); i++) {
+                TS_ASSERT(cg.getIndex(*vertices[i]) >= 0);
+                TS_ASSERT(cg.getVertex(cg.getIndex(*vertices[i])) == vertices[i]);
+            }
+
+            WaypointVertex unknown;
+            unknown.setLayerID(2);
+            TS_ASSERT(cg.getIndex(unknown) == -1);
+            TS_ASSERT(cg.getVertex(SIZE * SIZE) == NULL);
+
+            // Compare with the Boost-based implementation.
+            CompactGraph::Workspace ws(cg);
+            vector<const Vertex*> route;
+            TS_ASSERT(cg.getShortestPath(*vertices[0], *vertices[SIZE * SIZE - 1], ws, route));
+            vector<const Vertex*> reference = g.getShortestPath(*vertices[0], *vertices[SIZE * SIZE - 1]);
+            TS_ASSERT(route.size() == reference.size());
+            TS_ASSERT(route.front() == vertices[0]);
+            TS_ASSERT(route.back() == vertices[SIZE * SIZE - 1]);
+            TS_ASSERT_DELTA(getLength(route), getLength(reference), 1e-9);
+            TS_ASSERT_DELTA(getLength(route), 2 * (SIZE - 1) * 10.0, 1e-9);
+
+            // Lane 1 is one-way; thus, going back needs a detour via lane 2.
+            TS_ASSERT(cg.getShortestPath(*vertices[SIZE - 1], *vertices[0], ws, route));
+            TS_ASSERT_DELTA(getLength(route), (SIZE + 1) * 10.0, 1e-9);
+
+            // Same vertex.
+            TS_ASSERT(cg.getShortestPath(*vertices[5], *vertices[5], ws, route));
+            TS_ASSERT(route.size() == 1);
+
+            // Unknown vertex.
+            TS_ASSERT(!cg.getShortestPath(*vertices[5], unknown, ws, route));
+            TS_ASSERT(route.empty());
+
+            // Several queries reuse the same workspace.
+            vector<uint32_t> indices;
+            for (uint32_t i = 0; i < 100; i++) {
+                const uint32_t from = (i * 7) % (SIZE * SIZE);
+                const uint32_t to = (i * 13 + 5) % (SIZE * SIZE);
+                TS_ASSERT(cg.getShortestPath(from, to, ws, indices));
+                TS_ASSERT(indices.front() == from);
+                TS_ASSERT(indices.back() == to);
+            }
+        }
+
+        void testUnreachableVertex() {
+            DirectedGraph g;
+            WaypointVertex *v1 = new WaypointVertex();
+            v1->setWaypointID(1);
+            WaypointVertex *v2 = new WaypointVertex();
+            v2->setWaypointID(2);
+            v2->setPosition(Point3(10, 0, 0));
+            addEdge(g, v1, v2);
+
+            CompactGraph cg(g);
+            CompactGraph::Workspace ws(cg);
+            vector<const Vertex*> route;
+            TS_ASSERT(cg.getShortestPath(*v1, *v2, ws, route));
+            TS_ASSERT(route.size() == 2);
+            TS_ASSERT(!cg.getShortestPath(*v2, *v1, ws, route));
+            TS_ASSERT(route.empty());
+        }
+
+        void testWaypointIndex() {
+            const uint32_t SIZE = 20;
+            DirectedGraph g;
+            vector<WaypointVertex*> vertices = createGrid(g, SIZE);
+            CompactGraph cg(g);
+
+            WaypointIndex index(cg, 15);
+            TS_ASSERT(index.getSize() == SIZE * SIZE);
+
+            for (int32_t i = -50; i < 250; i += 7) {
+                for (int32_t j = -50; j < 250; j += 11) {
+                    const Point3 p(i + 0.3, j + 0.1, 0);
+
+                    double minimumDistance = 1e10;
+                    for (uint32_t k = 0; k < vertices.size(); k++) {
+                        minimumDistance = min(minimumDistance, p.getXYDistanceTo(vertices[k]->getPosition()));
+                    }
+
+                    const int32_t nearest = index.findNearest(p);
+                    TS_ASSERT(nearest >= 0);
+                    const WaypointVertex *v = dynamic_cast<const WaypointVertex*>(cg.getVertex(nearest));
+                    TS_ASSERT(v != NULL);
+                    TS_ASSERT_DELTA(p.getXYDistanceTo(v->getPosition()), minimumDistance, 1e-9);
+                }
+            }
+
+            DirectedGraph empty;
+            CompactGraph emptyCG(empty);
+            WaypointIndex emptyIndex(emptyCG, 10);
+            TS_ASSERT(emptyIndex.findNearest(Point3(0, 0, 0)) == -1);
+        }
+
+        void testCompactGraphBenchmark() {
+            const uint32_t SIZE = 60;
+            const uint32_t QUERIES = 200;
+            DirectedGraph g;
+            vector<WaypointVertex*> vertices = createGrid(g, SIZE);
+
+            CompactGraph cg(g);
+            CompactGraph::Workspace ws(cg);
+            WaypointIndex index(cg, 10);
+
+            vector<uint32_t> route;
+            TimeStamp before;
+            uint32_t found = 0;
+            for (uint32_t i = 0; i < QUERIES; i++) {
+                const int32_t from = index.findNearest(Point3((i * 37) % (SIZE * 10), (i * 53) % (SIZE * 10), 0));
+                const int32_t to = index.findNearest(Point3((i * 91) % (SIZE * 10), (i * 17) % (SIZE * 10), 0));
+                if (cg.getShortestPath(from, to, ws, route)) {
+                    found++;
+                }
+            }
+            TimeStamp after;
+
+            TS_ASSERT(found == QUERIES);
+            cout << endl << "CompactGraph: " << cg.getNumberOfVertices() << " vertices, " << cg.getNumberOfEdges() << " edges: "
+                 << (after - before).toMicroseconds() / QUERIES << "us per snapped route query." << endl;
+        }
+};
+
+#endif /*HESPERIA_COMPACTGRAPHTESTSUITE_H_*/
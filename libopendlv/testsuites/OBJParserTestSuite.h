@@ -0,0 +1,200 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_OBJPARSERTESTSUITE_H_
+#define HESPERIA_OBJPARSERTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <cstdio>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "opendavinci/odcore/data/TimeStamp.h"
+#include "opendavinci/odcore/strings/StringComparator.h"
+#include "opendlv/threeD/Material.h"
+#include "opendlv/threeD/loaders/OBJParser.h"
+#include "opendlv/threeD/models/TriangleMesh.h"
+
+using namespace std;
+using namespace odcore::data;
+using namespace opendlv::threeD;
+using namespace opendlv::threeD::loaders;
+using namespace opendlv::threeD::models;
+
+class OBJParserTest : public CxxTest::TestSuite {
+    private:
+        // Create a regular grid of size x size quads with normals and texture coordinates.
+        string createGrid(const uint32_t &size) {
+            stringstream s;
+            s << "# Grid" << endl << "mtllib grid.mtl" << endl;
+            for (uint32_t y = 0; y <= size; y++) {
+                for (uint32_t x = 0; x <= size; x++) {
+                    s << "v " << x * 0.125 << " " << y * -0.25 << " " << (x + y) * 1.5e-3 << endl;
+                    s << "vt " << static_cast<double>(x) / size << " " << static_cast<double>(y) / size << endl;
+                }
+            }
+            s << "vn 0 0 1" << endl;
+            s << "g grid" << endl << "usemtl Ground" << endl;
+            for (uint32_t y = 0; y < size; y++) {
+                for (uint32_t x = 0; x < size; x++) {
+                    const uint32_t a = y * (size + 1) + x + 1;
+                    const uint32_t b = a + 1;
+                    const uint32_t c = a + size + 2;
+                    const uint32_t d = a + size + 1;
+                    s << "f " << a << "/" << a << "/1 " << b << "/" << b << "/1 " << c << "/" << c << "/1 " << d << "/" << d << "/1" << endl;
+                }
+            }
+            return s.str();
+        }
+
+    public:
+        void testParseFaceFormats() {
+            const string obj = "# Test\r\n"
+                               "v 0 0 0\r\n"
+                               "v 1.5 0 0\n"
+                               "v 1 1 -2.5e1\n"
+                               "  v 0 1 0\n"
+                               "vt 0 0\n"
+                               "vt 1 0\n"
+                               "vt 1 1\n"
+                               "vn 0 0 1\n"
+                               "f 1 2 3\n"
+                               "g second\n"
+                               "usemtl Red\n"
+                               "f 1//1 2//1 3//1\n"
+                               "f 1/1 2/2 3/3\n"
+                               "usemtl Blue\r\n"
+                               "f 1/1/1 2/2/1 3/3/1 4/3/1\n"
+                               "f -4/-3/-1 -3/-2/-1 -2/-1/-1\n"
+                               "f 1 2 7\n";
+
+            TriangleMesh mesh;
+            OBJParser::parseOBJ(obj.data(), obj.length(), mesh);
+
+            // Quad is triangulated and the invalid face is skipped.
+            TS_ASSERT(mesh.getNumberOfTriangles() == 6);
+            TS_ASSERT(mesh.hasNormals());
+            TS_ASSERT(mesh.hasTextureCoordinates());
+
+            // Vertices: 1,2,3 (plain); 1,2,3 (normal); 1,2,3 (texture); 1,2,3,4 (both).
+            TS_ASSERT(mesh.getNumberOfVertices() == 13);
+            TS_ASSERT_DELTA(mesh.getPositions()[3], 1.5, 1e-6);
+            TS_ASSERT_DELTA(mesh.getPositions()[8], -25, 1e-6);
+
+            const vector<uint32_t> &indices = mesh.getIndices();
+            // Relative indices refer to the same vertices as the absolute ones of the quad.
+            TS_ASSERT(indices[15] == indices[9]);
+            TS_ASSERT(indices[16] == indices[10]);
+            TS_ASSERT(indices[17] == indices[11]);
+
+            vector<TriangleMesh::Group> groups = mesh.getGroups();
+            TS_ASSERT(groups.size() == 3);
+            TS_ASSERT(groups[0].m_materialName == "");
+            TS_ASSERT(groups[0].m_numberOfIndices == 3);
+            TS_ASSERT(groups[1].m_materialName == "Red");
+            TS_ASSERT(groups[1].m_firstIndex == 3);
+            TS_ASSERT(groups[1].m_numberOfIndices == 6);
+            TS_ASSERT(groups[2].m_materialName == "Blue");
+            TS_ASSERT(groups[2].m_numberOfIndices == 9);
+        }
+
+        void testParseMaterials() {
+            const string mtl = "newmtl Red\r\n"
+                               "Ns 96.078431\n"
+                               "Ka 0.1 0.2 0.3\n"
+                               "Kd 0.640000 0.000000 0.000000\n"
+                               "Ks 0.5 0.5 0.5\n"
+                               "\n"
+                               "newmtl Textured\n"
+                               "map_Kd  Texture.png \r\n";
+
+            map<string, Material, odcore::strings::StringComparator> mapOfMaterials;
+            OBJParser::parseMTL(mtl.data(), mtl.length(), mapOfMaterials);
+
+            TS_ASSERT(mapOfMaterials.size() == 2);
+            TS_ASSERT_DELTA(mapOfMaterials["Red"].getShininess(), 96.078431, 1e-4);
+            TS_ASSERT_DELTA(mapOfMaterials["Red"].getAmbient().getY(), 0.2, 1e-6);
+            TS_ASSERT_DELTA(mapOfMaterials["Red"].getDiffuse().getX(), 0.64, 1e-6);
+            TS_ASSERT_DELTA(mapOfMaterials["Red"].getSpecular().getZ(), 0.5, 1e-6);
+            TS_ASSERT(mapOfMaterials["Textured"].getTextureName() == "Texture.png");
+        }
+
+        void testMeshCache() {
+            const string obj = createGrid(10);
+            TriangleMesh mesh;
+            OBJParser::parseOBJ(obj.data(), obj.length(), mesh);
+            TS_ASSERT(mesh.getNumberOfTriangles() == 200);
+            TS_ASSERT(mesh.getNumberOfVertices() == 121);
+
+            const uint64_t key = TriangleMesh::getKey(obj.data(), obj.length());
+            TS_ASSERT(mesh.writeCache("OBJParserTest.meshcache", key));
+
+            TriangleMesh cached;
+            TS_ASSERT(cached.readCache("OBJParserTest.meshcache", key));
+            TS_ASSERT(cached.getPositions() == mesh.getPositions());
+            TS_ASSERT(cached.getNormals() == mesh.getNormals());
+            TS_ASSERT(cached.getTextureCoordinates() == mesh.getTextureCoordinates());
+            TS_ASSERT(cached.getIndices() == mesh.getIndices());
+            TS_ASSERT(cached.hasNormals() && cached.hasTextureCoordinates());
+            TS_ASSERT(cached.getGroups().size() == 1);
+            TS_ASSERT(cached.getGroups()[0].m_materialName == "Ground");
+
+            // Outdated cache.
+            TriangleMesh outdated;
+            TS_ASSERT(!outdated.readCache("OBJParserTest.meshcache", key + 1));
+            TS_ASSERT(outdated.getNumberOfVertices() == 0);
+
+            // Missing cache.
+            TS_ASSERT(!outdated.readCache("OBJParserTest.missing", key));
+
+            remove("OBJParserTest.meshcache");
+        }
+
+        void testOBJParserBenchmark() {
+            const uint32_t SIZE = 300;
+            const string obj = createGrid(SIZE);
+
+            TimeStamp before;
+            TriangleMesh mesh;
+            OBJParser::parseOBJ(obj.data(), obj.length(), mesh);
+            TimeStamp afterParsing;
+
+            const uint64_t key = TriangleMesh::getKey(obj.data(), obj.length());
+            TS_ASSERT(mesh.writeCache("OBJParserBenchmark.meshcache", key));
+            TimeStamp beforeReading;
+            TriangleMesh cached;
+            TS_ASSERT(cached.readCache("OBJParserBenchmark.meshcache", key));
+            TimeStamp afterReading;
+
+            TS_ASSERT(mesh.getNumberOfTriangles() == 2 * SIZE * SIZE);
+            TS_ASSERT(cached.getIndices() == mesh.getIndices());
+
+            cout << endl << "OBJParser: " << obj.length() / 1024 << "kB, " << mesh.getNumberOfTriangles() << " triangles: "
+                 << "parsing " << (afterParsing - before).toMicroseconds() / 1000 << "ms, "
+                 << "mesh cache " << (afterReading - beforeReading).toMicroseconds() / 1000 << "ms." << endl;
+
+            remove("OBJParserBenchmark.meshcache");
+        }
+};
+
+#endif /*HESPERIA_OBJPARSERTESTSUITE_H_*/
@@ -0,0 +1,165 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_POINTSENSORTESTSUITE_H_
+#define HESPERIA_POINTSENSORTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <vector>
+
+#include "opendavinci/odcore/data/TimeStamp.h"
+#include "automotivedata/generated/cartesian/Constants.h"
+#include "opendlv/data/environment/Point3.h"
+#include "opendlv/data/environment/Polygon.h"
+#include "opendlv/vehiclecontext/model/PointSensor.h"
+#include "opendlv/vehiclecontext/model/PolygonIndex.h"
+
+using namespace std;
+using namespace odcore::data;
+using namespace opendlv::data::environment;
+using namespace opendlv::vehiclecontext::model;
+
+class PointSensorTest : public CxxTest::TestSuite {
+    private:
+        Polygon createSquare(const double &x, const double &y, const double &size) {
+            Polygon p;
+            p.add(Point3(x, y, 0));
+            p.add(Point3(x + size, y, 0));
+            p.add(Point3(x + size, y + size, 0));
+            p.add(Point3(x, y + size, 0));
+            return p;
+        }
+
+        // Place numberOfPolygons squares on a regular grid with 20m spacing.
+        void createScene(const uint32_t &numberOfPolygons, map<uint32_t, Polygon> &mapOfPolygons, PolygonIndex &polygonIndex) {
+            const uint32_t side = static_cast<uint32_t>(ceil(sqrt(static_cast<double>(numberOfPolygons))));
+            for (uint32_t i = 0; i < numberOfPolygons; i++) {
+                const double x = (i % side) * 20.0 - side * 10.0 + 5.0;
+                const double y = (i / side) * 20.0 - side * 10.0 + 5.0;
+                Polygon p = createSquare(x, y, 3.0);
+                mapOfPolygons[i] = p;
+                polygonIndex.add(p);
+            }
+        }
+
+    public:
+        void testPolygonIndexReturnsOverlappingPolygonsOnlyOnce() {
+            PolygonIndex polygonIndex(5);
+            polygonIndex.add(createSquare(0, 0, 1));
+            polygonIndex.add(createSquare(12, 12, 12));
+            polygonIndex.add(createSquare(-100, -100, 1));
+            // Large polygon covering many cells.
+            polygonIndex.add(createSquare(-1000, -1000, 2000));
+            TS_ASSERT(polygonIndex.getSize() == 4);
+
+            vector<const Polygon*> candidates;
+            polygonIndex.getCandidates(createSquare(-1, -1, 15), candidates);
+            TS_ASSERT(candidates.size() == 3);
+
+            candidates.clear();
+            polygonIndex.getCandidates(createSquare(-101, -101, 2), candidates);
+            TS_ASSERT(candidates.size() == 2);
+
+            candidates.clear();
+            polygonIndex.getCandidates(createSquare(5000, 5000, 1), candidates);
+            TS_ASSERT(candidates.size() == 0);
+
+            // Query area larger than all occupied cells.
+            candidates.clear();
+            polygonIndex.getCandidates(createSquare(-10000, -10000, 20000), candidates);
+            TS_ASSERT(candidates.size() == 4);
+
+            polygonIndex.clear();
+            candidates.clear();
+            polygonIndex.getCandidates(createSquare(-10000, -10000, 20000), candidates);
+            TS_ASSERT(polygonIndex.getSize() == 0);
+            TS_ASSERT(candidates.size() == 0);
+        }
+
+        void testPointSensorDistanceWithPolygonIndexEqualsFullIteration() {
+            map<uint32_t, Polygon> mapOfPolygons;
+            PolygonIndex polygonIndex(40);
+            createScene(400, mapOfPolygons, polygonIndex);
+
+            PointSensor ps(0, "front", Point3(2, 0, 0), 0, 30, 40, 39, false, 0, 0);
+
+            uint32_t hits = 0;
+            for (int32_t i = 0; i < 72; i++) {
+                Point3 rotation(1, 0, 0);
+                rotation.rotateZ(i * 5 * cartesian::Constants::DEG2RAD);
+                ps.updateFOV(Point3(i, -i, 0), rotation);
+
+                const double expected = ps.getDistance(mapOfPolygons);
+                const double actual = ps.getDistance(polygonIndex);
+                TS_ASSERT_DELTA(actual, expected, 1e-9);
+                if (expected > 0) {
+                    hits++;
+                }
+            }
+            TS_ASSERT(hits > 0);
+        }
+
+        void testPointSensorBenchmarkAgainstNumberOfPolygons() {
+            const uint32_t NUMBER_OF_SENSORS = 12;
+            const uint32_t NUMBER_OF_STEPS = 5;
+
+            for (uint32_t numberOfPolygons = 100; numberOfPolygons <= 10000; numberOfPolygons *= 10) {
+                map<uint32_t, Polygon> mapOfPolygons;
+                PolygonIndex polygonIndex(40);
+                createScene(numberOfPolygons, mapOfPolygons, polygonIndex);
+
+                vector<PointSensor*> sensors;
+                for (uint32_t i = 0; i < NUMBER_OF_SENSORS; i++) {
+                    sensors.push_back(new PointSensor(i, "sensor", Point3(1, 0, 0), i * (360.0 / NUMBER_OF_SENSORS), 30, 40, 39, false, 0, 0));
+                }
+
+                long durationFullIteration = 0;
+                long durationPolygonIndex = 0;
+                for (uint32_t step = 0; step < NUMBER_OF_STEPS; step++) {
+                    for (uint32_t i = 0; i < NUMBER_OF_SENSORS; i++) {
+                        sensors[i]->updateFOV(Point3(step, step * 0.5, 0), Point3(1, 0, 0));
+
+                        TimeStamp before;
+                        const double d1 = sensors[i]->getDistance(mapOfPolygons);
+                        TimeStamp middle;
+                        const double d2 = sensors[i]->getDistance(polygonIndex);
+                        TimeStamp after;
+
+                        TS_ASSERT_DELTA(d1, d2, 1e-9);
+                        durationFullIteration += (middle - before).toMicroseconds();
+                        durationPolygonIndex += (after - middle).toMicroseconds();
+                    }
+                }
+
+                cout << endl << "PointSensor: " << numberOfPolygons << " polygons, " << NUMBER_OF_SENSORS << " sensors, per step: "
+                     << "full iteration " << durationFullIteration / NUMBER_OF_STEPS << "us, "
+                     << "polygon index " << durationPolygonIndex / NUMBER_OF_STEPS << "us." << endl;
+
+                for (uint32_t i = 0; i < NUMBER_OF_SENSORS; i++) {
+                    delete sensors[i];
+                }
+            }
+        }
+};
+
+#endif /*HESPERIA_POINTSENSORTESTSUITE_H_*/
@@ -528,6 +528,99 @@ class WGS84CoordinateTest : public CxxTest::TestSuite {
             }
         }
 
+        void testBatchTransformationAgainstScalar() {
+            WGS84Coordinate reference(52.247041, WGS84Coordinate::NORTH, 10.575830, WGS84Coordinate::EAST);
+
+            // Grid of +/-0.5deg around the reference including the equator and a pole.
+            vector<WGS84Coordinate> coordinates;
+            for (int32_t i = -25; i <= 25; i++) {
+                for (int32_t j = -25; j <= 25; j++) {
+                    coordinates.push_back(WGS84Coordinate(52.247041 + i * 0.02, WGS84Coordinate::NORTH, 10.575830 + j * 0.02, WGS84Coordinate::EAST));
+                }
+            }
+            coordinates.push_back(WGS84Coordinate(0, WGS84Coordinate::NORTH, 10.575830, WGS84Coordinate::EAST));
+            coordinates.push_back(WGS84Coordinate(90, WGS84Coordinate::NORTH, 10.575830, WGS84Coordinate::EAST));
+
+            vector<Point3> result;
+            reference.transform(coordinates, result);
+            TS_ASSERT(result.size() == coordinates.size());
+
+            for (uint32_t i = 0; i < coordinates.size(); i++) {
+                Point3 p = reference.transform(coordinates.at(i));
+                TS_ASSERT_DELTA(result.at(i).getX(), p.getX(), 1e-3);
+                TS_ASSERT_DELTA(result.at(i).getY(), p.getY(), 1e-3);
+                TS_ASSERT_DELTA(result.at(i).getZ(), 0, 1e-9);
+            }
+        }
+
+        void testBatchInverseTransformation() {
+            WGS84Coordinate reference(52.247041, WGS84Coordinate::NORTH, 10.575830, WGS84Coordinate::EAST);
+
+            vector<Point3> points;
+            for (int32_t i = -20; i <= 20; i++) {
+                for (int32_t j = -20; j <= 20; j++) {
+                    points.push_back(Point3(i * 500.0, j * 500.0, 0));
+                }
+            }
+
+            vector<WGS84Coordinate> coordinates;
+            reference.transform(points, coordinates, 1e-4);
+            TS_ASSERT(coordinates.size() == points.size());
+
+            // Round trip to millimetre accuracy.
+            vector<Point3> result;
+            reference.transform(coordinates, result);
+            for (uint32_t i = 0; i < points.size(); i++) {
+                TS_ASSERT_DELTA(result.at(i).getX(), points.at(i).getX(), 1e-3);
+                TS_ASSERT_DELTA(result.at(i).getY(), points.at(i).getY(), 1e-3);
+            }
+
+            // Agreement with the scalar inverse transformation within its accuracy.
+            WGS84Coordinate w = reference.transform(Point3(-154.48, 441.75, 0));
+            vector<Point3> p(1, Point3(-154.48, 441.75, 0));
+            reference.transform(p, coordinates, 1e-4);
+            TS_ASSERT(coordinates.size() == 1);
+            TS_ASSERT_DELTA(coordinates.at(0).getLatitude(), w.getLatitude(), 1e-4);
+            TS_ASSERT_DELTA(coordinates.at(0).getLongitude(), w.getLongitude(), 1e-4);
+        }
+
+        void testBatchTransformationBenchmark() {
+            const uint32_t SIZE = 100000;
+            WGS84Coordinate reference(52.247041, WGS84Coordinate::NORTH, 10.575830, WGS84Coordinate::EAST);
+
+            vector<WGS84Coordinate> coordinates;
+            coordinates.reserve(SIZE);
+            for (uint32_t i = 0; i < SIZE; i++) {
+                coordinates.push_back(WGS84Coordinate(52.247041 + (i % 1000) * 1e-4, WGS84Coordinate::NORTH, 10.575830 + (i / 1000) * 1e-4, WGS84Coordinate::EAST));
+            }
+
+            TimeStamp before;
+            double sum = 0;
+            for (uint32_t i = 0; i < SIZE; i++) {
+                sum += reference.transform(coordinates[i]).getX();
+            }
+            TimeStamp afterScalar;
+            vector<Point3> result;
+            reference.transform(coordinates, result);
+            TimeStamp afterBatch;
+
+            vector<WGS84Coordinate> inverse;
+            reference.transform(result, inverse, 1e-3);
+            TimeStamp afterInverse;
+
+            TS_ASSERT(result.size() == SIZE);
+            TS_ASSERT(inverse.size() == SIZE);
+            TS_ASSERT(sum > 0);
+
+            const double scalar = (afterScalar - before).toMicroseconds();
+            const double batch = (afterBatch - afterScalar).toMicroseconds();
+            const double batchInverse = (afterInverse - afterBatch).toMicroseconds();
+            cout << endl << "WGS84Coordinate: " << SIZE << " points: "
+                 << "scalar " << static_cast<uint64_t>(SIZE / (scalar + 1) * 1e6) << " points/s, "
+                 << "batch " << static_cast<uint64_t>(SIZE / (batch + 1) * 1e6) << " points/s, "
+                 << "batch inverse " << static_cast<uint64_t>(SIZE / (batchInverse + 1) * 1e6) << " points/s." << endl;
+        }
+
         void testGPRMC() {
             double latitude = 52.247041;
             double longitude = 10.575830;
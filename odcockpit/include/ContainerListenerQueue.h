@@ -0,0 +1,132 @@
+/**
+ * cockpit - Visualization environment
+ * Copyright (C) 2012 - 2015 Christian Berger
+ * Copyright (C) 2008 - 2011 (as monitor component) Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef CONTAINERLISTENERQUEUE_H_
+#define CONTAINERLISTENERQUEUE_H_
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "ContainerObserver.h"
+#include "opendavinci/odcore/base/Condition.h"
+#include "opendavinci/odcore/base/Service.h"
+#include "opendavinci/odcore/data/Container.h"
+
+namespace odcore { namespace io { namespace conference { class ContainerListener; } } }
+
+namespace cockpit {
+
+    using namespace std;
+
+    /**
+     * This class delivers containers to one ContainerListener from its
+     * own thread. Pending containers are held in a bounded queue or, in
+     * conflating mode, as the latest container per data type. A
+     * container is shared by all queues it is delivered to; therefore,
+     * ContainerListeners must treat it as immutable and decode it only
+     * via the const Container::getData() overload.
+     */
+    class ContainerListenerQueue : public odcore::base::Service {
+        private:
+            /**
+             * "Forbidden" copy constructor. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the copy constructor.
+             *
+             * @param obj Reference to an object of this class.
+             */
+            ContainerListenerQueue(const ContainerListenerQueue &/*obj*/);
+
+            /**
+             * "Forbidden" assignment operator. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the assignment operator.
+             *
+             * @param obj Reference to an object of this class.
+             * @return Reference to this instance.
+             */
+            ContainerListenerQueue& operator=(const ContainerListenerQueue &/*obj*/);
+
+        public:
+            /**
+             * Constructor.
+             *
+             * @param containerListener ContainerListener to deliver containers to.
+             * @param dataTypes Data types to be delivered; an empty list means all data types.
+             * @param mode Delivery mode.
+             * @param capacity Maximum number of pending containers.
+             * @param frequency Frequency in Hz to deliver pending containers; 0 delivers them immediately.
+             */
+            ContainerListenerQueue(odcore::io::conference::ContainerListener *containerListener, const vector<int32_t> &dataTypes, const ContainerObserver::DELIVERYMODE &mode, const uint32_t &capacity, const float &frequency);
+
+            virtual ~ContainerListenerQueue();
+
+            /**
+             * @return ContainerListener of this queue.
+             */
+            odcore::io::conference::ContainerListener* getContainerListener() const;
+
+            /**
+             * @param dataType Data type to check.
+             * @return true if containers of the given data type are delivered.
+             */
+            bool isSubscribedTo(const int32_t &dataType) const;
+
+            /**
+             * This method enqueues a container for delivery.
+             *
+             * @param c Shared container to be delivered.
+             */
+            void enqueue(const std::shared_ptr<const odcore::data::Container> &c);
+
+            /**
+             * @return Number of containers that were dropped because the queue was full.
+             */
+            uint64_t getNumberOfDroppedContainers() const;
+
+        private:
+            virtual void beforeStop();
+
+            virtual void run();
+
+            /**
+             * This method delivers all pending containers.
+             */
+            void deliver();
+
+        private:
+            odcore::io::conference::ContainerListener *m_containerListener;
+            vector<int32_t> m_dataTypes;
+            ContainerObserver::DELIVERYMODE m_mode;
+            uint32_t m_capacity;
+            uint32_t m_periodInMilliseconds;
+
+            mutable odcore::base::Condition m_queueCondition;
+            deque<std::shared_ptr<const odcore::data::Container> > m_queue;
+            map<int32_t, std::shared_ptr<const odcore::data::Container> > m_latest;
+            uint64_t m_numberOfDroppedContainers;
+    };
+
+} // cockpit
+
+#endif /*CONTAINERLISTENERQUEUE_H_*/
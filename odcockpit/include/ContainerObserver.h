@@ -21,24 +21,51 @@
 #ifndef CONTAINEROBSERVER_H_
 #define CONTAINEROBSERVER_H_
 
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+
 namespace odcore { namespace io { namespace conference { class ContainerListener; } } }
 
 namespace cockpit {
 
+    using namespace std;
+
     /**
      * This interface manages multiple ContainerListeners.
      */
     class ContainerObserver {
+        public:
+            enum DELIVERYMODE {
+                QUEUE,    // Every container is delivered; the oldest ones are dropped when the queue is full.
+                CONFLATE  // Only the latest container per data type is delivered.
+            };
+
         public:
             virtual ~ContainerObserver();
 
             /**
-             * This method adds a container listener.
+             * This method adds a container listener that receives
+             * containers of all data types.
              *
              * @param containerListener ContainerListener to be added.
              */
             virtual void addContainerListener(odcore::io::conference::ContainerListener *containerListener) = 0;
 
+            /**
+             * This method adds a container listener that receives only
+             * containers of the given data types. The containers are
+             * delivered from a separate thread for every container
+             * listener so that a slow listener does not delay others.
+             *
+             * @param containerListener ContainerListener to be added.
+             * @param dataTypes Data types to be delivered; an empty list means all data types.
+             * @param mode Delivery mode.
+             * @param capacity Maximum number of pending containers.
+             * @param frequency Frequency in Hz to deliver pending containers; 0 delivers them immediately.
+             */
+            virtual void addContainerListener(odcore::io::conference::ContainerListener *containerListener, const vector<int32_t> &dataTypes, const DELIVERYMODE &mode, const uint32_t &capacity, const float &frequency) = 0;
+
             /**
              * This method removes a container listener.
              *
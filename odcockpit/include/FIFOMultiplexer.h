@@ -37,8 +37,14 @@ namespace cockpit {
 
     using namespace std;
 
+    class ContainerListenerQueue;
+
     /**
      * This class implements a simple FIFO for multiplexing incoming containers.
+     * Every incoming container is wrapped once and handed to the
+     * ContainerListenerQueues of all ContainerListeners that subscribed to
+     * its data type; every ContainerListenerQueue delivers the containers
+     * from its own thread.
      */
     class FIFOMultiplexer : public odcore::base::Service, public ContainerObserver {
         private:
@@ -61,6 +67,11 @@ namespace cockpit {
              */
             FIFOMultiplexer& operator=(const FIFOMultiplexer &/*obj*/);
 
+        public:
+            enum {
+                DEFAULT_CAPACITY = 1000
+            };
+
         public:
             /**
              * Constructor.
@@ -73,6 +84,8 @@ namespace cockpit {
 
             virtual void addContainerListener(odcore::io::conference::ContainerListener *containerListener);
 
+            virtual void addContainerListener(odcore::io::conference::ContainerListener *containerListener, const vector<int32_t> &dataTypes, const DELIVERYMODE &mode, const uint32_t &capacity, const float &frequency);
+
             virtual void removeContainerListener(odcore::io::conference::ContainerListener *containerListener);
 
         protected:
@@ -84,7 +97,7 @@ namespace cockpit {
         private:
             odcore::base::DataStoreManager &m_dataStoreManager;
             mutable odcore::base::Mutex m_fifoMutex;
-            vector<odcore::io::conference::ContainerListener*> m_listOfContainerListeners;
+            vector<ContainerListenerQueue*> m_listOfContainerListenerQueues;
             odcore::base::FIFOQueue m_fifo;
 
             virtual void beforeStop();
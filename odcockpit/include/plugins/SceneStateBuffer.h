@@ -0,0 +1,221 @@
+/**
+ * cockpit - Visualization environment
+ * Copyright (C) 2012 - 2015 Christian Berger
+ * Copyright (C) 2008 - 2011 (as monitor component) Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef PLUGINS_SCENESTATEBUFFER_H_
+#define PLUGINS_SCENESTATEBUFFER_H_
+
+#include <map>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Mutex.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
+#include "opendlv/data/environment/EgoState.h"
+#include "opendlv/data/environment/Line.h"
+#include "opendlv/data/environment/Obstacle.h"
+#include "opendlv/data/environment/Point3.h"
+#include "opendlv/data/sensor/ContouredObject.h"
+
+namespace odcore { namespace data { class Container; } }
+
+namespace cockpit {
+    namespace plugins {
+
+        using namespace std;
+
+        /**
+         * This class is a ring buffer with a fixed capacity that
+         * overwrites its oldest entry when it is full.
+         */
+        template <typename T>
+        class RingBuffer {
+            public:
+                RingBuffer(const uint32_t &capacity) :
+                    m_entries(),
+                    m_capacity((capacity > 0) ? capacity : 1),
+                    m_head(0) {
+                    m_entries.reserve(m_capacity);
+                }
+
+                void push(const T &entry) {
+                    if (m_entries.size() < m_capacity) {
+                        m_entries.push_back(entry);
+                    }
+                    else {
+                        m_entries[m_head] = entry;
+                        m_head = (m_head + 1) % m_capacity;
+                    }
+                }
+
+                void clear() {
+                    m_entries.clear();
+                    m_head = 0;
+                }
+
+                uint32_t getSize() const {
+                    return m_entries.size();
+                }
+
+                /**
+                 * @param i Index starting from the oldest entry.
+                 * @return Entry at the given index.
+                 */
+                const T& at(const uint32_t &i) const {
+                    return m_entries[(m_head + i) % m_entries.size()];
+                }
+
+            private:
+                vector<T> m_entries;
+                uint32_t m_capacity;
+                uint32_t m_head;
+        };
+
+        /**
+         * This class holds the data to be visualized by a viewer: Positions,
+         * obstacles, traces, and plans. Every part has a version that is
+         * incremented on every change so that a viewer rebuilds only the
+         * parts of its scene graph that have changed.
+         */
+        class SceneState {
+            public:
+                SceneState(const uint32_t &traceCapacity, const uint32_t &lineCapacity);
+
+            public:
+                bool m_hasEgoState;
+                opendlv::data::environment::EgoState m_egoState;
+                uint32_t m_egoStateVersion;
+
+                RingBuffer<opendlv::data::environment::Point3> m_egoTrace;
+                uint32_t m_egoTraceVersion;
+
+                map<uint32_t, opendlv::data::environment::Obstacle> m_obstacles;
+                uint32_t m_obstaclesVersion;
+
+                vector<opendlv::data::environment::Point3> m_plannedRoute;
+                uint32_t m_plannedRouteVersion;
+
+                RingBuffer<opendlv::data::environment::Line> m_lines;
+                uint32_t m_linesVersion;
+
+                vector<opendlv::data::sensor::ContouredObject> m_contouredObjects;
+                uint32_t m_contouredObjectsVersion;
+        };
+
+        /**
+         * This class decouples the intake of containers from rendering:
+         * nextContainer() applies the received data to a back buffer under
+         * a short lock while a viewer renders its front buffer without any
+         * lock; beginFrame() copies the back buffer into the front buffer
+         * once per rendered frame if it has changed. Furthermore, the time
+         * to render a frame and the lag between receiving and rendering
+         * an update are measured.
+         */
+        class SceneStateBuffer {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                SceneStateBuffer(const SceneStateBuffer &/*obj*/);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                SceneStateBuffer& operator=(const SceneStateBuffer &/*obj*/);
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param traceDecimation Every n-th EgoState is added to the trace.
+                 * @param traceCapacity Maximum number of positions in the trace.
+                 * @param lineCapacity Maximum number of individual lines.
+                 */
+                SceneStateBuffer(const uint32_t &traceDecimation, const uint32_t &traceCapacity, const uint32_t &lineCapacity);
+
+                virtual ~SceneStateBuffer();
+
+                /**
+                 * This method applies the given container to the back buffer.
+                 *
+                 * @param c Container with EgoState, Obstacle, Route, Line, or ContouredObjects.
+                 */
+                void nextContainer(odcore::data::Container &c);
+
+                /**
+                 * This method clears the trace of the EgoState.
+                 */
+                void clearEgoTrace();
+
+                /**
+                 * This method is called by the viewer before rendering a frame
+                 * and updates the front buffer.
+                 *
+                 * @return Front buffer to be rendered.
+                 */
+                const SceneState& beginFrame();
+
+                /**
+                 * This method is called by the viewer after rendering a frame.
+                 */
+                void endFrame();
+
+                /**
+                 * @return Time in microseconds to render the last frame.
+                 */
+                int64_t getFrameTime() const;
+
+                /**
+                 * @return Time in microseconds between receiving the oldest
+                 *         update and rendering it in the last updated frame.
+                 */
+                int64_t getUpdateLag() const;
+
+            private:
+                uint32_t m_traceDecimation;
+                uint32_t m_numberOfReceivedEgoStates;
+
+                odcore::base::Mutex m_backMutex;
+                SceneState m_back;
+                bool m_hasChanged;
+                odcore::data::TimeStamp m_oldestUpdate;
+
+                SceneState m_front;
+
+                mutable odcore::base::Mutex m_statisticsMutex;
+                odcore::data::TimeStamp m_beginOfFrame;
+                int64_t m_frameTime;
+                int64_t m_updateLag;
+
+                /**
+                 * This method marks the back buffer as changed.
+                 *
+                 * @param received Time stamp when the update was received.
+                 */
+                void hasChanged(const odcore::data::TimeStamp &received);
+        };
+
+    }
+} // cockpit::plugins
+
+#endif /*PLUGINS_SCENESTATEBUFFER_H_*/
@@ -23,7 +23,6 @@
 #include <QtCore>
 #include <QtGui>
 
-#include <map>
 #include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
@@ -33,6 +32,7 @@
 #include "opendlv/data/environment/Point3.h"
 #include "opendlv/scenegraph/SceneNodeDescriptor.h"
 #include "opendlv/scenegraph/renderer/RenderingConfiguration.h"
+#include "plugins/SceneStateBuffer.h"
 #include "plugins/birdseyemap/SelectableNodeDescriptorTreeListener.h"
 
 class QMouseEvent;
@@ -110,6 +110,16 @@ class SelectableNodeDescriptor;
 
                     virtual void update(odcore::base::TreeNode<SelectableNodeDescriptor> *node);
 
+                    /**
+                     * @return Time in microseconds to render the last frame.
+                     */
+                    int64_t getFrameTime() const;
+
+                    /**
+                     * @return Time in microseconds between receiving and rendering an update.
+                     */
+                    int64_t getUpdateLag() const;
+
                 private:
                     virtual void paintEvent(QPaintEvent *evnt);
 
@@ -142,19 +152,28 @@ class SelectableNodeDescriptor;
                     opendlv::data::environment::Point3 m_centerOfMap;
                     opendlv::data::environment::Point3 m_mouseOld;
 
-                    uint32_t m_numberOfReceivedEgoStates;
-                    opendlv::data::environment::EgoState m_egoState;
-                    opendlv::data::environment::EgoState m_lastEgoState;
+                    SceneStateBuffer m_sceneStateBuffer;
+                    uint32_t m_egoTraceVersion;
+                    uint32_t m_obstaclesVersion;
+                    uint32_t m_plannedRouteVersion;
+
                     opendlv::scenegraph::models::SimpleCar *m_egoCar;
                     opendlv::scenegraph::SceneNode *m_egoCarTrace;
 
                     opendlv::scenegraph::SceneNode *m_obstaclesRoot;
-                    map<uint32_t, opendlv::scenegraph::SceneNode*> m_mapOfObstacles;
 
                     opendlv::scenegraph::SceneNode *m_plannedRoute;
 
                     void createSceneGraph();
 
+                    /**
+                     * This method rebuilds the parts of the scene graph
+                     * that have changed in the given scene state.
+                     *
+                     * @param state Scene state to be rendered.
+                     */
+                    void updateSceneGraph(const SceneState &state);
+
                     void modifyRenderingConfiguration(odcore::base::TreeNode<SelectableNodeDescriptor> *node);
             };
 
@@ -32,6 +32,7 @@
 #include "opendlv/threeD/NodeDescriptorComparator.h"
 #include "opendlv/threeD/RenderingConfiguration.h"
 #include "plugins/AbstractGLWidget.h"
+#include "plugins/SceneStateBuffer.h"
 #include "plugins/environmentviewer/SelectableNodeDescriptorTreeListener.h"
 
 class QWidget;
@@ -92,6 +93,16 @@ class SelectableNodeDescriptor;
 
                     virtual void update(odcore::base::TreeNode<SelectableNodeDescriptor> *node);
 
+                    /**
+                     * @return Time in microseconds to render the last frame.
+                     */
+                    int64_t getFrameTime() const;
+
+                    /**
+                     * @return Time in microseconds between receiving and rendering an update.
+                     */
+                    int64_t getUpdateLag() const;
+
                 protected:
                     virtual void setupOpenGL();
 
@@ -108,14 +119,20 @@ class SelectableNodeDescriptor;
                     opendlv::threeD::TransformGroup *m_plannedRoute;
                     opendlv::threeD::TransformGroup *m_lines;
 
+                    SceneStateBuffer m_sceneStateBuffer;
+                    uint32_t m_egoStateVersion;
+                    uint32_t m_egoTraceVersion;
+                    uint32_t m_contouredObjectsVersion;
+                    uint32_t m_plannedRouteVersion;
+                    uint32_t m_linesVersion;
+                    uint32_t m_obstaclesVersion;
+
                     opendlv::threeD::NodeDescriptor m_egoStateNodeDescriptor;
-                    uint32_t m_numberOfReceivedEgoStates;
                     opendlv::threeD::TransformGroup *m_egoStateNode;
                     map<opendlv::threeD::NodeDescriptor, opendlv::threeD::TransformGroup*, opendlv::threeD::NodeDescriptorComparator> m_mapOfTraceablePositions;
                     opendlv::threeD::TransformGroup *m_contouredObjectsNode;
                     opendlv::threeD::RenderingConfiguration m_renderingConfiguration;
                     opendlv::threeD::TransformGroup *m_obstaclesRoot;
-                    map<uint32_t, opendlv::threeD::Node*> m_mapOfObstacles;
 
                     CameraAssignableNodesListener &m_cameraAssignableNodesListener;
                     vector<opendlv::threeD::NodeDescriptor> m_listOfCameraAssignableNodes;
@@ -136,6 +153,14 @@ class SelectableNodeDescriptor;
                      * This method creates the scene graph.
                      */
                     void createSceneGraph();
+
+                    /**
+                     * This method rebuilds the parts of the scene graph
+                     * that have changed in the given scene state.
+                     *
+                     * @param state Scene state to be rendered.
+                     */
+                    void updateSceneGraph(const SceneState &state);
             };
         }
     }
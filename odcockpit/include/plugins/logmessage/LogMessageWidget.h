@@ -85,7 +85,7 @@ namespace cockpit {
                     map<string, QTreeWidgetItem* > m_components;
                     map<string, QTreeWidgetItem* > m_loglevelPerComponent;
 
-                    void addLogMessageToTree(Container &container);
+                    void addLogMessageToTree(const Container &container);
             };
 
         }
@@ -31,7 +31,7 @@
 #include <memory>
 #include "opendavinci/odcore/base/Mutex.h"
 #include "opendavinci/odcore/io/conference/ContainerListener.h"
-#include "opendavinci/odcore/wrapper/SharedMemory.h"
+#include "opendavinci/odcore/data/image/SharedImageReader.h"
 #include "opendavinci/generated/odcore/data/image/SharedImage.h"
 
 class QImage;
@@ -90,7 +90,7 @@ namespace cockpit {
                 private:
                     mutable odcore::base::Mutex m_sharedImageMemoryMutex;
                     odcore::data::image::SharedImage m_sharedImage;
-                    std::shared_ptr<odcore::wrapper::SharedMemory> m_sharedImageMemory;
+                    odcore::data::image::SharedImageReader m_sharedImageReader;
                     QImage *m_drawableImage;
                     QVector<QRgb> m_grayscale;
 
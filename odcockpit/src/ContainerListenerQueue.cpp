@@ -0,0 +1,148 @@
+/**
+ * cockpit - Visualization environment
+ * Copyright (C) 2012 - 2015 Christian Berger
+ * Copyright (C) 2008 - 2011 (as monitor component) Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/odcore/io/conference/ContainerListener.h"
+
+#include "ContainerListenerQueue.h"
+
+namespace cockpit {
+
+    using namespace std;
+    using namespace odcore::base;
+    using namespace odcore::data;
+    using namespace odcore::io::conference;
+
+    ContainerListenerQueue::ContainerListenerQueue(ContainerListener *containerListener, const vector<int32_t> &dataTypes, const ContainerObserver::DELIVERYMODE &mode, const uint32_t &capacity, const float &frequency) :
+        m_containerListener(containerListener),
+        m_dataTypes(dataTypes),
+        m_mode(mode),
+        m_capacity((capacity > 0) ? capacity : 1),
+        m_periodInMilliseconds((frequency > 0) ? static_cast<uint32_t>(lround(1000.0 / frequency)) : 0),
+        m_queueCondition(),
+        m_queue(),
+        m_latest(),
+        m_numberOfDroppedContainers(0) {
+        sort(m_dataTypes.begin(), m_dataTypes.end());
+    }
+
+    ContainerListenerQueue::~ContainerListenerQueue() {}
+
+    ContainerListener* ContainerListenerQueue::getContainerListener() const {
+        return m_containerListener;
+    }
+
+    bool ContainerListenerQueue::isSubscribedTo(const int32_t &dataType) const {
+        return (m_dataTypes.empty() || binary_search(m_dataTypes.begin(), m_dataTypes.end(), dataType));
+    }
+
+    void ContainerListenerQueue::enqueue(const shared_ptr<const Container> &c) {
+        Lock l(m_queueCondition);
+        if (m_mode == ContainerObserver::CONFLATE) {
+            map<int32_t, shared_ptr<const Container> >::iterator it = m_latest.find(c->getDataType());
+            if (it != m_latest.end()) {
+                it->second = c;
+            }
+            else if (m_latest.size() < m_capacity) {
+                m_latest[c->getDataType()] = c;
+            }
+            else {
+                m_numberOfDroppedContainers++;
+            }
+        }
+        else {
+            if (m_queue.size() >= m_capacity) {
+                m_queue.pop_front();
+                m_numberOfDroppedContainers++;
+            }
+            m_queue.push_back(c);
+        }
+
+        // Periodic delivery does not need to be woken up.
+        if (m_periodInMilliseconds == 0) {
+            m_queueCondition.wakeAll();
+        }
+    }
+
+    uint64_t ContainerListenerQueue::getNumberOfDroppedContainers() const {
+        Lock l(m_queueCondition);
+        return m_numberOfDroppedContainers;
+    }
+
+    void ContainerListenerQueue::beforeStop() {
+        // Awake our thread.
+        Lock l(m_queueCondition);
+        m_queueCondition.wakeAll();
+    }
+
+    void ContainerListenerQueue::deliver() {
+        deque<shared_ptr<const Container> > pending;
+        {
+            Lock l(m_queueCondition);
+            if (m_mode == ContainerObserver::CONFLATE) {
+                map<int32_t, shared_ptr<const Container> >::iterator it = m_latest.begin();
+                while (it != m_latest.end()) {
+                    pending.push_back(it->second);
+                    it++;
+                }
+                m_latest.clear();
+            }
+            else {
+                pending.swap(m_queue);
+            }
+        }
+
+        // Deliver without holding the lock so that enqueuing is never blocked by the listener.
+        // ContainerListener's interface is non-const; see the class comment.
+        deque<shared_ptr<const Container> >::iterator it = pending.begin();
+        while (it != pending.end()) {
+            m_containerListener->nextContainer(const_cast<Container&>(**it));
+            it++;
+        }
+    }
+
+    void ContainerListenerQueue::run() {
+        serviceReady();
+        while (isRunning()) {
+            {
+                Lock l(m_queueCondition);
+                if (m_periodInMilliseconds > 0) {
+                    if (isRunning()) {
+                        m_queueCondition.waitOnSignalWithTimeout(m_periodInMilliseconds);
+                    }
+                }
+                else {
+                    while (isRunning() && m_queue.empty() && m_latest.empty()) {
+                        m_queueCondition.waitOnSignal();
+                    }
+                }
+            }
+
+            if (isRunning()) {
+                deliver();
+            }
+        }
+    }
+
+} // cockpit
@@ -18,11 +18,14 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <memory>
+
 #include "opendavinci/odcore/base/DataStoreManager.h"
 #include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/data/Container.h"
 #include "opendavinci/odcore/io/conference/ContainerListener.h"
 
+#include "ContainerListenerQueue.h"
 #include "FIFOMultiplexer.h"
 
 namespace cockpit {
@@ -35,35 +38,58 @@ namespace cockpit {
     FIFOMultiplexer::FIFOMultiplexer(DataStoreManager &dsm) :
         m_dataStoreManager(dsm),
         m_fifoMutex(),
-        m_listOfContainerListeners(),
+        m_listOfContainerListenerQueues(),
         m_fifo() {}
 
     FIFOMultiplexer::~FIFOMultiplexer() {
         Lock l(m_fifoMutex);
-        m_listOfContainerListeners.clear();
+        vector<ContainerListenerQueue*>::iterator it = m_listOfContainerListenerQueues.begin();
+        while (it != m_listOfContainerListenerQueues.end()) {
+            ContainerListenerQueue *clq = (*it++);
+            clq->stop();
+            OPENDAVINCI_CORE_DELETE_POINTER(clq);
+        }
+        m_listOfContainerListenerQueues.clear();
     }
 
     void FIFOMultiplexer::addContainerListener(odcore::io::conference::ContainerListener *containerListener) {
+        addContainerListener(containerListener, vector<int32_t>(), QUEUE, DEFAULT_CAPACITY, 0);
+    }
+
+    void FIFOMultiplexer::addContainerListener(odcore::io::conference::ContainerListener *containerListener, const vector<int32_t> &dataTypes, const DELIVERYMODE &mode, const uint32_t &capacity, const float &frequency) {
         if (containerListener != NULL) {
+            ContainerListenerQueue *clq = new ContainerListenerQueue(containerListener, dataTypes, mode, capacity, frequency);
+            clq->start();
+
             Lock l(m_fifoMutex);
-            m_listOfContainerListeners.push_back(containerListener);
+            m_listOfContainerListenerQueues.push_back(clq);
         }
     }
 
     void FIFOMultiplexer::removeContainerListener(odcore::io::conference::ContainerListener *containerListener) {
         if (containerListener != NULL) {
-            Lock l(m_fifoMutex);
-            vector<ContainerListener*>::iterator it = m_listOfContainerListeners.begin();
-            while (it != m_listOfContainerListeners.end()) {
-                if (*it == containerListener) {
-                    break;
+            ContainerListenerQueue *clq = NULL;
+            {
+                Lock l(m_fifoMutex);
+                vector<ContainerListenerQueue*>::iterator it = m_listOfContainerListenerQueues.begin();
+                while (it != m_listOfContainerListenerQueues.end()) {
+                    if ((*it)->getContainerListener() == containerListener) {
+                        break;
+                    }
+                    it++;
+                }
+
+                // Actually remove the container listener.
+                if (it != m_listOfContainerListenerQueues.end()) {
+                    clq = *it;
+                    m_listOfContainerListenerQueues.erase(it);
                 }
-                it++;
             }
 
-            // Actually remove the container listener.
-            if (it != m_listOfContainerListeners.end()) {
-                m_listOfContainerListeners.erase(it);
+            // Stop the delivering thread outside the lock as it might still be busy with the listener.
+            if (clq != NULL) {
+                clq->stop();
+                OPENDAVINCI_CORE_DELETE_POINTER(clq);
             }
         }
     }
@@ -78,18 +104,20 @@ namespace cockpit {
     }
 
     void FIFOMultiplexer::distributeContainer(Container c){
-    	{
-    	  Lock l(m_fifoMutex);
-    	  vector<ContainerListener*>::iterator it = m_listOfContainerListeners.begin();
-    	  while (it != m_listOfContainerListeners.end()) {
-    		  ContainerListener *cl = (*it++);
-    		  if (cl != NULL) {
-    			 cl->nextContainer(c);
-    		  }
-    	  }
-    	}
+        Lock l(m_fifoMutex);
+        // All subscribed queues share one immutable copy of the container.
+        shared_ptr<const Container> sharedContainer;
+        vector<ContainerListenerQueue*>::iterator it = m_listOfContainerListenerQueues.begin();
+        while (it != m_listOfContainerListenerQueues.end()) {
+            ContainerListenerQueue *clq = (*it++);
+            if (clq->isSubscribedTo(c.getDataType())) {
+                if (!sharedContainer) {
+                    sharedContainer = shared_ptr<const Container>(new Container(c));
+                }
+                clq->enqueue(sharedContainer);
+            }
+        }
     }
-
     Container FIFOMultiplexer::leaveContainer(){
     	Container c;
     	{
@@ -0,0 +1,223 @@
+/**
+ * cockpit - Visualization environment
+ * Copyright (C) 2012 - 2015 Christian Berger
+ * Copyright (C) 2008 - 2011 (as monitor component) Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/data/Container.h"
+#include "opendlv/data/environment/EgoState.h"
+#include "opendlv/data/environment/Line.h"
+#include "opendlv/data/environment/Obstacle.h"
+#include "opendlv/data/planning/Route.h"
+#include "opendlv/data/sensor/ContouredObjects.h"
+#include "plugins/SceneStateBuffer.h"
+
+namespace cockpit {
+    namespace plugins {
+
+        using namespace std;
+        using namespace odcore::base;
+        using namespace odcore::data;
+        using namespace opendlv::data::environment;
+        using namespace opendlv::data::planning;
+        using namespace opendlv::data::sensor;
+
+        SceneState::SceneState(const uint32_t &traceCapacity, const uint32_t &lineCapacity) :
+            m_hasEgoState(false),
+            m_egoState(),
+            m_egoStateVersion(0),
+            m_egoTrace(traceCapacity),
+            m_egoTraceVersion(0),
+            m_obstacles(),
+            m_obstaclesVersion(0),
+            m_plannedRoute(),
+            m_plannedRouteVersion(0),
+            m_lines(lineCapacity),
+            m_linesVersion(0),
+            m_contouredObjects(),
+            m_contouredObjectsVersion(0) {}
+
+        SceneStateBuffer::SceneStateBuffer(const uint32_t &traceDecimation, const uint32_t &traceCapacity, const uint32_t &lineCapacity) :
+            m_traceDecimation((traceDecimation > 0) ? traceDecimation : 1),
+            m_numberOfReceivedEgoStates(0),
+            m_backMutex(),
+            m_back(traceCapacity, lineCapacity),
+            m_hasChanged(false),
+            m_oldestUpdate(),
+            m_front(traceCapacity, lineCapacity),
+            m_statisticsMutex(),
+            m_beginOfFrame(),
+            m_frameTime(0),
+            m_updateLag(0) {}
+
+        SceneStateBuffer::~SceneStateBuffer() {}
+
+        void SceneStateBuffer::hasChanged(const TimeStamp &received) {
+            if (!m_hasChanged) {
+                m_hasChanged = true;
+                m_oldestUpdate = received;
+            }
+        }
+
+        void SceneStateBuffer::nextContainer(Container &c) {
+            const Container &sharedContainer = c;
+            // Containers are decoded before the back buffer is locked.
+            TimeStamp received = c.getReceivedTimeStamp();
+            if (received.toMicroseconds() == 0) {
+                received = TimeStamp();
+            }
+
+            if (c.getDataType() == EgoState::ID()) {
+                const EgoState egoState = sharedContainer.getData<EgoState>();
+
+                Lock l(m_backMutex);
+                m_back.m_hasEgoState = true;
+                m_back.m_egoState = egoState;
+                m_back.m_egoStateVersion++;
+
+                m_numberOfReceivedEgoStates++;
+                if ( (m_numberOfReceivedEgoStates % m_traceDecimation) == 0 ) {
+                    m_back.m_egoTrace.push(egoState.getPosition());
+                    m_back.m_egoTraceVersion++;
+                }
+                hasChanged(received);
+            }
+            else if (c.getDataType() == Obstacle::ID()) {
+                const Obstacle obstacle = sharedContainer.getData<Obstacle>();
+
+                Lock l(m_backMutex);
+                switch (obstacle.getState()) {
+                    case Obstacle::REMOVE:
+                        m_back.m_obstacles.erase(obstacle.getObstacleID());
+                    break;
+
+                    case Obstacle::UPDATE:
+                        m_back.m_obstacles[obstacle.getObstacleID()] = obstacle;
+                    break;
+                }
+                m_back.m_obstaclesVersion++;
+                hasChanged(received);
+            }
+            else if (c.getDataType() == Route::ID()) {
+                Route route = sharedContainer.getData<Route>();
+                vector<Point3> listOfVertices = route.getListOfPoints();
+
+                if (listOfVertices.size() > 0) {
+                    Lock l(m_backMutex);
+                    m_back.m_plannedRoute.swap(listOfVertices);
+                    m_back.m_plannedRouteVersion++;
+                    hasChanged(received);
+                }
+            }
+            else if (c.getDataType() == Line::ID()) {
+                const Line line = sharedContainer.getData<Line>();
+
+                Lock l(m_backMutex);
+                m_back.m_lines.push(line);
+                m_back.m_linesVersion++;
+                hasChanged(received);
+            }
+            else if (c.getDataType() == ContouredObjects::ID()) {
+                const ContouredObjects contouredObjects = sharedContainer.getData<ContouredObjects>();
+                vector<ContouredObject> listOfContouredObjects = contouredObjects.getContouredObjects();
+
+                Lock l(m_backMutex);
+                m_back.m_contouredObjects.swap(listOfContouredObjects);
+                m_back.m_contouredObjectsVersion++;
+                hasChanged(received);
+            }
+        }
+
+        void SceneStateBuffer::clearEgoTrace() {
+            Lock l(m_backMutex);
+            m_back.m_egoTrace.clear();
+            m_back.m_egoTraceVersion++;
+            hasChanged(TimeStamp());
+        }
+
+        const SceneState& SceneStateBuffer::beginFrame() {
+            const TimeStamp now;
+            bool updated = false;
+            int64_t updateLag = 0;
+
+            {
+                Lock l(m_backMutex);
+                if (m_hasChanged) {
+                    // Copy only the parts that have changed since the last frame.
+                    if (m_front.m_egoStateVersion != m_back.m_egoStateVersion) {
+                        m_front.m_hasEgoState = m_back.m_hasEgoState;
+                        m_front.m_egoState = m_back.m_egoState;
+                        m_front.m_egoStateVersion = m_back.m_egoStateVersion;
+                    }
+                    if (m_front.m_egoTraceVersion != m_back.m_egoTraceVersion) {
+                        m_front.m_egoTrace = m_back.m_egoTrace;
+                        m_front.m_egoTraceVersion = m_back.m_egoTraceVersion;
+                    }
+                    if (m_front.m_obstaclesVersion != m_back.m_obstaclesVersion) {
+                        m_front.m_obstacles = m_back.m_obstacles;
+                        m_front.m_obstaclesVersion = m_back.m_obstaclesVersion;
+                    }
+                    if (m_front.m_plannedRouteVersion != m_back.m_plannedRouteVersion) {
+                        m_front.m_plannedRoute = m_back.m_plannedRoute;
+                        m_front.m_plannedRouteVersion = m_back.m_plannedRouteVersion;
+                    }
+                    if (m_front.m_linesVersion != m_back.m_linesVersion) {
+                        m_front.m_lines = m_back.m_lines;
+                        m_front.m_linesVersion = m_back.m_linesVersion;
+                    }
+                    if (m_front.m_contouredObjectsVersion != m_back.m_contouredObjectsVersion) {
+                        m_front.m_contouredObjects = m_back.m_contouredObjects;
+                        m_front.m_contouredObjectsVersion = m_back.m_contouredObjectsVersion;
+                    }
+
+                    updateLag = (now - m_oldestUpdate).toMicroseconds();
+                    m_hasChanged = false;
+                    updated = true;
+                }
+            }
+
+            {
+                Lock l(m_statisticsMutex);
+                m_beginOfFrame = now;
+                if (updated) {
+                    m_updateLag = updateLag;
+                }
+            }
+
+            return m_front;
+        }
+
+        void SceneStateBuffer::endFrame() {
+            const TimeStamp now;
+
+            Lock l(m_statisticsMutex);
+            m_frameTime = (now - m_beginOfFrame).toMicroseconds();
+        }
+
+        int64_t SceneStateBuffer::getFrameTime() const {
+            Lock l(m_statisticsMutex);
+            return m_frameTime;
+        }
+
+        int64_t SceneStateBuffer::getUpdateLag() const {
+            Lock l(m_statisticsMutex);
+            return m_updateLag;
+        }
+
+    }
+} // cockpit::plugins
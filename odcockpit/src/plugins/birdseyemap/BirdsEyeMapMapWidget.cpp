@@ -86,13 +86,14 @@ namespace cockpit {
                 m_scaleFactor(9.99995),
                 m_centerOfMap(),
                 m_mouseOld(-1, -1, 0),
-                m_numberOfReceivedEgoStates(0),
-                m_egoState(),
-                m_lastEgoState(),
+                // Every 10th EgoState is added to the trace of at most 5000 positions; individual lines are not shown.
+                m_sceneStateBuffer(10, 5000, 1),
+                m_egoTraceVersion(0),
+                m_obstaclesVersion(0),
+                m_plannedRouteVersion(0),
                 m_egoCar(NULL),
                 m_egoCarTrace(NULL),
                 m_obstaclesRoot(NULL),
-                m_mapOfObstacles(),
                 m_plannedRoute(NULL) {
 
                 m_root->addChild(m_scales);
@@ -230,8 +231,55 @@ namespace cockpit {
                  }
             }
 
+            int64_t BirdsEyeMapMapWidget::getFrameTime() const {
+                return m_sceneStateBuffer.getFrameTime();
+            }
+
+            int64_t BirdsEyeMapMapWidget::getUpdateLag() const {
+                return m_sceneStateBuffer.getUpdateLag();
+            }
+
+            void BirdsEyeMapMapWidget::updateSceneGraph(const SceneState &state) {
+                if (m_egoTraceVersion != state.m_egoTraceVersion) {
+                    m_egoCarTrace->deleteAllChildren();
+                    for (uint32_t i = 1; i < state.m_egoTrace.getSize(); i++) {
+                        m_egoCarTrace->addChild(new opendlv::scenegraph::primitives::Line(m_egoCarTrace->getSceneNodeDescriptor(), state.m_egoTrace.at(i - 1), state.m_egoTrace.at(i), Point3(1, 0.84, 0), 2));
+                    }
+                    m_egoTraceVersion = state.m_egoTraceVersion;
+                }
+
+                if (m_plannedRouteVersion != state.m_plannedRouteVersion) {
+                    m_plannedRoute->deleteAllChildren();
+                    for (uint32_t i = 1; i < state.m_plannedRoute.size(); i++) {
+                        Point3 posA = state.m_plannedRoute.at(i - 1);
+                        posA.setZ(0.05);
+
+                        Point3 posB = state.m_plannedRoute.at(i);
+                        posB.setZ(0.05);
+
+                        m_plannedRoute->addChild(new opendlv::scenegraph::primitives::Line(m_plannedRoute->getSceneNodeDescriptor(), posA, posB, Point3(0.84, 1, 1), 4));
+                    }
+                    m_plannedRouteVersion = state.m_plannedRouteVersion;
+                }
+
+                if (m_obstaclesVersion != state.m_obstaclesVersion) {
+                    m_obstaclesRoot->deleteAllChildren();
+                    map<uint32_t, Obstacle>::const_iterator it = state.m_obstacles.begin();
+                    while (it != state.m_obstacles.end()) {
+                        m_obstaclesRoot->addChild(new opendlv::scenegraph::primitives::Polygon(SceneNodeDescriptor("Obstacles"), it->second.getPolygon().getVertices(), Point3(0, 1, 0), 2));
+                        it++;
+                    }
+                    m_obstaclesVersion = state.m_obstaclesVersion;
+                }
+            }
+
             void BirdsEyeMapMapWidget::paintEvent(QPaintEvent *evt) {
+                // Take the latest scene state; containers are applied concurrently to the back buffer.
+                const SceneState &state = m_sceneStateBuffer.beginFrame();
+
                 Lock l(m_rootMutex);
+                updateSceneGraph(state);
+
                 const double scaleMax = 20;
                 const double scaleMin = 0.0001;
 
@@ -260,8 +308,8 @@ namespace cockpit {
 
                 if (m_cameraAssignedNodeDescriptor.getName() == "EgoCar") {
                     // This applies map translation wrt. vehicle-fixed orientation.
-                    cartesianCoordinates.translate((evt->rect().width() / 2) + m_egoState.getPosition().getX()*10, (evt->rect().height() / 2) + m_egoState.getPosition().getY()*10);
-                    cartesianCoordinates.rotateRadians(m_egoState.getRotation().getAngleXY()+(-90*cartesian::Constants::DEG2RAD));
+                    cartesianCoordinates.translate((evt->rect().width() / 2) + state.m_egoState.getPosition().getX()*10, (evt->rect().height() / 2) + state.m_egoState.getPosition().getY()*10);
+                    cartesianCoordinates.rotateRadians(state.m_egoState.getRotation().getAngleXY()+(-90*cartesian::Constants::DEG2RAD));
                 }
                 else {
                     // Fixed translation to center of window.
@@ -285,7 +333,7 @@ namespace cockpit {
 
                 {
                     // Update position of ego car and renderer it.
-                    m_egoCar->setPosition(m_egoState.getPosition(), m_egoState.getRotation().getAngleXY());
+                    m_egoCar->setPosition(state.m_egoState.getPosition(), state.m_egoState.getRotation().getAngleXY());
 
                     // Now, draw everything in the scaled cartesian coordinate frame.
                     painter.setTransform(scaledCartesianCoordinates);
@@ -297,7 +345,16 @@ namespace cockpit {
                     m_root->accept(renderer);
                 }
 
+                // Show frame time and update lag of the previous frame for monitoring.
+                painter.resetTransform();
+                painter.setPen(Qt::white);
+                stringstream statistics;
+                statistics << "Frame: " << m_sceneStateBuffer.getFrameTime() / 1000.0 << " ms, lag: " << m_sceneStateBuffer.getUpdateLag() / 1000.0 << " ms";
+                painter.drawText(10, evt->rect().height() - 10, QString(statistics.str().c_str()));
+
                 painter.end();
+
+                m_sceneStateBuffer.endFrame();
             }
 
             void BirdsEyeMapMapWidget::update(TreeNode<SelectableNodeDescriptor> *node) {
@@ -308,10 +365,7 @@ namespace cockpit {
             }
 
             void BirdsEyeMapMapWidget::resetEgoTrace() {
-                Lock l(m_rootMutex);
-                if (m_egoCarTrace != NULL) {
-                    m_egoCarTrace->deleteAllChildren();
-                }
+                m_sceneStateBuffer.clearEgoTrace();
             }
 
             void BirdsEyeMapMapWidget::modifyRenderingConfiguration(TreeNode<SelectableNodeDescriptor> *node) {
@@ -331,79 +385,7 @@ namespace cockpit {
             }
 
             void BirdsEyeMapMapWidget::nextContainer(Container &c) {
-                if (c.getDataType() == opendlv::data::environment::EgoState::ID()) {
-                    Lock l(m_rootMutex);
-                    m_egoState = c.getData<EgoState>();
-                    m_numberOfReceivedEgoStates++;
-
-                    if ( (m_numberOfReceivedEgoStates % 10) == 0 ) {
-                        opendlv::scenegraph::primitives::Line *line = new opendlv::scenegraph::primitives::Line(m_egoCarTrace->getSceneNodeDescriptor(), m_lastEgoState.getPosition(), m_egoState.getPosition(), Point3(1, 0.84, 0), 2);
-                        m_egoCarTrace->addChild(line);
-
-                        m_lastEgoState = m_egoState;
-                    }
-                }
-
-                if (c.getDataType() == opendlv::data::planning::Route::ID()) {
-                    if (m_plannedRoute != NULL) {
-                        Lock l(m_rootMutex);
-                        opendlv::data::planning::Route r = c.getData<opendlv::data::planning::Route>();
-                        vector<Point3> listOfVertices = r.getListOfPoints();
-                        const uint32_t SIZE = listOfVertices.size();
-                        if (SIZE > 0) {
-                            m_plannedRoute->deleteAllChildren();
-                            for (uint32_t i = 0; i < SIZE - 1; i++) {
-                                Point3 posA = listOfVertices.at(i);
-                                posA.setZ(0.05);
-
-                                Point3 posB = listOfVertices.at(i+1);
-                                posB.setZ(0.05);
-
-                                m_plannedRoute->addChild(new opendlv::scenegraph::primitives::Line(m_plannedRoute->getSceneNodeDescriptor(), posA, posB, Point3(0.84, 1, 1), 4));
-                            }
-                        }
-                    }
-                }
-
-                if (c.getDataType() == opendlv::data::environment::Obstacle::ID()) {
-                    if (m_obstaclesRoot != NULL) {
-                        Lock l(m_rootMutex);
-                        Obstacle obstacle = c.getData<Obstacle>();
-                        switch (obstacle.getState()) {
-                            case Obstacle::REMOVE:
-                            {
-                                // Remove obstacle.
-                                map<uint32_t, SceneNode*>::iterator result = m_mapOfObstacles.find(obstacle.getObstacleID());
-                                if (result != m_mapOfObstacles.end()) {
-                                    // Remove child from scene graph node.
-                                    m_obstaclesRoot->removeChild(result->second);
-
-                                    // Remove entry from map.
-                                    m_mapOfObstacles.erase(result);
-                                }
-                            }
-                            break;
-
-                            case Obstacle::UPDATE:
-                            {
-                                map<uint32_t, SceneNode*>::iterator result = m_mapOfObstacles.find(obstacle.getObstacleID());
-                                if (result != m_mapOfObstacles.end()) {
-                                    // Remove child from scene graph node.
-                                    m_obstaclesRoot->removeChild(result->second);
-
-                                    // Remove entry from map.
-                                    m_mapOfObstacles.erase(result);
-                                }
-                                stringstream contourName;
-                                contourName << "Obstacles";
-                                opendlv::scenegraph::primitives::Polygon *contour = new opendlv::scenegraph::primitives::Polygon(SceneNodeDescriptor(contourName.str()), obstacle.getPolygon().getVertices(), Point3(0, 1, 0), 2);
-                                m_mapOfObstacles[obstacle.getObstacleID()] = contour;
-                                m_obstaclesRoot->addChild(contour);
-                            }
-                            break;
-                        }
-                    }
-                }
+                m_sceneStateBuffer.nextContainer(c);
             }
         }
     }
@@ -19,6 +19,9 @@
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "ContainerObserver.h"
+#include "opendlv/data/environment/EgoState.h"
+#include "opendlv/data/environment/Obstacle.h"
+#include "opendlv/data/planning/Route.h"
 #include "plugins/birdseyemap/BirdsEyeMapPlugIn.h"
 #include "plugins/birdseyemap/BirdsEyeMapWidget.h"
 
@@ -45,7 +48,12 @@ namespace cockpit {
 
                 cockpit::ContainerObserver *co = getContainerObserver();
                 if (co != NULL) {
-                    co->addContainerListener(m_widget);
+                    // Obstacles are added and removed incrementally; thus, every container is needed.
+                    vector<int32_t> dataTypes;
+                    dataTypes.push_back(opendlv::data::environment::EgoState::ID());
+                    dataTypes.push_back(opendlv::data::environment::Obstacle::ID());
+                    dataTypes.push_back(opendlv::data::planning::Route::ID());
+                    co->addContainerListener(m_widget, dataTypes, ContainerObserver::QUEUE, 1000, 20);
                 }
             }
 
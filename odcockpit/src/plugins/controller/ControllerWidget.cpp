@@ -147,8 +147,9 @@ namespace cockpit {
             ControllerWidget::~ControllerWidget() {}
 
             void ControllerWidget::nextContainer(Container &container) {
+                const Container &sharedContainer = container;
                 if (container.getDataType() == automotive::VehicleControl::ID()) {
-                    VehicleControl vc = container.getData<VehicleControl>();
+                    VehicleControl vc = sharedContainer.getData<VehicleControl>();
                     m_value->setText(vc.toString().c_str());
                 }
             }
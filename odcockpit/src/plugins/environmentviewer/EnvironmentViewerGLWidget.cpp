@@ -93,14 +93,20 @@ namespace cockpit {
                     m_measurements(NULL),
                     m_plannedRoute(NULL),
                     m_lines(NULL),
+                    // Every 30th EgoState is added to the trace of at most 5000 positions; at most 1000 individual lines are shown.
+                    m_sceneStateBuffer(30, 5000, 1000),
+                    m_egoStateVersion(0),
+                    m_egoTraceVersion(0),
+                    m_contouredObjectsVersion(0),
+                    m_plannedRouteVersion(0),
+                    m_linesVersion(0),
+                    m_obstaclesVersion(0),
                     m_egoStateNodeDescriptor(),
-                    m_numberOfReceivedEgoStates(0),
                     m_egoStateNode(NULL),
                     m_mapOfTraceablePositions(),
                     m_contouredObjectsNode(NULL),
                     m_renderingConfiguration(),
                     m_obstaclesRoot(NULL),
-                    m_mapOfObstacles(),
                     m_cameraAssignableNodesListener(canl),
                     m_listOfCameraAssignableNodes(),
                     m_cameraAssignedNodeDescriptor(),
@@ -152,7 +158,7 @@ namespace cockpit {
                     fstream fin(objxModel.c_str(), ios::in | ios::binary);
                     if (fin.good()) {
                         cout << "Loading car model" << endl;
-                        OBJXArchive *objxArchive = OBJXArchiveFactory::getInstance().getOBJXArchive(fin);
+                        OBJXArchive *objxArchive = OBJXArchiveFactory::getInstance().getOBJXArchive(objxModel);
 
                         fin.close();
                         if (objxArchive != NULL) {
@@ -248,9 +254,115 @@ namespace cockpit {
                 glLightfv(GL_LIGHT0, GL_SPECULAR, light0Specular);
             }
 
+            int64_t EnvironmentViewerGLWidget::getFrameTime() const {
+                return m_sceneStateBuffer.getFrameTime();
+            }
+
+            int64_t EnvironmentViewerGLWidget::getUpdateLag() const {
+                return m_sceneStateBuffer.getUpdateLag();
+            }
+
+            void EnvironmentViewerGLWidget::updateSceneGraph(const SceneState &state) {
+                if ( (m_egoStateNode != NULL) && state.m_hasEgoState && (m_egoStateVersion != state.m_egoStateVersion) ) {
+                    Point3 dir(0, 0, state.m_egoState.getRotation().getAngleXY());
+                    m_egoStateNode->setRotation(dir);
+                    m_egoStateNode->setTranslation(state.m_egoState.getPosition());
+
+                    Position egoPosition;
+                    egoPosition.setPosition(state.m_egoState.getPosition());
+                    egoPosition.setRotation(state.m_egoState.getRotation());
+                    m_mapOfCurrentPositions[m_egoStateNodeDescriptor] = egoPosition;
+
+                    m_egoStateVersion = state.m_egoStateVersion;
+                }
+
+                if (m_egoTraceVersion != state.m_egoTraceVersion) {
+                    NodeDescriptor nd("EgoCar (Trace)");
+                    TransformGroup *tg = m_mapOfTraceablePositions[nd];
+                    if (tg != NULL) {
+                        tg->deleteAllChildren();
+                        Point3 color(0, 0, 1);
+                        for (uint32_t i = 0; i < state.m_egoTrace.getSize(); i++) {
+                            tg->addChild(new opendlv::threeD::models::Point(NodeDescriptor("Trace"), state.m_egoTrace.at(i), color, 5));
+                        }
+                    }
+                    m_egoTraceVersion = state.m_egoTraceVersion;
+                }
+
+                if ( (m_contouredObjectsNode != NULL) && (m_contouredObjectsVersion != state.m_contouredObjectsVersion) ) {
+                    m_contouredObjectsNode->deleteAllChildren();
+                    vector<ContouredObject>::const_iterator it = state.m_contouredObjects.begin();
+                    while (it != state.m_contouredObjects.end()) {
+                        vector<Point3> contour = (*it).getContour();
+                        vector<Point3>::iterator jt = contour.begin();
+                        while (jt != contour.end()) {
+                            m_contouredObjectsNode->addChild(new opendlv::threeD::models::Point(NodeDescriptor("Point"), (*jt), Point3(1, 0, 0), 2));
+                            jt++;
+                        }
+                        it++;
+                    }
+                    m_contouredObjectsVersion = state.m_contouredObjectsVersion;
+                }
+
+                if ( (m_plannedRoute != NULL) && (m_plannedRouteVersion != state.m_plannedRouteVersion) ) {
+                    m_plannedRoute->deleteAllChildren();
+                    for (uint32_t i = 1; i < state.m_plannedRoute.size(); i++) {
+                        Point3 posA = state.m_plannedRoute.at(i - 1);
+                        posA.setZ(0.05);
+
+                        Point3 posB = state.m_plannedRoute.at(i);
+                        posB.setZ(0.05);
+
+                        m_plannedRoute->addChild(new opendlv::threeD::models::Line(NodeDescriptor(), posA, posB, Point3(0, 1, 0), 6));
+                    }
+                    m_plannedRouteVersion = state.m_plannedRouteVersion;
+                }
+
+                if ( (m_lines != NULL) && (m_linesVersion != state.m_linesVersion) ) {
+                    m_lines->deleteAllChildren();
+                    for (uint32_t i = 0; i < state.m_lines.getSize(); i++) {
+                        Point3 posA = state.m_lines.at(i).getA();
+                        posA.setZ(0.05);
+
+                        Point3 posB = state.m_lines.at(i).getB();
+                        posB.setZ(0.05);
+
+                        m_lines->addChild(new opendlv::threeD::models::Line(NodeDescriptor(), posA, posB, Point3(1, 0, 0), 6));
+                    }
+                    m_linesVersion = state.m_linesVersion;
+                }
+
+                if ( (m_obstaclesRoot != NULL) && (m_obstaclesVersion != state.m_obstaclesVersion) ) {
+                    m_obstaclesRoot->deleteAllChildren();
+                    map<uint32_t, Obstacle>::const_iterator it = state.m_obstacles.begin();
+                    while (it != state.m_obstacles.end()) {
+                        TransformGroup *contourTG = new TransformGroup();
+                        vector<Point3> contour = it->second.getPolygon().getVertices();
+                        if (contour.size() > 0) {
+                            // Close polygons.
+                            Point3 p = contour.at(0);
+                            contour.push_back(p);
+                            for (uint32_t k = 0; k < contour.size() - 1; k++) {
+                                Point3 A = contour.at(k); A.setZ(0.5);
+                                Point3 B = contour.at(k+1); B.setZ(0.5);
+
+                                contourTG->addChild(new opendlv::threeD::models::Line(NodeDescriptor(), A, B, Point3(0, 1, 0), 2));
+                            }
+                        }
+                        m_obstaclesRoot->addChild(contourTG);
+                        it++;
+                    }
+                    m_obstaclesVersion = state.m_obstaclesVersion;
+                }
+            }
+
             void EnvironmentViewerGLWidget::drawScene() {
                 if (m_root != NULL) {
+                    // Take the latest scene state; containers are applied concurrently to the back buffer.
+                    const SceneState &state = m_sceneStateBuffer.beginFrame();
+
                     Lock l(m_rootMutex);
+                    updateSceneGraph(state);
 
                     if (m_cameraAssignedNodeDescriptor.getName().size() > 0) {
                         Position assignedNode = m_mapOfCurrentPositions[m_cameraAssignedNodeDescriptor];
@@ -282,6 +394,8 @@ namespace cockpit {
                     else {
                         m_root->render(m_renderingConfiguration);
                     }
+
+                    m_sceneStateBuffer.endFrame();
     /*
                     {
                         // Visualize camera using quaternions.
@@ -391,132 +505,7 @@ namespace cockpit {
             }
 
             void EnvironmentViewerGLWidget::nextContainer(Container &c) {
-                if (c.getDataType() == opendlv::data::environment::EgoState::ID()) {
-                    m_numberOfReceivedEgoStates++;
-
-                    if (m_egoStateNode != NULL) {
-                        Lock l(m_rootMutex);
-                        EgoState egostate = c.getData<EgoState>();
-                        Point3 dir(0, 0, egostate.getRotation().getAngleXY());
-                        m_egoStateNode->setRotation(dir);
-                        m_egoStateNode->setTranslation(egostate.getPosition());
-
-                        Position egoPosition;
-                        egoPosition.setPosition(egostate.getPosition());
-                        egoPosition.setRotation(egostate.getRotation());
-                        m_mapOfCurrentPositions[m_egoStateNodeDescriptor] = egoPosition;
-
-                        if ( (m_numberOfReceivedEgoStates % 30) == 0 ) {
-                            NodeDescriptor nd("EgoCar (Trace)");
-                            TransformGroup *tg = m_mapOfTraceablePositions[nd];
-                            if (tg != NULL) {
-                                Point3 color(0, 0, 1);
-                                opendlv::threeD::models::Point *p = new opendlv::threeD::models::Point(NodeDescriptor("Trace"), egostate.getPosition(), color, 5);
-                                tg->addChild(p);
-                            }
-                        }
-                    }
-                }
-                if (c.getDataType() == ContouredObjects::ID()) {
-                    if (m_contouredObjectsNode != NULL) {
-                        Lock l(m_rootMutex);
-                        ContouredObjects cos = c.getData<ContouredObjects>();
-                        vector<ContouredObject> listOfContouredObjects = cos.getContouredObjects();
-                        vector<ContouredObject>::iterator it = listOfContouredObjects.begin();
-                        m_contouredObjectsNode->deleteAllChildren();
-                        while (it != listOfContouredObjects.end()) {
-                            vector<Point3> contour = (*it).getContour();
-                            vector<Point3>::iterator jt = contour.begin();
-                            while (jt != contour.end()) {
-                                m_contouredObjectsNode->addChild(new opendlv::threeD::models::Point(NodeDescriptor("Point"), (*jt), Point3(1, 0, 0), 2));
-                                jt++;
-                            }
-                            it++;
-                        }
-                    }
-                }
-                if (c.getDataType() == opendlv::data::planning::Route::ID()) {
-                    if (m_plannedRoute != NULL) {
-                        Lock l(m_rootMutex);
-                        Route r = c.getData<Route>();
-                        vector<Point3> listOfVertices = r.getListOfPoints();
-                        const uint32_t SIZE = listOfVertices.size();
-                        if (SIZE > 0) {
-                            m_plannedRoute->deleteAllChildren();
-                            for (uint32_t i = 0; i < SIZE - 1; i++) {
-                                Point3 posA = listOfVertices.at(i);
-                                posA.setZ(0.05);
-
-                                Point3 posB = listOfVertices.at(i+1);
-                                posB.setZ(0.05);
-
-                                m_plannedRoute->addChild(new opendlv::threeD::models::Line(NodeDescriptor(), posA, posB, Point3(0, 1, 0), 6));
-                            }
-                        }
-                    }
-                }
-                if (c.getDataType() == opendlv::data::environment::Line::ID()) {
-                    if (m_lines != NULL) {
-                        Lock l(m_rootMutex);
-                        opendlv::data::environment::Line line = c.getData<Line>();
-
-                        Point3 posA = line.getA();
-                        posA.setZ(0.05);
-
-                        Point3 posB = line.getB();
-                        posB.setZ(0.05);
-
-                        m_lines->addChild(new opendlv::threeD::models::Line(NodeDescriptor(), posA, posB, Point3(1, 0, 0), 6));
-                    }
-                }
-                if (c.getDataType() == opendlv::data::environment::Obstacle::ID()) {
-                    if (m_obstaclesRoot != NULL) {
-                        Lock l(m_rootMutex);
-                        Obstacle obstacle = c.getData<Obstacle>();
-                        switch (obstacle.getState()) {
-                            case Obstacle::REMOVE:
-                            {
-                                // Remove obstacle.
-                                map<uint32_t, Node*>::iterator result = m_mapOfObstacles.find(obstacle.getObstacleID());
-                                if (result != m_mapOfObstacles.end()) {
-                                    // Remove child from scene graph node.
-                                    m_obstaclesRoot->removeChild(result->second);
-
-                                    // Remove entry from map.
-                                    m_mapOfObstacles.erase(result);
-                                }
-                            }
-                            break;
-
-                            case Obstacle::UPDATE:
-                            {
-                                map<uint32_t, Node*>::iterator result = m_mapOfObstacles.find(obstacle.getObstacleID());
-                                if (result != m_mapOfObstacles.end()) {
-                                    // Remove child from scene graph node.
-                                    m_obstaclesRoot->removeChild(result->second);
-
-                                    // Remove entry from map.
-                                    m_mapOfObstacles.erase(result);
-                                }
-                                // Update obstacle.
-                                TransformGroup *contourTG = new TransformGroup();
-                                vector<Point3> contour = obstacle.getPolygon().getVertices();
-                                // Close polygons.
-                                Point3 p = contour.at(0);
-                                contour.push_back(p);
-                                for (uint32_t k = 0; k < contour.size() - 1; k++) {
-                                    Point3 A = contour.at(k); A.setZ(0.5);
-                                    Point3 B = contour.at(k+1); B.setZ(0.5);
-
-                                    contourTG->addChild(new opendlv::threeD::models::Line(NodeDescriptor(), A, B, Point3(0, 1, 0), 2));
-                                }
-                                m_mapOfObstacles[obstacle.getObstacleID()] = contourTG;
-                                m_obstaclesRoot->addChild(contourTG);
-                            }
-                            break;
-                        }
-                    }
-                }
+                m_sceneStateBuffer.nextContainer(c);
             }
         }
     }
@@ -20,6 +20,11 @@
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "ContainerObserver.h"
+#include "opendlv/data/environment/EgoState.h"
+#include "opendlv/data/environment/Line.h"
+#include "opendlv/data/environment/Obstacle.h"
+#include "opendlv/data/planning/Route.h"
+#include "opendlv/data/sensor/ContouredObjects.h"
 #include "plugins/environmentviewer/EnvironmentViewerPlugIn.h"
 #include "plugins/environmentviewer/EnvironmentViewerWidget.h"
 
@@ -46,7 +51,14 @@ namespace cockpit {
 
                 cockpit::ContainerObserver *co = getContainerObserver();
                 if (co != NULL) {
-                    co->addContainerListener(m_widget);
+                    // Obstacles are added and removed incrementally; thus, every container is needed.
+                    vector<int32_t> dataTypes;
+                    dataTypes.push_back(opendlv::data::environment::EgoState::ID());
+                    dataTypes.push_back(opendlv::data::environment::Line::ID());
+                    dataTypes.push_back(opendlv::data::environment::Obstacle::ID());
+                    dataTypes.push_back(opendlv::data::planning::Route::ID());
+                    dataTypes.push_back(opendlv::data::sensor::ContouredObjects::ID());
+                    co->addContainerListener(m_widget, dataTypes, ContainerObserver::QUEUE, 1000, 25);
                 }
             }
 
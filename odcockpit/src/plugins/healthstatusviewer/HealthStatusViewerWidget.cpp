@@ -78,13 +78,14 @@ namespace cockpit {
             HealthStatusViewerWidget::~HealthStatusViewerWidget() {}
 
             void HealthStatusViewerWidget::nextContainer(Container &container) {
+                const Container &sharedContainer = container;
                 Lock l(m_healthStatusViewMutex);
                 if (container.getDataType() == opendlv::system::diagnostics::HealthStatus::ID()) {
                     m_healthStatusView->setEnabled(false);
                     m_healthStatusView->setSortingEnabled(false);
                     m_healthStatusView->clear();
 
-                    opendlv::system::diagnostics::HealthStatus hs = container.getData<opendlv::system::diagnostics::HealthStatus>();
+                    opendlv::system::diagnostics::HealthStatus hs = sharedContainer.getData<opendlv::system::diagnostics::HealthStatus>();
 
                     // Update widget.
                     auto pairOfIterators = hs.iteratorPair_MapOfStatus();
@@ -20,6 +20,7 @@
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "ContainerObserver.h"
+#include "automotivedata/generated/automotive/miniature/SensorBoardData.h"
 #include "plugins/iruscharts/IrUsChartsPlugIn.h"
 #include "plugins/iruscharts/IrUsChartsWidget.h"
 
@@ -47,7 +48,10 @@ namespace cockpit {
 
                 ContainerObserver *co = getContainerObserver();
                 if (co != NULL) {
-                    co->addContainerListener(m_irusChartsWidget);
+                    // The charts need every SensorBoardData sample.
+                    vector<int32_t> dataTypes;
+                    dataTypes.push_back(automotive::miniature::SensorBoardData::ID());
+                    co->addContainerListener(m_irusChartsWidget, dataTypes, ContainerObserver::QUEUE, 10*15, 20);
                 }
 
             }
@@ -258,8 +258,9 @@ namespace cockpit {
             }
 
             void IrUsChartsWidget::nextContainer(Container &container) {
+                const Container &sharedContainer = container;
                 if (container.getDataType() == automotive::miniature::SensorBoardData::ID()) {
-                    automotive::miniature::SensorBoardData sbd = container.getData<automotive::miniature::SensorBoardData>();
+                    automotive::miniature::SensorBoardData sbd = sharedContainer.getData<automotive::miniature::SensorBoardData>();
 
                     m_data.push_back(sbd);
 
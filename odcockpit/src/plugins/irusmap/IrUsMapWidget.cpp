@@ -110,9 +110,10 @@ namespace cockpit {
             }
 
             void IrUsMapWidget::nextContainer(Container &c) {
+                const Container &sharedContainer = c;
                 if (c.getDataType() == automotive::miniature::SensorBoardData::ID()) {
                     Lock l(m_sensorBoardDataMutex);
-        			m_sensorBoardData = c.getData<automotive::miniature::SensorBoardData>();
+        			m_sensorBoardData = sharedContainer.getData<automotive::miniature::SensorBoardData>();
                 }
             }
 
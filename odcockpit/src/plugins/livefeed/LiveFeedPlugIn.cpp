@@ -46,7 +46,8 @@ namespace cockpit {
 
                 ContainerObserver *co = getContainerObserver();
                 if (co != NULL) {
-                    co->addContainerListener(m_viewerWidget);
+                    // The live feed displays only the latest container per data type.
+                    co->addContainerListener(m_viewerWidget, vector<int32_t>(), ContainerObserver::CONFLATE, 256, 10);
                 }
             }
 
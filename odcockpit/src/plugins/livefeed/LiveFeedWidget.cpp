@@ -222,8 +222,11 @@ namespace cockpit {
             }
 
             void LiveFeedWidget::nextContainer(Container &container) {
+                // The generated mapping helpers decode through a mutable
+                // Container; work on a private copy of the shared one.
+                Container c(container);
                 Lock l(m_dataViewMutex);
-                transformContainerToTree(container);
+                transformContainerToTree(c);
             }
 
             void LiveFeedWidget::transformContainerToTree(Container &container) {
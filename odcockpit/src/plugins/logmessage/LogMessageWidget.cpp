@@ -78,7 +78,7 @@ namespace cockpit {
                 }
             }
 
-            void LogMessageWidget::addLogMessageToTree(Container &container) {
+            void LogMessageWidget::addLogMessageToTree(const Container &container) {
                 if (container.getDataType() == odcore::data::LogMessage::ID()) {
                     odcore::data::LogMessage lm = container.getData<odcore::data::LogMessage>();
 
@@ -71,8 +71,9 @@ namespace cockpit {
             }
 
             void ModuleStatisticsViewerWidget::nextContainer(Container &c) {
+                const Container &sharedContainer = c;
                 if (c.getDataType() == odcore::data::dmcp::ModuleStatistics::ID()) {
-                    ModuleStatistics ms = c.getData<ModuleStatistics>();
+                    ModuleStatistics ms = sharedContainer.getData<ModuleStatistics>();
                     m_moduleStatistics.push_back(ms);
 
                     // Get the iterator to the entries.
@@ -71,7 +71,7 @@ namespace cockpit {
                 fstream fin(objxModel.c_str(), ios::in | ios::binary);
 
                 if (fin.good()) {
-                    OBJXArchive *objxArchive = OBJXArchiveFactory::getInstance().getOBJXArchive(fin);
+                    OBJXArchive *objxArchive = OBJXArchiveFactory::getInstance().getOBJXArchive(objxModel);
 
                     fin.close();
 
@@ -300,9 +300,16 @@ namespace cockpit {
                     const bool THREADING = false;
                     const bool AUTO_REWIND = false;
 #ifdef HAVE_ODPLAYERH264
-                    // Base port for letting spawned children connect to parent process.
-                    const uint32_t BASE_PORT = m_kvc.getValue<uint32_t>("odplayerh264.portbaseforchildprocesses");
-                    m_player = shared_ptr<Player>(new odplayerh264::PlayerH264(url, AUTO_REWIND, MEMORY_SEGMENT_SIZE, NUMBER_OF_SEGMENTS, THREADING, BASE_PORT));
+                    // Number of frames per video stream to decode ahead of the playback.
+                    uint32_t numberOfFrameBuffers = 4;
+                    try {
+                        numberOfFrameBuffers = m_kvc.getValue<uint32_t>("odplayerh264.numberOfFrameBuffers");
+                    }
+                    catch(...) {
+                        cerr << "[odcockpit] Using default odplayerh264.numberOfFrameBuffers = " << numberOfFrameBuffers << "." << endl;
+                    }
+                    const uint32_t NUMBER_OF_DECODING_THREADS = 1;
+                    m_player = shared_ptr<Player>(new odplayerh264::PlayerH264(url, AUTO_REWIND, MEMORY_SEGMENT_SIZE, NUMBER_OF_SEGMENTS, THREADING, numberOfFrameBuffers, NUMBER_OF_DECODING_THREADS));
 #else
                     m_player = shared_ptr<Player>(new Player(url, AUTO_REWIND, MEMORY_SEGMENT_SIZE, NUMBER_OF_SEGMENTS, THREADING));
 #endif
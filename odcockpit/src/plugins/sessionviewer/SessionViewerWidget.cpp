@@ -114,11 +114,12 @@ namespace cockpit {
             SessionViewerWidget::~SessionViewerWidget() {}
 
             void SessionViewerWidget::nextContainer(Container &container) {
+                const Container &sharedContainer = container;
                 Lock l(m_participatingModulesViewMutex);
                 if (container.getDataType() == odcore::data::dmcp::ModuleStatistics::ID()) {
                     m_participatingModulesView->setSortingEnabled(false);
 
-                    odcore::data::dmcp::ModuleStatistics mss = container.getData<odcore::data::dmcp::ModuleStatistics>();
+                    odcore::data::dmcp::ModuleStatistics mss = sharedContainer.getData<odcore::data::dmcp::ModuleStatistics>();
 
                     // Update widget.
                     uint32_t totalNumberOfModules = 0;
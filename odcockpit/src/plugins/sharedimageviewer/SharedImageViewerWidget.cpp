@@ -27,7 +27,7 @@
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/data/Container.h"
-#include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"
+#include "opendavinci/odcore/data/image/ImageKernels.h"
 #include "plugins/sharedimageviewer/SharedImageViewerWidget.h"
 #include "opendavinci/generated/odcore/data/image/SharedImage.h"
 
@@ -49,7 +49,7 @@ namespace cockpit {
                 QWidget(prnt),
                 m_sharedImageMemoryMutex(),
                 m_sharedImage(),
-                m_sharedImageMemory(),
+                m_sharedImageReader(),
                 m_drawableImage(NULL),
                 m_grayscale(),
                 m_list(NULL),
@@ -94,7 +94,6 @@ namespace cockpit {
                         cerr << "Using shared image: " << si.toString() << endl;
                         setWindowTitle(QString::fromStdString(si.toString()));
 
-                        m_sharedImageMemory = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(si.getName());
                         m_sharedImage = si;
 
                         // Remove the selection box.
@@ -104,8 +103,9 @@ namespace cockpit {
             }
 
             void SharedImageViewerWidget::nextContainer(Container &c) {
+                const Container &sharedContainer = c;
                 if (c.getDataType() == odcore::data::image::SharedImage::ID()) {
-                    SharedImage si = c.getData<SharedImage>();
+                    SharedImage si = sharedContainer.getData<SharedImage>();
 
                     if ( ( (si.getWidth() * si.getHeight()) > 0) && (si.getName().size() > 0) ) {
                         // Check if this shared image is already in the list.
@@ -126,27 +126,38 @@ namespace cockpit {
             void SharedImageViewerWidget::paintEvent(QPaintEvent * /*evnt*/) {
                 Lock l(m_sharedImageMemoryMutex);
 
-                if ( (m_sharedImageMemory.get()) && (m_sharedImageMemory->isValid()) ) {
-                    m_sharedImageMemory->lock();
+                const int width = static_cast<int>(m_sharedImage.getWidth());
+                const int height = static_cast<int>(m_sharedImage.getHeight());
+                const uint32_t bytesPerPixel = m_sharedImage.getBytesPerPixel();
+                if ( ((bytesPerPixel != 3) && (bytesPerPixel != 1)) || (width * height == 0) ) {
+                    return;
+                }
 
+                // The drawable image is only allocated when the shared image changes.
+                if ( (m_drawableImage == NULL) || (m_drawableImage->width() != width) || (m_drawableImage->height() != height)
+                     || (m_drawableImage->depth() != static_cast<int>(bytesPerPixel * 8)) ) {
                     OPENDAVINCI_CORE_DELETE_POINTER(m_drawableImage);
-                    if (m_sharedImage.getBytesPerPixel() == 3) {
-                        m_drawableImage = new QImage((uchar*)(static_cast<char*>(m_sharedImageMemory->getSharedMemory())), m_sharedImage.getWidth(), m_sharedImage.getHeight(), m_sharedImage.getBytesPerPixel() * m_sharedImage.getWidth(), QImage::Format_RGB888);
-                        *m_drawableImage = m_drawableImage->rgbSwapped();
+                    if (bytesPerPixel == 3) {
+                        m_drawableImage = new QImage(width, height, QImage::Format_RGB888);
                     }
-                    else if (m_sharedImage.getBytesPerPixel() == 1) {
-                        m_drawableImage = new QImage((uchar*)(static_cast<char*>(m_sharedImageMemory->getSharedMemory())), m_sharedImage.getWidth(), m_sharedImage.getHeight(), m_sharedImage.getBytesPerPixel() * m_sharedImage.getWidth(), QImage::Format_Indexed8);
+                    else {
+                        m_drawableImage = new QImage(width, height, QImage::Format_Indexed8);
                         m_drawableImage->setColorTable(m_grayscale);
                     }
+                }
 
-                    if (m_drawableImage != NULL) {
-                        QPainter widgetPainter(this);
-                        widgetPainter.drawImage(0, 0, *m_drawableImage);
+                // The shared memory is only locked while copying; the conversion from BGR happens afterwards.
+                uchar *pixels = m_drawableImage->bits();
+                const uint32_t bytesPerLine = static_cast<uint32_t>(m_drawableImage->bytesPerLine());
+                if (m_sharedImageReader.copy(m_sharedImage, pixels, bytesPerLine)) {
+                    if (bytesPerPixel == 3) {
+                        ImageKernels::swapRedBlue(pixels, bytesPerLine, pixels, bytesPerLine, m_sharedImage.getWidth(), m_sharedImage.getHeight());
                     }
-                    m_sharedImageMemory->unlock();
+
+                    QPainter widgetPainter(this);
+                    widgetPainter.drawImage(0, 0, *m_drawableImage);
                 }
             }
-
         }
     }
 }
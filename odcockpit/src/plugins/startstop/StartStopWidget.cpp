@@ -92,9 +92,10 @@ namespace cockpit {
             StartStopWidget::~StartStopWidget() {}
 
             void StartStopWidget::nextContainer(Container &container) {
+                const Container &sharedContainer = container;
                 if (container.getDataType() == opendlv::proxy::ControlOverrideState::ID()) {
                     Lock l(m_startedMutex);
-                    opendlv::proxy::ControlOverrideState cos = container.getData<opendlv::proxy::ControlOverrideState>();
+                    opendlv::proxy::ControlOverrideState cos = sharedContainer.getData<opendlv::proxy::ControlOverrideState>();
                     m_overrideActive = cos.getIsOverridden();
 
                     m_statusLabel->setText(m_overrideActive ? "manual override" : "");
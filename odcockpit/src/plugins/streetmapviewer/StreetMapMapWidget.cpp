@@ -132,8 +132,9 @@ namespace cockpit {
             }
 
             void StreetMapMapWidget::nextContainer(Container &c) {
+                const Container &sharedContainer = c;
                 if (c.getDataType() == opendlv::data::environment::EgoState::ID()) {
-                    EgoState es = c.getData<EgoState>();
+                    EgoState es = sharedContainer.getData<EgoState>();
                     cout << "[StreetMapMapWidget]: " << es.toString() << endl;
                 }
                 else {
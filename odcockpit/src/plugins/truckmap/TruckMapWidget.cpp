@@ -73,6 +73,7 @@ namespace cockpit {
             }
 
             void TruckMapWidget::nextContainer(Container &c) {
+                const Container &sharedContainer = c;
                 if (c.getDataType() == (opendlv::perception::Environment::ID())) {
                     Lock l(m_objectsMutex);
                     // opendlv::perception::Object obj = c.getData<opendlv::perception::Object>();
@@ -81,7 +82,7 @@ namespace cockpit {
                     // Store last time stamp of update.
                     // TimeStamp now;
                     // m_objectsLastUpdated[obj.getObjectId()] = now;
-                    m_environment = c.getData<opendlv::perception::Environment>();
+                    m_environment = sharedContainer.getData<opendlv::perception::Environment>();
                 }
             }
 
@@ -108,7 +108,7 @@ namespace chasecar {
                 fstream fin(objxModel.c_str(), ios::in | ios::binary);
                 if (fin.good()) {
                     cout << "Loading car model" << endl;
-                    OBJXArchive *objxArchive = OBJXArchiveFactory::getInstance().getOBJXArchive(fin);
+                    OBJXArchive *objxArchive = OBJXArchiveFactory::getInstance().getOBJXArchive(objxModel);
 
                     fin.close();
                     if (objxArchive != NULL) {
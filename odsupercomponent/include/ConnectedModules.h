@@ -80,7 +80,9 @@ class ConnectedModule;
             /**
              * This method sends a pulse to all connected modules and
              * requires an ACK confirmation sent from the respective,
-             * dependent module that the PULSE has been processed.
+             * dependent module that the PULSE has been processed. Every
+             * module receives only the containers of the data types it
+             * has subscribed to.
              *
              * @param pm Pulse to be sent.
              * @param timeout Timeout in milliseconds to wait for an ACK from the dependent module.
@@ -21,6 +21,12 @@
 #ifndef SUPERCOMPONENT_GLOBALCONFIGURATIONPROVIDER_H_
 #define SUPERCOMPONENT_GLOBALCONFIGURATIONPROVIDER_H_
 
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "opendavinci/odcore/base/KeyValueConfiguration.h"
 #include "opendavinci/odcore/base/Mutex.h"
 #include "opendavinci/odcore/dmcp/ModuleConfigurationProvider.h"
@@ -31,6 +37,17 @@ namespace odsupercomponent {
 
     using namespace std;
 
+    /**
+     * This class provides the configuration for a connecting module. The
+     * keys of the global configuration are indexed once into a prefix trie;
+     * the configuration for a pair of module name and identifier is
+     * composed from the sections "global.", "<name>.", and
+     * "<name>:<identifier>." only once and cached afterwards. Cached
+     * configurations are looked up without locking.
+     *
+     * Assigning a new provider must not happen concurrently to calls of
+     * getConfiguration().
+     */
     class GlobalConfigurationProvider : public odcore::dmcp::ModuleConfigurationProvider {
         public:
             GlobalConfigurationProvider();
@@ -43,9 +60,57 @@ namespace odsupercomponent {
             virtual odcore::base::KeyValueConfiguration getConfiguration(const odcore::data::dmcp::ModuleDescriptor& md);
             virtual odcore::base::KeyValueConfiguration getGlobalConfiguration() const;
 
-        protected:
+        private:
+            /**
+             * Node of the prefix trie: As the keys are sorted, all keys
+             * starting with the node's prefix are the range [m_first, m_last)
+             * of m_listOfEntries.
+             */
+            class TrieNode {
+                public:
+                    TrieNode();
+
+                public:
+                    map<char, uint32_t> m_children;
+                    uint32_t m_first;
+                    uint32_t m_last;
+            };
+
+            typedef map<string, std::shared_ptr<const odcore::base::KeyValueConfiguration> > MapOfConfigurations;
+
+            /**
+             * This method builds the sorted list of entries and the prefix
+             * trie from m_configuration and drops all cached configurations.
+             */
+            void buildIndex();
+
+            /**
+             * This method determines the range of entries whose keys start
+             * with the given prefix.
+             *
+             * @param prefix Prefix in lower case.
+             * @param first First entry.
+             * @param last Entry after the last one.
+             */
+            void getRange(const string &prefix, uint32_t &first, uint32_t &last) const;
+
+            /**
+             * This method composes the configuration for the given module.
+             *
+             * @param name Module name in lower case.
+             * @param identifier Module identifier in lower case.
+             * @return Configuration for the module.
+             */
+            std::shared_ptr<const odcore::base::KeyValueConfiguration> createConfiguration(const string &name, const string &identifier) const;
+
+        private:
             odcore::base::KeyValueConfiguration m_configuration;
-            odcore::base::Mutex m_configurationMutex;
+            vector<pair<string, string> > m_listOfEntries;
+            vector<TrieNode> m_trie;
+
+            // Replaced as a whole by std::atomic_store; m_configurationsMutex serializes writers only.
+            std::shared_ptr<const MapOfConfigurations> m_configurations;
+            odcore::base::Mutex m_configurationsMutex;
     };
 }
 
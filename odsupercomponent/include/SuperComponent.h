@@ -38,6 +38,7 @@
 #include "opendavinci/odcore/dmcp/connection/ConnectionHandler.h"
 #include "opendavinci/odcore/io/conference/ContainerListener.h"
 #include "opendavinci/generated/odcore/data/LogMessage.h"
+#include "opendavinci/generated/odcore/data/dmcp/CycleStatistics.h"
 #include "opendavinci/generated/odcore/data/dmcp/ModuleExitCodeMessage.h"
 #include "opendavinci/generated/odcore/data/dmcp/ModuleStateMessage.h"
 #include "opendavinci/generated/odcore/data/dmcp/ModuleStatistics.h"
@@ -115,6 +116,9 @@ class ConnectedModule;
             virtual void handleRuntimeStatistics(const odcore::data::dmcp::ModuleDescriptor& md,
                                                  const odcore::data::dmcp::RuntimeStatistic& rs);
 
+            virtual void handleCycleStatistics(const odcore::data::dmcp::ModuleDescriptor& md,
+                                               const odcore::data::dmcp::CycleStatistics& cs);
+
             virtual void handleConnectionLost(const odcore::data::dmcp::ModuleDescriptor& md);
 
             virtual void handleUnkownContainer(const odcore::data::dmcp::ModuleDescriptor& md,
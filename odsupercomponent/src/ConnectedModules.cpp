@@ -150,6 +150,12 @@ namespace odsupercomponent {
         // via this TCP link and NOT via the regular UDP multicast conference.
         vector<Container> allContainersToBeDeliveredInNextCycle;
 
+        // Pulses are built once per distinct set of subscribed data types and
+        // shared among all modules with the same subscriptions; an empty list
+        // of subscribed data types means all containers.
+        const vector<Container> listOfContainers = pm.getListOfContainers();
+        map<vector<int32_t>, Container> pulses;
+
         Lock l(m_modulesMutex);
         map<string, ConnectedModule*>::iterator iter;
 
@@ -161,8 +167,24 @@ namespace odsupercomponent {
             // Check whether we have to skip this module when sending pulses.
             vector<string>::const_iterator it = find(modulesToIgnore.begin(), modulesToIgnore.end(), s);
             if (it == modulesToIgnore.end()) {
+                const vector<int32_t> subscribedDataTypes = iter->second->getConnection().getListOfSubscribedDataTypes();
+                map<vector<int32_t>, Container>::iterator pulse = pulses.find(subscribedDataTypes);
+                if (pulse == pulses.end()) {
+                    PulseMessage subscribedPulse = pm;
+                    if (!subscribedDataTypes.empty()) {
+                        vector<Container> subscribedContainers;
+                        for (vector<Container>::const_iterator jt = listOfContainers.begin(); jt != listOfContainers.end(); ++jt) {
+                            if (binary_search(subscribedDataTypes.begin(), subscribedDataTypes.end(), jt->getDataType())) {
+                                subscribedContainers.push_back(*jt);
+                            }
+                        }
+                        subscribedPulse.setListOfContainers(subscribedContainers);
+                    }
+                    pulse = pulses.insert(make_pair(subscribedDataTypes, Container(subscribedPulse))).first;
+                }
+
                 // The following call blocks until the client has confirmed the processing of this pulse.
-                vector<Container> containersToBeDeliveredInNextCycle = iter->second->getConnection().pulse_ack_containers(pm, timeout);
+                vector<Container> containersToBeDeliveredInNextCycle = iter->second->getConnection().pulse_ack_containers(pulse->second, timeout);
 
                 // Add newly received containers to the overall list.
                 allContainersToBeDeliveredInNextCycle.insert(allContainersToBeDeliveredInNextCycle.end(), containersToBeDeliveredInNextCycle.begin(), containersToBeDeliveredInNextCycle.end());
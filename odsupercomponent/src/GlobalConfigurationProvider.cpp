@@ -18,7 +18,9 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
-#include <fstream>
+#include <algorithm>
+#include <cctype>
+#include <functional>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -32,85 +34,165 @@ namespace odsupercomponent {
     using namespace odcore::base;
     using namespace odcore::data::dmcp;
 
+    GlobalConfigurationProvider::TrieNode::TrieNode() :
+        m_children(),
+        m_first(0),
+        m_last(0)
+    {}
+
     GlobalConfigurationProvider::GlobalConfigurationProvider(const KeyValueConfiguration& configurations) :
         m_configuration(configurations),
-        m_configurationMutex()
-    {}
+        m_listOfEntries(),
+        m_trie(),
+        m_configurations(),
+        m_configurationsMutex()
+    {
+        buildIndex();
+    }
 
     GlobalConfigurationProvider::GlobalConfigurationProvider() :
         m_configuration(),
-        m_configurationMutex()
-    {}
+        m_listOfEntries(),
+        m_trie(),
+        m_configurations(),
+        m_configurationsMutex()
+    {
+        buildIndex();
+    }
 
     GlobalConfigurationProvider::GlobalConfigurationProvider(const GlobalConfigurationProvider& configurationProvider) :
 	    odcore::dmcp::ModuleConfigurationProvider(),
         m_configuration(configurationProvider.getGlobalConfiguration()),
-        m_configurationMutex()
-    {}
+        m_listOfEntries(),
+        m_trie(),
+        m_configurations(),
+        m_configurationsMutex()
+    {
+        buildIndex();
+    }
 
     GlobalConfigurationProvider& GlobalConfigurationProvider::operator=(const GlobalConfigurationProvider& configurationProvider) {
         m_configuration = KeyValueConfiguration(configurationProvider.getGlobalConfiguration());
+        buildIndex();
         return *this;
     }
 
     GlobalConfigurationProvider::~GlobalConfigurationProvider() {}
 
-    KeyValueConfiguration GlobalConfigurationProvider::getConfiguration(const ModuleDescriptor& md) {
-        Lock l(m_configurationMutex);
+    void GlobalConfigurationProvider::buildIndex() {
+        // Split the global configuration into its key/value pairs; keys are already in lower case.
+        m_listOfEntries.clear();
+        stringstream sstrConfiguration;
+        m_configuration.writeTo(sstrConfiguration);
+        string line;
+        while (getline(sstrConfiguration, line)) {
+            const string::size_type delimiter = line.find("=");
+            if (delimiter != string::npos) {
+                m_listOfEntries.push_back(make_pair(line.substr(0, delimiter), line.substr(delimiter + 1)));
+            }
+        }
+        sort(m_listOfEntries.begin(), m_listOfEntries.end());
+
+        // Insert the sorted keys into the trie; all keys below a node are consecutive.
+        m_trie.clear();
+        m_trie.push_back(TrieNode());
+        m_trie[0].m_last = m_listOfEntries.size();
+        for (uint32_t i = 0; i < m_listOfEntries.size(); i++) {
+            const string &key = m_listOfEntries[i].first;
+            uint32_t node = 0;
+            for (uint32_t j = 0; j < key.size(); j++) {
+                map<char, uint32_t>::const_iterator it = m_trie[node].m_children.find(key[j]);
+                if (it == m_trie[node].m_children.end()) {
+                    const uint32_t child = m_trie.size();
+                    m_trie[node].m_children[key[j]] = child;
+                    m_trie.push_back(TrieNode());
+                    m_trie[child].m_first = i;
+                    node = child;
+                }
+                else {
+                    node = it->second;
+                }
+                m_trie[node].m_last = i + 1;
+            }
+        }
 
-        if (md.getName() == "odcockpit") {
-            return m_configuration;
+        Lock l(m_configurationsMutex);
+        std::atomic_store(&m_configurations, std::shared_ptr<const MapOfConfigurations>(new MapOfConfigurations()));
+    }
+
+    void GlobalConfigurationProvider::getRange(const string &prefix, uint32_t &first, uint32_t &last) const {
+        first = last = 0;
+        uint32_t node = 0;
+        for (uint32_t i = 0; i < prefix.size(); i++) {
+            map<char, uint32_t>::const_iterator it = m_trie[node].m_children.find(prefix[i]);
+            if (it == m_trie[node].m_children.end()) {
+                return;
+            }
+            node = it->second;
         }
+        first = m_trie[node].m_first;
+        last = m_trie[node].m_last;
+    }
 
-        // Determine subset of configuration for this client.
-        KeyValueConfiguration globalConfiguration = m_configuration.getSubsetForSection("global.");
-
-        stringstream module;
-        module << md.getName() << ".";
-        KeyValueConfiguration privateConfigurationBasedOnModuleName = m_configuration.getSubsetForSection(module.str());
-
-        KeyValueConfiguration privateConfigurationBasedOnModuleIdentifier;
-        if (md.getIdentifier() != "") {
-            stringstream moduleIdentifier;
-            moduleIdentifier << md.getName() << ":" << md.getIdentifier() << ".";
-            KeyValueConfiguration privateConfigurationBasedOnModuleIdentiferIncludingModuleIdentifier;
-            privateConfigurationBasedOnModuleIdentiferIncludingModuleIdentifier = m_configuration.getSubsetForSection(moduleIdentifier.str());
-
-            // Remove string ":" + md.getIdentifier().
-            const vector<string> keys = privateConfigurationBasedOnModuleIdentiferIncludingModuleIdentifier.getListOfKeys();
-            vector<string>::const_iterator it = keys.begin();
-            stringstream moduleIdentifierPart;
-            moduleIdentifierPart << ":" << md.getIdentifier() << ".";
-            stringstream sstrPrivateConfigurationWithoutModuleIdentifier;
-            while (it != keys.end()) {
-                string key = (*it++);
-
-                stringstream modifiedKey;
-                modifiedKey << key.substr(0, key.find(moduleIdentifierPart.str())) << "." << key.substr(key.find(moduleIdentifierPart.str()) + moduleIdentifierPart.str().length());
-
-                sstrPrivateConfigurationWithoutModuleIdentifier << modifiedKey.str() << "=" << privateConfigurationBasedOnModuleIdentiferIncludingModuleIdentifier.getValue<string>(key) << endl;
+    std::shared_ptr<const KeyValueConfiguration> GlobalConfigurationProvider::createConfiguration(const string &name, const string &identifier) const {
+        stringstream configurationForClient;
+        uint32_t first = 0;
+        uint32_t last = 0;
+
+        // Global configuration first, followed by the private configuration based on the module name.
+        const string prefixes[] = { "global.", name + "." };
+        for (uint32_t i = 0; i < 2; i++) {
+            getRange(prefixes[i], first, last);
+            for (uint32_t j = first; j < last; j++) {
+                configurationForClient << m_listOfEntries[j].first << "=" << m_listOfEntries[j].second << endl;
             }
-            if (sstrPrivateConfigurationWithoutModuleIdentifier.str().length() > 0) {
-                privateConfigurationBasedOnModuleIdentifier.readFrom(sstrPrivateConfigurationWithoutModuleIdentifier);
+        }
+
+        // The private configuration based on the module identifier overrides the one based on the name; remove ":" + identifier from the keys.
+        if (identifier != "") {
+            const string prefix = name + ":" + identifier + ".";
+            getRange(prefix, first, last);
+            for (uint32_t j = first; j < last; j++) {
+                configurationForClient << name << "." << m_listOfEntries[j].first.substr(prefix.length()) << "=" << m_listOfEntries[j].second << endl;
             }
         }
 
-        // Prepare configuration.
-        stringstream configurationForClient;
-        globalConfiguration.writeTo(configurationForClient);
-        configurationForClient << endl;
+        std::shared_ptr<KeyValueConfiguration> clientKeyValueConfiguration(new KeyValueConfiguration());
+        clientKeyValueConfiguration->readFrom(configurationForClient);
+        return clientKeyValueConfiguration;
+    }
 
-        privateConfigurationBasedOnModuleName.writeTo(configurationForClient);
-        configurationForClient << endl;
+    KeyValueConfiguration GlobalConfigurationProvider::getConfiguration(const ModuleDescriptor& md) {
+        if (md.getName() == "odcockpit") {
+            return m_configuration;
+        }
 
-        privateConfigurationBasedOnModuleIdentifier.writeTo(configurationForClient);
-        configurationForClient << endl;
+        string name = md.getName();
+        transform(name.begin(), name.end(), name.begin(), ptr_fun(::tolower));
+        string identifier = md.getIdentifier();
+        transform(identifier.begin(), identifier.end(), identifier.begin(), ptr_fun(::tolower));
+        const string key = name + ":" + identifier;
 
-        KeyValueConfiguration clientKeyValueConfiguration;
-        clientKeyValueConfiguration.readFrom(configurationForClient);
+        std::shared_ptr<const MapOfConfigurations> configurations = std::atomic_load(&m_configurations);
+        MapOfConfigurations::const_iterator it = configurations->find(key);
+        if (it != configurations->end()) {
+            return *(it->second);
+        }
 
-        // Set up configuration object.
-        return clientKeyValueConfiguration;
+        std::shared_ptr<const KeyValueConfiguration> configuration = createConfiguration(name, identifier);
+        {
+            // Add the new configuration to a copy of the current map; a concurrent handshake may have added it already.
+            Lock l(m_configurationsMutex);
+            configurations = std::atomic_load(&m_configurations);
+            it = configurations->find(key);
+            if (it != configurations->end()) {
+                return *(it->second);
+            }
+            std::shared_ptr<MapOfConfigurations> newConfigurations(new MapOfConfigurations(*configurations));
+            (*newConfigurations)[key] = configuration;
+            std::atomic_store(&m_configurations, std::shared_ptr<const MapOfConfigurations>(newConfigurations));
+        }
+        return *configuration;
     }
 
     KeyValueConfiguration GlobalConfigurationProvider::getGlobalConfiguration() const {
@@ -544,6 +544,17 @@ namespace odsupercomponent {
         m_moduleStatisticsMap[sstr.str()] = entry;
     }
 
+    void SuperComponent::handleCycleStatistics(const ModuleDescriptor& md, const odcore::data::dmcp::CycleStatistics& cs) {
+        CLOG1 << "[odsupercomponent]: Received CycleStatistics from " << md.toString() << ": " << cs.getNumberOfCycles() << " cycles, "
+              << cs.getNumberOfOverruns() << " overruns, maximum execution time " << cs.getMaximumExecutionTime() << " us" << endl;
+
+        // Distribute the cycle statistics tagged with the sending module to all other components like monitoring tools.
+        odcore::data::dmcp::CycleStatistics moduleCycleStatistics = cs;
+        moduleCycleStatistics.setModule(md);
+        Container c(moduleCycleStatistics);
+        m_conference->send(c);
+    }
+
     void SuperComponent::handleConnectionLost(const ModuleDescriptor& md) {
         // This methods is called when a module terminates not properly.
         if (m_modules.hasModule(md)) {
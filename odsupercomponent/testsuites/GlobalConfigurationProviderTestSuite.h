@@ -0,0 +1,110 @@
+/**
+ * odsupercomponent - Configuration and monitoring component for
+ *                    distributed software systems
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe 
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GLOBALCONFIGURATIONPROVIDERTESTSUITE_H_
+#define GLOBALCONFIGURATIONPROVIDERTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "opendavinci/odcore/base/KeyValueConfiguration.h"
+#include "opendavinci/generated/odcore/data/dmcp/ModuleDescriptor.h"
+
+#include "../include/GlobalConfigurationProvider.h"
+
+using namespace std;
+using namespace odcore::base;
+using namespace odcore::data::dmcp;
+using namespace odsupercomponent;
+
+class GlobalConfigurationProviderTest : public CxxTest::TestSuite {
+    private:
+        KeyValueConfiguration getConfiguration() {
+            stringstream sstr;
+            sstr << "global.value = 1" << endl
+                 << "Global.Car = vehicle" << endl
+                 << "odspy.value = 2" << endl
+                 << "odspy.text = some words" << endl
+                 << "odspy:2.value = 3" << endl
+                 << "odspy:2.other = 4" << endl
+                 << "spy.value = 5" << endl
+                 << "odspyx.value = 6" << endl
+                 << "odrecorder.value = 7" << endl;
+            KeyValueConfiguration kvc;
+            kvc.readFrom(sstr);
+            return kvc;
+        }
+
+    public:
+        void testConfigurationForModuleName() {
+            GlobalConfigurationProvider gcp(getConfiguration());
+
+            const KeyValueConfiguration kvc = gcp.getConfiguration(ModuleDescriptor("odspy", "", "", 1));
+            TS_ASSERT(kvc.getListOfKeys().size() == 4);
+            TS_ASSERT(kvc.getValue<int32_t>("global.value") == 1);
+            TS_ASSERT(kvc.getValue<string>("global.car") == "vehicle");
+            TS_ASSERT(kvc.getValue<int32_t>("odspy.value") == 2);
+            TS_ASSERT(kvc.toString().find("odspy.text=some words") != string::npos);
+
+            // Repeated handshakes return the cached configuration.
+            const KeyValueConfiguration kvc2 = gcp.getConfiguration(ModuleDescriptor("OdSpy", "", "", 1));
+            TS_ASSERT(kvc.toString() == kvc2.toString());
+        }
+
+        void testConfigurationForModuleIdentifier() {
+            GlobalConfigurationProvider gcp(getConfiguration());
+
+            const KeyValueConfiguration kvc = gcp.getConfiguration(ModuleDescriptor("odspy", "2", "", 1));
+            TS_ASSERT(kvc.getListOfKeys().size() == 5);
+            TS_ASSERT(kvc.getValue<int32_t>("global.value") == 1);
+            TS_ASSERT(kvc.getValue<int32_t>("odspy.value") == 3);
+            TS_ASSERT(kvc.getValue<int32_t>("odspy.other") == 4);
+
+            const KeyValueConfiguration kvc2 = gcp.getConfiguration(ModuleDescriptor("odspy", "3", "", 1));
+            TS_ASSERT(kvc2.getListOfKeys().size() == 4);
+            TS_ASSERT(kvc2.getValue<int32_t>("odspy.value") == 2);
+        }
+
+        void testConfigurationForUnknownModuleAndOdcockpit() {
+            GlobalConfigurationProvider gcp(getConfiguration());
+
+            const KeyValueConfiguration kvc = gcp.getConfiguration(ModuleDescriptor("unknown", "", "", 1));
+            TS_ASSERT(kvc.getListOfKeys().size() == 2);
+
+            const KeyValueConfiguration kvc2 = gcp.getConfiguration(ModuleDescriptor("odcockpit", "", "", 1));
+            TS_ASSERT(kvc2.toString() == getConfiguration().toString());
+        }
+
+        void testAssignedConfigurationProvider() {
+            GlobalConfigurationProvider gcp;
+            TS_ASSERT(gcp.getConfiguration(ModuleDescriptor("odspy", "", "", 1)).getListOfKeys().size() == 0);
+
+            gcp = GlobalConfigurationProvider(getConfiguration());
+            TS_ASSERT(gcp.getConfiguration(ModuleDescriptor("odspy", "", "", 1)).getListOfKeys().size() == 4);
+
+            GlobalConfigurationProvider gcp2(gcp);
+            TS_ASSERT(gcp2.getConfiguration(ModuleDescriptor("odrecorder", "", "", 1)).getValue<int32_t>("odrecorder.value") == 7);
+        }
+};
+
+#endif /*GLOBALCONFIGURATIONPROVIDERTESTSUITE_H_*/
@@ -23,12 +23,15 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <opendavinci/odcore/base/Mutex.h>
 #include <opendavinci/odtools/player/Player.h>
 #include <opendavinci/odtools/player/PlayerDelegate.h>
 
-#include "PlayerH264ChildHandler.h"
+#include "opendavinci/generated/odcore/data/image/H264DecoderStatistics.h"
+
+#include "PlayerH264Decoder.h"
 
 namespace odplayerh264 {
 
@@ -37,7 +40,8 @@ namespace odplayerh264 {
     /**
      * This class can be used to replay previously recorded data using a
      * conference for distribution. In addition, this class is also
-     * restoring h264 video streams.
+     * restoring h264 video streams; every video stream is decoded ahead
+     * of the playback by its own PlayerH264Decoder thread.
      */
     class PlayerH264 : public odtools::player::Player,
                        public odtools::player::PlayerDelegate {
@@ -70,19 +74,26 @@ namespace odplayerh264 {
              * @param memorySegmentSize Size of the memory segment to be used for buffering.
              * @param numberOfMemorySegments Number of memory segments to be used for buffering.
              * @param threading If set to true, player will load new containers from the file in background.
-             * @param basePort Base port for letting spawned children connect to the parent process.
+             * @param numberOfFrameBuffers Number of frames per video stream to decode ahead of the playback.
+             * @param numberOfDecodingThreads Number of threads to be used by the codec per video stream (0 = automatic).
              */
-            PlayerH264(const odcore::io::URL &url, const bool &autoRewind, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading, const uint32_t &basePort);
+            PlayerH264(const odcore::io::URL &url, const bool &autoRewind, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading, const uint32_t &numberOfFrameBuffers, const uint32_t &numberOfDecodingThreads);
 
             virtual ~PlayerH264();
 
             virtual odcore::data::Container process(odcore::data::Container &c);
 
+            /**
+             * @return Statistics for all video streams.
+             */
+            vector<odcore::data::image::H264DecoderStatistics> getStatistics();
+
         private:
-            uint32_t m_basePort;
+            uint32_t m_numberOfFrameBuffers;
+            uint32_t m_numberOfDecodingThreads;
 
             odcore::base::Mutex m_mapOfDecodersMutex;
-            map<string, shared_ptr<PlayerH264ChildHandler> > m_mapOfDecoders;
+            map<string, shared_ptr<PlayerH264Decoder> > m_mapOfDecoders;
     };
 
 } // odplayerh264
@@ -30,17 +30,18 @@ extern "C" {
 }
 
 #include <memory>
+#include <string>
 #include <vector>
 
+#include <opendavinci/odcore/base/Condition.h>
 #include <opendavinci/odcore/base/Mutex.h>
-#include <opendavinci/odcore/io/ConnectionListener.h>
-#include <opendavinci/odcore/io/StringListener.h>
-#include <opendavinci/odcore/io/tcp/TCPConnection.h>
+#include <opendavinci/odcore/base/Service.h>
+#include <opendavinci/odcore/data/TimeStamp.h>
 #include <opendavinci/odcore/wrapper/SharedMemory.h>
 
+#include "opendavinci/generated/odcore/data/image/H264DecoderStatistics.h"
 #include "opendavinci/generated/odcore/data/image/SharedImage.h"
 
-#include <opendavinci/odtools/player/Player.h>
 #include <opendavinci/odtools/player/PlayerDelegate.h>
 
 namespace odplayerh264 {
@@ -48,12 +49,12 @@ namespace odplayerh264 {
     using namespace std;
 
     /**
-     * This class can be used to replay previously recorded data using a
-     * conference for distribution. In addition, this class is also
-     * restoring h264 video streams.
+     * This class restores the SharedImages of one h264 video stream. The
+     * frames are decoded in an own thread several frames ahead of the
+     * playback into a ring of frame buffers; whenever the player reaches
+     * an H264Frame, the next decoded frame is copied into the shared memory.
      */
-    class PlayerH264Decoder : public odcore::io::ConnectionListener,
-                              public odcore::io::StringListener,
+    class PlayerH264Decoder : public odcore::base::Service,
                               public odtools::player::PlayerDelegate {
         private:
             /**
@@ -79,87 +80,103 @@ namespace odplayerh264 {
             /**
              * Constructor.
              *
-             * @param Port to connect to the parent process.
+             * @param filename Name of the h264 file to decode.
+             * @param si SharedImage describing the frames of the video stream.
+             * @param numberOfFrameBuffers Number of frames to decode ahead.
+             * @param numberOfDecodingThreads Number of threads to be used by the codec.
              */
-            PlayerH264Decoder(const uint32_t &port);
+            PlayerH264Decoder(const string &filename, const odcore::data::image::SharedImage &si, const uint32_t &numberOfFrameBuffers, const uint32_t &numberOfDecodingThreads);
 
             virtual ~PlayerH264Decoder();
 
             virtual odcore::data::Container process(odcore::data::Container &c);
 
-            virtual void nextString(const std::string &s);
-
-            virtual void handleConnectionError();
-
             /**
-             * This method returns true as long as we have an established
-             * connection to the recorder instance.
-             *
-             * @return true as long as this child process has a connection to the recorder.
+             * @return Statistics about this decoder.
              */
-            bool hasConnection();
+            odcore::data::image::H264DecoderStatistics getStatistics() const;
+
+        protected:
+            virtual void beforeStop();
+
+            virtual void run();
 
         private:
             /**
              * This method initializes the h.264 decoder.
              *
-             * @param filename Name of the file to read data from.
              * @return true if initialization succeeded.
              */
-            bool initialize(const string &filename);
+            bool initialize();
 
             /**
-             * This method is cleaning up the encoding.
+             * This method is cleaning up the decoding.
              */
             void stopAndCleanUpDecoding();
 
             /**
-             * This method returns the next frame from the given h264 file.
-             *
-             * @return true if succeeded; the shared memory segment contains the decoded frame in BGR24 format.
+             * This method restarts decoding from the beginning of the file.
              */
-            bool getNextFrame();
+            void restartDecoding();
 
             /**
-             * This method fills up the internal buffe with bytes.
+             * This method decodes the next frame from the h264 file.
              *
-             * @return The amount of bytes read into the internal buffer.
+             * @param frameBuffer Frame buffer to store the decoded frame in BGR24 format.
+             * @return true if succeeded.
              */
-            int fillBuffer();
+            bool getNextFrame(uint8_t *frameBuffer);
 
             /**
-             * This method is called whenever more bytes in the internal buffer
-             * are needed.
+             * This method fills up the internal buffer with bytes.
              *
-             * @param readMoreBytes indicate whether we need to read more bytes.
-             * @return true if succeeded.
+             * @return The amount of bytes read into the internal buffer.
              */
-            bool update(bool &readMoreBytes);
+            int fillBuffer();
 
             /**
              * This method does the actual decoding.
              *
-             * @param data Raw h264-encoded data.
+             * @param data Raw h264-encoded data or NULL to flush delayed frames.
              * @param size Size of encoded data.
+             * @param frameBuffer Frame buffer to store the decoded frame in BGR24 format.
+             * @return true if a frame was decoded.
              */
-            void decodeFrame(uint8_t *data, uint32_t size);
+            bool decodeFrame(uint8_t *data, uint32_t size, uint8_t *frameBuffer);
 
         private:
-            shared_ptr<odcore::io::tcp::TCPConnection> m_connection;
-            odcore::base::Mutex m_hasConnectionMutex;
-            bool m_hasConnection;
+            string m_filename;
+            uint32_t m_numberOfDecodingThreads;
 
-        private:
             // This shared memory will contain the resulting decoded image frame.
             std::shared_ptr<odcore::wrapper::SharedMemory> m_mySharedMemory;
 
-            // This SharedImage described the resuling frame.
-            odcore::data::image::SharedImage m_mySharedImage;
+            // Dimensions of the resulting frame; fixed for the video stream.
+            const uint32_t m_width;
+            const uint32_t m_height;
+            const uint32_t m_bytesPerPixel;
 
         private:
-            // Counter for successfully decoded frames.
-            uint32_t m_frameCounter;
+            // Ring of decoded frames.
+            odcore::base::Condition m_ringCondition;
+            vector<vector<uint8_t> > m_frameBuffers;
+            uint32_t m_readIndex;
+            uint32_t m_numberOfDecodedFrames;
+            bool m_endOfStream;
+            bool m_restart;
+
+            // Identifier of the last published H264Frame to detect rewinds; only accessed by the player.
+            uint32_t m_lastFrameIdentifier;
 
+            // Wall clock and recorded time of the first published frame to derive scheduled playback times; only accessed by the player.
+            bool m_hasPlaybackStart;
+            odcore::data::TimeStamp m_playbackStartWallClock;
+            odcore::data::TimeStamp m_playbackStartSampleTime;
+
+            mutable odcore::base::Mutex m_statisticsMutex;
+            odcore::data::image::H264DecoderStatistics m_statistics;
+
+        private:
             // Buffer to read from video file.
             uint8_t *m_readFromFileBuffer;
 
@@ -180,9 +197,6 @@ namespace odplayerh264 {
 
             // Image pixel transformation context.
             SwsContext *m_pixelTransformationContext;
-
-            // We return the image in BGR pixel format; thus, we need to transform the data from the decoder.
-            AVFrame *m_frameBGR;
     };
 
 } // odplayerh264
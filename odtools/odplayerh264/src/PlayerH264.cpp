@@ -22,16 +22,10 @@ extern "C" {
     #include <libavcodec/avcodec.h>
 }
 
-#include <signal.h>
-#include <unistd.h>
-#include <sys/wait.h>
-
-#include <cstring>
 #include <iostream>
 #include <string>
 
 #include <opendavinci/odcore/base/Lock.h>
-#include <opendavinci/odcore/base/Thread.h>
 #include <opendavinci/odtools/player/Player.h>
 
 #include "opendavinci/generated/odcore/data/image/H264Frame.h"
@@ -46,30 +40,12 @@ namespace odplayerh264 {
     using namespace odcore::data;
     using namespace odtools::player;
 
-    uint32_t basePortForChildProcesses = 1234;
-
-    __attribute__((noreturn))
-    void handleInChild(int id) {
-        PlayerH264Decoder decoder(basePortForChildProcesses + id);
-
-        const uint32_t ONE_SECOND = 1000 * 1000;
-        while (decoder.hasConnection()) {
-            odcore::base::Thread::usleepFor(ONE_SECOND);
-        }
-
-        cout << "[odplayerh264] Goodbye from " << id << endl;
-        exit(EXIT_SUCCESS);
-    }
-
-    ///////////////////////////////////////////////////////////////////////////
-
-    PlayerH264::PlayerH264(const odcore::io::URL &url, const bool &autoRewind, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading, const uint32_t &basePort) :
+    PlayerH264::PlayerH264(const odcore::io::URL &url, const bool &autoRewind, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading, const uint32_t &numberOfFrameBuffers, const uint32_t &numberOfDecodingThreads) :
         Player(url, autoRewind, memorySegmentSize, numberOfMemorySegments, threading),
-        m_basePort(basePort),
+        m_numberOfFrameBuffers(numberOfFrameBuffers),
+        m_numberOfDecodingThreads(numberOfDecodingThreads),
         m_mapOfDecodersMutex(),
         m_mapOfDecoders() {
-        basePortForChildProcesses = basePort;
-
         // Register all codecs from FFMPEG.
         avcodec_register_all();
 
@@ -81,58 +57,49 @@ namespace odplayerh264 {
         // Unregister us as delegate to handle odcore::data::image::H264Frame messages.
         registerPlayerDelegate(odcore::data::image::H264Frame::ID(), NULL);
 
-        // Close connection to child.
+        // Stop decoding threads.
+        Lock l(m_mapOfDecodersMutex);
         for(auto entry : m_mapOfDecoders) {
-            entry.second->getConnection()->stop();
+            entry.second->stop();
         }
+        m_mapOfDecoders.clear();
+    }
 
-        // Terminate child processes.
-        const uint32_t ONE_SECOND = 1000 * 1000;
-        odcore::base::Thread::usleepFor(ONE_SECOND);
+    vector<odcore::data::image::H264DecoderStatistics> PlayerH264::getStatistics() {
+        Lock l(m_mapOfDecodersMutex);
+
+        vector<odcore::data::image::H264DecoderStatistics> listOfStatistics;
         for(auto entry : m_mapOfDecoders) {
-            kill(entry.second->getPID(), SIGKILL);
+            listOfStatistics.push_back(entry.second->getStatistics());
         }
-
-        m_mapOfDecoders.clear();
+        return listOfStatistics;
     }
 
     Container PlayerH264::process(Container &c) {
-        static uint32_t id = 0;
-        Lock l(m_mapOfDecodersMutex);
-
         Container replacementContainer;
 
         if (c.getDataType() == odcore::data::image::H264Frame::ID()) {
             odcore::data::image::H264Frame h264frame = c.getData<odcore::data::image::H264Frame>();
 
-            // Find existing or create new encoder.
-            auto delegateEntry = m_mapOfDecoders.find(h264frame.getH264Filename());
-            if (delegateEntry == m_mapOfDecoders.end()) {
-                shared_ptr<PlayerH264ChildHandler> handler(new PlayerH264ChildHandler(m_basePort + id));
-
-                // Duplicate the current process.
-                pid_t cpid = fork();
-                if (cpid == 0) {
-                    // Here, we are in the child process.
-                    handleInChild(id);
+            // Find existing or create new decoder.
+            shared_ptr<PlayerH264Decoder> decoder;
+            {
+                Lock l(m_mapOfDecodersMutex);
+                auto delegateEntry = m_mapOfDecoders.find(h264frame.getH264Filename());
+                if (delegateEntry == m_mapOfDecoders.end()) {
+                    decoder = shared_ptr<PlayerH264Decoder>(new PlayerH264Decoder(h264frame.getH264Filename(), h264frame.getAssociatedSharedImage(), m_numberOfFrameBuffers, m_numberOfDecodingThreads));
+                    decoder->start();
+                    m_mapOfDecoders[h264frame.getH264Filename()] = decoder;
+
+                    cout << "[odplayerh264] Created decoding thread to handle '" << h264frame.getH264Filename() << "'." << endl;
                 }
                 else {
-                    // Here, we are in the parent process.
-                    handler->setPID(cpid);
-                    handler->waitForClientToConnect();
-
-                    m_mapOfDecoders[h264frame.getH264Filename()] = handler;
-
-                    cout << "[odplayerh264] Created decoding child process " << handler->getPID() << " to handle '" << h264frame.getH264Filename() << "'." << endl;
-                    id++;
-
-                    replacementContainer = m_mapOfDecoders[h264frame.getH264Filename()]->process(c);
+                    decoder = delegateEntry->second;
                 }
             }
-            else {
-                // Reuse existing decoder.
-                replacementContainer = m_mapOfDecoders[h264frame.getH264Filename()]->process(c);
-            }
+
+            // The decoder might wait for its next frame; thus, do not block the other streams.
+            replacementContainer = decoder->process(c);
         }
 
         return replacementContainer;
@@ -38,9 +38,7 @@ extern "C" {
 #endif
 
 #include <opendavinci/odcore/base/Lock.h>
-#include <opendavinci/odcore/base/Thread.h>
-#include <opendavinci/odcore/io/tcp/TCPFactory.h>
-#include <opendavinci/odcore/strings/StringToolbox.h>
+#include <opendavinci/odcore/data/TimeStamp.h>
 #include <opendavinci/odcore/wrapper/SharedMemoryFactory.h>
 
 #include "opendavinci/generated/odcore/data/image/H264Frame.h"
@@ -52,124 +50,242 @@ namespace odplayerh264 {
     using namespace std;
     using namespace odcore::base;
     using namespace odcore::data;
-    using namespace odcore::io::tcp;
     using namespace odtools::player;
 
     const uint32_t BUFFER_SIZE = 16384;
 
-    PlayerH264Decoder::PlayerH264Decoder(const uint32_t &port) :
-        m_connection(),
-        m_hasConnectionMutex(),
-        m_hasConnection(false),
-        m_mySharedMemory(NULL),
-        m_mySharedImage(),
-        m_frameCounter(0),
+    // Maximum time to wait for a frame that is not yet decoded.
+    const uint32_t MAX_WAIT_FOR_FRAME = 1000;
+
+    PlayerH264Decoder::PlayerH264Decoder(const string &filename, const odcore::data::image::SharedImage &si, const uint32_t &numberOfFrameBuffers, const uint32_t &numberOfDecodingThreads) :
+        Service(),
+        m_filename(filename),
+        m_numberOfDecodingThreads(numberOfDecodingThreads),
+        m_mySharedMemory(),
+        m_width(si.getWidth()),
+        m_height(si.getHeight()),
+        m_bytesPerPixel(si.getBytesPerPixel()),
+        m_ringCondition(),
+        m_frameBuffers((numberOfFrameBuffers > 0) ? numberOfFrameBuffers : 1, vector<uint8_t>(m_width * m_height * m_bytesPerPixel)),
+        m_readIndex(0),
+        m_numberOfDecodedFrames(0),
+        m_endOfStream(false),
+        m_restart(false),
+        m_lastFrameIdentifier(0),
+        m_hasPlaybackStart(false),
+        m_playbackStartWallClock(),
+        m_playbackStartSampleTime(),
+        m_statisticsMutex(),
+        m_statistics(),
         m_readFromFileBuffer(NULL),
         m_internalBuffer(),
         m_inputFile(NULL),
         m_decodeContext(NULL),
         m_parser(NULL),
         m_picture(NULL),
-        m_pixelTransformationContext(NULL),
-        m_frameBGR(NULL) {
-        // Try to connect to odrecorderh264 process to exchange Containers to encode.
-        try {
-            m_connection = shared_ptr<TCPConnection>(TCPFactory::createTCPConnectionTo("127.0.0.1", port));
-            m_connection->setConnectionListener(this);
-            m_connection->setStringListener(this);
-            m_connection->start();
-            {
-                Lock l(m_hasConnectionMutex);
-                m_hasConnection = true;
-            }
-        }
-        catch(string &exception) {
-            cerr << "[odplayerh264] Could not connect to odplayerh264: " << exception << endl;
-        }
+        m_pixelTransformationContext(NULL) {
+        // Acquire shared memory.
+        m_mySharedMemory = odcore::wrapper::SharedMemoryFactory::createSharedMemory(si.getName(), si.getSize());
+
+        m_statistics.setName(si.getName());
 
         // Create a buffer to read from file.
         m_readFromFileBuffer = new uint8_t[BUFFER_SIZE + FF_INPUT_BUFFER_PADDING_SIZE];
     }
 
     PlayerH264Decoder::~PlayerH264Decoder() {
-        stopAndCleanUpDecoding();
+        stop();
+
+        if (m_readFromFileBuffer != NULL) {
+            delete [] m_readFromFileBuffer;
+            m_readFromFileBuffer = NULL;
+        }
+    }
+
+    odcore::data::image::H264DecoderStatistics PlayerH264Decoder::getStatistics() const {
+        Lock l(m_statisticsMutex);
+        return m_statistics;
     }
 
-    bool PlayerH264Decoder::hasConnection() {
-        Lock l(m_hasConnectionMutex);
-        return m_hasConnection;
+    void PlayerH264Decoder::beforeStop() {
+        Lock l(m_ringCondition);
+        m_ringCondition.wakeAll();
     }
 
-    void PlayerH264Decoder::handleConnectionError() {
-        Lock l(m_hasConnectionMutex);
-        m_hasConnection = false;
+    void PlayerH264Decoder::run() {
+        const bool IS_INITIALIZED = initialize();
+
+        serviceReady();
+
+        while (true) {
+            bool restart = false;
+            uint32_t slot = 0;
+            {
+                Lock l(m_ringCondition);
+                while (isRunning() && !m_restart &&
+                       (m_endOfStream || (m_numberOfDecodedFrames == m_frameBuffers.size()))) {
+                    m_ringCondition.waitOnSignal();
+                }
+                if (!isRunning()) {
+                    break;
+                }
+                if (m_restart) {
+                    m_restart = false;
+                    m_readIndex = 0;
+                    m_numberOfDecodedFrames = 0;
+                    m_endOfStream = false;
+                    restart = true;
+                }
+                slot = (m_readIndex + m_numberOfDecodedFrames) % m_frameBuffers.size();
+            }
+
+            if (restart && IS_INITIALIZED) {
+                restartDecoding();
+            }
+
+            // The player does not access this slot until it is marked as decoded.
+            const bool DECODED = IS_INITIALIZED && getNextFrame(&m_frameBuffers[slot][0]);
+
+            {
+                Lock l(m_ringCondition);
+                if (!m_restart) {
+                    if (DECODED) {
+                        m_numberOfDecodedFrames++;
+                    }
+                    else {
+                        m_endOfStream = true;
+                    }
+                }
+                m_ringCondition.wakeAll();
+            }
+        }
+
         stopAndCleanUpDecoding();
-        cerr << "[odplayerh264] Lost connection to odplayerh264." << endl;
     }
 
     void PlayerH264Decoder::stopAndCleanUpDecoding() {
         // Close decoder.
-        av_parser_close(m_parser);
-        avcodec_close(m_decodeContext);
+        if (m_parser != NULL) {
+            av_parser_close(m_parser);
+            m_parser = NULL;
+        }
+        if (m_decodeContext != NULL) {
+            avcodec_close(m_decodeContext);
+            av_free(m_decodeContext);
+            m_decodeContext = NULL;
+        }
 
         // Free acquired memory.
-        av_free(m_decodeContext);
-        av_free(m_picture);
-        av_free(m_frameBGR);
+        if (m_picture != NULL) {
+            av_frame_free(&m_picture);
+        }
+        if (m_pixelTransformationContext != NULL) {
+            sws_freeContext(m_pixelTransformationContext);
+            m_pixelTransformationContext = NULL;
+        }
 
         // Close input file.
-        fclose(m_inputFile);
+        if (m_inputFile != NULL) {
+            fclose(m_inputFile);
+            m_inputFile = NULL;
+        }
 
         // Free buffer.
         m_internalBuffer.clear();
-        if (m_readFromFileBuffer != NULL) {
-            delete [] m_readFromFileBuffer;
-            m_readFromFileBuffer = NULL;
-        }
     }
 
-    void PlayerH264Decoder::nextString(const std::string &s) {
-        Container in;
-        Container out;
-
-        {
-            stringstream sstr(s);
-            sstr >> in;
-        }
+    void PlayerH264Decoder::restartDecoding() {
+        fseek(m_inputFile, 0, SEEK_SET);
+        m_internalBuffer.clear();
 
-        out = process(in);
+        // Discard any state from the previous pass through the stream.
+        avcodec_flush_buffers(m_decodeContext);
+        av_parser_close(m_parser);
+        m_parser = av_parser_init(AV_CODEC_ID_H264);
 
-        {
-            stringstream sstr;
-            sstr << out;
-            m_connection->send(sstr.str());
-        }
+        fillBuffer();
     }
 
     Container PlayerH264Decoder::process(Container &c) {
-        static bool isInitialized = false;
-
         Container replacementContainer;
 
         // Translate an H264Frame message into a proper SharedImage one.
         if (c.getDataType() == odcore::data::image::H264Frame::ID()) {
             odcore::data::image::H264Frame h264frame = c.getData<odcore::data::image::H264Frame>();
-            m_mySharedImage = h264frame.getAssociatedSharedImage();
 
-            // If not initialized, initialze the h.264 decoder structure.
-            if (!isInitialized) {
-                isInitialized = initialize(h264frame.getH264Filename());
+            bool hasFrame = false;
+            uint32_t slot = 0;
+            {
+                Lock l(m_ringCondition);
+
+                // The recording was rewound; start decoding from the beginning.
+                if (h264frame.getFrameIdentifier() <= m_lastFrameIdentifier) {
+                    m_restart = true;
+                    m_hasPlaybackStart = false;
+                    m_ringCondition.wakeAll();
+                }
+                m_lastFrameIdentifier = h264frame.getFrameIdentifier();
+
+                const TimeStamp deadline = TimeStamp() + TimeStamp(MAX_WAIT_FOR_FRAME / 1000, (MAX_WAIT_FOR_FRAME % 1000) * 1000);
+                while (!hasFrame) {
+                    if (!m_restart && (m_numberOfDecodedFrames > 0)) {
+                        slot = m_readIndex;
+                        hasFrame = true;
+                    }
+                    else if (!m_restart && m_endOfStream) {
+                        break;
+                    }
+                    else {
+                        const int64_t REMAINING = (deadline - TimeStamp()).toMicroseconds();
+                        if (REMAINING <= 0) {
+                            break;
+                        }
+                        // Wake up as soon as the decoding thread signals a new frame or when the deadline passes.
+                        m_ringCondition.waitOnSignalWithTimeout(static_cast<unsigned long>((REMAINING + 999) / 1000));
+                    }
+                }
+            }
+
+            if (hasFrame) {
+                // Copy the decoded frame into the shared memory segment; the decoding thread does not write to this slot.
+                if (m_mySharedMemory->isValid()) {
+                    Lock l(m_mySharedMemory);
+                    memcpy(m_mySharedMemory->getSharedMemory(), &m_frameBuffers[slot][0], min<uint32_t>(m_frameBuffers[slot].size(), m_mySharedMemory->getSize()));
+                }
+
+                {
+                    Lock l(m_ringCondition);
+                    m_readIndex = (m_readIndex + 1) % m_frameBuffers.size();
+                    m_numberOfDecodedFrames--;
+                    m_ringCondition.wakeAll();
+                }
+
+                replacementContainer = Container(h264frame.getAssociatedSharedImage());
+                replacementContainer.setSentTimeStamp(c.getSentTimeStamp());
+                replacementContainer.setReceivedTimeStamp(c.getReceivedTimeStamp());
+                replacementContainer.setSampleTimeStamp(c.getSampleTimeStamp());
             }
 
-            // If we have a valid shared memory segment, decode next frame.
-            if (m_mySharedMemory->isValid()) {
-                if (getNextFrame()) {
-                    replacementContainer = Container(m_mySharedImage);
-                    replacementContainer.setSentTimeStamp(c.getSentTimeStamp());
-                    replacementContainer.setReceivedTimeStamp(c.getReceivedTimeStamp());
-                    replacementContainer.setSampleTimeStamp(c.getSampleTimeStamp());
+            {
+                Lock l(m_statisticsMutex);
+                if (hasFrame) {
+                    m_statistics.setNumberOfPublishedFrames(m_statistics.getNumberOfPublishedFrames() + 1);
+                }
+
+                // Anchor the recorded time line to the wall clock when playback (re)starts to derive each frame's scheduled playback time.
+                TimeStamp now;
+                if (!m_hasPlaybackStart) {
+                    m_playbackStartWallClock = now;
+                    m_playbackStartSampleTime = c.getSampleTimeStamp();
+                    m_hasPlaybackStart = true;
+                }
 
-                    //cout << "[odplayerh264] Created replacement for " << h264frame.toString() << endl;
+                // A frame is late when it is published after its scheduled playback time.
+                const TimeStamp scheduled = m_playbackStartWallClock + (c.getSampleTimeStamp() - m_playbackStartSampleTime);
+                const int64_t LATENESS = (now - scheduled).toMicroseconds();
+                if (LATENESS > 0) {
+                    m_statistics.setNumberOfLateFrames(m_statistics.getNumberOfLateFrames() + 1);
+                    m_statistics.setMaximumLateness(max(m_statistics.getMaximumLateness(), static_cast<uint32_t>(LATENESS)));
                 }
             }
         }
@@ -177,96 +293,95 @@ namespace odplayerh264 {
         return replacementContainer;
     }
 
-    bool PlayerH264Decoder::initialize(const string &filename) {
-        bool retVal = false;
-
-        // Acquire shared memory.
-        if (m_mySharedMemory.get() == NULL) {
-            m_mySharedMemory = odcore::wrapper::SharedMemoryFactory::createSharedMemory(m_mySharedImage.getName(), m_mySharedImage.getSize());
+    bool PlayerH264Decoder::initialize() {
+        if (!m_mySharedMemory->isValid()) {
+            return false;
         }
 
-        if (m_mySharedMemory->isValid()) {
-            // Allocating memory to hold resulting image.
-            m_frameBGR = av_frame_alloc();
-            if (!m_frameBGR) {
-                cerr << "[odplayerh264] Could not allocate buffer for resulting frame." << endl;
-                return false;
-            }
-
-            // Acquire memory for raw picture.
-            const uint32_t BYTES = avpicture_get_size(AVPixelFormat::AV_PIX_FMT_BGR24, m_mySharedImage.getWidth(), m_mySharedImage.getHeight());
-            uint8_t *myPixelBuffer = static_cast<uint8_t*>(av_malloc(BYTES * sizeof(uint8_t)));
-            avpicture_fill(reinterpret_cast<AVPicture*>(m_frameBGR),
-                           myPixelBuffer, AVPixelFormat::AV_PIX_FMT_BGR24,
-                           m_mySharedImage.getWidth(), m_mySharedImage.getHeight());
-
-            // Image pixel transformation context to transform from YUV420p to BGR24.
-            m_pixelTransformationContext = sws_getContext(m_mySharedImage.getWidth(), m_mySharedImage.getHeight(),
-                                 AVPixelFormat::AV_PIX_FMT_YUV420P, m_mySharedImage.getWidth(), m_mySharedImage.getHeight(),
-                                 AVPixelFormat::AV_PIX_FMT_BGR24, 0, 0, 0, 0);
-
-            // Find proper decoder for h264.
-            AVCodec *decodeCodec = avcodec_find_decoder(AV_CODEC_ID_H264);
-            if (!decodeCodec) {
-                cerr << "[odplayerh264] Codec h264 not found." << endl;
-                return false;
-            }
+        // Image pixel transformation context to transform from YUV420p to BGR24.
+        m_pixelTransformationContext = sws_getContext(m_width, m_height,
+                             AVPixelFormat::AV_PIX_FMT_YUV420P, m_width, m_height,
+                             AVPixelFormat::AV_PIX_FMT_BGR24, 0, 0, 0, 0);
 
-            // Configure decoding context.
-            m_decodeContext = avcodec_alloc_context3(decodeCodec);
+        // Find proper decoder for h264.
+        AVCodec *decodeCodec = avcodec_find_decoder(AV_CODEC_ID_H264);
+        if (!decodeCodec) {
+            cerr << "[odplayerh264] Codec h264 not found." << endl;
+            return false;
+        }
 
-            // Allow partial data handed over from file to decoder.
-            if (decodeCodec->capabilities & CODEC_CAP_TRUNCATED) {
-                m_decodeContext->flags |= CODEC_FLAG_TRUNCATED;
-            }
+        // Configure decoding context.
+        m_decodeContext = avcodec_alloc_context3(decodeCodec);
 
-            // Open actual codec.
-            if (avcodec_open2(m_decodeContext, decodeCodec, NULL) < 0) {
-                cerr << "[odplayerh264] Could not open codec h264 with given parameters." << endl;
-                return false;
-            }
+        // Let the codec distribute the work over several threads; frame threading requires complete frames from the parser.
+        m_decodeContext->thread_count = m_numberOfDecodingThreads;
+        m_decodeContext->thread_type = FF_THREAD_SLICE | FF_THREAD_FRAME;
 
-            // Open video file.
-            m_inputFile = fopen(filename.c_str(), "rb");
-            if (!m_inputFile) {
-                cerr << "[odplayerh264] Could not open " << filename << endl;
-                return false;
-            }
+        // Allow partial data handed over from file to decoder.
+        if ( (m_numberOfDecodingThreads == 1) && (decodeCodec->capabilities & CODEC_CAP_TRUNCATED) ) {
+            m_decodeContext->flags |= CODEC_FLAG_TRUNCATED;
+        }
 
-            // Allocate picture buffer.
-            m_picture = av_frame_alloc();
+        // Open actual codec.
+        if (avcodec_open2(m_decodeContext, decodeCodec, NULL) < 0) {
+            cerr << "[odplayerh264] Could not open codec h264 with given parameters." << endl;
+            return false;
+        }
 
-            // Initialize decoding parser.
-            m_parser = av_parser_init(AV_CODEC_ID_H264);
-            if (!m_parser) {
-                cerr << "[odplayerh264] Could not create H264 parser." << endl;
-                return false;
-            }
+        // Open video file.
+        m_inputFile = fopen(m_filename.c_str(), "rb");
+        if (!m_inputFile) {
+            cerr << "[odplayerh264] Could not open " << m_filename << endl;
+            return false;
+        }
 
-            // Fill buffer from file.
-            fillBuffer();
+        // Allocate picture buffer.
+        m_picture = av_frame_alloc();
 
-            retVal = true;
+        // Initialize decoding parser.
+        m_parser = av_parser_init(AV_CODEC_ID_H264);
+        if (!m_parser) {
+            cerr << "[odplayerh264] Could not create H264 parser." << endl;
+            return false;
         }
-        return retVal;
+
+        // Fill buffer from file.
+        fillBuffer();
+
+        return true;
     }
 
-    bool PlayerH264Decoder::getNextFrame() {
-        bool readMore = false;
+    bool PlayerH264Decoder::getNextFrame(uint8_t *frameBuffer) {
+        uint8_t* data = NULL;
+        int size = 0;
+
+        // Parse and decode until the decoder returns the next frame.
+        while (m_internalBuffer.size() > 0 || (fillBuffer() > 0)) {
+            int length = av_parser_parse2(m_parser, m_decodeContext, &data, &size,
+                                          &m_internalBuffer[0], m_internalBuffer.size(),
+                                          0, 0, AV_NOPTS_VALUE);
+            if (length < 0) {
+                cerr << "[odplayerh264] Error while parsing a frame." << endl;
+                return false;
+            }
+            m_internalBuffer.erase(m_internalBuffer.begin(), m_internalBuffer.begin() + length);
 
-        // Decode next frame (or fill buffer if needed).
-        while (!update(readMore)) {
-            if (readMore) {
-                fillBuffer();
+            if ( (size > 0) && decodeFrame(data, size, frameBuffer) ) {
+                return true;
             }
 
-            // Leave loop if EOF.
-            if (feof(m_inputFile)) {
-                return false;
+            // The parser waits for more bytes to complete a frame.
+            if ( (length == 0) && (size == 0) && (fillBuffer() <= 0) ) {
+                break;
             }
         }
 
-        return true;
+        // At the end of the file, flush the last frame from the parser followed by the frames delayed in the decoder.
+        av_parser_parse2(m_parser, m_decodeContext, &data, &size, NULL, 0, 0, 0, AV_NOPTS_VALUE);
+        if ( (size > 0) && decodeFrame(data, size, frameBuffer) ) {
+            return true;
+        }
+        return decodeFrame(NULL, 0, frameBuffer);
     }
 
     int PlayerH264Decoder::fillBuffer() {
@@ -280,72 +395,28 @@ namespace odplayerh264 {
         return nbytes;
     }
 
-    bool PlayerH264Decoder::update(bool &readMoreBytes) {
-        readMoreBytes = false;
-
-        if (feof(m_inputFile)) {
-            return false;
-        }
-
-        if (!m_inputFile) {
-            cerr << "[odplayerh264] Cannot read from file." << endl;
-            return false;
-        }
-
-        if (m_internalBuffer.size() == 0) {
-            readMoreBytes = true;
-            return false;
-        }
-     
-        uint8_t* data = NULL;
-        int size = 0;
-        int length = av_parser_parse2(m_parser, m_decodeContext, &data, &size,
-                                      &m_internalBuffer[0], m_internalBuffer.size(),
-                                      0, 0, AV_NOPTS_VALUE);
-
-        if ((size == 0) && (length >= 0)) {
-            readMoreBytes = true;
-            return false;
-        }
-
-        if (length > 0) {
-            decodeFrame(&m_internalBuffer[0], size);
-            m_internalBuffer.erase(m_internalBuffer.begin(), m_internalBuffer.begin() + length);
-            return true;
-        }
-
-        return false;
-    }
-
-    void PlayerH264Decoder::decodeFrame(uint8_t *data, uint32_t size) {
+    bool PlayerH264Decoder::decodeFrame(uint8_t *data, uint32_t size, uint8_t *frameBuffer) {
         AVPacket packet;
         int gotPicture = 0;
-        int length = 0;
 
         av_init_packet(&packet);
         packet.data = data;
         packet.size = size;
 
-        length = avcodec_decode_video2(m_decodeContext, m_picture, &gotPicture, &packet);
+        int length = avcodec_decode_video2(m_decodeContext, m_picture, &gotPicture, &packet);
         if (length < 0) {
             cerr << "[odplayerh264] Error while decoding a frame." << endl;
+            return false;
         }
-        else {
-            if (gotPicture) {
-                m_frameCounter++;
-
-                // cout << "[odplayerh264] Read frame " << m_picture->pts << endl;
 
-                // Transform from YUV420p into BGR24 format.
-                sws_scale(m_pixelTransformationContext, m_picture->data, m_picture->linesize, 0, m_mySharedImage.getHeight(), m_frameBGR->data, m_frameBGR->linesize);
-
-                // Copy resulting frame into the shared memory segment.
-                if (m_mySharedMemory->isValid()) {
-                    Lock l(m_mySharedMemory);
-                    memcpy(m_mySharedMemory->getSharedMemory(), m_frameBGR->data[0], m_mySharedImage.getWidth() * m_mySharedImage.getHeight() * m_mySharedImage.getBytesPerPixel());
-                }
-            }
+        if (gotPicture) {
+            // Transform from YUV420p into BGR24 format directly into the frame buffer.
+            uint8_t *outData[1] = { frameBuffer };
+            int outLinesize[1] = { static_cast<int>(m_width * m_bytesPerPixel) };
+            sws_scale(m_pixelTransformationContext, m_picture->data, m_picture->linesize, 0, m_height, outData, outLinesize);
         }
+
+        return (gotPicture != 0);
     }
 
 } // odplayerh264
@@ -19,12 +19,15 @@
 
 #include <cmath>
 #include <iostream>
+#include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/base/Thread.h"
 #include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
 #include "opendavinci/odcore/io/URL.h"
 #include "opendavinci/odtools/player/Player.h"
+#include "opendavinci/generated/odcore/data/image/H264DecoderStatistics.h"
 #include "opendavinci/generated/odcore/data/player/PlayerCommand.h"
 
 #include "PlayerH264.h"
@@ -75,14 +78,34 @@ namespace odplayerh264 {
         // Run player in asynchronous mode with data caching in background.
         const bool THREADING = true;
 
-        // Base port for letting spawned children connect to parent process.
-        const uint32_t BASE_PORT = getKeyValueConfiguration().getValue<uint32_t>("odplayerh264.portbaseforchildprocesses");
+        // Number of frames per video stream to decode ahead of the playback.
+        const uint32_t DEFAULT_NUMBER_OF_FRAME_BUFFERS = 4;
+        uint32_t numberOfFrameBuffers = DEFAULT_NUMBER_OF_FRAME_BUFFERS;
+        try {
+            numberOfFrameBuffers = getKeyValueConfiguration().getValue<uint32_t>("odplayerh264.numberOfFrameBuffers");
+            if (numberOfFrameBuffers == 0) {
+                cerr << "[odplayerh264] Invalid value for odplayerh264.numberOfFrameBuffers, using " << DEFAULT_NUMBER_OF_FRAME_BUFFERS << "." << endl;
+                numberOfFrameBuffers = DEFAULT_NUMBER_OF_FRAME_BUFFERS;
+            }
+        }
+        catch(...) {
+            CLOG1 << "[odplayerh264] Using default odplayerh264.numberOfFrameBuffers = " << numberOfFrameBuffers << "." << endl;
+        }
+
+        // Number of threads used by the codec per video stream (0 = automatic).
+        uint32_t numberOfDecodingThreads = 1;
+        try {
+            numberOfDecodingThreads = getKeyValueConfiguration().getValue<uint32_t>("odplayerh264.numberOfDecodingThreads");
+        }
+        catch(...) {
+            CLOG1 << "[odplayerh264] Using default odplayerh264.numberOfDecodingThreads = " << numberOfDecodingThreads << "." << endl;
+        }
 
         // Add FIFOQueue for controlling the player.
         addDataStoreFor(odcore::data::player::PlayerCommand::ID(), m_playerControl);
 
         // Construct player.
-        PlayerH264 player(url, autoRewind, MEMORY_SEGMENT_SIZE, NUMBER_OF_SEGMENTS, THREADING, BASE_PORT);
+        PlayerH264 player(url, autoRewind, MEMORY_SEGMENT_SIZE, NUMBER_OF_SEGMENTS, THREADING, numberOfFrameBuffers, numberOfDecodingThreads);
 
         // The next container to be sent.
         Container nextContainerToBeSent;
@@ -95,7 +118,19 @@ namespace odplayerh264 {
         bool doStep = false;
 
         // The main loop.
+        TimeStamp lastStatistics;
         while (getModuleStateAndWaitForRemainingTimeInTimeslice() == odcore::data::dmcp::ModuleStateMessage::RUNNING) {
+            // Report decoder statistics once per second.
+            TimeStamp now;
+            if ((now - lastStatistics).toMicroseconds() >= 1000 * 1000) {
+                vector<odcore::data::image::H264DecoderStatistics> listOfStatistics = player.getStatistics();
+                for (auto statistics : listOfStatistics) {
+                    Container c(statistics);
+                    getConference().send(c);
+                }
+                lastStatistics = now;
+            }
+
             if (playing) {
                 // Get container to be sent.
                 nextContainerToBeSent = player.getNextContainerToBeSent();
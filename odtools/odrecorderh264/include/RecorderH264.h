@@ -23,13 +23,15 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <opendavinci/odcore/base/Mutex.h>
 #include <opendavinci/odtools/recorder/Recorder.h>
 #include <opendavinci/odtools/recorder/RecorderDelegate.h>
 
+#include <opendavinci/generated/odcore/data/image/H264EncoderStatistics.h>
+
 #include "RecorderH264Encoder.h"
-#include "RecorderH264ChildHandler.h"
 
 namespace odrecorderh264 {
 
@@ -37,7 +39,9 @@ namespace odrecorderh264 {
 
     /**
      * This class can be used to record data distributed in a Container conference
-     * and to encode SharedImage containers as h264 video streams.
+     * and to encode SharedImage containers as h264 video streams. Every video
+     * stream is encoded by its own RecorderH264Encoder thread; the resulting
+     * H264Frame containers are entered into the recorder's queue.
      */
     class RecorderH264 : public odtools::recorder::Recorder,
                          public odtools::recorder::RecorderDelegate {
@@ -75,21 +79,38 @@ namespace odrecorderh264 {
              *                  containers of type SharedImage or SharedMemory are dropped.
              * @param dumpSharedData If true, shared images and shared data will be stored as well.
              * @param lossless If set to true, the video encoded is conducted in a lossless way.
-             * @param basePort Base port to be used for letting the child processes communicate with the parent process.
+             * @param numberOfFrameBuffers Number of frames per video stream that can be queued for encoding before frames are dropped.
+             * @param numberOfEncodingThreads Number of threads to be used by the codec per video stream (0 = automatic).
+             * @param listOfCPUCores CPU cores to pin the encoding threads to in the order of appearing video streams; empty for no pinning.
              */
-            RecorderH264(const string &url, const uint32_t &memorySegmentSize, const uint32_t &numberOfSegments, const bool &threading, const bool &dumpSharedData, const bool &lossless, const uint32_t &basePort);
+            RecorderH264(const string &url, const uint32_t &memorySegmentSize, const uint32_t &numberOfSegments, const bool &threading, const bool &dumpSharedData, const bool &lossless, const uint32_t &numberOfFrameBuffers, const uint32_t &numberOfEncodingThreads, const vector<int32_t> &listOfCPUCores);
 
             virtual ~RecorderH264();
 
+            /**
+             * This method queues the given SharedImage for encoding. The
+             * corresponding H264Frame is entered into the recorder's queue
+             * by the encoding thread; thus, an empty container is returned.
+             *
+             * @param c Container to process.
+             * @return Empty container.
+             */
             virtual odcore::data::Container process(odcore::data::Container &c);
 
+            /**
+             * @return Statistics for all video streams.
+             */
+            vector<odcore::data::image::H264EncoderStatistics> getStatistics();
+
         private:
             string m_filenameBase;
             bool m_lossless;
-            uint32_t m_basePort;
+            uint32_t m_numberOfFrameBuffers;
+            uint32_t m_numberOfEncodingThreads;
+            vector<int32_t> m_listOfCPUCores;
 
             odcore::base::Mutex m_mapOfEncodersMutex;
-            map<string, shared_ptr<RecorderH264ChildHandler> > m_mapOfEncoders;
+            map<string, shared_ptr<RecorderH264Encoder> > m_mapOfEncoders;
     };
 
 } // odrecorderh264
@@ -27,29 +27,33 @@ extern "C" {
     #include <libswscale/swscale.h>
 }
 
+#include <deque>
 #include <memory>
 #include <string>
+#include <vector>
 
+#include <opendavinci/odcore/base/Condition.h>
+#include <opendavinci/odcore/base/FIFOQueue.h>
 #include <opendavinci/odcore/base/Mutex.h>
-#include <opendavinci/odcore/io/ConnectionListener.h>
-#include <opendavinci/odcore/io/StringListener.h>
-#include <opendavinci/odcore/io/tcp/TCPConnection.h>
+#include <opendavinci/odcore/base/Service.h>
+#include <opendavinci/odcore/data/Container.h>
+#include <opendavinci/odcore/data/TimeStamp.h>
 #include <opendavinci/odcore/wrapper/SharedMemory.h>
-#include <opendavinci/odtools/recorder/RecorderDelegate.h>
+
+#include <opendavinci/generated/odcore/data/image/H264EncoderStatistics.h>
 
 namespace odrecorderh264 {
 
     using namespace std;
 
     /**
-     * This class handles the actual video stream encoding. An instance is
-     * embedded in an own process context and communicates with the
-     * recorder instance via TCP to get information about the next SharedImage
-     * to encode and to return the replacement H264Frame instance.
+     * This class handles the actual video stream encoding for one SharedImage
+     * stream in its own thread. Frames to encode are copied once from the
+     * shared memory into a pool of frame buffers; the encoding thread converts
+     * and encodes them and enters the resulting H264Frame containers into the
+     * given queue. If no frame buffer is available, the frame is dropped.
      */
-    class RecorderH264Encoder : public odcore::io::ConnectionListener,
-                                public odcore::io::StringListener,
-                                public odtools::recorder::RecorderDelegate {
+    class RecorderH264Encoder : public odcore::base::Service {
         private:
             /**
              * "Forbidden" copy constructor. Goal: The compiler should warn
@@ -76,53 +80,101 @@ namespace odrecorderh264 {
              *
              * @param filenameBase Base file name of the file to write the video stream to where the actual video stream name is appended.
              * @param lossless If true, h264 is encoding the video frames in a lossless way.
-             * @param port TCP port to connect to the recorder instance for communication.
+             * @param numberOfFrameBuffers Number of frames that can be queued for encoding.
+             * @param numberOfEncodingThreads Number of threads to be used by the codec (0 = automatic).
+             * @param cpuCore CPU core to pin the encoding thread to (< 0 = no pinning).
+             * @param out Queue to enter the resulting H264Frame containers to.
              */
-            RecorderH264Encoder(const string &filenameBase, const bool &lossless, const uint32_t &port);
+            RecorderH264Encoder(const string &filenameBase, const bool &lossless, const uint32_t &numberOfFrameBuffers, const uint32_t &numberOfEncodingThreads, const int32_t &cpuCore, odcore::base::FIFOQueue &out);
 
             virtual ~RecorderH264Encoder();
 
-            virtual odcore::data::Container process(odcore::data::Container &c);
-
-            virtual void nextString(const std::string &s);
-
-            virtual void handleConnectionError();
-
             /**
-             * This method returns true as long as we have an established
-             * connection to the recorder instance.
+             * This method copies the frame described by the given SharedImage
+             * container into a free frame buffer and queues it for encoding.
              *
-             * @return true as long as this child process has a connection to the recorder.
+             * @param c Container with a SharedImage.
+             * @return true if the frame was queued, false if it was dropped.
              */
-            bool hasConnection();
+            bool enqueue(const odcore::data::Container &c);
+
+            /**
+             * @return Statistics about this encoder.
+             */
+            odcore::data::image::H264EncoderStatistics getStatistics() const;
+
+        protected:
+            virtual void beforeStop();
+
+            virtual void run();
 
         private:
             /**
-             * This method initializes the h.264 decoder.
+             * This method initializes the h.264 encoder.
              *
              * @return 0 if initialization succeeded, a value < 0 otherwise.
              */
             int initialize(const uint32_t &width, const uint32_t &height);
 
+            /**
+             * This method encodes the given frame buffer; passing NULL
+             * flushes any delayed frames from the codec.
+             *
+             * @param frameBuffer Frame buffer with BGR data or NULL.
+             * @return true if a packet was written.
+             */
+            bool encode(const uint8_t *frameBuffer);
+
             /**
              * This method is cleaning up the encoding.
              */
             void stopAndCleanUpEncoding();
 
+            /**
+             * This method pins the calling thread to m_cpuCore.
+             */
+            void pinToCPUCore();
+
         private:
-            shared_ptr<odcore::io::tcp::TCPConnection> m_connection;
-            odcore::base::Mutex m_hasConnectionMutex;
-            bool m_hasConnection;
+            /**
+             * A frame queued for encoding.
+             */
+            class QueuedFrame {
+                public:
+                    QueuedFrame();
+                    QueuedFrame(const uint32_t &frameBuffer, const odcore::data::Container &c);
+
+                public:
+                    uint32_t m_frameBuffer;
+                    odcore::data::Container m_container;
+                    odcore::data::TimeStamp m_queued;
+            };
 
         private:
             string m_filenameBase;
             string m_filename;
             bool m_lossless;
+            uint32_t m_numberOfEncodingThreads;
+            int32_t m_cpuCore;
+            odcore::base::FIFOQueue &m_out;
 
         private:
+            bool m_isInitialized;
             bool m_hasAttachedToSharedImageMemory;
             std::shared_ptr<odcore::wrapper::SharedMemory> m_sharedImageMemory;
 
+            odcore::base::Condition m_queueCondition;
+            vector<vector<uint8_t> > m_frameBuffers;
+            deque<uint32_t> m_listOfFreeFrameBuffers;
+            deque<QueuedFrame> m_queue;
+
+            // Frames handed to the codec but not yet returned as packet; only accessed by the encoding thread.
+            deque<QueuedFrame> m_listOfFramesInCodec;
+
+            mutable odcore::base::Mutex m_statisticsMutex;
+            odcore::data::image::H264EncoderStatistics m_statistics;
+            uint64_t m_sumOfEncodingLatencies;
+
             uint32_t m_frameCounter;
 
             AVCodec *m_encodeCodec;
@@ -22,21 +22,13 @@ extern "C" {
     #include <libavcodec/avcodec.h>
 }
 
-#include <signal.h>
-#include <unistd.h>
-#include <sys/wait.h>
-
 #include <iostream>
 
 #include <opendavinci/odcore/base/Lock.h>
-#include <opendavinci/odcore/base/Thread.h>
 #include <opendavinci/odcore/io/URL.h>
 
 #include "opendavinci/generated/odcore/data/image/SharedImage.h"
 
-#include <opendavinci/odcore/io/tcp/TCPFactory.h>
-#include <opendavinci/odcore/io/tcp/TCPConnection.h>
-
 #include "RecorderH264.h"
 
 namespace odrecorderh264 {
@@ -44,41 +36,19 @@ namespace odrecorderh264 {
     using namespace std;
     using namespace odcore::base;
     using namespace odcore::data;
-    using namespace odcore::io::tcp;
     using namespace odtools::recorder;
 
-
-    string filenameBaseForChildProcesses = "";
-    bool losslessForChildProcesses = true;
-    uint32_t basePortForChildProcesses = 1234;
-
-    __attribute__((noreturn))
-    void handleInChild(int id) {
-        RecorderH264Encoder encoder(filenameBaseForChildProcesses, losslessForChildProcesses, basePortForChildProcesses + id);
-
-        const uint32_t ONE_SECOND = 1000 * 1000;
-        while (encoder.hasConnection()) {
-            odcore::base::Thread::usleepFor(ONE_SECOND);
-        }
-
-        cout << "[odrecorderh264] Goodbye from " << id << endl;
-        exit(EXIT_SUCCESS);
-    }
-
-    ///////////////////////////////////////////////////////////////////////////
-
-    RecorderH264::RecorderH264(const string &url, const uint32_t &memorySegmentSize, const uint32_t &numberOfSegments, const bool &threading, const bool &dumpSharedData, const bool &lossless, const uint32_t &basePort) :
+    RecorderH264::RecorderH264(const string &url, const uint32_t &memorySegmentSize, const uint32_t &numberOfSegments, const bool &threading, const bool &dumpSharedData, const bool &lossless, const uint32_t &numberOfFrameBuffers, const uint32_t &numberOfEncodingThreads, const vector<int32_t> &listOfCPUCores) :
         Recorder(url, memorySegmentSize, numberOfSegments, threading, dumpSharedData),
         m_filenameBase(""),
         m_lossless(lossless),
-        m_basePort(basePort),
+        m_numberOfFrameBuffers(numberOfFrameBuffers),
+        m_numberOfEncodingThreads(numberOfEncodingThreads),
+        m_listOfCPUCores(listOfCPUCores),
         m_mapOfEncodersMutex(),
         m_mapOfEncoders() {
         odcore::io::URL u(url);
         m_filenameBase = u.getResource();
-        filenameBaseForChildProcesses = m_filenameBase;
-        losslessForChildProcesses = m_lossless;
-        basePortForChildProcesses = m_basePort;
 
         // This instance is handling all SharedImages by delegating to the corresponding entry in the map.
         registerRecorderDelegate(odcore::data::image::SharedImage::ID(), this);
@@ -91,60 +61,57 @@ namespace odrecorderh264 {
         // Unregister us.
         registerRecorderDelegate(odcore::data::image::SharedImage::ID(), NULL);
 
-        // Close connection to child.
-        for(auto entry : m_mapOfEncoders) {
-            entry.second->getConnection()->stop();
-        }
-
-        // Terminate child processes.
-        const uint32_t ONE_SECOND = 1000 * 1000;
-        odcore::base::Thread::usleepFor(ONE_SECOND);
+        // Encode all queued frames; Recorder's destructor records the resulting H264Frames.
+        Lock l(m_mapOfEncodersMutex);
         for(auto entry : m_mapOfEncoders) {
-            kill(entry.second->getPID(), SIGKILL);
+            entry.second->stop();
         }
         m_mapOfEncoders.clear();
     }
 
-    Container RecorderH264::process(Container &c) {
-        static uint32_t id = 0;
+    vector<odcore::data::image::H264EncoderStatistics> RecorderH264::getStatistics() {
         Lock l(m_mapOfEncodersMutex);
 
-        Container retVal;
+        vector<odcore::data::image::H264EncoderStatistics> listOfStatistics;
+        for(auto entry : m_mapOfEncoders) {
+            listOfStatistics.push_back(entry.second->getStatistics());
+        }
+        return listOfStatistics;
+    }
 
+    Container RecorderH264::process(Container &c) {
         if (c.getDataType() == odcore::data::image::SharedImage::ID()) {
             odcore::data::image::SharedImage si = c.getData<odcore::data::image::SharedImage>();
 
             // Find existing or create new encoder.
-            auto delegateEntry = m_mapOfEncoders.find(si.getName());
-            if (delegateEntry == m_mapOfEncoders.end()) {
-                shared_ptr<RecorderH264ChildHandler> handler(new RecorderH264ChildHandler(m_basePort + id));
-
-                // Duplicate the current process.
-                pid_t cpid = fork();
-                if (cpid == 0) {
-                    // Here, we are in the child process.
-                    handleInChild(id);
+            shared_ptr<RecorderH264Encoder> encoder;
+            {
+                Lock l(m_mapOfEncodersMutex);
+                auto delegateEntry = m_mapOfEncoders.find(si.getName());
+                if (delegateEntry == m_mapOfEncoders.end()) {
+                    const int32_t CPU_CORE = (m_listOfCPUCores.empty() ? -1 : m_listOfCPUCores.at(m_mapOfEncoders.size() % m_listOfCPUCores.size()));
+
+                    encoder = shared_ptr<RecorderH264Encoder>(new RecorderH264Encoder(m_filenameBase, m_lossless, m_numberOfFrameBuffers, m_numberOfEncodingThreads, CPU_CORE, getFIFO()));
+                    encoder->start();
+                    m_mapOfEncoders[si.getName()] = encoder;
+
+                    cout << "[odrecorderh264] Created encoding thread for '" << si.getName() << "'";
+                    if (CPU_CORE >= 0) {
+                        cout << " on CPU core " << CPU_CORE;
+                    }
+                    cout << "." << endl;
                 }
                 else {
-                    // Here, we are in the parent process.
-                    handler->setPID(cpid);
-                    handler->waitForClientToConnect();
-
-                    m_mapOfEncoders[si.getName()] = handler;
-
-                    cout << "[odrecorderh264] Created encoding child process " << handler->getPID() << endl;
-                    id++;
-
-                    retVal = m_mapOfEncoders[si.getName()]->process(c);
+                    encoder = delegateEntry->second;
                 }
             }
-            else {
-                // Reuse existing encoder.
-                retVal = m_mapOfEncoders[si.getName()]->process(c);
-            }
+
+            // Copying the frame into the encoder's queue does not block the other streams.
+            encoder->enqueue(c);
         }
 
-        return retVal;
+        // The H264Frame is entered into the FIFO by the encoding thread.
+        return Container();
     }
 
 } // odrecorderh264
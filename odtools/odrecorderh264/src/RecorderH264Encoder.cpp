@@ -17,8 +17,15 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#ifdef __linux__
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+#include <algorithm>
 #include <cstring>
 #include <iostream>
+#include <sstream>
 #include <string>
 
 // Include files from FFMPEG to have h264 encoding.
@@ -38,8 +45,6 @@ extern "C" {
 #endif
 
 #include <opendavinci/odcore/base/Lock.h>
-#include <opendavinci/odcore/base/Thread.h>
-#include <opendavinci/odcore/io/tcp/TCPFactory.h>
 #include <opendavinci/odcore/strings/StringToolbox.h>
 #include <opendavinci/odcore/wrapper/SharedMemoryFactory.h>
 
@@ -53,102 +58,192 @@ namespace odrecorderh264 {
     using namespace std;
     using namespace odcore::base;
     using namespace odcore::data;
-    using namespace odcore::io::tcp;
-    using namespace odtools::recorder;
 
-    RecorderH264Encoder::RecorderH264Encoder(const string &filenameBase, const bool &lossless, const uint32_t &port) :
-        m_connection(),
-        m_hasConnectionMutex(),
-        m_hasConnection(false),
+    RecorderH264Encoder::QueuedFrame::QueuedFrame() :
+        m_frameBuffer(0),
+        m_container(),
+        m_queued() {}
+
+    RecorderH264Encoder::QueuedFrame::QueuedFrame(const uint32_t &frameBuffer, const Container &c) :
+        m_frameBuffer(frameBuffer),
+        m_container(c),
+        m_queued() {}
+
+    RecorderH264Encoder::RecorderH264Encoder(const string &filenameBase, const bool &lossless, const uint32_t &numberOfFrameBuffers, const uint32_t &numberOfEncodingThreads, const int32_t &cpuCore, FIFOQueue &out) :
+        Service(),
         m_filenameBase(filenameBase),
         m_filename(),
         m_lossless(lossless),
+        m_numberOfEncodingThreads(numberOfEncodingThreads),
+        m_cpuCore(cpuCore),
+        m_out(out),
+        m_isInitialized(false),
         m_hasAttachedToSharedImageMemory(false),
         m_sharedImageMemory(),
+        m_queueCondition(),
+        m_frameBuffers(max<uint32_t>(numberOfFrameBuffers, 1)),
+        m_listOfFreeFrameBuffers(),
+        m_queue(),
+        m_listOfFramesInCodec(),
+        m_statisticsMutex(),
+        m_statistics(),
+        m_sumOfEncodingLatencies(0),
         m_frameCounter(0),
         m_encodeCodec(NULL),
         m_encodeContext(NULL),
         m_pixelTransformationContext(NULL),
         m_outputFile(NULL),
         m_frame(NULL) {
-        // Try to connect to odrecorderh264 process to exchange Containers to encode.
-        try {
-            m_connection = shared_ptr<TCPConnection>(TCPFactory::createTCPConnectionTo("127.0.0.1", port));
-            m_connection->setConnectionListener(this);
-            m_connection->setStringListener(this);
-            m_connection->start();
-            {
-                Lock l(m_hasConnectionMutex);
-                m_hasConnection = true;
-            }
-        }
-        catch(string &exception) {
-            cerr << "[odrecorderh264] Could not connect to odrecorderh264: " << exception << endl;
+        for (uint32_t i = 0; i < m_frameBuffers.size(); i++) {
+            m_listOfFreeFrameBuffers.push_back(i);
         }
     }
 
     RecorderH264Encoder::~RecorderH264Encoder() {
-        stopAndCleanUpEncoding();
+        stop();
+    }
+
+    bool RecorderH264Encoder::enqueue(const Container &c) {
+        if (c.getDataType() != odcore::data::image::SharedImage::ID()) {
+            return false;
+        }
+
+        odcore::data::image::SharedImage si = const_cast<Container&>(c).getData<odcore::data::image::SharedImage>();
+
+        uint32_t frameBuffer = 0;
+        {
+            Lock l(m_queueCondition);
+            if (!m_hasAttachedToSharedImageMemory) {
+                m_filename = m_filenameBase + "-" + odcore::strings::StringToolbox::replaceAll(si.getName(), ' ', '_') + ".h264";
+                m_sharedImageMemory = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(si.getName());
+                m_hasAttachedToSharedImageMemory = true;
+
+                Lock l2(m_statisticsMutex);
+                m_statistics.setName(si.getName());
+            }
+
+            if (m_listOfFreeFrameBuffers.empty() || !m_sharedImageMemory->isValid()) {
+                Lock l2(m_statisticsMutex);
+                m_statistics.setNumberOfDroppedFrames(m_statistics.getNumberOfDroppedFrames() + 1);
+                return false;
+            }
+
+            frameBuffer = m_listOfFreeFrameBuffers.front();
+            m_listOfFreeFrameBuffers.pop_front();
+        }
+
+        // Copy the frame once out of the shared memory while the encoding thread keeps working.
+        const uint32_t SIZE = si.getWidth() * si.getHeight() * si.getBytesPerPixel();
+        vector<uint8_t> &buffer = m_frameBuffers[frameBuffer];
+        if (buffer.size() < SIZE) {
+            buffer.resize(SIZE);
+        }
+        {
+            Lock l(m_sharedImageMemory);
+            memcpy(&buffer[0], m_sharedImageMemory->getSharedMemory(), min<uint32_t>(SIZE, m_sharedImageMemory->getSize()));
+        }
+
+        {
+            Lock l(m_queueCondition);
+            m_queue.push_back(QueuedFrame(frameBuffer, c));
+            m_queueCondition.wakeAll();
+        }
+
+        return true;
     }
 
-    bool RecorderH264Encoder::hasConnection() {
-        Lock l(m_hasConnectionMutex);
-        return m_hasConnection;
+    odcore::data::image::H264EncoderStatistics RecorderH264Encoder::getStatistics() const {
+        Lock l(m_statisticsMutex);
+        return m_statistics;
     }
 
-    void RecorderH264Encoder::handleConnectionError() {
-        Lock l(m_hasConnectionMutex);
-        m_hasConnection = false;
-        stopAndCleanUpEncoding();
-        cerr << "[odrecorderh264] Lost connection to odrecorderh264." << endl;
+    void RecorderH264Encoder::beforeStop() {
+        // Wake up the encoding thread to drain the queue.
+        Lock l(m_queueCondition);
+        m_queueCondition.wakeAll();
     }
 
-    void RecorderH264Encoder::stopAndCleanUpEncoding() {
-        // Process any delayed frames in the encoder (feeding NULL images).
-        for (int succeeded = 1; succeeded; m_frameCounter++) {
-            AVPacket packet;
-            av_init_packet(&packet);
-            packet.data = NULL;
-            packet.size = 0;
+    void RecorderH264Encoder::run() {
+        pinToCPUCore();
 
-            // Feeding NULL to indicate end-of-stream.
-            int ret = avcodec_encode_video2(m_encodeContext, &packet, NULL, &succeeded);
-            if (ret < 0) {
-                cerr << "[odrecorderh264] Error encoding frame." << endl;
-                break;
+        serviceReady();
+
+        while (true) {
+            QueuedFrame queuedFrame;
+            {
+                Lock l(m_queueCondition);
+                while (m_queue.empty() && isRunning()) {
+                    m_queueCondition.waitOnSignal();
+                }
+                // Queued frames are still encoded after stop() was called.
+                if (m_queue.empty()) {
+                    break;
+                }
+                queuedFrame = m_queue.front();
+                m_queue.pop_front();
             }
-            if (succeeded) {
-                cout << "[odrecorderh264] Delayed writing frame " << m_frameCounter++ << ", size = " << packet.size << endl;
-                fwrite(packet.data, 1, packet.size, m_outputFile);
-                av_free_packet(&packet);
+
+            if (!m_isInitialized) {
+                odcore::data::image::SharedImage si = queuedFrame.m_container.getData<odcore::data::image::SharedImage>();
+                m_isInitialized = (initialize(si.getWidth(), si.getHeight()) == 0);
+            }
+
+            if (m_isInitialized) {
+                m_listOfFramesInCodec.push_back(queuedFrame);
+                encode(&m_frameBuffers[queuedFrame.m_frameBuffer][0]);
+            }
+            else {
+                Lock l(m_statisticsMutex);
+                m_statistics.setNumberOfDroppedFrames(m_statistics.getNumberOfDroppedFrames() + 1);
+            }
+
+            {
+                Lock l(m_queueCondition);
+                m_listOfFreeFrameBuffers.push_back(queuedFrame.m_frameBuffer);
             }
         }
 
-        // Close file.
-        fclose(m_outputFile);
+        stopAndCleanUpEncoding();
+    }
 
-        // Cleanup.
-        avcodec_close(m_encodeContext);
-        av_free(m_encodeContext);
-        av_freep(&m_frame->data[0]);
-        av_frame_free(&m_frame);
+    void RecorderH264Encoder::pinToCPUCore() {
+#ifdef __linux__
+        if (m_cpuCore >= 0) {
+            cpu_set_t cpuset;
+            CPU_ZERO(&cpuset);
+            CPU_SET(m_cpuCore, &cpuset);
+            if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset) != 0) {
+                cerr << "[odrecorderh264] Could not pin encoding thread to CPU core " << m_cpuCore << "." << endl;
+            }
+        }
+#endif
     }
 
-    void RecorderH264Encoder::nextString(const std::string &s) {
-        Container in;
-        Container out;
+    void RecorderH264Encoder::stopAndCleanUpEncoding() {
+        if (m_encodeContext != NULL) {
+            // Process any delayed frames in the encoder (feeding NULL images).
+            while (encode(NULL)) {}
+
+            // Cleanup.
+            avcodec_close(m_encodeContext);
+            av_free(m_encodeContext);
+            m_encodeContext = NULL;
+        }
 
-        {
-            stringstream sstr(s);
-            sstr >> in;
+        // Close file.
+        if (m_outputFile != NULL) {
+            fclose(m_outputFile);
+            m_outputFile = NULL;
         }
 
-        out = process(in);
+        if (m_frame != NULL) {
+            av_freep(&m_frame->data[0]);
+            av_frame_free(&m_frame);
+        }
 
-        {
-            stringstream sstr;
-            sstr << out;
-            m_connection->send(sstr.str());
+        if (m_pixelTransformationContext != NULL) {
+            sws_freeContext(m_pixelTransformationContext);
+            m_pixelTransformationContext = NULL;
         }
     }
 
@@ -166,6 +261,10 @@ namespace odrecorderh264 {
         m_encodeContext->height = height;
         m_encodeContext->pix_fmt = AVPixelFormat::AV_PIX_FMT_YUV420P; // Output pixel format.
 
+        // Let the codec distribute the work of one stream over several threads.
+        m_encodeContext->thread_count = m_numberOfEncodingThreads;
+        m_encodeContext->thread_type = FF_THREAD_SLICE | FF_THREAD_FRAME;
+
         // Setup h264-specific parameters.
         AVDictionary *param = NULL;
         if (m_lossless) {
@@ -176,8 +275,10 @@ namespace odrecorderh264 {
         // Try to open codec.
         if (avcodec_open2(m_encodeContext, m_encodeCodec, &param) < 0) {
             cerr << "[odrecorderh264] Could not open codec h264 with given parameters." << endl;
+            av_dict_free(&param);
             return -3;
         }
+        av_dict_free(&param);
 
         // Setup output file.
         m_outputFile = fopen(m_filename.c_str(), "wb");
@@ -212,78 +313,83 @@ namespace odrecorderh264 {
         return 0;
     }
 
-    Container RecorderH264Encoder::process(Container &c) {
-        static bool isInitialized = false;
+    bool RecorderH264Encoder::encode(const uint8_t *frameBuffer) {
+        int succeeded = 0;
 
-        Container retVal;
+        // This variable contains the encoded packets to be written to file.
+        AVPacket packet;
+        av_init_packet(&packet);
+        packet.data = NULL;
+        packet.size = 0;
 
-        if (c.getDataType() == odcore::data::image::SharedImage::ID()) {
-            odcore::data::image::SharedImage si = c.getData<odcore::data::image::SharedImage>();
+        int ret = 0;
+        if (frameBuffer != NULL) {
+            const QueuedFrame &queuedFrame = m_listOfFramesInCodec.back();
+            odcore::data::image::SharedImage si = const_cast<Container&>(queuedFrame.m_container).getData<odcore::data::image::SharedImage>();
 
-            if (!isInitialized) {
-                m_filename = m_filenameBase + "-" + odcore::strings::StringToolbox::replaceAll(si.getName(), ' ', '_') + ".h264";
-                initialize(si.getWidth(), si.getHeight());
-                isInitialized = true;
+            // Transform frame from BGR to YUV420P for encoding.
+            const uint8_t *inData[1] = { frameBuffer };
+            int inLinesize[1] = { static_cast<int>(si.getBytesPerPixel() * si.getWidth()) };
+            sws_scale(m_pixelTransformationContext, inData, inLinesize, 0, si.getHeight(), m_frame->data, m_frame->linesize);
+
+            // Frame counter.
+            m_frame->pts = m_frameCounter;
+            m_frameCounter++;
+
+            // Encoding image.
+            ret = avcodec_encode_video2(m_encodeContext, &packet, m_frame, &succeeded);
+        }
+        else {
+            // Feeding NULL to indicate end-of-stream.
+            ret = avcodec_encode_video2(m_encodeContext, &packet, NULL, &succeeded);
+        }
+
+        if (ret < 0) {
+            cerr << "[odrecorderh264] Error encoding frame." << endl;
+            if (frameBuffer != NULL) {
+                // The codec did not accept this frame; thus, it will never be returned as packet.
+                m_listOfFramesInCodec.pop_back();
+
+                Lock l(m_statisticsMutex);
+                m_statistics.setNumberOfDroppedFrames(m_statistics.getNumberOfDroppedFrames() + 1);
             }
+            return false;
+        }
 
-            if (isInitialized) {
-                int succeeded = 0;
+        // With frame threading, the codec returns packets delayed but in order.
+        if (succeeded && !m_listOfFramesInCodec.empty()) {
+            const QueuedFrame queuedFrame = m_listOfFramesInCodec.front();
+            m_listOfFramesInCodec.pop_front();
 
-                // This variable contains the encoded packets to be written to file.
-                AVPacket packet;
-                av_init_packet(&packet);
-                packet.data = NULL;
-                packet.size = 0;
+            fwrite(packet.data, sizeof(uint8_t), packet.size, m_outputFile);
 
-                // Transform frame from BGR to YUV420P for encoding.
-                if (!m_hasAttachedToSharedImageMemory) {
-                    m_sharedImageMemory = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(si.getName());
-                    m_hasAttachedToSharedImageMemory = true;
-                }
+            odcore::data::image::H264Frame h264Frame;
+            h264Frame.setH264Filename(m_filename);
+            h264Frame.setFrameIdentifier(static_cast<uint32_t>(packet.pts + 1));
+            h264Frame.setFrameSize(packet.size);
+            h264Frame.setAssociatedSharedImage(const_cast<Container&>(queuedFrame.m_container).getData<odcore::data::image::SharedImage>());
 
-                // Check if we could successfully attach to the shared memory.
-                if (m_sharedImageMemory->isValid()) {
-                    // Lock the memory region to gain exclusive access using a scoped lock.
-                    {
-                        Lock l2(m_sharedImageMemory);
-
-                        uint8_t *inData[1] = { static_cast<uint8_t*>(m_sharedImageMemory->getSharedMemory()) };
-                        int inLinesize[1] = { static_cast<int>(si.getBytesPerPixel() * si.getWidth()) };
-                        sws_scale(m_pixelTransformationContext, inData, inLinesize, 0, si.getHeight(), m_frame->data, m_frame->linesize);
-                    }
-
-                    // Frame counter.
-                    m_frame->pts = m_frameCounter;
-                    m_frameCounter++;
-
-                    // Encoding image.
-                    int ret = avcodec_encode_video2(m_encodeContext, &packet, m_frame, &succeeded);
-                    if (ret < 0) {
-                        cerr << "[odrecorderh264] Error encoding frame." << endl;
-                        return retVal;
-                    }
-                    if (succeeded) {
-                        fwrite(packet.data, sizeof(uint8_t), packet.size, m_outputFile);
-
-                        odcore::data::image::H264Frame h264Frame;
-                        h264Frame.setH264Filename(m_filename);
-                        h264Frame.setFrameIdentifier(m_frameCounter);
-                        h264Frame.setFrameSize(packet.size);
-                        h264Frame.setAssociatedSharedImage(si);
-
-                        retVal = Container(h264Frame);
-                        retVal.setSentTimeStamp(c.getSentTimeStamp());
-                        retVal.setReceivedTimeStamp(c.getReceivedTimeStamp());
-                        retVal.setSampleTimeStamp(c.getSampleTimeStamp());
-
-                        // Release packet.
-                        av_free_packet(&packet);
-                    }
-                }
+            Container c(h264Frame);
+            c.setSentTimeStamp(queuedFrame.m_container.getSentTimeStamp());
+            c.setReceivedTimeStamp(queuedFrame.m_container.getReceivedTimeStamp());
+            c.setSampleTimeStamp(queuedFrame.m_container.getSampleTimeStamp());
+            m_out.enter(c);
+
+            // Release packet.
+            av_free_packet(&packet);
+
+            TimeStamp now;
+            const uint32_t LATENCY = static_cast<uint32_t>((now - queuedFrame.m_queued).toMicroseconds());
+            {
+                Lock l(m_statisticsMutex);
+                m_statistics.setNumberOfEncodedFrames(m_statistics.getNumberOfEncodedFrames() + 1);
+                m_sumOfEncodingLatencies += LATENCY;
+                m_statistics.setAverageEncodingLatency(static_cast<uint32_t>(m_sumOfEncodingLatencies / m_statistics.getNumberOfEncodedFrames()));
+                m_statistics.setMaximumEncodingLatency(max(m_statistics.getMaximumEncodingLatency(), LATENCY));
             }
         }
 
-        return retVal;
+        return (succeeded != 0);
     }
 
 } // odrecorderh264
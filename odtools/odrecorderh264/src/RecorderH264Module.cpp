@@ -18,10 +18,15 @@
  */
 
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <vector>
 
+#include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/base/Thread.h"
+#include "opendavinci/odcore/strings/StringToolbox.h"
 #include "opendavinci/odtools/recorder/SharedDataListener.h"
+#include "opendavinci/generated/odcore/data/image/H264EncoderStatistics.h"
 #include "opendavinci/generated/odcore/data/recorder/RecorderCommand.h"
 
 #include "RecorderH264.h"
@@ -35,6 +40,7 @@ namespace odrecorderh264 {
     using namespace odcore::base;
     using namespace odcore::data;
     using namespace odcore::io;
+    using namespace odcore::strings;
     using namespace odtools::recorder;
 
     RecorderH264Module::RecorderH264Module(const int32_t &argc, char **argv) :
@@ -77,11 +83,49 @@ namespace odrecorderh264 {
         const bool DUMP_SHARED_DATA = getKeyValueConfiguration().getValue<uint32_t>("odrecorderh264.dumpshareddata") == 1;
         // Encode videos in a lossless way?
         const bool LOSSLESS = getKeyValueConfiguration().getValue<uint32_t>("odrecorderh264.lossless") == 1;
-        // Base port for TCP connections
-        const uint32_t BASE_PORT = getKeyValueConfiguration().getValue<uint32_t>("odrecorderh264.portbaseforchildprocesses");
+        // Number of frames per video stream that can be queued for encoding.
+        const uint32_t DEFAULT_NUMBER_OF_FRAME_BUFFERS = 8;
+        uint32_t numberOfFrameBuffers = DEFAULT_NUMBER_OF_FRAME_BUFFERS;
+        try {
+            numberOfFrameBuffers = getKeyValueConfiguration().getValue<uint32_t>("odrecorderh264.numberOfFrameBuffers");
+            if (numberOfFrameBuffers == 0) {
+                cerr << "[odrecorderh264] Invalid value for odrecorderh264.numberOfFrameBuffers, using " << DEFAULT_NUMBER_OF_FRAME_BUFFERS << "." << endl;
+                numberOfFrameBuffers = DEFAULT_NUMBER_OF_FRAME_BUFFERS;
+            }
+        }
+        catch(...) {
+            CLOG1 << "[odrecorderh264] Using default odrecorderh264.numberOfFrameBuffers = " << numberOfFrameBuffers << "." << endl;
+        }
+        // Number of threads used by the codec per video stream (0 = automatic).
+        uint32_t numberOfEncodingThreads = 0;
+        try {
+            numberOfEncodingThreads = getKeyValueConfiguration().getValue<uint32_t>("odrecorderh264.numberOfEncodingThreads");
+        }
+        catch(...) {
+            CLOG1 << "[odrecorderh264] Using default odrecorderh264.numberOfEncodingThreads = " << numberOfEncodingThreads << "." << endl;
+        }
+        // CPU cores to pin the encoding threads to (e.g. 2,3).
+        vector<int32_t> listOfCPUCores;
+        try {
+            const vector<string> listOfValues = StringToolbox::split(getKeyValueConfiguration().getValue<string>("odrecorderh264.cpuCores"), ',');
+            for (auto value : listOfValues) {
+                stringstream sstr(value);
+                int32_t cpuCore = -1;
+                sstr >> cpuCore;
+                if (cpuCore >= 0) {
+                    listOfCPUCores.push_back(cpuCore);
+                }
+                else {
+                    cerr << "[odrecorderh264] Ignoring invalid CPU core '" << value << "' in odrecorderh264.cpuCores." << endl;
+                }
+            }
+        }
+        catch(...) {
+            CLOG1 << "[odrecorderh264] No odrecorderh264.cpuCores given, encoding threads are not pinned." << endl;
+        }
 
         // Actual "recording" interface.
-        RecorderH264 rh264(recorderOutputURL, MEMORY_SEGMENT_SIZE, NUMBER_OF_SEGMENTS, THREADING, DUMP_SHARED_DATA, LOSSLESS, BASE_PORT);
+        RecorderH264 rh264(recorderOutputURL, MEMORY_SEGMENT_SIZE, NUMBER_OF_SEGMENTS, THREADING, DUMP_SHARED_DATA, LOSSLESS, numberOfFrameBuffers, numberOfEncodingThreads, listOfCPUCores);
 
         // Connect recorder's FIFOQueue to record all containers except for shared images/shared data.
         addDataStoreFor(rh264.getFIFO());
@@ -98,7 +142,19 @@ namespace odrecorderh264 {
 
         // If remote control is disabled, simply start recording immediately.
         bool recording = (!remoteControl);
+        TimeStamp lastStatistics;
         while (getModuleStateAndWaitForRemainingTimeInTimeslice() == odcore::data::dmcp::ModuleStateMessage::RUNNING) {
+            // Report encoder statistics once per second.
+            TimeStamp now;
+            if ((now - lastStatistics).toMicroseconds() >= 1000 * 1000) {
+                vector<odcore::data::image::H264EncoderStatistics> listOfStatistics = rh264.getStatistics();
+                for (auto statistics : listOfStatistics) {
+                    Container c(statistics);
+                    getConference().send(c);
+                }
+                lastStatistics = now;
+            }
+
             // Recording queued entries.
             if (recording) {
                 if (!rh264.getFIFO().isEmpty()) {
@@ -25,13 +25,17 @@
 #include "opendavinci/odcore/base/module/TimeTriggeredConferenceClientModule.h"
 #include "opendavinci/generated/odcore/data/dmcp/ModuleExitCodeMessage.h"
 
+#include "SpyStatistics.h"
+
 namespace odspy {
 
     using namespace std;
 
     /**
      * This class can be used to simply display data distributed
-     * using a conference.
+     * using a conference. If the configuration value odspy.statistics
+     * is set to 1, the containers are not printed one by one but
+     * aggregated per data type and printed as table once per second.
      */
     class Spy : public odcore::base::module::TimeTriggeredConferenceClientModule {
         private:
@@ -67,8 +71,22 @@ namespace odspy {
 
             odcore::data::dmcp::ModuleExitCodeMessage::ModuleExitCode body();
 
+        private:
+            /**
+             * This method prints all received containers one by one.
+             */
+            void printContainers();
+
+            /**
+             * This method prints the aggregated statistics once per second.
+             *
+             * @param fileName Name of the file to append the statistics as JSON to (empty = none).
+             */
+            void printStatistics(const string &fileName);
+
         private:
             odcore::base::FIFOQueue m_fifo;
+            SpyStatistics m_statistics;
 
             virtual void setUp();
 
@@ -0,0 +1,206 @@
+/**
+ * odspy - Tool for printint content from containers to stdout in a user-readable representation.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SPYSTATISTICS_H_
+#define SPYSTATISTICS_H_
+
+#include <iosfwd>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/AbstractDataStore.h"
+#include "opendavinci/odcore/base/Mutex.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
+
+namespace odcore { namespace data { class Container; } }
+
+namespace odspy {
+
+    using namespace std;
+
+    /**
+     * This data store aggregates all containers per data type instead of
+     * queuing them: For every data type, the number of containers, the
+     * number of bytes, a histogram of the latencies between sending and
+     * receiving, the maximum gap between two arrivals, and the number of
+     * containers that were sent before their predecessor are counted.
+     *
+     * The counters are kept in a fixed-size table that is allocated once;
+     * hence, adding a container neither allocates memory nor copies it.
+     * The aggregated values are fetched and reset with getStatistics().
+     */
+    class SpyStatistics : public odcore::base::AbstractDataStore {
+        public:
+            enum {
+                MAXIMUM_NUMBER_OF_DATA_TYPES = 256,
+                NUMBER_OF_LATENCY_BUCKETS = 128
+            };
+
+            /**
+             * Aggregated values for one data type over one interval.
+             */
+            class DataTypeStatistics {
+                public:
+                    DataTypeStatistics();
+
+                public:
+                    int32_t m_dataType;
+                    uint64_t m_numberOfContainers;
+                    uint32_t m_numberOfContainersInInterval;
+                    double m_containersPerSecond;
+                    double m_bytesPerSecond;
+                    int64_t m_latencyP50;
+                    int64_t m_latencyP90;
+                    int64_t m_latencyP99;
+                    int64_t m_latencyMaximum;
+                    int64_t m_maximumGap;
+                    uint32_t m_numberOfReorderedContainers;
+            };
+
+        private:
+            /**
+             * "Forbidden" copy constructor. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the copy constructor.
+             *
+             * @param obj Reference to an object of this class.
+             */
+            SpyStatistics(const SpyStatistics &/*obj*/);
+
+            /**
+             * "Forbidden" assignment operator. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the assignment operator.
+             *
+             * @param obj Reference to an object of this class.
+             * @return Reference to this instance.
+             */
+            SpyStatistics& operator=(const SpyStatistics &/*obj*/);
+
+        public:
+            SpyStatistics();
+
+            virtual ~SpyStatistics();
+
+            virtual void add(odcore::data::Container &container);
+
+            virtual void clear();
+
+            /**
+             * @return Number of data types seen so far.
+             */
+            virtual uint32_t getSize() const;
+
+            virtual bool isEmpty() const;
+
+            /**
+             * This method returns the aggregated values for all data
+             * types seen so far and starts a new interval.
+             *
+             * @param durationInSeconds Duration of the interval to compute the rates.
+             * @return Aggregated values ordered by data type.
+             */
+            vector<DataTypeStatistics> getStatistics(const double &durationInSeconds);
+
+            /**
+             * @return Number of containers that could not be accounted
+             *         because the table is full.
+             */
+            uint64_t getNumberOfUnaccountedContainers() const;
+
+            /**
+             * This method prints the given statistics as table.
+             *
+             * @param out Stream to print to.
+             * @param now Time stamp for the header.
+             * @param statistics Statistics to print.
+             */
+            static void printTable(ostream &out, const odcore::data::TimeStamp &now, const vector<DataTypeStatistics> &statistics);
+
+            /**
+             * This method prints the given statistics as one line in JSON.
+             *
+             * @param out Stream to print to.
+             * @param now Time stamp for this entry.
+             * @param statistics Statistics to print.
+             */
+            static void printJSON(ostream &out, const odcore::data::TimeStamp &now, const vector<DataTypeStatistics> &statistics);
+
+            /**
+             * This method returns the bucket in the latency histogram for
+             * the given value; every power of two is split into four buckets.
+             *
+             * @param value Latency in microseconds.
+             * @return Bucket.
+             */
+            static uint32_t getBucket(const int64_t &value);
+
+            /**
+             * @param bucket Bucket in the latency histogram.
+             * @return Largest value that is counted in the given bucket.
+             */
+            static int64_t getUpperBound(const uint32_t &bucket);
+
+        private:
+            /**
+             * Counters for one data type.
+             */
+            class Slot {
+                public:
+                    Slot();
+
+                    void reset();
+
+                public:
+                    bool m_isUsed;
+                    int32_t m_dataType;
+                    uint64_t m_numberOfContainers;
+                    uint32_t m_numberOfContainersInInterval;
+                    uint64_t m_bytesInInterval;
+                    int64_t m_lastSent;
+                    int64_t m_lastReceived;
+                    int64_t m_latencyMaximum;
+                    int64_t m_maximumGap;
+                    uint32_t m_numberOfReorderedContainers;
+                    uint32_t m_latencies[NUMBER_OF_LATENCY_BUCKETS];
+            };
+
+            /**
+             * This method returns the slot for the given data type.
+             *
+             * @param dataType Data type.
+             * @return Slot or NULL if the table is full.
+             */
+            Slot* getSlot(const int32_t &dataType);
+
+            /**
+             * @return Upper bound of the given percentile from the slot's histogram.
+             */
+            static int64_t getPercentile(const Slot &slot, const double &percentile);
+
+        private:
+            mutable odcore::base::Mutex m_tableMutex;
+            vector<Slot> m_table;
+            uint32_t m_numberOfDataTypes;
+            uint64_t m_numberOfUnaccountedContainers;
+    };
+
+} // odspy
+
+#endif /*SPYSTATISTICS_H_*/
@@ -17,8 +17,13 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <cmath>
+#include <fstream>
 #include <iostream>
 
+#include "opendavinci/odcore/base/KeyValueConfiguration.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
+
 #include "Spy.h"
 
 namespace odspy {
@@ -29,7 +34,8 @@ namespace odspy {
 
     Spy::Spy(const int32_t &argc, char **argv) :
         TimeTriggeredConferenceClientModule(argc, argv, "odspy"),
-        m_fifo() {}
+        m_fifo(),
+        m_statistics() {}
 
     Spy::~Spy() {}
 
@@ -38,6 +44,28 @@ namespace odspy {
     void Spy::tearDown() {}
 
     odcore::data::dmcp::ModuleExitCodeMessage::ModuleExitCode Spy::body() {
+        bool statistics = false;
+        string fileName;
+        try {
+            statistics = (getKeyValueConfiguration().getValue<uint32_t>("odspy.statistics") == 1);
+        }
+        catch(...) {}
+        try {
+            fileName = getKeyValueConfiguration().getValue<string>("odspy.statisticsFile");
+        }
+        catch(...) {}
+
+        if (statistics) {
+            printStatistics(fileName);
+        }
+        else {
+            printContainers();
+        }
+
+        return odcore::data::dmcp::ModuleExitCodeMessage::OKAY;
+    }
+
+    void Spy::printContainers() {
         // Add FIFOQueue to spy all data.
         addDataStoreFor(m_fifo);
 
@@ -48,8 +76,46 @@ namespace odspy {
                 cout << c.getSentTimeStamp().getYYYYMMDD_HHMMSSms() << "-->" << c.getReceivedTimeStamp().getYYYYMMDD_HHMMSSms() << " dt = " << (c.getReceivedTimeStamp() - c.getSentTimeStamp()).toString() << " ID = " << c.getDataType() << endl; 
             }
         }
+    }
 
-        return odcore::data::dmcp::ModuleExitCodeMessage::OKAY;
+    void Spy::printStatistics(const string &fileName) {
+        // Aggregate all data directly when it is received instead of queuing it.
+        addDataStoreFor(m_statistics);
+
+        ofstream jsonFile;
+        if (fileName.size() > 0) {
+            jsonFile.open(fileName.c_str(), ios::out | ios::app);
+            if (!jsonFile.good()) {
+                cerr << "[odspy] Could not open '" << fileName << "' to write the statistics." << endl;
+            }
+        }
+
+        // Refresh the table once per second independent from the runtime frequency.
+        const uint32_t SLICES_PER_REFRESH = (getFrequency() > 1) ? static_cast<uint32_t>(round(getFrequency())) : 1;
+        uint32_t slices = 0;
+        TimeStamp lastRefresh;
+
+        while (getModuleStateAndWaitForRemainingTimeInTimeslice() == odcore::data::dmcp::ModuleStateMessage::RUNNING) {
+            if (++slices < SLICES_PER_REFRESH) {
+                continue;
+            }
+            slices = 0;
+
+            TimeStamp now;
+            const vector<SpyStatistics::DataTypeStatistics> listOfStatistics = m_statistics.getStatistics((now - lastRefresh).toMicroseconds() / 1000000.0);
+            lastRefresh = now;
+
+            // Clear the terminal and move the cursor home.
+            cout << "\033[2J\033[H";
+            SpyStatistics::printTable(cout, now, listOfStatistics);
+            if (m_statistics.getNumberOfUnaccountedContainers() > 0) {
+                cout << endl << m_statistics.getNumberOfUnaccountedContainers() << " containers not accounted (more than " << SpyStatistics::MAXIMUM_NUMBER_OF_DATA_TYPES << " data types)." << endl;
+            }
+
+            if (jsonFile.good() && jsonFile.is_open()) {
+                SpyStatistics::printJSON(jsonFile, now, listOfStatistics);
+            }
+        }
     }
 
 } // odspy
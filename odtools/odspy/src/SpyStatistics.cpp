@@ -0,0 +1,292 @@
+/**
+ * odspy - Tool for printint content from containers to stdout in a user-readable representation.
+ * Copyright (C) 2016 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+#include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/data/Container.h"
+
+#include "SpyStatistics.h"
+
+namespace odspy {
+
+    using namespace std;
+    using namespace odcore::base;
+    using namespace odcore::data;
+
+    SpyStatistics::DataTypeStatistics::DataTypeStatistics() :
+        m_dataType(0),
+        m_numberOfContainers(0),
+        m_numberOfContainersInInterval(0),
+        m_containersPerSecond(0),
+        m_bytesPerSecond(0),
+        m_latencyP50(0),
+        m_latencyP90(0),
+        m_latencyP99(0),
+        m_latencyMaximum(0),
+        m_maximumGap(0),
+        m_numberOfReorderedContainers(0) {}
+
+    SpyStatistics::Slot::Slot() :
+        m_isUsed(false),
+        m_dataType(0),
+        m_numberOfContainers(0),
+        m_numberOfContainersInInterval(0),
+        m_bytesInInterval(0),
+        m_lastSent(0),
+        m_lastReceived(0),
+        m_latencyMaximum(0),
+        m_maximumGap(0),
+        m_numberOfReorderedContainers(0),
+        m_latencies() {}
+
+    void SpyStatistics::Slot::reset() {
+        m_numberOfContainersInInterval = 0;
+        m_bytesInInterval = 0;
+        m_latencyMaximum = 0;
+        m_maximumGap = 0;
+        m_numberOfReorderedContainers = 0;
+        ::memset(m_latencies, 0, sizeof(m_latencies));
+    }
+
+    SpyStatistics::SpyStatistics() :
+        m_tableMutex(),
+        m_table(MAXIMUM_NUMBER_OF_DATA_TYPES),
+        m_numberOfDataTypes(0),
+        m_numberOfUnaccountedContainers(0) {}
+
+    SpyStatistics::~SpyStatistics() {}
+
+    SpyStatistics::Slot* SpyStatistics::getSlot(const int32_t &dataType) {
+        // Open addressing with linear probing; the table is never shrunk.
+        uint32_t index = (static_cast<uint32_t>(dataType) * 2654435761u) % MAXIMUM_NUMBER_OF_DATA_TYPES;
+        for (uint32_t i = 0; i < MAXIMUM_NUMBER_OF_DATA_TYPES; i++) {
+            Slot &slot = m_table[index];
+            if (!slot.m_isUsed) {
+                slot.m_isUsed = true;
+                slot.m_dataType = dataType;
+                m_numberOfDataTypes++;
+                return &slot;
+            }
+            if (slot.m_dataType == dataType) {
+                return &slot;
+            }
+            index = (index + 1) % MAXIMUM_NUMBER_OF_DATA_TYPES;
+        }
+        return NULL;
+    }
+
+    void SpyStatistics::add(Container &container) {
+        const int64_t sent = container.getSentTimeStamp().toMicroseconds();
+        const int64_t received = container.getReceivedTimeStamp().toMicroseconds();
+        const int64_t latency = received - sent;
+        const uint32_t bytes = container.getSizeOfData();
+
+        Lock l(m_tableMutex);
+        Slot *slot = getSlot(container.getDataType());
+        if (slot == NULL) {
+            m_numberOfUnaccountedContainers++;
+            return;
+        }
+
+        if (slot->m_numberOfContainers > 0) {
+            if (sent < slot->m_lastSent) {
+                slot->m_numberOfReorderedContainers++;
+            }
+            if ((received - slot->m_lastReceived) > slot->m_maximumGap) {
+                slot->m_maximumGap = received - slot->m_lastReceived;
+            }
+        }
+        slot->m_lastSent = sent;
+        slot->m_lastReceived = received;
+
+        slot->m_numberOfContainers++;
+        slot->m_numberOfContainersInInterval++;
+        slot->m_bytesInInterval += bytes;
+        slot->m_latencies[getBucket(latency)]++;
+        if (latency > slot->m_latencyMaximum) {
+            slot->m_latencyMaximum = latency;
+        }
+    }
+
+    void SpyStatistics::clear() {
+        Lock l(m_tableMutex);
+        m_table.assign(MAXIMUM_NUMBER_OF_DATA_TYPES, Slot());
+        m_numberOfDataTypes = 0;
+        m_numberOfUnaccountedContainers = 0;
+    }
+
+    uint32_t SpyStatistics::getSize() const {
+        Lock l(m_tableMutex);
+        return m_numberOfDataTypes;
+    }
+
+    bool SpyStatistics::isEmpty() const {
+        return (getSize() == 0);
+    }
+
+    uint64_t SpyStatistics::getNumberOfUnaccountedContainers() const {
+        Lock l(m_tableMutex);
+        return m_numberOfUnaccountedContainers;
+    }
+
+    vector<SpyStatistics::DataTypeStatistics> SpyStatistics::getStatistics(const double &durationInSeconds) {
+        vector<DataTypeStatistics> statistics;
+
+        {
+            Lock l(m_tableMutex);
+            statistics.reserve(m_numberOfDataTypes);
+
+            vector<Slot>::iterator it = m_table.begin();
+            while (it != m_table.end()) {
+                Slot &slot = (*it++);
+                if (!slot.m_isUsed) {
+                    continue;
+                }
+
+                DataTypeStatistics dts;
+                dts.m_dataType = slot.m_dataType;
+                dts.m_numberOfContainers = slot.m_numberOfContainers;
+                dts.m_numberOfContainersInInterval = slot.m_numberOfContainersInInterval;
+                if (durationInSeconds > 0) {
+                    dts.m_containersPerSecond = slot.m_numberOfContainersInInterval / durationInSeconds;
+                    dts.m_bytesPerSecond = slot.m_bytesInInterval / durationInSeconds;
+                }
+                dts.m_latencyP50 = getPercentile(slot, 0.50);
+                dts.m_latencyP90 = getPercentile(slot, 0.90);
+                dts.m_latencyP99 = getPercentile(slot, 0.99);
+                dts.m_latencyMaximum = slot.m_latencyMaximum;
+                dts.m_maximumGap = slot.m_maximumGap;
+                dts.m_numberOfReorderedContainers = slot.m_numberOfReorderedContainers;
+                statistics.push_back(dts);
+
+                slot.reset();
+            }
+        }
+
+        // Insertion sort by data type; the table holds only few entries.
+        for (uint32_t i = 1; i < statistics.size(); i++) {
+            const DataTypeStatistics dts = statistics[i];
+            uint32_t j = i;
+            while ( (j > 0) && (statistics[j - 1].m_dataType > dts.m_dataType) ) {
+                statistics[j] = statistics[j - 1];
+                j--;
+            }
+            statistics[j] = dts;
+        }
+
+        return statistics;
+    }
+
+    uint32_t SpyStatistics::getBucket(const int64_t &value) {
+        if (value < 4) {
+            return (value > 0) ? static_cast<uint32_t>(value) : 0;
+        }
+
+        uint32_t msb = 2;
+        while ( (msb < 62) && ((value >> (msb + 1)) > 0) ) {
+            msb++;
+        }
+        const uint32_t bucket = 4 * (msb - 1) + static_cast<uint32_t>((value >> (msb - 2)) & 3);
+        return (bucket < NUMBER_OF_LATENCY_BUCKETS) ? bucket : (NUMBER_OF_LATENCY_BUCKETS - 1);
+    }
+
+    int64_t SpyStatistics::getUpperBound(const uint32_t &bucket) {
+        if (bucket < 3) {
+            return bucket;
+        }
+        // The upper bound of a bucket is one below the lower bound of the next bucket.
+        const uint32_t next = bucket + 1;
+        return (static_cast<int64_t>(4 + (next % 4)) << (next / 4 - 1)) - 1;
+    }
+
+    int64_t SpyStatistics::getPercentile(const Slot &slot, const double &percentile) {
+        if (slot.m_numberOfContainersInInterval == 0) {
+            return 0;
+        }
+
+        const uint32_t rank = static_cast<uint32_t>(ceil(percentile * slot.m_numberOfContainersInInterval));
+        uint32_t sum = 0;
+        for (uint32_t i = 0; i < NUMBER_OF_LATENCY_BUCKETS; i++) {
+            sum += slot.m_latencies[i];
+            if (sum >= rank) {
+                const int64_t upperBound = getUpperBound(i);
+                return (upperBound < slot.m_latencyMaximum) ? upperBound : slot.m_latencyMaximum;
+            }
+        }
+        return slot.m_latencyMaximum;
+    }
+
+    void SpyStatistics::printTable(ostream &out, const TimeStamp &now, const vector<DataTypeStatistics> &statistics) {
+        double containersPerSecond = 0;
+        double bytesPerSecond = 0;
+        vector<DataTypeStatistics>::const_iterator it = statistics.begin();
+        while (it != statistics.end()) {
+            containersPerSecond += it->m_containersPerSecond;
+            bytesPerSecond += it->m_bytesPerSecond;
+            it++;
+        }
+
+        out << "odspy - " << now.getYYYYMMDD_HHMMSS() << " - " << statistics.size() << " data types, "
+            << fixed << setprecision(1) << containersPerSecond << " containers/s, "
+            << bytesPerSecond / 1024.0 << " kB/s" << endl << endl;
+
+        out << setw(8) << "ID" << setw(12) << "total" << setw(10) << "1/s" << setw(11) << "kB/s"
+            << setw(10) << "p50[us]" << setw(10) << "p90[us]" << setw(10) << "p99[us]" << setw(10) << "max[us]"
+            << setw(10) << "gap[ms]" << setw(11) << "reordered" << endl;
+
+        it = statistics.begin();
+        while (it != statistics.end()) {
+            out << setw(8) << it->m_dataType << setw(12) << it->m_numberOfContainers
+                << setw(10) << setprecision(1) << it->m_containersPerSecond
+                << setw(11) << setprecision(2) << it->m_bytesPerSecond / 1024.0
+                << setw(10) << it->m_latencyP50 << setw(10) << it->m_latencyP90
+                << setw(10) << it->m_latencyP99 << setw(10) << it->m_latencyMaximum
+                << setw(10) << setprecision(1) << it->m_maximumGap / 1000.0
+                << setw(11) << it->m_numberOfReorderedContainers << endl;
+            it++;
+        }
+        out.flush();
+    }
+
+    void SpyStatistics::printJSON(ostream &out, const TimeStamp &now, const vector<DataTypeStatistics> &statistics) {
+        out << "{\"timestamp\":" << now.toMicroseconds() << ",\"dataTypes\":[";
+        vector<DataTypeStatistics>::const_iterator it = statistics.begin();
+        while (it != statistics.end()) {
+            out << ((it != statistics.begin()) ? "," : "")
+                << "{\"id\":" << it->m_dataType
+                << ",\"total\":" << it->m_numberOfContainers
+                << ",\"containers\":" << it->m_numberOfContainersInInterval
+                << ",\"containersPerSecond\":" << fixed << setprecision(3) << it->m_containersPerSecond
+                << ",\"bytesPerSecond\":" << it->m_bytesPerSecond
+                << ",\"latency\":{\"p50\":" << it->m_latencyP50
+                << ",\"p90\":" << it->m_latencyP90
+                << ",\"p99\":" << it->m_latencyP99
+                << ",\"max\":" << it->m_latencyMaximum << "}"
+                << ",\"maximumGap\":" << it->m_maximumGap
+                << ",\"reordered\":" << it->m_numberOfReorderedContainers << "}";
+            it++;
+        }
+        out << "]}" << endl;
+    }
+
+} // odspy
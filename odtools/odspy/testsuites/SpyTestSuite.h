@@ -22,8 +22,15 @@
 
 #include "cxxtest/TestSuite.h"
 
+#include <sstream>
+#include <vector>
+
+#include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
+
 // Include local header files.
 #include "../include/Spy.h"
+#include "../include/SpyStatistics.h"
 
 using namespace std;
 using namespace odcore::data;
@@ -84,6 +91,83 @@ class SpyTest : public CxxTest::TestSuite {
             TS_ASSERT(dt != NULL);
         }
 
+        void testSpyStatisticsLatencyBuckets() {
+            for (int64_t v = 0; v < 100000; v++) {
+                const uint32_t bucket = SpyStatistics::getBucket(v);
+                TS_ASSERT(v <= SpyStatistics::getUpperBound(bucket));
+                TS_ASSERT((bucket == 0) || (v > SpyStatistics::getUpperBound(bucket - 1)));
+            }
+            TS_ASSERT(SpyStatistics::getBucket(-5) == 0);
+            TS_ASSERT(SpyStatistics::getBucket(static_cast<int64_t>(1) << 50) == SpyStatistics::NUMBER_OF_LATENCY_BUCKETS - 1);
+        }
+
+        void testSpyStatisticsAggregatesPerDataType() {
+            SpyStatistics statistics;
+            TS_ASSERT(statistics.isEmpty());
+
+            // 100 containers of type 7 with latencies 1..100ms arriving every 10ms and one container of type 3.
+            for (int32_t i = 0; i < 100; i++) {
+                Container c(TimeStamp(10, 0), 7);
+                c.setSentTimeStamp(TimeStamp(100, i * 10000));
+                c.setReceivedTimeStamp(TimeStamp(100, i * 10000) + TimeStamp(0, (i + 1) * 1000));
+                statistics.add(c);
+            }
+            // This container was sent before its predecessor and arrives after a gap of 410ms.
+            Container late(TimeStamp(10, 0), 7);
+            late.setSentTimeStamp(TimeStamp(100, 0));
+            late.setReceivedTimeStamp(TimeStamp(101, 500000));
+            statistics.add(late);
+
+            Container other(TimeStamp(10, 0), 3);
+            other.setSentTimeStamp(TimeStamp(100, 0));
+            other.setReceivedTimeStamp(TimeStamp(100, 0));
+            statistics.add(other);
+
+            TS_ASSERT(statistics.getSize() == 2);
+
+            vector<SpyStatistics::DataTypeStatistics> result = statistics.getStatistics(2.0);
+            TS_ASSERT(result.size() == 2);
+            TS_ASSERT(result[0].m_dataType == 3);
+            TS_ASSERT(result[0].m_numberOfContainers == 1);
+            TS_ASSERT(result[1].m_dataType == 7);
+            TS_ASSERT(result[1].m_numberOfContainers == 101);
+            TS_ASSERT_DELTA(result[1].m_containersPerSecond, 50.5, 1e-9);
+            TS_ASSERT_DELTA(result[1].m_bytesPerSecond, 101 * late.getSizeOfData() / 2.0, 1e-9);
+            TS_ASSERT(result[1].m_numberOfReorderedContainers == 1);
+            TS_ASSERT(result[1].m_maximumGap == 410000);
+            TS_ASSERT(result[1].m_latencyMaximum == 1500000);
+
+            // Percentiles are upper bounds with a resolution of a quarter power of two.
+            TS_ASSERT(result[1].m_latencyP50 >= 50000);
+            TS_ASSERT(result[1].m_latencyP50 < 50000 * 1.25);
+            TS_ASSERT(result[1].m_latencyP99 >= 99000);
+            TS_ASSERT(result[1].m_latencyP99 < 99000 * 1.25);
+
+            // A new interval starts after fetching the statistics.
+            result = statistics.getStatistics(1.0);
+            TS_ASSERT(result.size() == 2);
+            TS_ASSERT(result[1].m_numberOfContainers == 101);
+            TS_ASSERT(result[1].m_numberOfContainersInInterval == 0);
+            TS_ASSERT(result[1].m_latencyP50 == 0);
+
+            stringstream json;
+            SpyStatistics::printJSON(json, TimeStamp(1, 2), result);
+            TS_ASSERT(json.str().find("{\"timestamp\":1000002,\"dataTypes\":[{\"id\":3,") == 0);
+
+            statistics.clear();
+            TS_ASSERT(statistics.isEmpty());
+        }
+
+        void testSpyStatisticsWithFullTable() {
+            SpyStatistics statistics;
+            for (int32_t i = 0; i < SpyStatistics::MAXIMUM_NUMBER_OF_DATA_TYPES + 10; i++) {
+                Container c(TimeStamp(), i);
+                statistics.add(c);
+            }
+            TS_ASSERT(statistics.getSize() == SpyStatistics::MAXIMUM_NUMBER_OF_DATA_TYPES);
+            TS_ASSERT(statistics.getNumberOfUnaccountedContainers() == 10);
+        }
+
         ////////////////////////////////////////////////////////////////////////////////////
         // Below this line the necessary constructor for initializing the pointer variables,
         // and the forbidden copy constructor and assignment operator are declared.